@@ -13,22 +13,19 @@
  * limitations under the License.
  */
 
-#include <regex>
 #include <vector>
 #include "hilog/log.h"
 #include "string_ex.h"
 #include "uri.h"
 
 using std::string;
-using std::regex;
+using std::string_view;
 using OHOS::HiviewDFX::HiLog;
 
 namespace OHOS {
 namespace {
-    const string NOT_CACHED = "NOT VALID";
     const string EMPTY = "";
     const size_t NOT_FOUND = string::npos;
-    const int NOT_CALCULATED = -2;
     const int PORT_NONE = -1;
     const char SCHEME_SEPARATOR = ':';
     const char SCHEME_FRAGMENT = '#';
@@ -40,412 +37,318 @@ namespace {
     const size_t POS_INC = 1;
     const size_t POS_INC_MORE = 2;
     const size_t POS_INC_AGAIN = 3;
-    const regex SCHEME_REGEX("[a-zA-Z][a-zA-Z|\\d|+|-|.]*$");
     const HiviewDFX::HiLogLabel LABEL = {LOG_CORE, 0xD001800, "URI"};
+
+    bool IsAsciiAlpha(char ch)
+    {
+        return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z');
+    }
+
+    bool IsAsciiDigit(char ch)
+    {
+        return ch >= '0' && ch <= '9';
+    }
 }; // namespace
 
 Uri::Uri(const string& uriString)
 {
-    cachedSsi_ = NOT_FOUND;
-    cachedFsi_ = NOT_FOUND;
-    port_ = NOT_CALCULATED;
-
     if (uriString.empty()) {
         return;
     }
 
     uriString_ = uriString;
-    scheme_ = NOT_CACHED;
-    ssp_ = NOT_CACHED;
-    authority_ = NOT_CACHED;
-    host_ = NOT_CACHED;
-    userInfo_ = NOT_CACHED;
-    query_ = NOT_CACHED;
-    path_ = NOT_CACHED;
-    fragment_ = NOT_CACHED;
-
+    Parse();
     if (!CheckScheme()) {
         uriString_ = EMPTY;
+        ssi_ = NOT_FOUND;
+        fsi_ = NOT_FOUND;
+        scheme_ = ssp_ = authority_ = userInfo_ = host_ = query_ = path_ = fragment_ = Part();
+        port_ = PORT_NONE;
         HiLog::Error(LABEL, "Scheme wrong!");
     }
 }
 
-bool Uri::CheckScheme()
+void Uri::Parse()
 {
-    scheme_ = ParseScheme();
-    if (scheme_.empty()) {
-        return true;
-    }
-    return regex_match(scheme_, SCHEME_REGEX);
-}
+    size_t length = uriString_.length();
+    ssi_ = uriString_.find(SCHEME_SEPARATOR);
+    fsi_ = (ssi_ == NOT_FOUND) ? NOT_FOUND : uriString_.find(SCHEME_FRAGMENT, ssi_);
 
-string Uri::GetScheme()
-{
-    if (uriString_.empty()) {
-        return EMPTY;
+    if (ssi_ != NOT_FOUND) {
+        scheme_ = { 0, ssi_ };
     }
 
-    if (scheme_ == NOT_CACHED) {
-        scheme_ = ParseScheme();
+    // The ssp is everything between ssi and fsi.
+    size_t start = (ssi_ == NOT_FOUND) ? 0 : (ssi_ + POS_INC);
+    size_t end = (fsi_ == NOT_FOUND) ? length : fsi_;
+    if (end > start) {
+        ssp_ = { start, end - start };
     }
-    return scheme_;
-}
-
-string Uri::ParseScheme()
-{
-    size_t ssi = FindSchemeSeparator();
-    return (ssi == NOT_FOUND) ? EMPTY : uriString_.substr(0, ssi);
-}
 
-string Uri::GetSchemeSpecificPart()
-{
-    if (uriString_.empty()) {
-        return EMPTY;
+    if (fsi_ != NOT_FOUND) {
+        fragment_ = { fsi_ + POS_INC, length - fsi_ - POS_INC };
     }
 
-    return (ssp_ == NOT_CACHED) ? (ssp_ = ParseSsp()) : ssp_;
+    ParseAuthority();
+    ParseQuery();
+    ParsePath();
 }
 
-string Uri::ParseSsp()
+void Uri::ParseAuthority()
 {
-    size_t ssi = FindSchemeSeparator();
-    size_t fsi = FindFragmentSeparator();
-
-    size_t start = (ssi == NOT_FOUND) ? 0 : (ssi + 1);
-    size_t end = (fsi == NOT_FOUND) ? uriString_.size() : fsi;
+    size_t length = uriString_.length();
+    // If "//" follows the scheme separator, we have an authority.
+    if ((ssi_ == NOT_FOUND) || (length <= (ssi_ + POS_INC_MORE)) || (uriString_[ssi_ + POS_INC] != LEFT_SEPARATOR) ||
+        (uriString_[ssi_ + POS_INC_MORE] != LEFT_SEPARATOR)) {
+        return;
+    }
 
-    // Return everything between ssi and fsi.
-    string ssp = EMPTY;
-    if (end > start) {
-        ssp = uriString_.substr(start, end - start);
+    // Look for the start of the path, query, or fragment, or the end of the string.
+    size_t start = ssi_ + POS_INC_AGAIN;
+    size_t end = start;
+    while (end < length) {
+        char ch = uriString_[end];
+        if ((ch == LEFT_SEPARATOR) || (ch == RIGHT_SEPARATOR) || (ch == QUERY_FLAG) || (ch == SCHEME_FRAGMENT)) {
+            break;
+        }
+        end++;
     }
+    authority_ = { start, end - start };
 
-    return ssp;
+    // Parse out user info and then port, the port separator is looked for *after* the user info separator.
+    string_view authority = GetAuthorityView();
+    size_t userInfoSeparator = authority.find_last_of(USER_HOST_SEPARATOR);
+    size_t hostStart = 0;
+    if (userInfoSeparator != NOT_FOUND) {
+        userInfo_ = { start, userInfoSeparator };
+        hostStart = userInfoSeparator + POS_INC;
+    }
+    size_t portSeparator = authority.find_first_of(PORT_SEPARATOR, hostStart);
+    size_t hostEnd = (portSeparator == NOT_FOUND) ? authority.size() : portSeparator;
+    if (hostStart < hostEnd) {
+        host_ = { start + hostStart, hostEnd - hostStart };
+    }
+    if (portSeparator != NOT_FOUND) {
+        int value = PORT_NONE;
+        port_ = StrToInt(string(authority.substr(portSeparator + POS_INC)), value) ? value : PORT_NONE;
+    }
 }
 
-string Uri::GetAuthority()
+void Uri::ParseQuery()
 {
-    if (uriString_.empty()) {
-        return EMPTY;
+    size_t qsi = uriString_.find_first_of(QUERY_FLAG, (ssi_ == NOT_FOUND) ? 0 : ssi_);
+    if (qsi == NOT_FOUND) {
+        return;
     }
 
-    if (authority_ == NOT_CACHED) {
-        authority_ = ParseAuthority();
+    size_t start = qsi + POS_INC;
+    if (fsi_ == NOT_FOUND) {
+        query_ = { start, uriString_.length() - start };
+    } else if (fsi_ > qsi) {
+        // A fragment before the query is invalid.
+        query_ = { start, fsi_ - start };
     }
-    return authority_;
 }
 
-string Uri::ParseAuthority()
+void Uri::ParsePath()
 {
-    size_t ssi = FindSchemeSeparator();
-    if (ssi == NOT_FOUND) {
-        return EMPTY;
+    size_t length = uriString_.length();
+    // If the URI is absolute, a '/' after the ':' means this is hierarchical, all relative URIs are hierarchical.
+    if ((ssi_ != NOT_FOUND) && (((ssi_ + POS_INC) == length) || (uriString_[ssi_ + POS_INC] != LEFT_SEPARATOR))) {
+        // Opaque URI.
+        return;
     }
 
-    size_t length = uriString_.length();
-    // If "//" follows the scheme separator, we have an authority.
-    if ((length > (ssi + POS_INC_MORE)) && (uriString_.at(ssi + POS_INC) == LEFT_SEPARATOR) &&
-        (uriString_.at(ssi + POS_INC_MORE) == LEFT_SEPARATOR)) {
-        // Look for the start of the path, query, or fragment, or the end of the string.
-        size_t start = ssi + POS_INC_AGAIN;
-        size_t end = start;
-
-        while (end < length) {
-            char ch = uriString_.at(end);
-            if ((ch == LEFT_SEPARATOR) || (ch == RIGHT_SEPARATOR) || (ch == QUERY_FLAG) ||
-                (ch == SCHEME_FRAGMENT)) {
+    // Find start of path.
+    size_t pathStart = (ssi_ == NOT_FOUND) ? 0 : (ssi_ + POS_INC);
+    if ((length > (pathStart + POS_INC)) && (uriString_[pathStart] == LEFT_SEPARATOR) &&
+        (uriString_[pathStart + POS_INC] == LEFT_SEPARATOR)) {
+        // Skip over authority to path.
+        pathStart += POS_INC_MORE;
+
+        while (pathStart < length) {
+            char ch = uriString_[pathStart];
+            if ((ch == QUERY_FLAG) || (ch == SCHEME_FRAGMENT)) {
+                return;
+            }
+
+            if ((ch == LEFT_SEPARATOR) || (ch == RIGHT_SEPARATOR)) {
                 break;
             }
 
-            end++;
+            pathStart++;
+        }
+    }
+
+    // Find end of path.
+    size_t pathEnd = pathStart;
+    while (pathEnd < length) {
+        char ch = uriString_[pathEnd];
+        if ((ch == QUERY_FLAG) || (ch == SCHEME_FRAGMENT)) {
+            break;
         }
 
-        return uriString_.substr(start, end - start);
-    } else {
-        return EMPTY;
+        pathEnd++;
     }
+    path_ = { pathStart, pathEnd - pathStart };
 }
 
-string Uri::GetUserInfo()
+bool Uri::CheckScheme() const
 {
-    if (uriString_.empty()) {
-        return EMPTY;
+    // The same as matching "[a-zA-Z][a-zA-Z|\\d|+|-|.]*$", where "|-|" is a range of '|' only.
+    string_view scheme = GetSchemeView();
+    if (scheme.empty()) {
+        return true;
     }
-
-    if (userInfo_ == NOT_CACHED) {
-        userInfo_ = ParseUserInfo();
+    if (!IsAsciiAlpha(scheme[0])) {
+        return false;
+    }
+    for (size_t i = POS_INC; i < scheme.size(); i++) {
+        char ch = scheme[i];
+        if (!IsAsciiAlpha(ch) && !IsAsciiDigit(ch) && (ch != '+') && (ch != '.') && (ch != '|')) {
+            return false;
+        }
     }
-    return userInfo_;
+    return true;
 }
 
-string Uri::ParseUserInfo()
+string_view Uri::GetPart(const Part& part) const
 {
-    string authority = GetAuthority();
-    if (authority.empty()) {
-        return EMPTY;
-    }
-
-    size_t end = authority.find_last_of(USER_HOST_SEPARATOR);
-    return (end == NOT_FOUND) ? EMPTY : authority.substr(0, end);
+    return string_view(uriString_).substr(part.start, part.length);
 }
 
-string Uri::GetHost()
+string Uri::GetScheme() const
 {
-    if (uriString_.empty()) {
-        return EMPTY;
-    }
-
-    if (host_ == NOT_CACHED) {
-        host_ = ParseHost();
-    }
-    return host_;
+    return string(GetSchemeView());
 }
 
-string Uri::ParseHost()
+string_view Uri::GetSchemeView() const
 {
-    string authority = GetAuthority();
-    if (authority.empty()) {
-        return EMPTY;
-    }
-
-    // Parse out user info and then port.
-    size_t userInfoSeparator = authority.find_last_of(USER_HOST_SEPARATOR);
-    size_t start = (userInfoSeparator == NOT_FOUND) ? 0 : (userInfoSeparator + 1);
-    size_t portSeparator = authority.find_first_of(PORT_SEPARATOR, start);
-    size_t end = (portSeparator == NOT_FOUND) ? authority.size() : portSeparator;
-
-    string host = EMPTY;
-    if (start < end) {
-        host = authority.substr(start, end - start);
-    }
-
-    return host;
+    return GetPart(scheme_);
 }
 
-int Uri::GetPort()
+string Uri::GetSchemeSpecificPart() const
 {
-    if (uriString_.empty()) {
-        return PORT_NONE;
-    }
-
-    if (port_ == NOT_CALCULATED) {
-        port_ = ParsePort();
-    }
-    return port_;
+    return string(GetSchemeSpecificPartView());
 }
 
-int Uri::ParsePort()
+string_view Uri::GetSchemeSpecificPartView() const
 {
-    string authority = GetAuthority();
-    if (authority.empty()) {
-        return PORT_NONE;
-    }
-
-    // Make sure we look for the port separtor *after* the user info separator.
-    size_t userInfoSeparator = authority.find_last_of(USER_HOST_SEPARATOR);
-    size_t start = (userInfoSeparator == NOT_FOUND) ? 0 : (userInfoSeparator + 1);
-    size_t portSeparator = authority.find_first_of(PORT_SEPARATOR, start);
-    if (portSeparator == NOT_FOUND) {
-        return PORT_NONE;
-    }
-
-    start = portSeparator + 1;
-    string portString = authority.substr(start);
-
-    int value = PORT_NONE;
-    return StrToInt(portString, value) ? value : PORT_NONE;
+    return GetPart(ssp_);
 }
 
-string Uri::GetQuery()
+string Uri::GetAuthority() const
 {
-    if (uriString_.empty()) {
-        return EMPTY;
-    }
-
-    if (query_ == NOT_CACHED) {
-        query_ = ParseQuery();
-    }
-    return query_;
+    return string(GetAuthorityView());
 }
 
-string Uri::ParseQuery()
+string_view Uri::GetAuthorityView() const
 {
-    size_t ssi = FindSchemeSeparator();
-    if (ssi == NOT_FOUND) {
-        ssi = 0;
-    }
-    size_t qsi = uriString_.find_first_of(QUERY_FLAG, ssi);
-    if (qsi == NOT_FOUND) {
-        return EMPTY;
-    }
-
-    size_t start = qsi + 1;
-    size_t fsi = FindFragmentSeparator();
-    if (fsi == NOT_FOUND) {
-        return uriString_.substr(start);
-    }
-
-    if (fsi < qsi) {
-        // Invalid.
-        return EMPTY;
-    }
-
-    return uriString_.substr(start, fsi - start);
+    return GetPart(authority_);
 }
 
-string Uri::GetPath()
+string Uri::GetUserInfo() const
 {
-    if (uriString_.empty()) {
-        return EMPTY;
-    }
-
-    if (path_ == NOT_CACHED) {
-        path_ = ParsePath();
-    }
-    return path_;
+    return string(GetUserInfoView());
 }
 
-void Uri::GetPathSegments(std::vector<std::string>& segments)
+string_view Uri::GetUserInfoView() const
 {
-    if (uriString_.empty()) {
-        return;
-    }
-    if (path_ == NOT_CACHED) {
-        path_ = ParsePath();
-    }
-
-    size_t previous = 0;
-    size_t current;
-    while ((current = path_.find(LEFT_SEPARATOR, previous)) != std::string::npos) {
-        if (previous < current) {
-            segments.emplace_back(path_.substr(previous, current - previous));
-        }
-        previous = current + POS_INC;
-    }
-    // Add in the final path segment.
-    if (previous < path_.length()) {
-        segments.emplace_back(path_.substr(previous));
-    }
+    return GetPart(userInfo_);
 }
 
-string Uri::ParsePath()
+string Uri::GetHost() const
 {
-    size_t ssi = FindSchemeSeparator();
-    // If the URI is absolute.
-    if (ssi != NOT_FOUND) {
-        // Is there anything after the ':'?
-        if ((ssi + 1) == uriString_.length()) {
-            // Opaque URI.
-            return EMPTY;
-        }
-
-        // A '/' after the ':' means this is hierarchical.
-        if (uriString_.at(ssi + 1) != LEFT_SEPARATOR) {
-            // Opaque URI.
-            return EMPTY;
-        }
-    } else {
-        // All relative URIs are hierarchical.
-    }
-
-    return ParsePath(ssi);
+    return string(GetHostView());
 }
 
-string Uri::ParsePath(size_t ssi)
+string_view Uri::GetHostView() const
 {
-    size_t length = uriString_.length();
-
-    // Find start of path.
-    size_t pathStart = (ssi == NOT_FOUND) ? 0 : (ssi + POS_INC);
-    if ((length > (pathStart + POS_INC)) && (uriString_.at(pathStart) == LEFT_SEPARATOR) &&
-        (uriString_.at(pathStart + POS_INC) == LEFT_SEPARATOR)) {
-        // Skip over authority to path.
-        pathStart += POS_INC_MORE;
-
-        while (pathStart < length) {
-            char ch = uriString_.at(pathStart);
-            if ((ch == QUERY_FLAG) || (ch == SCHEME_FRAGMENT)) {
-                return EMPTY;
-            }
-
-            if ((ch == LEFT_SEPARATOR) || (ch == RIGHT_SEPARATOR)) {
-                break;
-            }
+    return GetPart(host_);
+}
 
-            pathStart++;
-        }
-    }
+int Uri::GetPort() const
+{
+    return port_;
+}
 
-    // Find end of path.
-    size_t pathEnd = pathStart;
-    while (pathEnd < length) {
-        char ch = uriString_.at(pathEnd);
-        if ((ch == QUERY_FLAG) || (ch == SCHEME_FRAGMENT)) {
-            break;
-        }
+string Uri::GetQuery() const
+{
+    return string(GetQueryView());
+}
 
-        pathEnd++;
-    }
+string_view Uri::GetQueryView() const
+{
+    return GetPart(query_);
+}
 
-    return uriString_.substr(pathStart, pathEnd - pathStart);
+string Uri::GetPath() const
+{
+    return string(GetPathView());
 }
 
-string Uri::GetFragment()
+string_view Uri::GetPathView() const
 {
-    if (uriString_.empty()) {
-        return EMPTY;
-    }
+    return GetPart(path_);
+}
 
-    if (fragment_ == NOT_CACHED) {
-        fragment_ = ParseFragment();
+void Uri::GetPathSegments(std::vector<std::string>& segments) const
+{
+    std::vector<string_view> views;
+    GetPathSegments(views);
+    for (const auto& view : views) {
+        segments.emplace_back(view);
     }
-    return fragment_;
 }
 
-string Uri::ParseFragment()
+void Uri::GetPathSegments(std::vector<string_view>& segments) const
 {
-    size_t fsi = FindFragmentSeparator();
-    return (fsi == NOT_FOUND) ? EMPTY : uriString_.substr(fsi + 1);
+    string_view path = GetPathView();
+    size_t previous = 0;
+    size_t current;
+    while ((current = path.find(LEFT_SEPARATOR, previous)) != NOT_FOUND) {
+        if (previous < current) {
+            segments.emplace_back(path.substr(previous, current - previous));
+        }
+        previous = current + POS_INC;
+    }
+    // Add in the final path segment.
+    if (previous < path.length()) {
+        segments.emplace_back(path.substr(previous));
+    }
 }
 
-size_t Uri::FindSchemeSeparator()
+string Uri::GetFragment() const
 {
-    if (cachedSsi_ == NOT_FOUND) {
-        cachedSsi_ = uriString_.find_first_of(SCHEME_SEPARATOR);
-    }
-    return cachedSsi_;
+    return string(GetFragmentView());
 }
 
-size_t Uri::FindFragmentSeparator()
+string_view Uri::GetFragmentView() const
 {
-    if (cachedFsi_ == NOT_FOUND) {
-        cachedFsi_ = uriString_.find_first_of(SCHEME_FRAGMENT, FindSchemeSeparator());
-    }
-    return cachedFsi_;
+    return GetPart(fragment_);
 }
 
-bool Uri::IsHierarchical()
+bool Uri::IsHierarchical() const
 {
     if (uriString_.empty()) {
         return false;
     }
 
-    size_t ssi = FindSchemeSeparator();
-    if (ssi == NOT_FOUND) {
+    if (ssi_ == NOT_FOUND) {
         // All relative URIs are hierarchical.
         return true;
     }
 
-    if (uriString_.length() == (ssi + 1)) {
+    if (uriString_.length() == (ssi_ + 1)) {
         // No ssp.
         return false;
     }
 
     // If the ssp starts with a '/', this is hierarchical.
-    return (uriString_.at(ssi + 1) == LEFT_SEPARATOR);
+    return (uriString_.at(ssi_ + 1) == LEFT_SEPARATOR);
 }
 
-bool Uri::IsOpaque()
+bool Uri::IsOpaque() const
 {
     if (uriString_.empty()) {
         return false;
@@ -454,7 +357,7 @@ bool Uri::IsOpaque()
     return !IsHierarchical();
 }
 
-bool Uri::IsAbsolute()
+bool Uri::IsAbsolute() const
 {
     if (uriString_.empty()) {
         return false;
@@ -463,34 +366,39 @@ bool Uri::IsAbsolute()
     return !IsRelative();
 }
 
-bool Uri::IsRelative()
+bool Uri::IsRelative() const
 {
     if (uriString_.empty()) {
         return false;
     }
 
     // Note: We return true if the index is 0
-    return FindSchemeSeparator() == NOT_FOUND;
+    return ssi_ == NOT_FOUND;
 }
 
 bool Uri::Equals(const Uri& other) const
 {
-    return ToString() == other.ToString();
+    return uriString_ == other.uriString_;
 }
 
 int Uri::CompareTo(const Uri& other) const
 {
-    return ToString().compare(other.ToString());
+    return uriString_.compare(other.uriString_);
 }
 
-string Uri::ToString() const
+const string& Uri::ToString() const
 {
     return uriString_;
 }
 
+size_t Uri::Hash() const
+{
+    return std::hash<string>()(uriString_);
+}
+
 bool Uri::operator==(const Uri& other) const
 {
-    return ToString() == other.ToString();
+    return uriString_ == other.uriString_;
 }
 
 bool Uri::Marshalling(Parcel& parcel) const
@@ -187,7 +187,7 @@ void Operation::RemoveFlags(unsigned int flags)
  * @description: Obtains the value of the uri attribute included in this Operation.
  * @return Returns the URI included in this Operation.
  */
-Uri Operation::GetUri() const
+const Uri &Operation::GetUri() const
 {
     return uri_;
 }
@@ -57,6 +57,25 @@ namespace {
 const int FLOAT_PRECISION = 7;
 const int DOUBLE_PRECISION = 17;
 const std::regex NUMBER_REGEX("^[-+]?([0-9]+)([.]([0-9]+))?$");
+const std::string PACMAP_JSON_TAG = "PACMAP";
+const std::string PACMAP_BINARY_TAG = "PACMAP_BINARY";
+const int PACMAP_MAX_DEPTH = 32;
+
+struct PacMapArrayType {
+    int elementType;
+    const InterfaceID *iid;
+};
+const std::map<int, PacMapArrayType> PACMAP_ARRAY_TYPES = {
+    {PACMAP_DATA_ARRAY_SHORT, {PACMAP_DATA_SHORT, &g_IID_IShort}},
+    {PACMAP_DATA_ARRAY_INTEGER, {PACMAP_DATA_INTEGER, &g_IID_IInteger}},
+    {PACMAP_DATA_ARRAY_LONG, {PACMAP_DATA_LONG, &g_IID_ILong}},
+    {PACMAP_DATA_ARRAY_CHAR, {PACMAP_DATA_CHAR, &g_IID_IChar}},
+    {PACMAP_DATA_ARRAY_BYTE, {PACMAP_DATA_BYTE, &g_IID_IByte}},
+    {PACMAP_DATA_ARRAY_BOOLEAN, {PACMAP_DATA_BOOLEAN, &g_IID_IBoolean}},
+    {PACMAP_DATA_ARRAY_FLOAT, {PACMAP_DATA_FLOAT, &g_IID_IFloat}},
+    {PACMAP_DATA_ARRAY_DOUBLE, {PACMAP_DATA_DOUBLE, &g_IID_IDouble}},
+    {PACMAP_DATA_ARRAY_STRING, {PACMAP_DATA_STRING, &g_IID_IString}},
+};
 };  // namespace
 
 #define PAC_MAP_PUT_VALUE(id, iid, key, value, mapList) \
@@ -225,9 +244,7 @@ IINTERFACE_IMPL_1(PacMap, Object, IPacMap);
 PacMap::PacMap(const PacMap &other)
 {
     std::lock_guard<std::mutex> mLock(mapLock_);
-    dataList_.clear();
-    std::string str = MapListToString(other.dataList_);
-    StringToMapList(str, dataList_);
+    DeepCopyData(dataList_, other.dataList_);
 }
 
 PacMap::~PacMap()
@@ -241,9 +258,7 @@ PacMap::~PacMap()
 PacMap &PacMap::operator=(const PacMap &other)
 {
     if (&other != this) {
-        dataList_.clear();
-        std::string str = MapListToString(other.dataList_);
-        StringToMapList(str, dataList_);
+        DeepCopyData(dataList_, other.dataList_);
     }
     return *this;
 }
@@ -266,8 +281,7 @@ PacMap PacMap::Clone(void)
 {
     std::lock_guard<std::mutex> mLock(mapLock_);
     PacMap pac_map;
-    std::string currentString = MapListToString(dataList_);
-    StringToMapList(currentString, pac_map.dataList_);
+    DeepCopyData(pac_map.dataList_, dataList_);
     return pac_map;
 }
 
@@ -280,16 +294,14 @@ PacMap PacMap::DeepCopy(void)
 {
     std::lock_guard<std::mutex> mLock(mapLock_);
     PacMap pac_map;
-    std::string str = MapListToString(dataList_);
-    StringToMapList(str, pac_map.dataList_);
+    DeepCopyData(pac_map.dataList_, dataList_);
     return pac_map;
 }
 
 void PacMap::DeepCopy(PacMap &other)
 {
     std::lock_guard<std::mutex> mLock(mapLock_);
-    dataList_.clear();
-    StringToMapList(MapListToString(other.dataList_), dataList_);
+    DeepCopyData(dataList_, other.dataList_);
 }
 
 /**
@@ -598,8 +610,7 @@ void PacMap::InnerPutStringValueArray(
 void PacMap::PutAll(std::map<std::string, PacMapObject::INTERFACE> &mapData)
 {
     std::lock_guard<std::mutex> mLock(mapLock_);
-    dataList_.clear();
-    StringToMapList(MapListToString(mapData), dataList_);
+    DeepCopyData(dataList_, mapData);
 }
 
 /**
@@ -609,8 +620,7 @@ void PacMap::PutAll(std::map<std::string, PacMapObject::INTERFACE> &mapData)
 void PacMap::PutAll(PacMap &pacMap)
 {
     std::lock_guard<std::mutex> mLock(mapLock_);
-    dataList_.clear();
-    StringToMapList(MapListToString(pacMap.dataList_), dataList_);
+    DeepCopyData(dataList_, pacMap.dataList_);
 }
 
 /**
@@ -878,7 +888,7 @@ std::map<std::string, PacMapObject::INTERFACE> PacMap::GetAll(void)
     std::lock_guard<std::mutex> mLock(mapLock_);
 
     PacMapList tmpMapList;
-    StringToMapList(MapListToString(dataList_), tmpMapList);
+    DeepCopyData(tmpMapList, dataList_);
 
     return tmpMapList;
 }
@@ -891,6 +901,73 @@ void PacMap::ShallowCopyData(PacMapList &desPacMap, const PacMapList &srcPacMap)
     }
 }
 
+static sptr<IArray> CloneArray(IArray *srcArray)
+{
+    long size = 0;
+    InterfaceID typeId;
+    srcArray->GetLength(size);
+    srcArray->GetType(typeId);
+    sptr<IArray> desArray = new (std::nothrow) Array(size, typeId);
+    if (desArray == nullptr) {
+        return nullptr;
+    }
+    for (long i = 0; i < size; i++) {
+        sptr<IInterface> element;
+        srcArray->Get(i, element);
+        desArray->Set(i, element.GetRefPtr());
+    }
+    return desArray;
+}
+
+/**
+ * @brief Copies the source list by walking it directly instead of going through a JSON round trip.
+ * Boxed base values and strings are immutable, so they are shared between both lists; arrays, nested
+ * PacMaps and user objects are duplicated so that later changes on either side stay independent.
+ */
+void PacMap::DeepCopyData(PacMapList &desPacMap, const PacMapList &srcPacMap) const
+{
+    desPacMap.clear();
+    for (auto it = srcPacMap.begin(); it != srcPacMap.end(); it++) {
+        IInterface *value = it->second.GetRefPtr();
+        if (value == nullptr) {
+            continue;
+        }
+        if (IPacMap::Query(value) != nullptr) {
+            PacMap *srcMap = static_cast<PacMap *>(IPacMap::Query(value));
+            PacMap *desMap = new (std::nothrow) PacMap();
+            if (desMap == nullptr) {
+                continue;
+            }
+            sptr<IPacMap> sp = desMap;
+            DeepCopyData(desMap->dataList_, srcMap->dataList_);
+            desPacMap.emplace(it->first, sp);
+        } else if (IArray::Query(value) != nullptr) {
+            sptr<IArray> desArray = CloneArray(IArray::Query(value));
+            if (desArray != nullptr) {
+                desPacMap.emplace(it->first, sptr<IInterface>(static_cast<IInterface *>(desArray.GetRefPtr())));
+            }
+        } else if (IUserObject::Query(value) != nullptr) {
+            std::shared_ptr<UserObjectBase> srcObject = UserObject::Unbox(IUserObject::Query(value));
+            if (srcObject == nullptr) {
+                continue;
+            }
+            UserObjectBase *userObjectIns =
+                UserObjectBaseLoader::GetInstance().GetUserObjectByName(srcObject->GetClassName());
+            if (userObjectIns == nullptr) {
+                continue;
+            }
+            std::shared_ptr<UserObjectBase> desObject(userObjectIns);
+            desObject->DeepCopy(srcObject);
+            sptr<IUserObject> valObject = UserObject::Box(desObject);
+            if (valObject != nullptr) {
+                desPacMap.emplace(it->first, valObject);
+            }
+        } else {
+            desPacMap.emplace(it->first, it->second);
+        }
+    }
+}
+
 void PacMap::RemoveData(PacMapList &pacMapList, const std::string &key)
 {
     auto it = pacMapList.find(key);
@@ -1134,6 +1211,279 @@ bool PacMap::ReadFromParcel(Parcel &parcel)
     }
 }
 
+static int GetBaseValueType(AAFwk::IInterface *value)
+{
+    if (IShort::Query(value) != nullptr) {
+        return PACMAP_DATA_SHORT;
+    } else if (IInteger::Query(value) != nullptr) {
+        return PACMAP_DATA_INTEGER;
+    } else if (ILong::Query(value) != nullptr) {
+        return PACMAP_DATA_LONG;
+    } else if (IChar::Query(value) != nullptr) {
+        return PACMAP_DATA_CHAR;
+    } else if (IByte::Query(value) != nullptr) {
+        return PACMAP_DATA_BYTE;
+    } else if (IBoolean::Query(value) != nullptr) {
+        return PACMAP_DATA_BOOLEAN;
+    } else if (IFloat::Query(value) != nullptr) {
+        return PACMAP_DATA_FLOAT;
+    } else if (IDouble::Query(value) != nullptr) {
+        return PACMAP_DATA_DOUBLE;
+    } else if (IString::Query(value) != nullptr) {
+        return PACMAP_DATA_STRING;
+    }
+    return PACMAP_DATA_NONE;
+}
+
+static int GetValueType(AAFwk::IInterface *value)
+{
+    if (IPacMap::Query(value) != nullptr) {
+        return PACMAP_DATA_PACMAP;
+    }
+    if (IUserObject::Query(value) != nullptr) {
+        return PACMAP_DATA_USEROBJECT;
+    }
+    IArray *array = IArray::Query(value);
+    if (array != nullptr) {
+        InterfaceID typeId;
+        array->GetType(typeId);
+        for (auto &arrayType : PACMAP_ARRAY_TYPES) {
+            if (*arrayType.second.iid == typeId) {
+                return arrayType.first;
+            }
+        }
+        return PACMAP_DATA_NONE;
+    }
+    return GetBaseValueType(value);
+}
+
+static bool WriteBaseValue(Parcel &parcel, int type, AAFwk::IInterface *value)
+{
+    switch (type) {
+        case PACMAP_DATA_SHORT:
+            return parcel.WriteInt16(Short::Unbox(IShort::Query(value)));
+        case PACMAP_DATA_INTEGER:
+            return parcel.WriteInt32(Integer::Unbox(IInteger::Query(value)));
+        case PACMAP_DATA_LONG:
+            return parcel.WriteInt64(Long::Unbox(ILong::Query(value)));
+        case PACMAP_DATA_CHAR:
+            return parcel.WriteUint32(Char::Unbox(IChar::Query(value)));
+        case PACMAP_DATA_BYTE:
+            return parcel.WriteInt8(Byte::Unbox(IByte::Query(value)));
+        case PACMAP_DATA_BOOLEAN:
+            return parcel.WriteBool(Boolean::Unbox(IBoolean::Query(value)));
+        case PACMAP_DATA_FLOAT:
+            return parcel.WriteFloat(Float::Unbox(IFloat::Query(value)));
+        case PACMAP_DATA_DOUBLE:
+            return parcel.WriteDouble(Double::Unbox(IDouble::Query(value)));
+        case PACMAP_DATA_STRING:
+            return parcel.WriteString(String::Unbox(IString::Query(value)));
+        default:
+            return false;
+    }
+}
+
+static sptr<IInterface> ReadBaseValue(Parcel &parcel, int type)
+{
+    switch (type) {
+        case PACMAP_DATA_SHORT: {
+            int16_t value = 0;
+            return parcel.ReadInt16(value) ? Short::Box(value) : nullptr;
+        }
+        case PACMAP_DATA_INTEGER: {
+            int32_t value = 0;
+            return parcel.ReadInt32(value) ? Integer::Box(value) : nullptr;
+        }
+        case PACMAP_DATA_LONG: {
+            int64_t value = 0;
+            return parcel.ReadInt64(value) ? Long::Box(static_cast<long>(value)) : nullptr;
+        }
+        case PACMAP_DATA_CHAR: {
+            uint32_t value = 0;
+            return parcel.ReadUint32(value) ? Char::Box(static_cast<zchar>(value)) : nullptr;
+        }
+        case PACMAP_DATA_BYTE: {
+            int8_t value = 0;
+            return parcel.ReadInt8(value) ? Byte::Box(static_cast<byte>(value)) : nullptr;
+        }
+        case PACMAP_DATA_BOOLEAN: {
+            bool value = false;
+            return parcel.ReadBool(value) ? Boolean::Box(value) : nullptr;
+        }
+        case PACMAP_DATA_FLOAT: {
+            float value = 0.0f;
+            return parcel.ReadFloat(value) ? Float::Box(value) : nullptr;
+        }
+        case PACMAP_DATA_DOUBLE: {
+            double value = 0.0;
+            return parcel.ReadDouble(value) ? Double::Box(value) : nullptr;
+        }
+        case PACMAP_DATA_STRING: {
+            std::string value;
+            return parcel.ReadString(value) ? String::Box(value) : nullptr;
+        }
+        default:
+            return nullptr;
+    }
+}
+
+/**
+ * @brief Writes the list as typed, length-prefixed entries: the entry count, then for each entry its key,
+ * its type id and its value. Arrays are prefixed with their length and nested PacMaps recurse.
+ */
+bool PacMap::WriteMapListToParcel(Parcel &parcel, const PacMapList &mapList) const
+{
+    std::vector<std::pair<PacMapList::const_iterator, int>> entries;
+    entries.reserve(mapList.size());
+    for (auto it = mapList.begin(); it != mapList.end(); it++) {
+        int type = GetValueType(it->second.GetRefPtr());
+        if (type != PACMAP_DATA_NONE) {
+            entries.emplace_back(it, type);
+        }
+    }
+
+    if (!parcel.WriteInt32(static_cast<int32_t>(entries.size()))) {
+        return false;
+    }
+    for (auto &entry : entries) {
+        if (!parcel.WriteString(entry.first->first) || !parcel.WriteInt32(entry.second)) {
+            return false;
+        }
+        if (!WriteValueToParcel(parcel, entry.second, entry.first->second.GetRefPtr())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool PacMap::WriteValueToParcel(Parcel &parcel, int type, AAFwk::IInterface *value) const
+{
+    if (type == PACMAP_DATA_PACMAP) {
+        PacMap *pacMap = static_cast<PacMap *>(IPacMap::Query(value));
+        return WriteMapListToParcel(parcel, pacMap->dataList_);
+    }
+    if (type == PACMAP_DATA_USEROBJECT) {
+        std::shared_ptr<UserObjectBase> userObject = UserObject::Unbox(IUserObject::Query(value));
+        if (userObject == nullptr) {
+            return parcel.WriteString("") && parcel.WriteString("");
+        }
+        return parcel.WriteString(userObject->GetClassName()) && parcel.WriteString(userObject->ToString());
+    }
+    if (PACMAP_ARRAY_TYPES.find(type) != PACMAP_ARRAY_TYPES.end()) {
+        return WriteArrayToParcel(parcel, type, value);
+    }
+    return WriteBaseValue(parcel, type, value);
+}
+
+bool PacMap::WriteArrayToParcel(Parcel &parcel, int type, AAFwk::IInterface *value) const
+{
+    IArray *array = IArray::Query(value);
+    long size = 0;
+    array->GetLength(size);
+    if (!parcel.WriteInt32(static_cast<int32_t>(size))) {
+        return false;
+    }
+    int elementType = PACMAP_ARRAY_TYPES.at(type).elementType;
+    for (long i = 0; i < size; i++) {
+        sptr<IInterface> element;
+        array->Get(i, element);
+        if (!WriteBaseValue(parcel, elementType, element.GetRefPtr())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool PacMap::ReadMapListFromParcel(Parcel &parcel, PacMapList &mapList, int depth)
+{
+    if (depth > PACMAP_MAX_DEPTH) {
+        return false;
+    }
+    int32_t size = 0;
+    if (!parcel.ReadInt32(size) || size < 0 || static_cast<size_t>(size) > parcel.GetReadableBytes()) {
+        return false;
+    }
+    for (int32_t i = 0; i < size; i++) {
+        std::string key;
+        int32_t type = PACMAP_DATA_NONE;
+        if (!parcel.ReadString(key) || !parcel.ReadInt32(type)) {
+            return false;
+        }
+        if (!ReadValueFromParcel(parcel, mapList, key, type, depth)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool PacMap::ReadValueFromParcel(Parcel &parcel, PacMapList &mapList, const std::string &key, int type, int depth)
+{
+    if (type == PACMAP_DATA_PACMAP) {
+        PacMap *pacMap = new (std::nothrow) PacMap();
+        if (pacMap == nullptr) {
+            return false;
+        }
+        sptr<IPacMap> sp = pacMap;
+        if (!ReadMapListFromParcel(parcel, pacMap->dataList_, depth + 1)) {
+            return false;
+        }
+        RemoveData(mapList, key);
+        mapList.emplace(key, sp);
+        return true;
+    }
+    if (type == PACMAP_DATA_USEROBJECT) {
+        std::string className;
+        std::string data;
+        if (!parcel.ReadString(className) || !parcel.ReadString(data)) {
+            return false;
+        }
+        UserObjectBase *userObjectIns = UserObjectBaseLoader::GetInstance().GetUserObjectByName(className);
+        if (userObjectIns == nullptr) {
+            // Unknown classes are skipped like the JSON decoder does, the stream stays aligned.
+            return true;
+        }
+        if (!data.empty()) {
+            userObjectIns->Parse(data);
+        }
+        std::shared_ptr<UserObjectBase> userObject(userObjectIns);
+        InnerPutObject(mapList, key, userObject);
+        return true;
+    }
+    if (PACMAP_ARRAY_TYPES.find(type) != PACMAP_ARRAY_TYPES.end()) {
+        return ReadArrayFromParcel(parcel, mapList, key, type);
+    }
+    sptr<IInterface> value = ReadBaseValue(parcel, type);
+    if (value == nullptr) {
+        return false;
+    }
+    RemoveData(mapList, key);
+    mapList.emplace(key, value);
+    return true;
+}
+
+bool PacMap::ReadArrayFromParcel(Parcel &parcel, PacMapList &mapList, const std::string &key, int type)
+{
+    int32_t size = 0;
+    if (!parcel.ReadInt32(size) || size < 0 || static_cast<size_t>(size) > parcel.GetReadableBytes()) {
+        return false;
+    }
+    const PacMapArrayType &arrayType = PACMAP_ARRAY_TYPES.at(type);
+    sptr<IArray> array = new (std::nothrow) Array(size, *arrayType.iid);
+    if (array == nullptr) {
+        return false;
+    }
+    for (int32_t i = 0; i < size; i++) {
+        sptr<IInterface> element = ReadBaseValue(parcel, arrayType.elementType);
+        if (element == nullptr) {
+            return false;
+        }
+        array->Set(i, element.GetRefPtr());
+    }
+    RemoveData(mapList, key);
+    mapList.emplace(key, sptr<IInterface>(static_cast<IInterface *>(array.GetRefPtr())));
+    return true;
+}
+
 /**
  * @brief Marshals this Sequenceable object to a Parcel.
  * @param parcel Indicates the Parcel object into which the Sequenceable object has been marshaled.
@@ -1141,11 +1491,10 @@ bool PacMap::ReadFromParcel(Parcel &parcel)
  */
 bool PacMap::Marshalling(Parcel &parcel) const
 {
-    if (!parcel.WriteString("PACMAP")) {
+    if (!parcel.WriteString(PACMAP_BINARY_TAG)) {
         return false;
     }
-    std::string str = MapListToString(dataList_);
-    return parcel.WriteString(str);
+    return WriteMapListToParcel(parcel, dataList_);
 }
 
 /**
@@ -1156,11 +1505,16 @@ bool PacMap::Marshalling(Parcel &parcel) const
 PacMap *PacMap::Unmarshalling(Parcel &parcel)
 {
     std::string value = parcel.ReadString();
-    if (value != "PACMAP") {
+    if (value != PACMAP_BINARY_TAG && value != PACMAP_JSON_TAG) {
         return nullptr;
     }
     PacMap *pPacMap = new (std::nothrow) PacMap();
-    if (pPacMap != nullptr && !pPacMap->ReadFromParcel(parcel)) {
+    if (pPacMap == nullptr) {
+        return nullptr;
+    }
+    bool ret = (value == PACMAP_BINARY_TAG) ? pPacMap->ReadMapListFromParcel(parcel, pPacMap->dataList_, 0) :
+        pPacMap->ReadFromParcel(parcel);
+    if (!ret) {
         delete pPacMap;
         return nullptr;
     }
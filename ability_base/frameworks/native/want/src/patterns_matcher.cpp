@@ -39,6 +39,7 @@ PatternsMatcher::PatternsMatcher(const PatternsMatcher &patternsMatcher)
 {
     pattern_ = patternsMatcher.GetPattern();
     type_ = patternsMatcher.GetType();
+    regex_ = patternsMatcher.regex_;
 }
 
 /**
@@ -61,7 +62,7 @@ PatternsMatcher::~PatternsMatcher()
  *
  * @return the specified pattern.
  */
-std::string PatternsMatcher::GetPattern() const
+const std::string &PatternsMatcher::GetPattern() const
 {
     return pattern_;
 }
@@ -82,9 +83,15 @@ MatchType PatternsMatcher::GetType() const
  * @param str The desired string to look for.
  * @return Returns either a valid match constant.
  */
-bool PatternsMatcher::match(std::string match)
+bool PatternsMatcher::match(const std::string &match)
 {
-    return MatchPattern(pattern_, match, type_);
+    if (type_ != MatchType::PATTERN || match.empty()) {
+        return MatchPattern(pattern_, match, type_);
+    }
+    if (regex_ == nullptr) {
+        regex_ = std::make_shared<std::regex>(pattern_);
+    }
+    return std::regex_match(match, *regex_);
 }
 
 /**
@@ -96,7 +103,7 @@ bool PatternsMatcher::match(std::string match)
  *
  * @return Returns either a valid match constant.
  */
-bool PatternsMatcher::MatchPattern(std::string pattern, std::string match, MatchType type)
+bool PatternsMatcher::MatchPattern(const std::string &pattern, const std::string &match, MatchType type)
 {
     if (match.empty()) {
         return false;
@@ -130,31 +137,27 @@ bool PatternsMatcher::MatchPattern(std::string pattern, std::string match, Match
  *
  * @return Returns either a valid match constant.
  */
-bool PatternsMatcher::GlobPattern(std::string pattern, std::string match)
+bool PatternsMatcher::GlobPattern(const std::string &pattern, const std::string &match)
 {
     size_t indexP = 0;
     size_t find_pos = 0;
     size_t indexM = 0;
     while (indexP < pattern.length() && find_pos != std::string::npos) {
-        find_pos = pattern.find("*", indexP);
-        std::string p;
-        if (find_pos == std::string::npos) {
-            p = pattern.substr(indexP, pattern.length());
-        } else {
-            p = pattern.substr(indexP, find_pos - indexP);
-        }
-        if (p.length() == 0) {
+        find_pos = pattern.find('*', indexP);
+        // search the part between two '*' in place, instead of copying it out of the pattern.
+        size_t partLength = (find_pos == std::string::npos) ? pattern.length() - indexP : find_pos - indexP;
+        if (partLength == 0) {
             indexP = indexP + 1;
             continue;
         }
-        size_t find_pos_m = match.find(p, indexM);
+        size_t find_pos_m = match.find(pattern.data() + indexP, indexM, partLength);
         if (find_pos_m == std::string::npos) {
             return false;
         }
         indexP = find_pos;
-        indexM = find_pos_m + p.length();
+        indexM = find_pos_m + partLength;
     }
-    if (indexM < match.length() && !(pattern.rfind("*") == pattern.length() - 1)) {
+    if (indexM < match.length() && !(pattern.rfind('*') == pattern.length() - 1)) {
         return false;
     }
     return true;
@@ -196,6 +199,7 @@ bool PatternsMatcher::ReadFromParcel(Parcel &parcel)
     std::u16string readString16;
     READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(String16, parcel, readString16);
     pattern_ = Str16ToStr8(readString16);
+    regex_ = nullptr;
 
     // flags_
     int32_t type;
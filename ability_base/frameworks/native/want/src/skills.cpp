@@ -14,6 +14,9 @@
  */
 
 #include "skills.h"
+
+#include <algorithm>
+
 using namespace OHOS;
 using namespace OHOS::AppExecFwk;
 namespace OHOS {
@@ -295,7 +298,7 @@ void Skills::AddPath(const std::string &path)
  */
 void Skills::AddPath(const PatternsMatcher &patternsMatcher)
 {
-    auto hasPath = std::find_if(paths_.begin(), paths_.end(), [&patternsMatcher](const PatternsMatcher pm) {
+    auto hasPath = std::find_if(paths_.begin(), paths_.end(), [&patternsMatcher](const PatternsMatcher &pm) {
         return (pm.GetPattern() == patternsMatcher.GetPattern()) && (pm.GetType() == patternsMatcher.GetType());
     });
 
@@ -324,7 +327,7 @@ void Skills::AddPath(const std::string &path, const MatchType &matchType)
 bool Skills::HasPath(const std::string &path)
 {
     auto hasPath = std::find_if(
-        paths_.begin(), paths_.end(), [&path](const PatternsMatcher pm) { return pm.GetPattern() == path; });
+        paths_.begin(), paths_.end(), [&path](const PatternsMatcher &pm) { return pm.GetPattern() == path; });
     return hasPath != paths_.end();
 }
 
@@ -336,7 +339,7 @@ bool Skills::HasPath(const std::string &path)
 void Skills::RemovePath(const std::string &path)
 {
     auto hasPath = std::find_if(
-        paths_.begin(), paths_.end(), [&path](const PatternsMatcher pm) { return pm.GetPattern() == path; });
+        paths_.begin(), paths_.end(), [&path](const PatternsMatcher &pm) { return pm.GetPattern() == path; });
 
     if (hasPath != paths_.end()) {
         paths_.erase(hasPath);
@@ -350,7 +353,7 @@ void Skills::RemovePath(const std::string &path)
  */
 void Skills::RemovePath(const PatternsMatcher &patternsMatcher)
 {
-    auto hasPath = std::find_if(paths_.begin(), paths_.end(), [&patternsMatcher](const PatternsMatcher pm) {
+    auto hasPath = std::find_if(paths_.begin(), paths_.end(), [&patternsMatcher](const PatternsMatcher &pm) {
         return (pm.GetPattern() == patternsMatcher.GetPattern()) && (pm.GetType() == patternsMatcher.GetType());
     });
 
@@ -462,7 +465,7 @@ void Skills::AddSchemeSpecificPart(const std::string &schemeSpecificPart)
 {
     PatternsMatcher patternsMatcher(schemeSpecificPart, MatchType::DEFAULT);
     auto it = std::find_if(
-        schemeSpecificParts_.begin(), schemeSpecificParts_.end(), [&patternsMatcher](const PatternsMatcher pm) {
+        schemeSpecificParts_.begin(), schemeSpecificParts_.end(), [&patternsMatcher](const PatternsMatcher &pm) {
             return (pm.GetPattern() == patternsMatcher.GetPattern()) && (pm.GetType() == patternsMatcher.GetType());
         });
 
@@ -480,7 +483,7 @@ bool Skills::HasSchemeSpecificPart(const std::string &schemeSpecificPart)
 {
     auto it = std::find_if(schemeSpecificParts_.begin(),
         schemeSpecificParts_.end(),
-        [&schemeSpecificPart](const PatternsMatcher pm) { return pm.GetPattern() == schemeSpecificPart; });
+        [&schemeSpecificPart](const PatternsMatcher &pm) { return pm.GetPattern() == schemeSpecificPart; });
     return it != schemeSpecificParts_.end();
 }
 
@@ -493,7 +496,7 @@ void Skills::RemoveSchemeSpecificPart(const std::string &schemeSpecificPart)
 {
     auto it = std::find_if(schemeSpecificParts_.begin(),
         schemeSpecificParts_.end(),
-        [&schemeSpecificPart](const PatternsMatcher pm) { return pm.GetPattern() == schemeSpecificPart; });
+        [&schemeSpecificPart](const PatternsMatcher &pm) { return pm.GetPattern() == schemeSpecificPart; });
 
     if (it != schemeSpecificParts_.end()) {
         schemeSpecificParts_.erase(it);
@@ -563,7 +566,7 @@ void Skills::AddType(const PatternsMatcher &patternsMatcher)
             auto it = std::find_if(types_.begin(),
                 types_.end(),
                 [type = pm.GetPattern(), matchType = pm.GetType()](
-                    const PatternsMatcher pm) { return (pm.GetPattern() == type) && (pm.GetType() == matchType); });
+                    const PatternsMatcher &pm) { return (pm.GetPattern() == type) && (pm.GetType() == matchType); });
             if (it == types_.end()) {
                 types_.emplace_back(pm);
             }
@@ -573,7 +576,7 @@ void Skills::AddType(const PatternsMatcher &patternsMatcher)
             auto it = std::find_if(types_.begin(),
                 types_.end(),
                 [type = pm.GetPattern(), matchType = pm.GetType()](
-                    const PatternsMatcher pm) { return (pm.GetPattern() == type) && (pm.GetType() == matchType); });
+                    const PatternsMatcher &pm) { return (pm.GetPattern() == type) && (pm.GetType() == matchType); });
             if (it == types_.end()) {
                 types_.emplace_back(pm);
             }
@@ -589,7 +592,7 @@ void Skills::AddType(const PatternsMatcher &patternsMatcher)
 bool Skills::HasType(const std::string &type)
 {
     auto it = std::find_if(
-        types_.begin(), types_.end(), [&type](const PatternsMatcher pm) { return pm.GetPattern() == type; });
+        types_.begin(), types_.end(), [&type](const PatternsMatcher &pm) { return pm.GetPattern() == type; });
     return it != types_.end();
 }
 
@@ -601,7 +604,7 @@ bool Skills::HasType(const std::string &type)
 void Skills::RemoveType(const std::string &type)
 {
     auto it = std::find_if(
-        types_.begin(), types_.end(), [&type](const PatternsMatcher pm) { return pm.GetPattern() == type; });
+        types_.begin(), types_.end(), [&type](const PatternsMatcher &pm) { return pm.GetPattern() == type; });
 
     if (it != types_.end()) {
         types_.erase(it);
@@ -615,7 +618,7 @@ void Skills::RemoveType(const std::string &type)
  */
 void Skills::RemoveType(const PatternsMatcher &patternsMatcher)
 {
-    auto it = std::find_if(types_.begin(), types_.end(), [&patternsMatcher](const PatternsMatcher pm) {
+    auto it = std::find_if(types_.begin(), types_.end(), [&patternsMatcher](const PatternsMatcher &pm) {
         return (pm.GetPattern() == patternsMatcher.GetPattern()) && (pm.GetType() == patternsMatcher.GetType());
     });
 
@@ -717,48 +720,41 @@ bool Skills::MatchAction(const std::string &action)
  *
  * @return Returns either a valid match constant.
  */
-int Skills::MatchData(const std::string &type, const std::string &scheme, Uri data)
+int Skills::MatchData(const std::string &type, const std::string &scheme, const Uri &data)
 {
-    std::vector<std::string> types;
-    for (auto it = types_.begin(); it != types_.end(); it++) {
-        types.emplace_back(it->GetPattern());
-    }
-    std::vector<std::string> schemes = schemes_;
-
     int match = RESULT_EMPTY;
 
-    if (types.empty() && schemes.empty()) {
+    if (types_.empty() && schemes_.empty()) {
         return (type == std::string() ? (RESULT_EMPTY + RESULT_NORMAL) : DISMATCH_DATA);
     }
 
-    if (!schemes.empty()) {
-        auto it = std::find(schemes.begin(), schemes.end(), scheme);
-        if (it != schemes.end()) {
+    if (!schemes_.empty()) {
+        if (HasScheme(scheme)) {
             match = RESULT_SCHEME;
         } else {
             return DISMATCH_DATA;
         }
 
-        std::vector<PatternsMatcher> schemeSpecificParts = schemeSpecificParts_;
-        if (schemeSpecificParts.size() >= 0) {
-            match = HasSchemeSpecificPart(data.GetSchemeSpecificPart()) ? RESULT_SCHEME_SPECIFIC_PART : DISMATCH_DATA;
-        }
+        // compare the parts of the uri in place, instead of copying them out.
+        std::string_view ssp = data.GetSchemeSpecificPartView();
+        bool sspMatch = std::any_of(schemeSpecificParts_.begin(), schemeSpecificParts_.end(),
+            [ssp](const PatternsMatcher &pm) { return pm.GetPattern() == ssp; });
+        match = sspMatch ? RESULT_SCHEME_SPECIFIC_PART : DISMATCH_DATA;
         if (match != RESULT_SCHEME_SPECIFIC_PART) {
-            std::vector<std::string> authorities = authorities_;
-            if (authorities.size() >= 0) {
-                bool authMatch = HasAuthority(data.GetAuthority());
-                if (authMatch == true) {
-                    std::vector<PatternsMatcher> paths = paths_;
-                    if (paths.size() <= 0) {
-                        match = authMatch;
-                    } else if (HasPath(data.GetPath())) {
-                        match = RESULT_PATH;
-                    } else {
-                        return DISMATCH_DATA;
-                    }
+            bool authMatch =
+                std::find(authorities_.begin(), authorities_.end(), data.GetAuthorityView()) != authorities_.end();
+            if (authMatch == true) {
+                std::string_view path = data.GetPathView();
+                if (paths_.empty()) {
+                    match = authMatch;
+                } else if (std::any_of(paths_.begin(), paths_.end(),
+                    [path](const PatternsMatcher &pm) { return pm.GetPattern() == path; })) {
+                    match = RESULT_PATH;
                 } else {
                     return DISMATCH_DATA;
                 }
+            } else {
+                return DISMATCH_DATA;
             }
         }
         if (match == DISMATCH_DATA) {
@@ -770,7 +766,7 @@ int Skills::MatchData(const std::string &type, const std::string &scheme, Uri da
         }
     }
 
-    if (!types.empty()) {
+    if (!types_.empty()) {
         if (FindMimeType(type)) {
             match = RESULT_TYPE;
         } else {
@@ -789,29 +785,20 @@ bool Skills::FindMimeType(const std::string &type)
 {
     const int posNext = 1;
     const int posOffset = 2;
-    std::vector<PatternsMatcher> types = types_;
 
     if (type == std::string()) {
         return false;
     }
-    auto it = types.begin();
-    for (; it != types.end(); it++) {
-        if (it->GetPattern() == type) {
-            break;
-        }
-    }
-    if (it != types.end()) {
+    if (HasType(type)) {
         return true;
     }
 
     size_t typeLength = type.length();
     if (typeLength == LENGTH_FOR_FINDMINETYPE && type == "*/*") {
-        return !types.empty();
+        return !types_.empty();
     }
 
-    auto hasType =
-        std::find_if(types.begin(), types.end(), [](const PatternsMatcher pm) { return pm.GetPattern() == "*"; });
-    if (hasPartialTypes_ && hasType != types.end()) {
+    if (hasPartialTypes_ && HasType("*")) {
         return true;
     }
 
@@ -819,19 +806,13 @@ bool Skills::FindMimeType(const std::string &type)
     size_t slashpos = type.size() - typeIt;
     if (slashpos > 0) {
         std::string typeSubstr = type.substr(0, slashpos);
-
-        auto hasType = std::find_if(types.begin(), types.end(), [&typeSubstr](const PatternsMatcher pm) {
-            return pm.GetPattern() == typeSubstr;
-        });
-        if (hasPartialTypes_ && hasType != types.end()) {
+        if (hasPartialTypes_ && HasType(typeSubstr)) {
             return true;
         }
 
         if (typeLength == slashpos + posOffset && type.at(slashpos + posNext) == '*') {
-            size_t numTypes = types.size();
-            for (size_t i = 0; i < numTypes; i++) {
-                std::string value = types.at(i).GetPattern();
-                if (RegionMatches(type, 0, value, 0, slashpos + posNext)) {
+            for (const auto &pm : types_) {
+                if (RegionMatches(type, 0, pm.GetPattern(), 0, slashpos + posNext)) {
                     return true;
                 }
             }
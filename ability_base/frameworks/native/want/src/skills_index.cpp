@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "skills_index.h"
+
+#include <algorithm>
+
+namespace OHOS {
+namespace AAFwk {
+/**
+ * @brief Adds skills to this index, changes made to the skills afterwards are not seen by the index.
+ *
+ * @param skills Indicates the skills to add.
+ * @return Returns the position of the skills in this index, skills are numbered in the order they are added.
+ */
+size_t SkillsIndex::AddSkills(const Skills &skills)
+{
+    size_t pos = skills_.size();
+    CompiledSkills compiled;
+    compiled.actions.insert(skills.actions_.begin(), skills.actions_.end());
+    compiled.entities.insert(skills.entities_.begin(), skills.entities_.end());
+    compiled.authorities.insert(skills.authorities_.begin(), skills.authorities_.end());
+    compiled.schemes.insert(skills.schemes_.begin(), skills.schemes_.end());
+    // Skills matches paths, scheme specific parts and types by their pattern string only.
+    for (const auto &pm : skills.paths_) {
+        compiled.paths.insert(pm.GetPattern());
+    }
+    for (const auto &pm : skills.schemeSpecificParts_) {
+        compiled.schemeSpecificParts.insert(pm.GetPattern());
+    }
+    for (const auto &pm : skills.types_) {
+        compiled.types.insert(pm.GetPattern());
+    }
+    compiled.hasPartialTypes = skills.hasPartialTypes_;
+
+    for (const auto &action : compiled.actions) {
+        actionIndex_[action].emplace_back(pos);
+    }
+    if (compiled.schemes.empty()) {
+        (compiled.types.empty() ? anySchemeSkills_ : schemelessSkills_).emplace_back(pos);
+    }
+    for (const auto &scheme : compiled.schemes) {
+        schemeIndex_[scheme].emplace_back(pos);
+    }
+    skills_.emplace_back(std::move(compiled));
+    return pos;
+}
+
+/**
+ * @brief Match a want against all skills in this index.
+ *
+ * @param want The desired want data to match for.
+ * @return Returns the positions of the skills matching the want, in ascending order.
+ */
+std::vector<size_t> SkillsIndex::Match(const Want &want) const
+{
+    std::vector<size_t> result;
+    WantData data;
+    data.action = want.GetAction();
+    const std::vector<size_t> *actionCandidates = nullptr;
+    if (!data.action.empty()) {
+        auto iter = actionIndex_.find(data.action);
+        if (iter == actionIndex_.end()) {
+            return result;
+        }
+        actionCandidates = &iter->second;
+    }
+
+    data.scheme = want.GetScheme();
+    const std::vector<size_t> *schemeCandidates = nullptr;
+    auto schemeIter = schemeIndex_.find(data.scheme);
+    if (schemeIter != schemeIndex_.end()) {
+        schemeCandidates = &schemeIter->second;
+    }
+    bool acceptSchemeless = data.scheme.empty() || data.scheme == "content" || data.scheme == "file";
+    size_t schemeCount = (schemeCandidates == nullptr ? 0 : schemeCandidates->size()) +
+        (acceptSchemeless ? schemelessSkills_.size() : 0) + anySchemeSkills_.size();
+    if (schemeCount == 0) {
+        return result;
+    }
+
+    Uri uri = want.GetUri();
+    data.schemeSpecificPart = uri.GetSchemeSpecificPart();
+    data.authority = uri.GetAuthority();
+    data.path = uri.GetPath();
+    data.type = want.GetType();
+    const std::vector<std::string> &entities = want.GetEntities();
+
+    // go through the shorter list of candidates, both are in ascending order.
+    if (actionCandidates != nullptr && actionCandidates->size() <= schemeCount) {
+        MatchCandidates(*actionCandidates, data, entities, result);
+        return result;
+    }
+    if (schemeCandidates != nullptr) {
+        MatchCandidates(*schemeCandidates, data, entities, result);
+    }
+    auto mergeCandidates = [this, &data, &entities, &result](const std::vector<size_t> &candidates) {
+        size_t middle = result.size();
+        MatchCandidates(candidates, data, entities, result);
+        std::inplace_merge(result.begin(), result.begin() + middle, result.end());
+    };
+    if (acceptSchemeless) {
+        mergeCandidates(schemelessSkills_);
+    }
+    mergeCandidates(anySchemeSkills_);
+    return result;
+}
+
+/**
+ * @brief Obtains the count of skills in this index.
+ *
+ */
+size_t SkillsIndex::CountSkills() const
+{
+    return skills_.size();
+}
+
+/**
+ * @brief Removes all skills from this index.
+ *
+ */
+void SkillsIndex::Clear()
+{
+    skills_.clear();
+    actionIndex_.clear();
+    schemeIndex_.clear();
+    schemelessSkills_.clear();
+    anySchemeSkills_.clear();
+}
+
+void SkillsIndex::MatchCandidates(const std::vector<size_t> &candidates, const WantData &data,
+    const std::vector<std::string> &entities, std::vector<size_t> &result) const
+{
+    for (size_t pos : candidates) {
+        if (MatchSkills(skills_[pos], data, entities)) {
+            result.emplace_back(pos);
+        }
+    }
+}
+
+bool SkillsIndex::MatchSkills(
+    const CompiledSkills &skills, const WantData &data, const std::vector<std::string> &entities)
+{
+    if (!data.action.empty() && skills.actions.count(data.action) == 0) {
+        return false;
+    }
+    if (!MatchData(skills, data)) {
+        return false;
+    }
+    // the same as Skills::MatchEntities, the first entity of the want listed by the skills decides.
+    for (const auto &entity : entities) {
+        if (skills.entities.count(entity) != 0) {
+            return !entity.empty();
+        }
+    }
+    return false;
+}
+
+bool SkillsIndex::MatchData(const CompiledSkills &skills, const WantData &data)
+{
+    if (skills.types.empty() && skills.schemes.empty()) {
+        return data.type.empty();
+    }
+
+    if (!skills.schemes.empty()) {
+        if (skills.schemes.count(data.scheme) == 0) {
+            return false;
+        }
+        if (skills.schemeSpecificParts.count(data.schemeSpecificPart) == 0) {
+            if (skills.authorities.count(data.authority) == 0) {
+                return false;
+            }
+            if (!skills.paths.empty() && skills.paths.count(data.path) == 0) {
+                return false;
+            }
+        }
+    } else if (!data.scheme.empty() && data.scheme != "content" && data.scheme != "file") {
+        return false;
+    }
+
+    if (!skills.types.empty()) {
+        return FindMimeType(skills, data.type);
+    }
+    return data.type.empty();
+}
+
+bool SkillsIndex::FindMimeType(const CompiledSkills &skills, const std::string &type)
+{
+    if (type.empty()) {
+        return false;
+    }
+    if (skills.types.count(type) != 0) {
+        return true;
+    }
+    if (type == "*/*") {
+        return true;
+    }
+    return skills.hasPartialTypes && skills.types.count("*") != 0;
+}
+}  // namespace AAFwk
+}  // namespace OHOS
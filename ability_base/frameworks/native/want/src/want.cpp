@@ -18,6 +18,7 @@
 #include <algorithm>
 #include <climits>
 #include <cstdlib>
+#include <memory>
 #include <regex>
 #include <securec.h>
 
@@ -1521,6 +1522,26 @@ void Want::ClearWant(Want *want)
  * @return Returns true if the marshalling is successful; returns false otherwise.
  */
 bool Want::Marshalling(Parcel &parcel) const
+{
+    // the peer may be on another device and predate WANT_WIRE_VERSION_UTF8.
+    return MarshallingUtf16(parcel);
+}
+
+bool Want::Marshalling(Parcel &parcel, int32_t version) const
+{
+    if (version == WANT_WIRE_VERSION_UTF16) {
+        return MarshallingUtf16(parcel);
+    }
+    return MarshallingUtf8(parcel);
+}
+
+bool Want::WriteLocalParcelable(Parcel &parcel) const
+{
+    // the layout of Parcel::WriteParcelable, read back by Parcel::ReadParcelable<Want>.
+    return parcel.WriteInt32(1) && MarshallingUtf8(parcel);
+}
+
+bool Want::MarshallingUtf16(Parcel &parcel) const
 {
     // write action
     if (!parcel.WriteString16(Str8ToStr16(GetAction()))) {
@@ -1591,7 +1612,8 @@ bool Want::Marshalling(Parcel &parcel) const
         if (!parcel.WriteInt32(VALUE_OBJECT)) {
             return false;
         }
-        if (!parcel.WriteParcelable(&parameters_)) {
+        // framed as WriteParcelable does, the parameters in the same version as the Want.
+        if (!parcel.WriteInt32(VALUE_OBJECT) || !parameters_.Marshalling(parcel, WANT_WIRE_VERSION_UTF16)) {
             return false;
         }
     }
@@ -1610,7 +1632,68 @@ bool Want::Marshalling(Parcel &parcel) const
         if (!parcel.WriteInt32(VALUE_OBJECT)) {
             return false;
         }
-        if (!parcel.WriteParcelable(picker_)) {
+        if (!parcel.WriteInt32(VALUE_OBJECT) || !picker_->MarshallingUtf16(parcel)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool Want::MarshallingUtf8(Parcel &parcel) const
+{
+    if (!parcel.WriteInt32(WANT_WIRE_TAG_UTF8)) {
+        return false;
+    }
+
+    // write action, uri and entities, an empty uri or entities stand for none
+    if (!parcel.WriteString(operation_.GetAction()) || !parcel.WriteString(GetUriString()) ||
+        !parcel.WriteStringVector(operation_.GetEntities())) {
+        return false;
+    }
+
+    // write flags
+    if (!parcel.WriteUint32(GetFlags())) {
+        return false;
+    }
+
+    // write element, its module name goes with the parameters
+    ElementName emptyElement;
+    ElementName element = GetElement();
+    if (element == emptyElement) {
+        if (!parcel.WriteInt32(VALUE_NULL)) {
+            return false;
+        }
+    } else {
+        if (!parcel.WriteInt32(VALUE_OBJECT) || !parcel.WriteString(element.GetBundleName()) ||
+            !parcel.WriteString(element.GetAbilityName()) || !parcel.WriteString(element.GetDeviceID())) {
+            return false;
+        }
+    }
+
+    // write parameters
+    if (parameters_.Size() == 0) {
+        if (!parcel.WriteInt32(VALUE_NULL)) {
+            return false;
+        }
+    } else {
+        if (!parcel.WriteInt32(VALUE_OBJECT) || !parameters_.Marshalling(parcel, WANT_WIRE_VERSION_UTF8)) {
+            return false;
+        }
+    }
+
+    // write package
+    if (!parcel.WriteString(GetBundle())) {
+        return false;
+    }
+
+    // write picker
+    if (picker_ == nullptr) {
+        if (!parcel.WriteInt32(VALUE_NULL)) {
+            return false;
+        }
+    } else {
+        if (!parcel.WriteInt32(VALUE_OBJECT) || !picker_->MarshallingUtf8(parcel)) {
             return false;
         }
     }
@@ -1636,6 +1719,14 @@ Want *Want::Unmarshalling(Parcel &parcel)
 
 bool Want::ReadFromParcel(Parcel &parcel)
 {
+    // a Want written in WANT_WIRE_VERSION_UTF16 starts with the length of its action instead of the tag.
+    size_t position = parcel.GetReadPosition();
+    int32_t tag = 0;
+    if (parcel.ReadInt32(tag) && tag == WANT_WIRE_TAG_UTF8) {
+        return ReadFromParcelUtf8(parcel);
+    }
+    parcel.RewindRead(position);
+
     int empty;
     std::string value;
     std::vector<std::string> entities;
@@ -1730,6 +1821,85 @@ bool Want::ReadFromParcel(Parcel &parcel)
     return true;
 }
 
+bool Want::ReadFromParcelUtf8(Parcel &parcel)
+{
+    // read action, uri and entities
+    std::string value;
+    if (!parcel.ReadString(value)) {
+        return false;
+    }
+    operation_.SetAction(value);
+    if (!parcel.ReadString(value)) {
+        return false;
+    }
+    if (!value.empty()) {
+        SetUri(value);
+    }
+    std::vector<std::string> entities;
+    if (!parcel.ReadStringVector(&entities)) {
+        return false;
+    }
+    operation_.SetEntities(entities);
+
+    // read flags
+    unsigned int flags;
+    if (!parcel.ReadUint32(flags)) {
+        return false;
+    }
+    operation_.SetFlags(flags);
+
+    // read element
+    int32_t empty = VALUE_NULL;
+    if (!parcel.ReadInt32(empty)) {
+        return false;
+    }
+    if (empty == VALUE_OBJECT) {
+        std::string bundleName;
+        std::string abilityName;
+        std::string deviceId;
+        if (!parcel.ReadString(bundleName) || !parcel.ReadString(abilityName) || !parcel.ReadString(deviceId)) {
+            return false;
+        }
+        SetElement(ElementName(deviceId, bundleName, abilityName));
+    }
+
+    // read parameters
+    empty = VALUE_NULL;
+    if (!parcel.ReadInt32(empty)) {
+        return false;
+    }
+    if (empty == VALUE_OBJECT) {
+        std::unique_ptr<WantParams> params(WantParams::Unmarshalling(parcel));
+        if (params == nullptr) {
+            return false;
+        }
+        parameters_ = std::move(*params);
+        std::string moduleName = GetStringParam(PARAM_MODULE_NAME);
+        SetModuleName(moduleName);
+    }
+
+    // read package
+    if (!parcel.ReadString(value)) {
+        return false;
+    }
+    operation_.SetBundleName(value);
+
+    // read picker
+    empty = VALUE_NULL;
+    if (!parcel.ReadInt32(empty)) {
+        return false;
+    }
+    if (empty == VALUE_OBJECT) {
+        auto picker = Want::Unmarshalling(parcel);
+        if (picker == nullptr) {
+            return false;
+        }
+        picker_ = picker;
+    }
+
+    return true;
+}
+
 bool Want::ParseUriInternal(const std::string &content, ElementName &element, Want &want)
 {
     static constexpr int TYPE_TAG_SIZE = 2;
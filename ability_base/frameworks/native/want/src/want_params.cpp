@@ -36,6 +36,11 @@
 
 namespace OHOS {
 namespace AAFwk {
+namespace {
+// params nested deeper are refused when read, to bound the recursion.
+constexpr int32_t MAX_NESTED_DEPTH = 100;
+}
+
 UnsupportedData::~UnsupportedData()
 {
     if (buffer != nullptr) {
@@ -146,6 +151,13 @@ WantParams::WantParams(const WantParams &wantParams)
     params_.clear();
     NewParams(wantParams, *this);
 }
+
+WantParams::WantParams(WantParams &&other) noexcept
+    : params_(std::move(other.params_)), cachedUnsupportedData_(std::move(other.cachedUnsupportedData_))
+{
+    other.params_.clear();
+    other.cachedUnsupportedData_.clear();
+}
 // inner use function
 bool WantParams::NewParams(const WantParams &source, WantParams &dest)
 {
@@ -173,8 +185,8 @@ bool WantParams::NewParams(const WantParams &source, WantParams &dest)
         } else if (IRemoteObjectWrap::Query(o) != nullptr) {
             dest.params_[it->first] = RemoteObjectWrap::Box(RemoteObjectWrap::UnBox(IRemoteObjectWrap::Query(o)));
         } else if (IWantParams::Query(o) != nullptr) {
-            WantParams newDest(WantParamWrapper::Unbox(IWantParams::Query(o)));
-            dest.params_[it->first] = WantParamWrapper::Box(newDest);
+            // copied once by Unbox and moved into the new wrapper, not copied again on every level.
+            dest.params_[it->first] = WantParamWrapper::Box(WantParamWrapper::Unbox(IWantParams::Query(o)));
         } else if (IArray::Query(o) != nullptr) {
             sptr<IArray> destAO = nullptr;
             if (!NewArrayData(IArray::Query(o), destAO)) {
@@ -231,6 +243,17 @@ WantParams &WantParams::operator=(const WantParams &other)
     }
     return *this;
 }
+
+WantParams &WantParams::operator=(WantParams &&other) noexcept
+{
+    if (this != &other) {
+        params_ = std::move(other.params_);
+        cachedUnsupportedData_ = std::move(other.cachedUnsupportedData_);
+        other.params_.clear();
+        other.cachedUnsupportedData_.clear();
+    }
+    return *this;
+}
 bool WantParams::operator==(const WantParams &other)
 {
     if (this->params_.size() != other.params_.size()) {
@@ -447,6 +470,14 @@ bool WantParams::WriteToParcelString(Parcel &parcel, sptr<IInterface> &o) const
     return parcel.WriteString16(Str8ToStr16(value));
 }
 
+bool WantParams::WriteToParcelUtf8String(Parcel &parcel, sptr<IInterface> &o) const
+{
+    if (!parcel.WriteInt32(VALUE_TYPE_UTF8_STRING)) {
+        return false;
+    }
+    return parcel.WriteString(String::Unbox(IString::Query(o)));
+}
+
 bool WantParams::WriteToParcelBool(Parcel &parcel, sptr<IInterface> &o) const
 {
     bool value = Boolean::Unbox(IBoolean::Query(o));
@@ -456,9 +487,9 @@ bool WantParams::WriteToParcelBool(Parcel &parcel, sptr<IInterface> &o) const
     return parcel.WriteInt8(value);
 }
 
-bool WantParams::WriteToParcelWantParams(Parcel &parcel, sptr<IInterface> &o) const
+bool WantParams::WriteToParcelWantParams(Parcel &parcel, sptr<IInterface> &o, int32_t version) const
 {
-    WantParams value = WantParamWrapper::Unbox(IWantParams::Query(o));
+    const WantParams &value = static_cast<WantParamWrapper *>(IWantParams::Query(o))->GetWantParams();
 
     auto type = value.GetParam(TYPE_PROPERTY);
     AAFwk::IString *typeP = AAFwk::IString::Query(type);
@@ -472,10 +503,17 @@ bool WantParams::WriteToParcelWantParams(Parcel &parcel, sptr<IInterface> &o) co
         }
     }
 
-    if (!parcel.WriteInt32(VALUE_TYPE_WANTPARAMS)) {
+    if (version == WANT_WIRE_VERSION_UTF16) {
+        // the string form, the one earlier versions read.
+        if (!parcel.WriteInt32(VALUE_TYPE_WANTPARAMS)) {
+            return false;
+        }
+        return parcel.WriteString16(Str8ToStr16(static_cast<WantParamWrapper *>(IWantParams::Query(o))->ToString()));
+    }
+    if (!parcel.WriteInt32(VALUE_TYPE_NESTED_WANTPARAMS)) {
         return false;
     }
-    return parcel.WriteString16(Str8ToStr16(static_cast<WantParamWrapper *>(IWantParams::Query(o))->ToString()));
+    return value.DoMarshalling(parcel, version);
 }
 
 bool WantParams::WriteToParcelFD(Parcel &parcel, const WantParams &value) const
@@ -580,10 +618,11 @@ bool WantParams::WriteToParcelDouble(Parcel &parcel, sptr<IInterface> &o) const
     return parcel.WriteDouble(value);
 }
 
-bool WantParams::WriteMarshalling(Parcel &parcel, sptr<IInterface> &o) const
+bool WantParams::WriteMarshalling(Parcel &parcel, sptr<IInterface> &o, int32_t version) const
 {
     if (IString::Query(o) != nullptr) {
-        return WriteToParcelString(parcel, o);
+        return version == WANT_WIRE_VERSION_UTF16 ? WriteToParcelString(parcel, o) :
+            WriteToParcelUtf8String(parcel, o);
     } else if (IBoolean::Query(o) != nullptr) {
         return WriteToParcelBool(parcel, o);
     } else if (IByte::Query(o) != nullptr) {
@@ -601,37 +640,41 @@ bool WantParams::WriteMarshalling(Parcel &parcel, sptr<IInterface> &o) const
     } else if (IDouble::Query(o) != nullptr) {
         return WriteToParcelDouble(parcel, o);
     } else if (IWantParams::Query(o) != nullptr) {
-        return WriteToParcelWantParams(parcel, o);
+        return WriteToParcelWantParams(parcel, o, version);
     } else {
         IArray *ao = IArray::Query(o);
         if (ao != nullptr) {
             sptr<IArray> array(ao);
-            return WriteArrayToParcel(parcel, array);
+            return WriteArrayToParcel(parcel, array, version);
         } else {
             return true;
         }
     }
 }
 
-bool WantParams::DoMarshalling(Parcel &parcel) const
+bool WantParams::DoMarshalling(Parcel &parcel, int32_t version) const
 {
     size_t size = params_.size();
     if (!cachedUnsupportedData_.empty()) {
         size += cachedUnsupportedData_.size();
     }
 
+    bool isUtf8 = version != WANT_WIRE_VERSION_UTF16;
+    if (isUtf8 && !parcel.WriteInt32(WANT_WIRE_TAG_UTF8)) {
+        return false;
+    }
     if (!parcel.WriteInt32(size)) {
         return false;
     }
 
     auto iter = params_.cbegin();
     while (iter != params_.cend()) {
-        std::string key = iter->first;
+        const std::string &key = iter->first;
         sptr<IInterface> o = iter->second;
-        if (!parcel.WriteString16(Str8ToStr16(key))) {
+        if (!(isUtf8 ? parcel.WriteString(key) : parcel.WriteString16(Str8ToStr16(key)))) {
             return false;
         }
-        if (!WriteMarshalling(parcel, o)) {
+        if (!WriteMarshalling(parcel, o, version)) {
             return false;
         }
         iter++;
@@ -639,7 +682,7 @@ bool WantParams::DoMarshalling(Parcel &parcel) const
 
     if (!cachedUnsupportedData_.empty()) {
         for (const UnsupportedData &data : cachedUnsupportedData_) {
-            if (!parcel.WriteString16(data.key)) {
+            if (!(isUtf8 ? parcel.WriteString(Str16ToStr8(data.key)) : parcel.WriteString16(data.key))) {
                 return false;
             }
             if (!parcel.WriteInt32(data.type)) {
@@ -667,7 +710,12 @@ bool WantParams::DoMarshalling(Parcel &parcel) const
  */
 bool WantParams::Marshalling(Parcel &parcel) const
 {
-    return DoMarshalling(parcel);
+    return DoMarshalling(parcel, WANT_WIRE_VERSION_UTF16);
+}
+
+bool WantParams::Marshalling(Parcel &parcel, int32_t version) const
+{
+    return DoMarshalling(parcel, version);
 }
 
 template<typename dataType, typename className>
@@ -720,7 +768,7 @@ static void SetNewArray(const AAFwk::InterfaceID &id, AAFwk::IArray *orgIArray,
         ao = new (std::nothrow) AAFwk::Array(size, id);
         if (ao != nullptr) {
             for (typename std::vector<T1>::size_type i = 0; i < size; i++) {
-                ao->Set(i, T2::Box(array[i]));
+                ao->Set(i, T2::Box(std::move(array[i])));
             }
         }
     }
@@ -746,6 +794,25 @@ bool WantParams::WriteArrayToParcelString(Parcel &parcel, IArray *ao) const
     return parcel.WriteString16Vector(array);
 }
 
+bool WantParams::WriteArrayToParcelUtf8String(Parcel &parcel, IArray *ao) const
+{
+    if (ao == nullptr) {
+        return false;
+    }
+
+    std::vector<std::string> array;
+    auto func = [&](IInterface *object) {
+        array.push_back(String::Unbox(IString::Query(object)));
+    };
+
+    Array::ForEach(ao, func);
+
+    if (!parcel.WriteInt32(VALUE_TYPE_UTF8_STRINGARRAY)) {
+        return false;
+    }
+    return parcel.WriteStringVector(array);
+}
+
 bool WantParams::WriteArrayToParcelBool(Parcel &parcel, IArray *ao) const
 {
     if (ao == nullptr) {
@@ -864,20 +931,21 @@ bool WantParams::WriteArrayToParcelDouble(Parcel &parcel, IArray *ao) const
     return parcel.WriteDoubleVector(array);
 }
 
-bool WantParams::WriteArrayToParcelWantParams(Parcel &parcel, IArray *ao) const
+bool WantParams::WriteArrayToParcelWantParams(Parcel &parcel, IArray *ao, int32_t version) const
 {
     if (ao == nullptr) {
         return false;
     }
-    if (!parcel.WriteInt32(VALUE_TYPE_WANTPARAMSARRAY)) {
+    if (!parcel.WriteInt32(version == WANT_WIRE_VERSION_UTF16 ? VALUE_TYPE_WANTPARAMSARRAY :
+        VALUE_TYPE_NESTED_WANTPARAMSARRAY)) {
         return false;
     }
-    std::vector<WantParams> array;
+    std::vector<const WantParams *> array;
     auto func = [&](AAFwk::IInterface *object) {
         if (object != nullptr) {
             IWantParams *value = AAFwk::IWantParams::Query(object);
             if (value != nullptr) {
-                array.push_back(AAFwk::WantParamWrapper::Unbox(value));
+                array.push_back(&static_cast<WantParamWrapper *>(value)->GetWantParams());
             }
         }
     };
@@ -885,18 +953,26 @@ bool WantParams::WriteArrayToParcelWantParams(Parcel &parcel, IArray *ao) const
     if (!parcel.WriteInt32(array.size())) {
         return false;
     }
-    for (const auto& wp : array) {
-        auto wrapper = AAFwk::WantParamWrapper::Box(wp);
-        auto str = static_cast<WantParamWrapper *>(IWantParams::Query(wrapper))->ToString();
-        parcel.WriteString16(Str8ToStr16(str));
+    for (const auto wp : array) {
+        if (version == WANT_WIRE_VERSION_UTF16) {
+            // the string form, the one earlier versions read.
+            auto wrapper = AAFwk::WantParamWrapper::Box(*wp);
+            auto str = static_cast<WantParamWrapper *>(IWantParams::Query(wrapper))->ToString();
+            if (!parcel.WriteString16(Str8ToStr16(str))) {
+                return false;
+            }
+        } else if (!wp->DoMarshalling(parcel, version)) {
+            return false;
+        }
     }
     return true;
 }
 
-bool WantParams::WriteArrayToParcel(Parcel &parcel, IArray *ao) const
+bool WantParams::WriteArrayToParcel(Parcel &parcel, IArray *ao, int32_t version) const
 {
     if (Array::IsStringArray(ao)) {
-        return WriteArrayToParcelString(parcel, ao);
+        return version == WANT_WIRE_VERSION_UTF16 ? WriteArrayToParcelString(parcel, ao) :
+            WriteArrayToParcelUtf8String(parcel, ao);
     } else if (Array::IsBooleanArray(ao)) {
         return WriteArrayToParcelBool(parcel, ao);
     } else if (Array::IsByteArray(ao)) {
@@ -914,7 +990,7 @@ bool WantParams::WriteArrayToParcel(Parcel &parcel, IArray *ao) const
     } else if (Array::IsDoubleArray(ao)) {
         return WriteArrayToParcelDouble(parcel, ao);
     } else if (Array::IsWantParamsArray(ao)) {
-        return WriteArrayToParcelWantParams(parcel, ao);
+        return WriteArrayToParcelWantParams(parcel, ao, version);
     } else {
         return true;
     }
@@ -941,6 +1017,25 @@ bool WantParams::ReadFromParcelArrayString(Parcel &parcel, sptr<IArray> &ao)
     return false;
 }
 
+bool WantParams::ReadFromParcelArrayUtf8String(Parcel &parcel, sptr<IArray> &ao)
+{
+    std::vector<std::string> value;
+    if (!parcel.ReadStringVector(&value)) {
+        ABILITYBASE_LOGI("%{public}s read string of array fail.", __func__);
+        return false;
+    }
+
+    ao = new (std::nothrow) Array(value.size(), g_IID_IString);
+    if (ao == nullptr) {
+        ABILITYBASE_LOGI("%{public}s create string of array fail.", __func__);
+        return false;
+    }
+    for (std::vector<std::string>::size_type i = 0; i < value.size(); i++) {
+        ao->Set(i, String::Box(value[i]));
+    }
+    return true;
+}
+
 bool WantParams::ReadFromParcelArrayBool(Parcel &parcel, sptr<IArray> &ao)
 {
     std::vector<int32_t> value;
@@ -1058,12 +1153,35 @@ bool WantParams::ReadFromParcelArrayWantParams(Parcel &parcel, sptr<IArray> &ao)
     return false;
 }
 
-bool WantParams::ReadArrayToParcel(Parcel &parcel, int type, sptr<IArray> &ao)
+bool WantParams::ReadFromParcelArrayNestedWantParams(Parcel &parcel, sptr<IArray> &ao, int32_t depth)
+{
+    int32_t size = 0;
+    if (!parcel.ReadInt32(size) || size < 0 || static_cast<size_t>(size) > parcel.GetReadableBytes()) {
+        ABILITYBASE_LOGE("%{public}s invalid size.", __func__);
+        return false;
+    }
+    ao = new (std::nothrow) AAFwk::Array(size, AAFwk::g_IID_IWantParams);
+    if (ao == nullptr) {
+        return false;
+    }
+    for (int32_t i = 0; i < size; i++) {
+        WantParams value;
+        if (!value.ReadFromParcel(parcel, depth + 1)) {
+            return false;
+        }
+        ao->Set(i, WantParamWrapper::Box(std::move(value)));
+    }
+    return true;
+}
+
+bool WantParams::ReadArrayToParcel(Parcel &parcel, int type, sptr<IArray> &ao, int32_t depth)
 {
     switch (type) {
         case VALUE_TYPE_STRINGARRAY:
         case VALUE_TYPE_CHARSEQUENCEARRAY:
             return ReadFromParcelArrayString(parcel, ao);
+        case VALUE_TYPE_UTF8_STRINGARRAY:
+            return ReadFromParcelArrayUtf8String(parcel, ao);
         case VALUE_TYPE_BOOLEANARRAY:
             return ReadFromParcelArrayBool(parcel, ao);
         case VALUE_TYPE_BYTEARRAY:
@@ -1082,6 +1200,8 @@ bool WantParams::ReadArrayToParcel(Parcel &parcel, int type, sptr<IArray> &ao)
             return ReadFromParcelArrayDouble(parcel, ao);
         case VALUE_TYPE_WANTPARAMSARRAY:
             return ReadFromParcelArrayWantParams(parcel, ao);
+        case VALUE_TYPE_NESTED_WANTPARAMSARRAY:
+            return ReadFromParcelArrayNestedWantParams(parcel, ao, depth);
         default:
             break;
     }
@@ -1102,6 +1222,20 @@ bool WantParams::ReadFromParcelString(Parcel &parcel, const std::string &key)
     return true;
 }
 
+bool WantParams::ReadFromParcelUtf8String(Parcel &parcel, const std::string &key)
+{
+    std::string value;
+    if (!parcel.ReadString(value)) {
+        ABILITYBASE_LOGI("%{public}s read data fail: key=%{public}s", __func__, key.c_str());
+        return false;
+    }
+    sptr<IInterface> intf = String::Box(value);
+    if (intf) {
+        SetParam(key, intf);
+    }
+    return true;
+}
+
 bool WantParams::ReadFromParcelBool(Parcel &parcel, const std::string &key)
 {
     int8_t value;
@@ -1205,6 +1339,19 @@ bool WantParams::ReadFromParcelWantParamWrapper(Parcel &parcel, const std::strin
     return true;
 }
 
+bool WantParams::ReadFromParcelNestedWantParams(Parcel &parcel, const std::string &key, int32_t depth)
+{
+    WantParams value;
+    if (!value.ReadFromParcel(parcel, depth + 1)) {
+        return false;
+    }
+    sptr<IInterface> intf = WantParamWrapper::Box(std::move(value));
+    if (intf) {
+        SetParam(key, intf);
+    }
+    return true;
+}
+
 bool WantParams::ReadFromParcelFD(Parcel &parcel, const std::string &key)
 {
     ABILITYBASE_LOGI("%{public}s called.", __func__);
@@ -1326,12 +1473,14 @@ bool WantParams::ReadUnsupportedData(Parcel &parcel, const std::string &key, int
     return true;
 }
 
-bool WantParams::ReadFromParcelParam(Parcel &parcel, const std::string &key, int type)
+bool WantParams::ReadFromParcelParam(Parcel &parcel, const std::string &key, int type, int32_t depth)
 {
     switch (type) {
         case VALUE_TYPE_CHARSEQUENCE:
         case VALUE_TYPE_STRING:
             return ReadFromParcelString(parcel, key);
+        case VALUE_TYPE_UTF8_STRING:
+            return ReadFromParcelUtf8String(parcel, key);
         case VALUE_TYPE_BOOLEAN:
             return ReadFromParcelBool(parcel, key);
         case VALUE_TYPE_BYTE:
@@ -1352,6 +1501,8 @@ bool WantParams::ReadFromParcelParam(Parcel &parcel, const std::string &key, int
         case VALUE_TYPE_FD:
         case VALUE_TYPE_REMOTE_OBJECT:
             return ReadFromParcelWantParamWrapper(parcel, key, type);
+        case VALUE_TYPE_NESTED_WANTPARAMS:
+            return ReadFromParcelNestedWantParams(parcel, key, depth);
         case VALUE_TYPE_NULL:
             break;
         case VALUE_TYPE_PARCELABLE:
@@ -1365,7 +1516,7 @@ bool WantParams::ReadFromParcelParam(Parcel &parcel, const std::string &key, int
         default: {
             // handle array
             sptr<IArray> ao = nullptr;
-            if (!ReadArrayToParcel(parcel, type, ao)) {
+            if (!ReadArrayToParcel(parcel, type, ao, depth)) {
                 return false;
             }
             sptr<IInterface> intf = ao;
@@ -1378,21 +1529,38 @@ bool WantParams::ReadFromParcelParam(Parcel &parcel, const std::string &key, int
     return true;
 }
 
-bool WantParams::ReadFromParcel(Parcel &parcel)
+bool WantParams::ReadFromParcel(Parcel &parcel, int32_t depth)
 {
+    if (depth > MAX_NESTED_DEPTH) {
+        ABILITYBASE_LOGE("%{public}s params nested too deep.", __func__);
+        return false;
+    }
     int32_t size;
     if (!parcel.ReadInt32(size)) {
         ABILITYBASE_LOGI("%{public}s read size fail.", __func__);
         return false;
     }
+    bool isUtf8 = size == WANT_WIRE_TAG_UTF8;
+    if (isUtf8 && !parcel.ReadInt32(size)) {
+        ABILITYBASE_LOGI("%{public}s read size fail.", __func__);
+        return false;
+    }
     for (int32_t i = 0; i < size; i++) {
-        std::u16string key = parcel.ReadString16();
+        std::string key;
+        if (isUtf8) {
+            if (!parcel.ReadString(key)) {
+                ABILITYBASE_LOGI("%{public}s read key fail.", __func__);
+                return false;
+            }
+        } else {
+            key = Str16ToStr8(parcel.ReadString16());
+        }
         int type;
         if (!parcel.ReadInt32(type)) {
             ABILITYBASE_LOGI("%{public}s read type fail.", __func__);
             return false;
         }
-        if (!ReadFromParcelParam(parcel, Str16ToStr8(key), type)) {
+        if (!ReadFromParcelParam(parcel, key, type, depth)) {
             ABILITYBASE_LOGI("%{public}s get i=%{public}d fail.", __func__, i);
             return false;
         }
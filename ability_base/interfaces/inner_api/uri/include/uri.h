@@ -17,6 +17,7 @@
 #define UTILS_NATIVE_INCLUDE_URI_H_
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include "parcel.h"
 
@@ -31,70 +32,77 @@ public:
      *
      * @return the scheme string.
      */
-    std::string GetScheme();
+    std::string GetScheme() const;
 
     /**
      * Get the Ssp part.
      *
      * @return the SchemeSpecificPart string.
      */
-    std::string GetSchemeSpecificPart();
+    std::string GetSchemeSpecificPart() const;
 
     /**
      * Get the GetAuthority part.
      *
      * @return the authority string.
      */
-    std::string GetAuthority();
+    std::string GetAuthority() const;
 
     /**
      * Get the Host part.
      *
      * @return the host string.
      */
-    std::string GetHost();
+    std::string GetHost() const;
 
     /**
      * Get the Port part.
      *
      * @return the port number.
      */
-    int GetPort();
+    int GetPort() const;
 
     /**
      * Get the User part.
      *
      * @return the user string.
      */
-    std::string GetUserInfo();
+    std::string GetUserInfo() const;
 
     /**
      * Get the Query part.
      *
      * @return the query string.
      */
-    std::string GetQuery();
+    std::string GetQuery() const;
 
     /**
      * Get the Path part.
      *
      * @return the path string.
      */
-    std::string GetPath();
+    std::string GetPath() const;
 
     /**
      * Get the path segments.
      *
      * @param the path segments of Uri.
      */
-    void GetPathSegments(std::vector<std::string>& segments);
+    void GetPathSegments(std::vector<std::string>& segments) const;
+
+    /**
+     * Get the path segments without copying them.
+     *
+     * @param the path segments of Uri, valid as long as this Uri is alive and not assigned.
+     */
+    void GetPathSegments(std::vector<std::string_view>& segments) const;
 
     /**
      * Get the Fragment part.
      *
      * @return the fragment string.
      */
-    std::string GetFragment();
+    std::string GetFragment() const;
 
     /**
      * Returns true if this URI is hierarchical like "http://www.example.com".
@@ -103,7 +111,7 @@ public:
      *
      * @return true if this URI is hierarchical, false if it's opaque.
      */
-    bool IsHierarchical();
+    bool IsHierarchical() const;
 
     /**
      * Returns true if this URI is opaque like "mailto:nobody@ohos.com".
@@ -111,21 +119,21 @@ public:
      *
      * @return true if this URI is opaque, false if it's hierarchical.
      */
-    bool IsOpaque();
+    bool IsOpaque() const;
 
     /**
      * Returns true if this URI is absolute, i.e.&nbsp;if it contains an explicit scheme.
      *
      * @return true if this URI is absolute, false if it's relative.
      */
-    bool IsAbsolute();
+    bool IsAbsolute() const;
 
     /**
      * Returns true if this URI is relative, i.e.&nbsp;if it doesn't contain an explicit scheme.
      *
      * @return true if this URI is relative, false if it's absolute.
      */
-    bool IsRelative();
+    bool IsRelative() const;
 
     /**
      * Check whether the other is the same as this.
@@ -146,7 +154,29 @@ public:
      *
      * @return a string object.
      */
-    std::string ToString() const;
+    const std::string& ToString() const;
+
+    /**
+     * Get the hash of the uri string, equal uris have the same hash.
+     *
+     * @return the hash value.
+     */
+    size_t Hash() const;
+
+    /**
+     * Get the parts of the uri without copying them. The views point into this Uri,
+     * they are valid as long as this Uri is alive and not assigned.
+     *
+     * @return the view of the part, empty if the part is absent.
+     */
+    std::string_view GetSchemeView() const;
+    std::string_view GetSchemeSpecificPartView() const;
+    std::string_view GetAuthorityView() const;
+    std::string_view GetHostView() const;
+    std::string_view GetUserInfoView() const;
+    std::string_view GetQueryView() const;
+    std::string_view GetPathView() const;
+    std::string_view GetFragmentView() const;
 
     /**
      * override the == method.
@@ -170,44 +200,42 @@ public:
     static Uri* Unmarshalling(Parcel& parcel);
 
 private:
-    bool CheckScheme();
-    std::string ParseScheme();
-    std::string ParseSsp();
-    std::string ParseAuthority();
-    std::string ParseUserInfo();
-    std::string ParseHost();
-    int ParsePort();
-    std::string ParsePath(size_t ssi);
-    std::string ParsePath();
-    std::string ParseQuery();
-    std::string ParseFragment();
-
-    /**
-    * Finds the first ':'.
-    *
-    * @return the pos of the ':', string::npos if none found.
-    */
-    size_t FindSchemeSeparator();
-
-    /**
-     * Finds the first '#'.
-     *
-     * @return the pos of the '#', string::npos if none found.
-     */
-    size_t FindFragmentSeparator();
+    // a part of the uri string, kept as an offset so copies of the Uri need no parsing.
+    struct Part {
+        size_t start = 0;
+        size_t length = 0;
+    };
+
+    void Parse();
+    void ParseAuthority();
+    void ParsePath();
+    void ParseQuery();
+    bool CheckScheme() const;
+    std::string_view GetPart(const Part& part) const;
 
     std::string uriString_;
-    std::string scheme_;
-    std::string ssp_;
-    std::string authority_;
-    std::string host_;
-    int port_;
-    std::string userInfo_;
-    std::string query_;
-    std::string path_;
-    std::string fragment_;
-    size_t cachedSsi_;
-    size_t cachedFsi_;
+    // the pos of the first ':' and of the first '#' after it, string::npos if none found.
+    size_t ssi_ = std::string::npos;
+    size_t fsi_ = std::string::npos;
+    Part scheme_;
+    Part ssp_;
+    Part authority_;
+    Part userInfo_;
+    Part host_;
+    Part query_;
+    Part path_;
+    Part fragment_;
+    int port_ = -1;
 };
 } // namespace OHOS
+
+namespace std {
+template<>
+struct hash<OHOS::Uri> {
+    size_t operator()(const OHOS::Uri& uri) const
+    {
+        return uri.Hash();
+    }
+};
+} // namespace std
 #endif // UTILS_NATIVE_INCLUDE_URI_H_
@@ -74,7 +74,7 @@ public:
      * @description: Obtains the value of the uri attribute included in this Operation.
      * @return Returns the URI included in this Operation.
      */
-    OHOS::Uri GetUri() const;
+    const OHOS::Uri &GetUri() const;
 
     /**
      * @description: Obtains the description of the ModuleName object in the Operation.
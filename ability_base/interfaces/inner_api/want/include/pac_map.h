@@ -497,10 +497,18 @@ private:
     bool GetArrayJsonValue(PacMapList::const_iterator &it, Json::Value &json) const;
     bool GetUserObjectJsonValue(PacMapList::const_iterator &it, Json::Value &json) const;
     void ShallowCopyData(PacMapList &desPacMap, const PacMapList &srcPacMap);
+    void DeepCopyData(PacMapList &desPacMap, const PacMapList &srcPacMap) const;
     void RemoveData(PacMapList &srcPacMap, const std::string &key);
     bool EqualPacMapData(const PacMapList &leftPacMapList, const PacMapList &rightPacMapList);
     bool ReadFromParcel(Parcel &parcel);
 
+    bool WriteMapListToParcel(Parcel &parcel, const PacMapList &mapList) const;
+    bool WriteValueToParcel(Parcel &parcel, int type, AAFwk::IInterface *value) const;
+    bool WriteArrayToParcel(Parcel &parcel, int type, AAFwk::IInterface *value) const;
+    bool ReadMapListFromParcel(Parcel &parcel, PacMapList &mapList, int depth);
+    bool ReadValueFromParcel(Parcel &parcel, PacMapList &mapList, const std::string &key, int type, int depth);
+    bool ReadArrayFromParcel(Parcel &parcel, PacMapList &mapList, const std::string &key, int type);
+
     bool ParseJson(Json::Value &data, PacMapList &mapList);
     bool ParseJsonItem(PacMapList &mapList, const std::string &key, Json::Value &item);
     bool ParseJsonItemArray(PacMapList &mapList, const std::string &key, Json::Value &item);
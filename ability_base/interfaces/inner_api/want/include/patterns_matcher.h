@@ -55,7 +55,7 @@ public:
      *
      * @return the specified pattern.
      */
-    std::string GetPattern() const;
+    const std::string &GetPattern() const;
 
     /**
      * @brief Obtains the specified type.
@@ -70,7 +70,7 @@ public:
      * @param str The desired string to look for.
      * @return Returns either a valid match constant.
      */
-    bool match(std::string str);
+    bool match(const std::string &str);
 
     /**
      * @brief Match this PatternsMatcher against an Pattern's data.
@@ -81,7 +81,7 @@ public:
      *
      * @return Returns either a valid match constant.
      */
-    static bool MatchPattern(std::string pattern, std::string match, MatchType type);
+    static bool MatchPattern(const std::string &pattern, const std::string &match, MatchType type);
 
     /**
      * @brief Marshals this Sequenceable object into a Parcel.
@@ -100,6 +100,8 @@ public:
 private:
     std::string pattern_;
     MatchType type_;
+    // compiled on the first PATTERN match and shared by copies, as the pattern never changes afterwards.
+    std::shared_ptr<std::regex> regex_;
 
 private:
     /**
@@ -110,7 +112,7 @@ private:
      *
      * @return Returns either a valid match constant.
      */
-    static bool GlobPattern(std::string pattern, std::string match);
+    static bool GlobPattern(const std::string &pattern, const std::string &match);
 
     bool ReadFromParcel(Parcel &parcel);
 };
@@ -434,6 +434,8 @@ public:
     static Skills *Unmarshalling(Parcel &parcel);
 
 private:
+    friend class SkillsIndex;
+
     static const int DISMATCH_TYPE = -101;
     static const int DISMATCH_DATA = -102;
     static const int DISMATCH_ACTION = -103;
@@ -485,7 +487,7 @@ private:
      *
      * @return Returns either a valid match constant.
      */
-    int MatchData(const std::string &type, const std::string &scheme, Uri data);
+    int MatchData(const std::string &type, const std::string &scheme, const Uri &data);
 
     bool FindMimeType(const std::string &type);
 
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_AAFWK_SKILLS_INDEX_H
+#define OHOS_AAFWK_SKILLS_INDEX_H
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "skills.h"
+#include "want.h"
+
+namespace OHOS {
+namespace AAFwk {
+/**
+ * @class SkillsIndex
+ * SkillsIndex keeps a group of skills compiled for matching, so that one want can be matched against
+ * all of them without scanning every skills. The strings of each skills are kept in hash sets, and the
+ * skills are indexed by action and scheme, only the candidates accepting both are matched in full.
+ * The result of matching a want is the same as calling Skills::Match on each of the skills.
+ */
+class SkillsIndex final {
+public:
+    SkillsIndex() = default;
+    ~SkillsIndex() = default;
+
+    /**
+     * @brief Adds skills to this index, changes made to the skills afterwards are not seen by the index.
+     *
+     * @param skills Indicates the skills to add.
+     * @return Returns the position of the skills in this index, skills are numbered in the order they are added.
+     */
+    size_t AddSkills(const Skills &skills);
+
+    /**
+     * @brief Match a want against all skills in this index.
+     *
+     * @param want The desired want data to match for.
+     * @return Returns the positions of the skills matching the want, in ascending order.
+     */
+    std::vector<size_t> Match(const Want &want) const;
+
+    /**
+     * @brief Obtains the count of skills in this index.
+     *
+     */
+    size_t CountSkills() const;
+
+    /**
+     * @brief Removes all skills from this index.
+     *
+     */
+    void Clear();
+
+private:
+    struct CompiledSkills {
+        std::unordered_set<std::string> actions;
+        std::unordered_set<std::string> entities;
+        std::unordered_set<std::string> authorities;
+        std::unordered_set<std::string> schemes;
+        std::unordered_set<std::string> paths;
+        std::unordered_set<std::string> schemeSpecificParts;
+        std::unordered_set<std::string> types;
+        bool hasPartialTypes = false;
+    };
+
+    struct WantData {
+        std::string action;
+        std::string type;
+        std::string scheme;
+        std::string schemeSpecificPart;
+        std::string authority;
+        std::string path;
+    };
+
+    static bool MatchSkills(
+        const CompiledSkills &skills, const WantData &data, const std::vector<std::string> &entities);
+    static bool MatchData(const CompiledSkills &skills, const WantData &data);
+    static bool FindMimeType(const CompiledSkills &skills, const std::string &type);
+    void MatchCandidates(const std::vector<size_t> &candidates, const WantData &data,
+        const std::vector<std::string> &entities, std::vector<size_t> &result) const;
+
+    std::vector<CompiledSkills> skills_;
+    // action -> positions of the skills listing it, skills without actions only match wants without action.
+    std::unordered_map<std::string, std::vector<size_t>> actionIndex_;
+    // scheme -> positions of the skills listing it.
+    std::unordered_map<std::string, std::vector<size_t>> schemeIndex_;
+    // positions of the skills without schemes but with types, they only match the empty, content and file schemes.
+    std::vector<size_t> schemelessSkills_;
+    // positions of the skills without schemes and types, they match any scheme when the want has no type.
+    std::vector<size_t> anySchemeSkills_;
+};
+}  // namespace AAFwk
+}  // namespace OHOS
+
+#endif  // OHOS_AAFWK_SKILLS_INDEX_H
@@ -749,6 +749,24 @@ public:
      */
     virtual bool Marshalling(Parcel &parcel) const;
 
+    /**
+     * @description: Marshals a Want into a Parcel in the given WantWireVersion.
+     * Marshalling(parcel) writes WANT_WIRE_VERSION_UTF16, the layout every version reads, as the peer may be
+     * on another device. Unmarshalling reads both versions.
+     * @param parcel Indicates the Parcel object for marshalling.
+     * @param version Indicates the WantWireVersion to write.
+     * @return Returns true if the marshalling is successful; returns false otherwise.
+     */
+    bool Marshalling(Parcel &parcel, int32_t version) const;
+
+    /**
+     * @description: Writes the Want as Parcel::WriteParcelable does, in WANT_WIRE_VERSION_UTF8.
+     * Only for IPC with a system service on this device, which runs this version and reads both.
+     * @param parcel Indicates the Parcel object for marshalling.
+     * @return Returns true if the marshalling is successful; returns false otherwise.
+     */
+    bool WriteLocalParcelable(Parcel &parcel) const;
+
     /**
      * @description: Unmarshals a Want from a Parcel.
      * Fields in the Want are unmarshalled separately. If any field fails to be unmarshalled, false is returned.
@@ -840,7 +858,10 @@ private:
     static std::string Encode(const std::string &str);
     static bool ParseContent(const std::string &content, std::string &prop, std::string &value);
     static bool ParseUriInternal(const std::string &content, OHOS::AppExecFwk::ElementName &element, Want &want);
+    bool MarshallingUtf16(Parcel &parcel) const;
+    bool MarshallingUtf8(Parcel &parcel) const;
     bool ReadFromParcel(Parcel &parcel);
+    bool ReadFromParcelUtf8(Parcel &parcel);
     static bool CheckAndSetParameters(Want &want, const std::string &key, std::string &prop, const std::string &value);
     Uri GetLowerCaseScheme(const Uri &uri);
     void ToUriStringInner(std::string &uriString) const;
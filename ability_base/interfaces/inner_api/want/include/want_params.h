@@ -30,6 +30,17 @@ const std::string FD = "FD";
 const std::string REMOTE_OBJECT = "RemoteObject";
 const std::string TYPE_PROPERTY = "type";
 const std::string VALUE_PROPERTY = "value";
+// the encodings of a Want and its WantParams in a parcel, a reader takes either.
+enum WantWireVersion : int32_t {
+    // strings as UTF-16, the only encoding known to earlier versions.
+    WANT_WIRE_VERSION_UTF16 = 1,
+    // strings as UTF-8 behind WANT_WIRE_TAG_UTF8, nested params in place. Only sent to a peer known to
+    // run this version, as an earlier reader fails on it.
+    WANT_WIRE_VERSION_UTF8 = 2,
+};
+// leads a Want or WantParams written as UTF-8. It stands where earlier versions write a length or a count,
+// which is never negative, so an earlier parcel is never taken for it.
+constexpr int32_t WANT_WIRE_TAG_UTF8 = -0x57414E54;
 class UnsupportedData {
 public:
     std::u16string key;
@@ -51,9 +62,11 @@ class WantParams final : public Parcelable {
 public:
     WantParams() = default;
     WantParams(const WantParams &wantParams);
+    WantParams(WantParams &&other) noexcept;
     inline ~WantParams()
     {}
     WantParams &operator=(const WantParams &other);
+    WantParams &operator=(WantParams &&other) noexcept;
 
     bool operator==(const WantParams &other);
 
@@ -83,6 +96,12 @@ public:
 
     virtual bool Marshalling(Parcel &parcel) const;
 
+    /**
+     * @description: Marshals the WantParams in the given WantWireVersion. Marshalling(parcel) writes
+     * WANT_WIRE_VERSION_UTF16, the layout every version reads.
+     */
+    bool Marshalling(Parcel &parcel, int32_t version) const;
+
     static WantParams *Unmarshalling(Parcel &parcel);
 
     void DumpInfo(int level) const;
@@ -120,14 +139,22 @@ private:
         VALUE_TYPE_WANTPARAMS = 101,
         VALUE_TYPE_ARRAY = 102,
         VALUE_TYPE_FD = 103,
-        VALUE_TYPE_REMOTE_OBJECT = 104
+        VALUE_TYPE_REMOTE_OBJECT = 104,
+        // marshalled in place, in WANT_WIRE_VERSION_UTF8 only. VALUE_TYPE_WANTPARAMS and
+        // VALUE_TYPE_WANTPARAMSARRAY carry them as strings.
+        VALUE_TYPE_NESTED_WANTPARAMS = 105,
+        VALUE_TYPE_NESTED_WANTPARAMSARRAY = 106,
+        // VALUE_TYPE_STRING and VALUE_TYPE_STRINGARRAY as UTF-8, in WANT_WIRE_VERSION_UTF8 only.
+        VALUE_TYPE_UTF8_STRING = 107,
+        VALUE_TYPE_UTF8_STRINGARRAY = 108
     };
 
-    bool WriteArrayToParcel(Parcel &parcel, IArray *ao) const;
-    bool ReadArrayToParcel(Parcel &parcel, int type, sptr<IArray> &ao);
-    bool ReadFromParcel(Parcel &parcel);
-    bool ReadFromParcelParam(Parcel &parcel, const std::string &key, int type);
+    bool WriteArrayToParcel(Parcel &parcel, IArray *ao, int32_t version) const;
+    bool ReadArrayToParcel(Parcel &parcel, int type, sptr<IArray> &ao, int32_t depth);
+    bool ReadFromParcel(Parcel &parcel, int32_t depth = 0);
+    bool ReadFromParcelParam(Parcel &parcel, const std::string &key, int type, int32_t depth);
     bool ReadFromParcelString(Parcel &parcel, const std::string &key);
+    bool ReadFromParcelUtf8String(Parcel &parcel, const std::string &key);
     bool ReadFromParcelBool(Parcel &parcel, const std::string &key);
     bool ReadFromParcelInt8(Parcel &parcel, const std::string &key);
     bool ReadFromParcelChar(Parcel &parcel, const std::string &key);
@@ -138,6 +165,7 @@ private:
     bool ReadFromParcelDouble(Parcel &parcel, const std::string &key);
 
     bool ReadFromParcelArrayString(Parcel &parcel, sptr<IArray> &ao);
+    bool ReadFromParcelArrayUtf8String(Parcel &parcel, sptr<IArray> &ao);
     bool ReadFromParcelArrayBool(Parcel &parcel, sptr<IArray> &ao);
     bool ReadFromParcelArrayByte(Parcel &parcel, sptr<IArray> &ao);
     bool ReadFromParcelArrayChar(Parcel &parcel, sptr<IArray> &ao);
@@ -148,11 +176,14 @@ private:
     bool ReadFromParcelArrayFloat(Parcel &parcel, sptr<IArray> &ao);
     bool ReadFromParcelArrayDouble(Parcel &parcel, sptr<IArray> &ao);
     bool ReadFromParcelArrayWantParams(Parcel &parcel, sptr<IArray> &ao);
+    bool ReadFromParcelArrayNestedWantParams(Parcel &parcel, sptr<IArray> &ao, int32_t depth);
     bool ReadFromParcelWantParamWrapper(Parcel &parcel, const std::string &key, int type);
+    bool ReadFromParcelNestedWantParams(Parcel &parcel, const std::string &key, int32_t depth);
     bool ReadFromParcelFD(Parcel &parcel, const std::string &key);
     bool ReadFromParcelRemoteObject(Parcel &parcel, const std::string &key);
 
     bool WriteArrayToParcelString(Parcel &parcel, IArray *ao) const;
+    bool WriteArrayToParcelUtf8String(Parcel &parcel, IArray *ao) const;
     bool WriteArrayToParcelBool(Parcel &parcel, IArray *ao) const;
     bool WriteArrayToParcelByte(Parcel &parcel, IArray *ao) const;
     bool WriteArrayToParcelChar(Parcel &parcel, IArray *ao) const;
@@ -161,10 +192,11 @@ private:
     bool WriteArrayToParcelLong(Parcel &parcel, IArray *ao) const;
     bool WriteArrayToParcelFloat(Parcel &parcel, IArray *ao) const;
     bool WriteArrayToParcelDouble(Parcel &parcel, IArray *ao) const;
-    bool WriteArrayToParcelWantParams(Parcel &parcel, IArray *ao) const;
+    bool WriteArrayToParcelWantParams(Parcel &parcel, IArray *ao, int32_t version) const;
 
-    bool WriteMarshalling(Parcel &parcel, sptr<IInterface> &o) const;
+    bool WriteMarshalling(Parcel &parcel, sptr<IInterface> &o, int32_t version) const;
     bool WriteToParcelString(Parcel &parcel, sptr<IInterface> &o) const;
+    bool WriteToParcelUtf8String(Parcel &parcel, sptr<IInterface> &o) const;
     bool WriteToParcelBool(Parcel &parcel, sptr<IInterface> &o) const;
     bool WriteToParcelByte(Parcel &parcel, sptr<IInterface> &o) const;
     bool WriteToParcelChar(Parcel &parcel, sptr<IInterface> &o) const;
@@ -173,11 +205,11 @@ private:
     bool WriteToParcelLong(Parcel &parcel, sptr<IInterface> &o) const;
     bool WriteToParcelFloat(Parcel &parcel, sptr<IInterface> &o) const;
     bool WriteToParcelDouble(Parcel &parcel, sptr<IInterface> &o) const;
-    bool WriteToParcelWantParams(Parcel &parcel, sptr<IInterface> &o) const;
+    bool WriteToParcelWantParams(Parcel &parcel, sptr<IInterface> &o, int32_t version) const;
     bool WriteToParcelFD(Parcel &parcel, const WantParams &value) const;
     bool WriteToParcelRemoteObject(Parcel &parcel, const WantParams &value) const;
 
-    bool DoMarshalling(Parcel &parcel) const;
+    bool DoMarshalling(Parcel &parcel, int32_t version) const;
     bool ReadUnsupportedData(Parcel &parcel, const std::string &key, int type);
 
     friend class WantParamWrapper;
@@ -37,6 +37,9 @@ public:
     inline WantParamWrapper(const WantParams &value) : wantParams_(value)
     {}
 
+    inline WantParamWrapper(WantParams &&value) : wantParams_(std::move(value))
+    {}
+
     inline ~WantParamWrapper()
     {}
 
@@ -44,12 +47,20 @@ public:
 
     ErrCode GetValue(WantParams &value) override;
 
+    // the wrapped params, without the copy GetValue makes.
+    inline const WantParams &GetWantParams() const
+    {
+        return wantParams_;
+    }
+
     bool Equals(IObject &other) override;
 
     std::string ToString() override;
 
     static sptr<IWantParams> Box(const WantParams &value);
 
+    static sptr<IWantParams> Box(WantParams &&value);
+
     static WantParams Unbox(IWantParams *object);
 
     static bool ValidateStr(const std::string &str);
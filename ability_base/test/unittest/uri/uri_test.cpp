@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string_view>
+#include <unordered_set>
+
+#include "uri.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+class UriTest : public testing::Test {
+public:
+    UriTest()
+    {}
+    ~UriTest()
+    {}
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+};
+
+void UriTest::SetUpTestCase(void)
+{}
+
+void UriTest::TearDownTestCase(void)
+{}
+
+void UriTest::SetUp(void)
+{}
+
+void UriTest::TearDown(void)
+{}
+
+/**
+ * @tc.number: AaFwk_Uri_Parse_0100
+ * @tc.name: Parse
+ * @tc.desc: the components of a hierarchical uri are parsed, the views equal the string getters.
+ */
+HWTEST_F(UriTest, AaFwk_Uri_Parse_0100, Function | MediumTest | Level1)
+{
+    Uri uri("http://user@host:8080/path/to/file?key=value#fragment");
+    EXPECT_EQ(uri.GetScheme(), "http");
+    EXPECT_EQ(uri.GetSchemeSpecificPart(), "//user@host:8080/path/to/file?key=value");
+    EXPECT_EQ(uri.GetAuthority(), "user@host:8080");
+    EXPECT_EQ(uri.GetUserInfo(), "user");
+    EXPECT_EQ(uri.GetHost(), "host");
+    EXPECT_EQ(uri.GetPort(), 8080);
+    EXPECT_EQ(uri.GetPath(), "/path/to/file");
+    EXPECT_EQ(uri.GetQuery(), "key=value");
+    EXPECT_EQ(uri.GetFragment(), "fragment");
+    EXPECT_TRUE(uri.IsHierarchical());
+    EXPECT_TRUE(uri.IsAbsolute());
+
+    EXPECT_EQ(uri.GetSchemeView(), uri.GetScheme());
+    EXPECT_EQ(uri.GetSchemeSpecificPartView(), uri.GetSchemeSpecificPart());
+    EXPECT_EQ(uri.GetAuthorityView(), uri.GetAuthority());
+    EXPECT_EQ(uri.GetUserInfoView(), uri.GetUserInfo());
+    EXPECT_EQ(uri.GetHostView(), uri.GetHost());
+    EXPECT_EQ(uri.GetPathView(), uri.GetPath());
+    EXPECT_EQ(uri.GetQueryView(), uri.GetQuery());
+    EXPECT_EQ(uri.GetFragmentView(), uri.GetFragment());
+}
+
+/**
+ * @tc.number: AaFwk_Uri_Parse_0200
+ * @tc.name: Parse
+ * @tc.desc: opaque, relative, empty and invalid uris.
+ */
+HWTEST_F(UriTest, AaFwk_Uri_Parse_0200, Function | MediumTest | Level1)
+{
+    Uri opaque("mailto:someone@example.com");
+    EXPECT_TRUE(opaque.IsOpaque());
+    EXPECT_EQ(opaque.GetSchemeSpecificPart(), "someone@example.com");
+    EXPECT_TRUE(opaque.GetAuthority().empty());
+    EXPECT_TRUE(opaque.GetPath().empty());
+    EXPECT_EQ(opaque.GetPort(), -1);
+
+    Uri relative("path/to/file?key");
+    EXPECT_TRUE(relative.IsRelative());
+    EXPECT_TRUE(relative.GetScheme().empty());
+    EXPECT_EQ(relative.GetPath(), "path/to/file");
+    EXPECT_EQ(relative.GetQuery(), "key");
+
+    Uri empty("");
+    EXPECT_FALSE(empty.IsHierarchical());
+    EXPECT_FALSE(empty.IsRelative());
+    EXPECT_TRUE(empty.ToString().empty());
+
+    // a scheme not starting with a letter or containing '-' makes the uri empty.
+    Uri invalid("1http://host/path");
+    EXPECT_TRUE(invalid.ToString().empty());
+    EXPECT_TRUE(invalid.GetHost().empty());
+    EXPECT_TRUE(invalid.GetPathView().empty());
+    EXPECT_EQ(invalid.GetPort(), -1);
+    EXPECT_TRUE(Uri("my-scheme://host").ToString().empty());
+    EXPECT_EQ(Uri("my+scheme.v1://host").GetScheme(), "my+scheme.v1");
+}
+
+/**
+ * @tc.number: AaFwk_Uri_GetPathSegments_0100
+ * @tc.name: GetPathSegments
+ * @tc.desc: empty segments are skipped, the view segments equal the string segments.
+ */
+HWTEST_F(UriTest, AaFwk_Uri_GetPathSegments_0100, Function | MediumTest | Level1)
+{
+    Uri uri("dataability://device/com.example.bundle//ability/table/?key#fragment");
+    std::vector<std::string> segments;
+    uri.GetPathSegments(segments);
+    std::vector<std::string> expected = { "com.example.bundle", "ability", "table" };
+    EXPECT_EQ(segments, expected);
+
+    std::vector<std::string_view> views;
+    uri.GetPathSegments(views);
+    ASSERT_EQ(views.size(), expected.size());
+    for (size_t i = 0; i < views.size(); i++) {
+        EXPECT_EQ(views[i], expected[i]);
+    }
+}
+
+/**
+ * @tc.number: AaFwk_Uri_Hash_0100
+ * @tc.name: Hash
+ * @tc.desc: equal uris have the same hash and can be looked up in hash containers.
+ */
+HWTEST_F(UriTest, AaFwk_Uri_Hash_0100, Function | MediumTest | Level1)
+{
+    Uri uri("dataability:///com.example.bundle/ability");
+    Uri copy(uri);
+    EXPECT_TRUE(uri == copy);
+    EXPECT_TRUE(uri.Equals(copy));
+    EXPECT_EQ(uri.CompareTo(copy), 0);
+    EXPECT_EQ(uri.Hash(), copy.Hash());
+    EXPECT_EQ(copy.GetPath(), "/com.example.bundle/ability");
+
+    std::unordered_set<Uri> uris = { uri, Uri("dataability:///com.example.bundle/other") };
+    EXPECT_EQ(uris.size(), 2U);
+    EXPECT_EQ(uris.count(Uri("dataability:///com.example.bundle/ability")), 1U);
+    EXPECT_EQ(uris.count(Uri("dataability:///com.example.bundle")), 0U);
+}
+}  // namespace OHOS
@@ -170,5 +170,21 @@ HWTEST_F(PatternsMatcherBaseTest, AaFwk_PatternsMatcher_Match_0400, Function | M
         EXPECT_EQ(PatternsMatcherIn_->match("abcABC12345"), false);
     }
 }
+
+/**
+ * @tc.number: AaFwk_PatternsMatcher_Match_0500
+ * @tc.name: Match
+ * @tc.desc: Match a copied PatternsMatcher repeatedly with the regex compiled once, and then check result.
+ */
+HWTEST_F(PatternsMatcherBaseTest, AaFwk_PatternsMatcher_Match_0500, Function | MediumTest | Level1)
+{
+    PatternsMatcher patternsMatcher("abc[0-9]+", MatchType::PATTERN);
+    EXPECT_EQ(patternsMatcher.match("abc123"), true);
+    PatternsMatcher copied(patternsMatcher);
+    EXPECT_EQ(copied.match("abc4"), true);
+    EXPECT_EQ(copied.match("abc"), false);
+    EXPECT_EQ(copied.match(""), false);
+    EXPECT_EQ(PatternsMatcher::MatchPattern("abc[0-9]+", "abc123", MatchType::PATTERN), true);
+}
 }  // namespace AAFwk
 }  // namespace OHOS
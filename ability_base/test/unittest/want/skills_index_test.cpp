@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "skills.h"
+#include "skills_index.h"
+#include "want.h"
+
+using namespace testing::ext;
+using namespace OHOS::AAFwk;
+
+namespace OHOS {
+namespace AAFwk {
+class SkillsIndexTest : public testing::Test {
+public:
+    SkillsIndexTest()
+    {}
+    ~SkillsIndexTest()
+    {}
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    static Skills MakeSkills(const std::string &action, const std::string &scheme);
+    static Want MakeWant(const std::string &action, const std::string &uri);
+};
+
+void SkillsIndexTest::SetUpTestCase(void)
+{}
+
+void SkillsIndexTest::TearDownTestCase(void)
+{}
+
+void SkillsIndexTest::SetUp(void)
+{}
+
+void SkillsIndexTest::TearDown(void)
+{}
+
+Skills SkillsIndexTest::MakeSkills(const std::string &action, const std::string &scheme)
+{
+    Skills skills;
+    skills.AddAction(action);
+    skills.AddEntity("entity.system.default");
+    if (!scheme.empty()) {
+        skills.AddScheme(scheme);
+        skills.AddAuthority("com.example.data");
+    }
+    return skills;
+}
+
+Want SkillsIndexTest::MakeWant(const std::string &action, const std::string &uri)
+{
+    Want want;
+    want.SetAction(action);
+    want.AddEntity("entity.system.default");
+    want.SetUri(uri);
+    return want;
+}
+
+/**
+ * @tc.number: AaFwk_SkillsIndex_Match_0100
+ * @tc.name: Match
+ * @tc.desc: only the skills listing the action of the want are matched.
+ */
+HWTEST_F(SkillsIndexTest, AaFwk_SkillsIndex_Match_0100, Function | MediumTest | Level1)
+{
+    SkillsIndex index;
+    EXPECT_EQ(index.AddSkills(MakeSkills("action.view", "")), 0U);
+    EXPECT_EQ(index.AddSkills(MakeSkills("action.send", "")), 1U);
+    EXPECT_EQ(index.AddSkills(MakeSkills("action.view", "")), 2U);
+    EXPECT_EQ(index.CountSkills(), 3U);
+
+    std::vector<size_t> expected = { 0, 2 };
+    EXPECT_EQ(index.Match(MakeWant("action.view", "")), expected);
+    expected = { 1 };
+    EXPECT_EQ(index.Match(MakeWant("action.send", "")), expected);
+    EXPECT_TRUE(index.Match(MakeWant("action.edit", "")).empty());
+    // a want without action is not filtered by action.
+    expected = { 0, 1, 2 };
+    EXPECT_EQ(index.Match(MakeWant("", "")), expected);
+}
+
+/**
+ * @tc.number: AaFwk_SkillsIndex_Match_0200
+ * @tc.name: Match
+ * @tc.desc: skills with schemes match the listed schemes, skills without schemes and types match any scheme
+ *           when the want has no type.
+ */
+HWTEST_F(SkillsIndexTest, AaFwk_SkillsIndex_Match_0200, Function | MediumTest | Level1)
+{
+    SkillsIndex index;
+    index.AddSkills(MakeSkills("action.view", "http"));
+    index.AddSkills(MakeSkills("action.view", ""));
+    index.AddSkills(MakeSkills("action.view", "dataability"));
+    index.AddSkills(MakeSkills("action.view", "http"));
+
+    std::vector<size_t> expected = { 0, 1, 3 };
+    EXPECT_EQ(index.Match(MakeWant("", "http://com.example.data/path")), expected);
+    expected = { 1, 2 };
+    EXPECT_EQ(index.Match(MakeWant("action.view", "dataability://com.example.data/path")), expected);
+    expected = { 1 };
+    EXPECT_EQ(index.Match(MakeWant("", "file://com.example.data/path")), expected);
+    EXPECT_EQ(index.Match(MakeWant("", "http://com.example.other/path")), expected);
+    EXPECT_EQ(index.Match(MakeWant("", "ftp://com.example.data/path")), expected);
+    Want typedWant = MakeWant("", "ftp://com.example.data/path");
+    typedWant.SetType("text/plain");
+    EXPECT_TRUE(index.Match(typedWant).empty());
+
+    index.Clear();
+    EXPECT_EQ(index.CountSkills(), 0U);
+    EXPECT_TRUE(index.Match(MakeWant("", "http://com.example.data/path")).empty());
+}
+
+/**
+ * @tc.number: AaFwk_SkillsIndex_Match_0300
+ * @tc.name: Match
+ * @tc.desc: the index gives the same result as Skills::Match for every skills.
+ */
+HWTEST_F(SkillsIndexTest, AaFwk_SkillsIndex_Match_0300, Function | MediumTest | Level1)
+{
+    std::vector<Skills> skillsList;
+    Skills skills = MakeSkills("action.view", "http");
+    skills.AddPath("/path");
+    skillsList.emplace_back(skills);
+    skills = MakeSkills("action.view", "http");
+    skills.AddSchemeSpecificPart("//com.example.other/other");
+    skillsList.emplace_back(skills);
+    skills = MakeSkills("action.view", "");
+    skills.AddType("text/plain");
+    skillsList.emplace_back(skills);
+    skills = MakeSkills("action.send", "");
+    skills.AddType("image/*");
+    skills.AddType("*/png");
+    skillsList.emplace_back(skills);
+    skills = MakeSkills("action.send", "content");
+    skills.AddEntity("entity.system.browsable");
+    skills.AddType("*/*");
+    skillsList.emplace_back(skills);
+    skillsList.emplace_back(MakeSkills("action.view", ""));
+    skillsList.emplace_back(Skills());
+
+    SkillsIndex index;
+    for (const auto &item : skillsList) {
+        index.AddSkills(item);
+    }
+
+    std::vector<std::string> actions = { "", "action.view", "action.send" };
+    std::vector<std::string> uris = { "", "http://com.example.data/path", "http://com.example.data/other",
+        "http://com.example.other/other", "content://com.example.data/path", "file://com.example.data/path",
+        "ftp://com.example.data/path" };
+    std::vector<std::string> types = { "", "text/plain", "image/png", "*/*", "image" };
+    std::vector<std::string> entities = { "", "entity.system.default", "entity.system.browsable" };
+    for (const auto &action : actions) {
+        for (const auto &uri : uris) {
+            for (const auto &type : types) {
+                for (const auto &entity : entities) {
+                    Want want;
+                    want.SetAction(action);
+                    want.SetUri(uri);
+                    want.SetType(type);
+                    want.AddEntity(entity);
+                    std::vector<size_t> expected;
+                    for (size_t i = 0; i < skillsList.size(); i++) {
+                        if (skillsList[i].Match(want)) {
+                            expected.emplace_back(i);
+                        }
+                    }
+                    EXPECT_EQ(index.Match(want), expected)
+                        << action << " " << uri << " " << type << " " << entity;
+                }
+            }
+        }
+    }
+}
+}  // namespace AAFwk
+}  // namespace OHOS
@@ -19,7 +19,10 @@
 #include "bool_wrapper.h"
 #include "int_wrapper.h"
 #include "long_wrapper.h"
+#include "array_wrapper.h"
+#include "want_params_wrapper.h"
 
+#include "string_ex.h"
 #include "want_params.h"
 
 using namespace testing::ext;
@@ -138,5 +141,145 @@ HWTEST_F(WantParamsBaseTest, AaFwk_WantParams_Parcelable_0400, Function | Medium
     std::string outString(String::Unbox(IString::Query(wantParamsOut_->GetParam(keyStr))));
     EXPECT_STREQ(std::to_string(valueLong).c_str(), outString.c_str());
 }
+
+/**
+ * @tc.number: AaFwk_WantParams_Parcelable_0500
+ * @tc.name: Marshalling/Unmarshalling
+ * @tc.desc: marshalling deeply nested WantParams, and then check every level.
+ */
+HWTEST_F(WantParamsBaseTest, AaFwk_WantParams_Parcelable_0500, Function | MediumTest | Level1)
+{
+    const int depth = 20;
+    WantParams nested;
+    for (int i = 0; i < depth; i++) {
+        WantParams level;
+        level.SetParam("level", Integer::Box(i));
+        level.SetParam("name", String::Box("level" + std::to_string(i)));
+        level.SetParam("child", WantParamWrapper::Box(nested));
+        nested = level;
+    }
+    wantParamsIn_->SetParam("root", WantParamWrapper::Box(nested));
+
+    Parcel in;
+    EXPECT_TRUE(wantParamsIn_->Marshalling(in, WANT_WIRE_VERSION_UTF8));
+    std::shared_ptr<WantParams> wantParamsOut(WantParams::Unmarshalling(in));
+    ASSERT_NE(wantParamsOut, nullptr);
+    WantParams level = WantParamWrapper::Unbox(IWantParams::Query(wantParamsOut->GetParam("root")));
+    for (int i = depth - 1; i >= 0; i--) {
+        EXPECT_EQ(Integer::Unbox(IInteger::Query(level.GetParam("level"))), i);
+        EXPECT_EQ(String::Unbox(IString::Query(level.GetParam("name"))), "level" + std::to_string(i));
+        level = WantParamWrapper::Unbox(IWantParams::Query(level.GetParam("child")));
+    }
+    EXPECT_TRUE(level.IsEmpty());
+}
+
+/**
+ * @tc.number: AaFwk_WantParams_Parcelable_0600
+ * @tc.name: Marshalling/Unmarshalling
+ * @tc.desc: marshalling an array of WantParams, and then check every element.
+ */
+HWTEST_F(WantParamsBaseTest, AaFwk_WantParams_Parcelable_0600, Function | MediumTest | Level1)
+{
+    const long size = 5;
+    sptr<IArray> array = new Array(size, g_IID_IWantParams);
+    for (long i = 0; i < size; i++) {
+        WantParams element;
+        element.SetParam("index", Integer::Box(i));
+        array->Set(i, WantParamWrapper::Box(element));
+    }
+    wantParamsIn_->SetParam("array", array);
+
+    Parcel in;
+    EXPECT_TRUE(wantParamsIn_->Marshalling(in, WANT_WIRE_VERSION_UTF8));
+    std::shared_ptr<WantParams> wantParamsOut(WantParams::Unmarshalling(in));
+    ASSERT_NE(wantParamsOut, nullptr);
+    IArray *arrayOut = IArray::Query(wantParamsOut->GetParam("array"));
+    ASSERT_NE(arrayOut, nullptr);
+    long sizeOut = 0;
+    arrayOut->GetLength(sizeOut);
+    EXPECT_EQ(sizeOut, size);
+    for (long i = 0; i < sizeOut; i++) {
+        sptr<IInterface> value;
+        arrayOut->Get(i, value);
+        WantParams element = WantParamWrapper::Unbox(IWantParams::Query(value));
+        EXPECT_EQ(Integer::Unbox(IInteger::Query(element.GetParam("index"))), i);
+    }
+}
+
+/**
+ * @tc.number: AaFwk_WantParams_Parcelable_0700
+ * @tc.name: Unmarshalling
+ * @tc.desc: nested WantParams marshalled as a string by an earlier version are still read.
+ */
+HWTEST_F(WantParamsBaseTest, AaFwk_WantParams_Parcelable_0700, Function | MediumTest | Level1)
+{
+    const int typeWantParams = 101;
+    WantParams nested;
+    nested.SetParam("key", String::Box("value"));
+    sptr<IWantParams> wrapper = WantParamWrapper::Box(nested);
+
+    Parcel in;
+    in.WriteInt32(1);
+    in.WriteString16(Str8ToStr16("nested"));
+    in.WriteInt32(typeWantParams);
+    in.WriteString16(Str8ToStr16(static_cast<WantParamWrapper *>(wrapper.GetRefPtr())->ToString()));
+    std::shared_ptr<WantParams> wantParamsOut(WantParams::Unmarshalling(in));
+    ASSERT_NE(wantParamsOut, nullptr);
+    WantParams nestedOut = WantParamWrapper::Unbox(IWantParams::Query(wantParamsOut->GetParam("nested")));
+    EXPECT_EQ(String::Unbox(IString::Query(nestedOut.GetParam("key"))), "value");
+}
+
+/**
+ * @tc.number: AaFwk_WantParams_Parcelable_0800
+ * @tc.name: Marshalling
+ * @tc.desc: by default strings and nested WantParams are written in the layout of earlier versions, as the
+ *           peer may predate WANT_WIRE_VERSION_UTF8.
+ */
+HWTEST_F(WantParamsBaseTest, AaFwk_WantParams_Parcelable_0800, Function | MediumTest | Level1)
+{
+    const int typeString = 9;
+    const int typeStringArray = 19;
+    const int typeWantParams = 101;
+    const int typeWantParamsArray = 24;
+    WantParams nested;
+    nested.SetParam("key", String::Box("value"));
+    sptr<IArray> strings = new Array(1, g_IID_IString);
+    strings->Set(0, String::Box("element"));
+    sptr<IArray> nestedArray = new Array(1, g_IID_IWantParams);
+    nestedArray->Set(0, WantParamWrapper::Box(nested));
+    wantParamsIn_->SetParam("a_string", String::Box("value"));
+    wantParamsIn_->SetParam("b_strings", strings);
+    wantParamsIn_->SetParam("c_nested", WantParamWrapper::Box(nested));
+    wantParamsIn_->SetParam("d_nestedArray", nestedArray);
+
+    Parcel in;
+    EXPECT_TRUE(wantParamsIn_->Marshalling(in));
+    int32_t size = 0;
+    EXPECT_TRUE(in.ReadInt32(size));
+    EXPECT_EQ(size, 4);
+    int32_t type = 0;
+    EXPECT_EQ(Str16ToStr8(in.ReadString16()), "a_string");
+    EXPECT_TRUE(in.ReadInt32(type));
+    EXPECT_EQ(type, typeString);
+    EXPECT_EQ(Str16ToStr8(in.ReadString16()), "value");
+    EXPECT_EQ(Str16ToStr8(in.ReadString16()), "b_strings");
+    EXPECT_TRUE(in.ReadInt32(type));
+    EXPECT_EQ(type, typeStringArray);
+    std::vector<std::u16string> stringsOut;
+    EXPECT_TRUE(in.ReadString16Vector(&stringsOut));
+    EXPECT_EQ(stringsOut, std::vector<std::u16string>({ u"element" }));
+    EXPECT_EQ(Str16ToStr8(in.ReadString16()), "c_nested");
+    EXPECT_TRUE(in.ReadInt32(type));
+    EXPECT_EQ(type, typeWantParams);
+    sptr<IWantParams> nestedOut = WantParamWrapper::Parse(Str16ToStr8(in.ReadString16()));
+    ASSERT_NE(nestedOut, nullptr);
+    EXPECT_EQ(Str16ToStr8(in.ReadString16()), "d_nestedArray");
+    EXPECT_TRUE(in.ReadInt32(type));
+    EXPECT_EQ(type, typeWantParamsArray);
+    EXPECT_TRUE(in.ReadInt32(size));
+    EXPECT_EQ(size, 1);
+    EXPECT_NE(WantParamWrapper::Parse(Str16ToStr8(in.ReadString16())), nullptr);
+    EXPECT_EQ(in.GetReadableBytes(), 0u);
+}
 }
 }
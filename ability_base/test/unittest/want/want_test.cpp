@@ -22,7 +22,9 @@
 #include "float_wrapper.h"
 #include "long_wrapper.h"
 #include "array_wrapper.h"
+#include "string_ex.h"
 #include "want.h"
+#include "want_params_wrapper.h"
 
 using namespace testing::ext;
 using namespace OHOS::AAFwk;
@@ -1025,6 +1027,88 @@ HWTEST_F(WantBaseTest, AaFwk_Want_Parcelable_0800, Function | MediumTest | Level
     }
 }
 
+/**
+ * @tc.number: AaFwk_Want_Parcelable_0900
+ * @tc.name: Marshalling/Unmarshalling
+ * @tc.desc: A want written in either wire version is read back the same.
+ */
+HWTEST_F(WantBaseTest, AaFwk_Want_Parcelable_0900, Function | MediumTest | Level1)
+{
+    Want want;
+    want.SetAction("want.action.test");
+    want.AddEntity("want.entity.test");
+    want.SetFlags(0x789);
+    want.SetUri("http://www.example.com/\u4e2d\u6587");
+    want.SetElement(ElementName("device", "bundlename", "abilityname", "modulename"));
+    want.SetParam("string", std::string("\u4e2d\u6587"));
+    want.SetParam("stringArray", std::vector<std::string>({ "a", "", "\u00e9" }));
+    want.SetParam("int", 7);
+    WantParams nested;
+    nested.SetParam("string", String::Box("nested"));
+    WantParams params = want.GetParams();
+    params.SetParam("nested", WantParamWrapper::Box(nested));
+    want.SetParams(params);
+
+    for (int32_t version : { WANT_WIRE_VERSION_UTF16, WANT_WIRE_VERSION_UTF8 }) {
+        Parcel parcel;
+        EXPECT_TRUE(want.Marshalling(parcel, version));
+        std::unique_ptr<Want> result(Want::Unmarshalling(parcel));
+        ASSERT_NE(result, nullptr);
+        EXPECT_EQ(result->GetAction(), want.GetAction());
+        EXPECT_EQ(result->GetEntities(), want.GetEntities());
+        EXPECT_EQ(result->GetFlags(), want.GetFlags());
+        EXPECT_EQ(result->GetUriString(), want.GetUriString());
+        EXPECT_EQ(result->GetElement(), want.GetElement());
+        EXPECT_EQ(result->GetStringParam("string"), want.GetStringParam("string"));
+        EXPECT_EQ(result->GetStringArrayParam("stringArray"), want.GetStringArrayParam("stringArray"));
+        EXPECT_EQ(result->GetIntParam("int", 0), 7);
+        WantParams resultNested = WantParamWrapper::Unbox(IWantParams::Query(result->GetParams().GetParam("nested")));
+        EXPECT_EQ(String::Unbox(IString::Query(resultNested.GetParam("string"))), "nested");
+    }
+}
+
+/**
+ * @tc.number: AaFwk_Want_Parcelable_1000
+ * @tc.name: Marshalling/Unmarshalling
+ * @tc.desc: Marshalling and so WriteParcelable write WANT_WIRE_VERSION_UTF16, which starts with the action as in
+ *           earlier versions. Only WriteLocalParcelable writes the tagged WANT_WIRE_VERSION_UTF8.
+ */
+HWTEST_F(WantBaseTest, AaFwk_Want_Parcelable_1000, Function | MediumTest | Level1)
+{
+    Want want;
+    want.SetAction("want.action.test");
+    want.SetElement(ElementName("", "bundlename", "abilityname"));
+    want.SetParam("string", std::string("value"));
+
+    Parcel legacy;
+    EXPECT_TRUE(want.Marshalling(legacy, WANT_WIRE_VERSION_UTF16));
+    Parcel current;
+    EXPECT_TRUE(want.Marshalling(current));
+    ASSERT_EQ(current.GetDataSize(), legacy.GetDataSize());
+    EXPECT_EQ(memcmp(reinterpret_cast<const void *>(current.GetData()),
+        reinterpret_cast<const void *>(legacy.GetData()), legacy.GetDataSize()), 0);
+    EXPECT_EQ(Str16ToStr8(current.ReadString16()), want.GetAction());
+
+    Parcel parcelable;
+    EXPECT_TRUE(parcelable.WriteParcelable(&want));
+    int32_t flag = 0;
+    EXPECT_TRUE(parcelable.ReadInt32(flag));
+    EXPECT_EQ(Str16ToStr8(parcelable.ReadString16()), want.GetAction());
+
+    Parcel local;
+    EXPECT_TRUE(want.WriteLocalParcelable(local));
+    EXPECT_LT(local.GetDataSize(), parcelable.GetDataSize());
+    int32_t tag = 0;
+    EXPECT_TRUE(local.ReadInt32(flag));
+    EXPECT_TRUE(local.ReadInt32(tag));
+    EXPECT_EQ(tag, WANT_WIRE_TAG_UTF8);
+    local.RewindRead(0);
+    std::unique_ptr<Want> result(local.ReadParcelable<Want>());
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(result->GetAction(), want.GetAction());
+    EXPECT_EQ(result->GetStringParam("string"), "value");
+}
+
 /**
  * @tc.number: AaFwk_Want_FormatMimeType_0100
  * @tc.name: formatMimeType
@@ -46,7 +46,7 @@ int FormMgrProxy::AddForm(
         HILOG_ERROR("%{public}s, failed to write formId", __func__);
         return ERR_APPEXECFWK_PARCEL_ERROR;
     }
-    if (!data.WriteParcelable(&want)) {
+    if (!want.WriteLocalParcelable(data)) {
         HILOG_ERROR("%{public}s, failed to write want", __func__);
         return ERR_APPEXECFWK_PARCEL_ERROR;
     }
@@ -302,7 +302,7 @@ ErrCode FormMgrProxy::RequestPublishForm(Want &want, bool withFormBindingData,
         HILOG_ERROR("%{public}s, failed to write interface token", __func__);
         return ERR_APPEXECFWK_PARCEL_ERROR;
     }
-    if (!data.WriteParcelable(&want)) {
+    if (!want.WriteLocalParcelable(data)) {
         HILOG_ERROR("%{public}s, failed to write want", __func__);
         return ERR_APPEXECFWK_PARCEL_ERROR;
     }
@@ -398,7 +398,7 @@ int FormMgrProxy::RequestForm(const int64_t formId, const sptr<IRemoteObject> &c
         HILOG_ERROR("%{public}s, failed to write callerToken", __func__);
         return ERR_APPEXECFWK_PARCEL_ERROR;
     }
-    if (!data.WriteParcelable(&want)) {
+    if (!want.WriteLocalParcelable(data)) {
         HILOG_ERROR("%{public}s, failed to write want", __func__);
         return ERR_APPEXECFWK_PARCEL_ERROR;
     }
@@ -614,7 +614,7 @@ int FormMgrProxy::MessageEvent(const int64_t formId, const Want &want, const spt
         HILOG_ERROR("%{public}s, failed to write formId", __func__);
         return ERR_APPEXECFWK_PARCEL_ERROR;
     }
-    if (!data.WriteParcelable(&want)) {
+    if (!want.WriteLocalParcelable(data)) {
         HILOG_ERROR("%{public}s, failed to write want", __func__);
         return ERR_APPEXECFWK_PARCEL_ERROR;
     }
@@ -652,7 +652,7 @@ int FormMgrProxy::RouterEvent(const int64_t formId, Want &want)
         HILOG_ERROR("%{public}s, failed to write formId", __func__);
         return ERR_APPEXECFWK_PARCEL_ERROR;
     }
-    if (!data.WriteParcelable(&want)) {
+    if (!want.WriteLocalParcelable(data)) {
         HILOG_ERROR("%{public}s, failed to write want", __func__);
         return ERR_APPEXECFWK_PARCEL_ERROR;
     }
@@ -811,7 +811,7 @@ int FormMgrProxy::DistributedDataAddForm(const Want &want)
         HILOG_ERROR("%{public}s, failed to write interface token", __func__);
         return ERR_APPEXECFWK_PARCEL_ERROR;
     }
-    if (!data.WriteParcelable(&want)) {
+    if (!want.WriteLocalParcelable(data)) {
         HILOG_ERROR("%{public}s, failed to write want", __func__);
         return ERR_APPEXECFWK_PARCEL_ERROR;
     }
@@ -921,7 +921,7 @@ int FormMgrProxy::AcquireFormState(const Want &want, const sptr<IRemoteObject> &
         HILOG_ERROR("%{public}s, failed to write interface token", __func__);
         return ERR_APPEXECFWK_PARCEL_ERROR;
     }
-    if (!data.WriteParcelable(&want)) {
+    if (!want.WriteLocalParcelable(data)) {
         HILOG_ERROR("%{public}s, failed to write want", __func__);
         return ERR_APPEXECFWK_PARCEL_ERROR;
     }
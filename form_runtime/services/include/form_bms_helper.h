@@ -16,6 +16,8 @@
 #ifndef FOUNDATION_APPEXECFWK_SERVICES_FORMMGR_INCLUDE_FORM_BMS_HELPER_H
 #define FOUNDATION_APPEXECFWK_SERVICES_FORMMGR_INCLUDE_FORM_BMS_HELPER_H
 
+#include <map>
+#include <mutex>
 #include <singleton.h>
 #include "ability_connect_callback_interface.h"
 #include "ability_manager_interface.h"
@@ -61,7 +63,89 @@ public:
      */
     void SetBundleManager(const sptr<IBundleMgr> &bundleManager);
 
+    /**
+     * @brief Get the uid of a bundle, cached until the bundle changes.
+     * @param bundleName The bundle name.
+     * @param userId The user id.
+     * @return Returns the uid, or -1 for failed.
+     */
+    int32_t GetUidByBundleName(const std::string &bundleName, const int32_t userId);
+
+    /**
+     * @brief Get the bundle name of a uid, cached until the bundle changes.
+     * @param uid The uid.
+     * @param bundleName The bundle name.
+     * @return Returns true on success, false on failure.
+     */
+    bool GetBundleNameForUid(const int32_t uid, std::string &bundleName);
+
+    /**
+     * @brief Check whether a bundle is a system app, cached until the bundle changes.
+     * @param bundleName The bundle name.
+     * @param userId The user id.
+     * @return Returns true if the bundle is a system app.
+     */
+    bool CheckIsSystemAppByBundleName(const std::string &bundleName, const int32_t userId);
+
+    /**
+     * @brief Get the bundle info with abilities, cached until the bundle changes.
+     * @param bundleName The bundle name.
+     * @param userId The user id.
+     * @param bundleInfo The bundle info.
+     * @return Returns true on success, false on failure.
+     */
+    bool GetBundleInfoWithAbilities(const std::string &bundleName, const int32_t userId, BundleInfo &bundleInfo);
+
+    /**
+     * @brief Drop what is cached of a bundle, for all users.
+     * @param bundleName The bundle name.
+     */
+    void InvalidateBundle(const std::string &bundleName);
+
+    /**
+     * @brief Drop what is cached of a user.
+     * @param userId The user id.
+     */
+    void InvalidateUser(const int32_t userId);
+
+    /**
+     * @brief Dump the size of the bundle cache and the count and latency of the calls to the bundle manager.
+     * @param cacheInfo Cache dump info.
+     */
+    void DumpCacheInfo(std::string &cacheInfo) const;
+
 private:
+    enum BmsCallType {
+        BMS_CALL_GET_UID = 0,
+        BMS_CALL_GET_BUNDLE_NAME,
+        BMS_CALL_CHECK_SYSTEM_APP,
+        BMS_CALL_GET_BUNDLE_INFO,
+        BMS_CALL_TYPE_COUNT,
+    };
+
+    struct BmsCallStats {
+        uint64_t count = 0;
+        int64_t totalTime = 0;
+        int64_t maxTime = 0;
+    };
+
+    struct BundleCacheItem {
+        bool hasUid = false;
+        int32_t uid = -1;
+        bool hasSystemApp = false;
+        bool isSystemApp = false;
+        std::shared_ptr<BundleInfo> bundleInfo = nullptr;
+    };
+
+    using BundleKey = std::pair<std::string, int32_t>;
+
+    /**
+     * @brief Get the cache item of a bundle, added if absent, the cache is cleared once it is full.
+     */
+    BundleCacheItem &GetCacheItem(const BundleKey &key);
+    void RecordBmsCall(BmsCallType type, int64_t startTime);
+    static int64_t GetTimeMicros();
+
     /**
      * @brief Generate module key.
      * @param bundleName Provider ability bundleName.
@@ -72,6 +156,14 @@ private:
 
 private:
     sptr<IBundleMgr> iBundleMgr_ = nullptr;
+    mutable std::mutex cacheMutex_;
+    std::map<BundleKey, BundleCacheItem> bundleCache_;
+    std::map<int32_t, std::string> uidBundleNames_;
+    // bumped by every invalidation, an answer got across one is not cached.
+    uint64_t cacheGeneration_ = 0;
+    uint64_t hitCount_ = 0;
+    uint64_t missCount_ = 0;
+    BmsCallStats callStats_[BMS_CALL_TYPE_COUNT];
 };
 }  // namespace AppExecFwk
 }  // namespace OHOS
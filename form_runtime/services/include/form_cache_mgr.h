@@ -15,19 +15,32 @@
 #ifndef FOUNDATION_APPEXECFWK_SERVICES_FORMMGR_INCLUDE_FORM_CACHE_MGR_H
 #define FOUNDATION_APPEXECFWK_SERVICES_FORMMGR_INCLUDE_FORM_CACHE_MGR_H
 
+#include <list>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <singleton.h>
 #include <string>
+#include <unordered_map>
 
 #include "form_ashmem.h"
 
 namespace OHOS {
 namespace AppExecFwk {
+/**
+ * @struct FormCacheData
+ * Cache data of a form, it is shared with readers and not modified once cached.
+ */
+struct FormCacheData {
+    std::string data;
+    std::map<std::string, std::pair<sptr<FormAshmem>, int32_t>> imageMap;
+};
+
 /**
  * @class FormCacheMgr
  * Form cache data manager.
+ * The cache is bounded by the bytes of the data and the image ashmem, the least recently used forms are
+ * evicted first, and an evicted form is acquired from its provider again when it is needed.
  */
 class FormCacheMgr final : public DelayedRefSingleton<FormCacheMgr> {
 DECLARE_DELAYED_REF_SINGLETON(FormCacheMgr)
@@ -42,7 +55,23 @@ public:
      * @return Returns true if this function is successfully called; returns false otherwise.
      */
     bool GetData(const int64_t formId, std::string &data,
-        std::map<std::string, std::pair<sptr<FormAshmem>, int32_t>> &imageMap) const;
+        std::map<std::string, std::pair<sptr<FormAshmem>, int32_t>> &imageMap);
+
+    /**
+     * @brief Get form data without copying it.
+     * @param formId Form id.
+     * @param cacheData Shared cache data.
+     * @return Returns true if this function is successfully called; returns false otherwise.
+     */
+    bool GetData(const int64_t formId, std::shared_ptr<const FormCacheData> &cacheData);
+
+    /**
+     * @brief Get form data without touching the recently used order or the hit rate.
+     * @param formId Form id.
+     * @param cacheData Form cache data.
+     * @return Returns true if the form data is cached; returns false otherwise.
+     */
+    bool PeekData(const int64_t formId, std::shared_ptr<const FormCacheData> &cacheData) const;
 
     /**
      * @brief Add form data.
@@ -74,10 +103,40 @@ public:
      * @return Returns true if this function is successfully called; returns false otherwise.
      */
     bool IsExist(const int64_t formId) const;
+
+    /**
+     * @brief Set the max bytes of the cache, the least recently used forms are evicted when it is exceeded.
+     * @param maxCacheSize The max bytes of the cache.
+     */
+    void SetMaxCacheSize(const size_t maxCacheSize);
+
+    /**
+     * @brief Dump the size and the hit rate of the cache.
+     * @param cacheInfo Cache dump info.
+     */
+    void Dump(std::string &cacheInfo) const;
 private:
+    struct CacheItem {
+        int64_t formId;
+        size_t size;
+        std::shared_ptr<const FormCacheData> cacheData;
+    };
+
+    bool PutItem(const int64_t formId, const std::shared_ptr<const FormCacheData> &cacheData);
+    void RemoveItem(const int64_t formId);
+    void EvictItems();
+    static size_t GetCacheSize(const FormCacheData &cacheData);
+
+    static constexpr size_t DEFAULT_MAX_CACHE_SIZE = 16 * 1024 * 1024;
+
     mutable std::mutex cacheMutex_;
-    std::map<int64_t, std::string> cacheData_;
-    std::map<int64_t, std::map<std::string, std::pair<sptr<FormAshmem>, int32_t>>> cacheImageMap_;
+    std::list<CacheItem> cacheItems_;
+    std::unordered_map<int64_t, std::list<CacheItem>::iterator> cacheIndex_;
+    size_t cacheSize_ = 0;
+    size_t maxCacheSize_ = DEFAULT_MAX_CACHE_SIZE;
+    uint64_t hitCount_ = 0;
+    uint64_t missCount_ = 0;
+    uint64_t evictCount_ = 0;
 };
 }  // namespace AppExecFwk
 }  // namespace OHOS
@@ -16,12 +16,14 @@
 #ifndef FOUNDATION_APPEXECFWK_SERVICES_FORMMGR_INCLUDE_FORM_DATA_MGR_H
 #define FOUNDATION_APPEXECFWK_SERVICES_FORMMGR_INCLUDE_FORM_DATA_MGR_H
 
+#include <list>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <set>
 #include <singleton.h>
 #include <string>
+#include <unordered_map>
 
 #include "form_constants.h"
 #include "form_host_record.h"
@@ -498,13 +500,32 @@ private:
     */
     ErrCode HandleUpdateHostFormFlag(const std::vector<int64_t> &formIds, bool flag, bool isOnlyEnableUpdate,
                                      FormHostRecord &formHostRecord, std::vector<int64_t> &refreshForms);
+    /**
+     * @brief Find the form host record by client stub.(NoLock)
+     * @param callerToken The client stub of the form host record.
+     * @return Returns the form host record, clientRecords_.end() if not found.
+     */
+    std::list<FormHostRecord>::iterator FindHostRecordNolock(const sptr<IRemoteObject> &callerToken);
+    /**
+     * @brief Add a form host record.(NoLock)
+     * @param record The form host record.
+     */
+    void AddHostRecordNolock(const FormHostRecord &record);
+    /**
+     * @brief Clean and erase a form host record.(NoLock)
+     * @param iter The form host record.
+     * @return Returns the form host record after it.
+     */
+    std::list<FormHostRecord>::iterator EraseHostRecordNolock(std::list<FormHostRecord>::iterator iter);
 private:
     mutable std::mutex formRecordMutex_;
     mutable std::mutex formHostRecordMutex_;
     mutable std::mutex formTempMutex_;
     mutable std::mutex formStateRecordMutex_;
     std::map<int64_t, FormRecord> formRecords_;
-    std::vector<FormHostRecord> clientRecords_;
+    // form host records in the order they were added, and the index on their client stub.
+    std::list<FormHostRecord> clientRecords_;
+    std::unordered_map<IRemoteObject *, std::list<FormHostRecord>::iterator> clientRecordMap_;
     std::vector<int64_t> tempForms_;
     std::map<std::string, FormHostRecord> formStateRecord_;
     int64_t udidHash_;
@@ -16,9 +16,12 @@
 #ifndef FOUNDATION_APPEXECFWK_SERVICES_FORMMGR_INCLUDE_FORM_DB_CACHE_H
 #define FOUNDATION_APPEXECFWK_SERVICES_FORMMGR_INCLUDE_FORM_DB_CACHE_H
 
+#include <list>
 #include <mutex>
 #include <set>
 #include <singleton.h>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "appexecfwk_errors.h"
@@ -162,9 +165,35 @@ public:
     ErrCode DeleteInvalidDBForms(int32_t userId, int32_t callingUid, std::set<int64_t> &matchedFormIds,
                                  std::map<int64_t, bool> &removedFormsMap);
 private:
+    using FormDBInfoIter = std::list<FormDBInfo>::iterator;
+
+    /**
+     * @brief Add a form data to the indexes.(NoLock)
+     * @param iter The form data.
+     */
+    void AddFormIndex(const FormDBInfoIter &iter);
+
+    /**
+     * @brief Remove a form data from the indexes.(NoLock)
+     * @param formDBInfo The form data.
+     */
+    void RemoveFormIndex(const FormDBInfo &formDBInfo);
+
+    /**
+     * @brief Erase a form data from DbCache and the indexes.(NoLock)
+     * @param formId Form data Id.
+     */
+    void EraseFormInfoNolock(const int64_t formId);
+
     std::shared_ptr<FormStorageMgr> dataStorage_;
     mutable std::mutex formDBInfosMutex_;
-    std::vector<FormDBInfo> formDBInfos_;
+    // form data in the order they were added, and the indexes on it, all guarded by formDBInfosMutex_.
+    std::list<FormDBInfo> formDBInfos_;
+    std::unordered_map<int64_t, FormDBInfoIter> formDBInfoMap_;
+    // bundleName -> moduleName -> formIds
+    std::unordered_map<std::string, std::unordered_map<std::string, std::unordered_set<int64_t>>> bundleFormIds_;
+    // userId -> formIds
+    std::unordered_map<int32_t, std::unordered_set<int64_t>> userFormIds_;
 };
 }  // namespace AppExecFwk
 }  // namespace OHOS
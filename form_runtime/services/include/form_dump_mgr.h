@@ -57,6 +57,16 @@ public:
      * @param formInfo Form dump info.
      */
     void DumpFormInfo(const FormRecord &formRecordInfo, std::string &formInfo) const;
+    /**
+     * @brief Dump the size and the hit rate of the form cache.
+     * @param formInfos Form cache dump info.
+     */
+    void DumpFormCacheInfo(std::string &formInfos) const;
+    /**
+     * @brief Dump the size and the hit rate of the bundle cache, and the time of the bundle manager calls.
+     * @param formInfos Bundle cache dump info.
+     */
+    void DumpBundleCacheInfo(std::string &formInfos) const;
 };
 }  // namespace AppExecFwk
 }  // namespace OHOS
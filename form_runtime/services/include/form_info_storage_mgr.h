@@ -21,6 +21,7 @@
 #include <string>
 #include "appexecfwk_errors.h"
 #include "distributed_kv_data_manager.h"
+#include "form_storage_batcher.h"
 #include "kvstore_death_recipient.h"
 
 namespace OHOS {
@@ -36,7 +37,7 @@ public:
 
 /**
  * @class FormInfoStorageMgr
- * Form info storage.
+ * Form info storage. The writes are committed in groups by a FormStorageBatcher.
  */
 class FormInfoStorageMgr final : public DelayedRefSingleton<FormInfoStorageMgr> {
 DECLARE_DELAYED_REF_SINGLETON(FormInfoStorageMgr)
@@ -54,6 +55,12 @@ public:
 
     ErrCode UpdateBundleFormInfos(const std::string &bundleName, const std::string &formInfoStorages);
 
+    /**
+     * @brief Commit the pending writes to DB.
+     * @return Returns true if all writes are committed.
+     */
+    bool Flush();
+
     bool ResetKvStore();
 
 private:
@@ -65,11 +72,15 @@ private:
 
     DistributedKv::Status GetEntries(std::vector<DistributedKv::Entry> &allEntries);
 
+    bool CommitBatch(const std::vector<DistributedKv::Entry> &entries,
+        const std::vector<DistributedKv::Key> &deletedKeys);
+
     const DistributedKv::AppId appId_ {"form_storage"};
     const DistributedKv::StoreId storeId_ {"form_infos"};
     DistributedKv::DistributedKvDataManager dataManager_;
     std::shared_ptr<DistributedKv::SingleKvStore> kvStorePtr_;
     mutable std::mutex kvStorePtrMutex_;
+    std::shared_ptr<FormStorageBatcher> batcher_;
     const int32_t MAX_TIMES = 600;              // 1min
     const int32_t SLEEP_INTERVAL = 100 * 1000;  // 100ms
 };
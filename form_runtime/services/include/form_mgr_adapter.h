@@ -556,7 +556,7 @@ private:
      * @param bundleName BundleName
      * @return Returns true if the form provider is system app, false if not.
      */
-    bool CheckIsSystemAppByBundleName(const sptr<IBundleMgr> &iBundleMgr, const std::string &bundleName);
+    bool CheckIsSystemAppByBundleName(const std::string &bundleName);
     /**
      * @brief Create eventMaps for event notify.
      *
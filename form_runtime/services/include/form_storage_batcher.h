@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_SERVICES_FORMMGR_INCLUDE_FORM_STORAGE_BATCHER_H
+#define FOUNDATION_APPEXECFWK_SERVICES_FORMMGR_INCLUDE_FORM_STORAGE_BATCHER_H
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "distributed_kv_data_manager.h"
+#include "event_handler.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+/**
+ * @class FormStorageBatcher
+ * FormStorageBatcher holds the writes to a kv store and commits them in groups. A write of a key replaces its
+ * pending one, so a group has one put or delete of a key. Every write gets a sequence number, and a group is
+ * committed with the number of its last write under SEQUENCE_KEY, so after a restart the store tells up to
+ * which write it is durable. A group is committed on the flush handler a short delay after its first write, or
+ * at once when it is full; a group failing to commit is kept and tried again. Flush commits all pending writes
+ * on the caller, which is what has to be done before the service stops.
+ */
+class FormStorageBatcher : public std::enable_shared_from_this<FormStorageBatcher> {
+public:
+    /**
+     * Writes a group to the store: the entries are put and the keys deleted. True on success.
+     */
+    using CommitFunc = std::function<bool(const std::vector<DistributedKv::Entry> &entries,
+        const std::vector<DistributedKv::Key> &deletedKeys)>;
+
+    /**
+     * @param commit, writes a group to the store.
+     * @param handler, the handler groups are committed on. If nullptr, a group is committed by Flush or by the
+     * write filling it.
+     */
+    FormStorageBatcher(const CommitFunc &commit, const std::shared_ptr<EventHandler> &handler,
+        int64_t delayMs = DEFAULT_DELAY_MS, size_t maxBatchSize = DEFAULT_MAX_BATCH_SIZE);
+    ~FormStorageBatcher();
+
+    /**
+     * Put, queue a put of the key.
+     *
+     * @return the sequence number of the write.
+     */
+    uint64_t Put(const std::string &key, const std::string &value);
+
+    /**
+     * Delete, queue a delete of the key.
+     *
+     * @return the sequence number of the write.
+     */
+    uint64_t Delete(const std::string &key);
+
+    /**
+     * GetPending, get the write of a key not committed yet.
+     *
+     * @param deleted, set if the pending write is a delete.
+     * @return false if no write of the key is pending.
+     */
+    bool GetPending(const std::string &key, std::string &value, bool &deleted);
+
+    /**
+     * Flush, commit the pending writes on the caller.
+     *
+     * @return true if every write queued before is committed.
+     */
+    bool Flush();
+
+    /**
+     * GetDurableSequence, the sequence number of the last write committed.
+     */
+    uint64_t GetDurableSequence();
+
+    /**
+     * SetDurableSequence, go on from the sequence number read from the store at load.
+     */
+    void SetDurableSequence(uint64_t sequence);
+
+    size_t GetPendingCount();
+
+    /**
+     * GetFlushHandler, the handler the form storages commit their groups on.
+     */
+    static std::shared_ptr<EventHandler> GetFlushHandler();
+
+    static const std::string SEQUENCE_KEY;
+    static constexpr int64_t DEFAULT_DELAY_MS = 50;
+    static constexpr size_t DEFAULT_MAX_BATCH_SIZE = 128;
+
+private:
+    struct PendingWrite {
+        uint64_t sequence = 0;
+        bool deleted = false;
+        std::string value;
+    };
+
+    uint64_t Write(const std::string &key, const std::string &value, bool deleted);
+    void ScheduleLocked(int64_t delayMs);
+    void OnFlushTask();
+    bool CommitPending();
+
+    CommitFunc commit_;
+    std::shared_ptr<EventHandler> handler_;
+    int64_t delayMs_;
+    size_t maxBatchSize_;
+    // one group is committed at a time, so the groups reach the store in order.
+    std::mutex commitMutex_;
+    std::mutex mutex_;
+    std::map<std::string, PendingWrite> pending_;
+    // the group being committed, still read by GetPending.
+    std::map<std::string, PendingWrite> committing_;
+    uint64_t nextSequence_ = 1;
+    uint64_t durableSequence_ = 0;
+    bool scheduled_ = false;
+    bool urgentScheduled_ = false;
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+
+#endif // FOUNDATION_APPEXECFWK_SERVICES_FORMMGR_INCLUDE_FORM_STORAGE_BATCHER_H
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_SERVICES_FORMMGR_INCLUDE_FORM_STORAGE_CODEC_H
+#define FOUNDATION_APPEXECFWK_SERVICES_FORMMGR_INCLUDE_FORM_STORAGE_CODEC_H
+
+#include <stdint.h>
+#include <string>
+
+#include "form_db_info.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+/**
+ * @class FormStorageCodec
+ * Compact binary encoding of the values in the form storages: a tag byte and a version byte, then the fields
+ * as varints and length prefixed strings. The tag is no json, so a value written as json before is still read.
+ */
+class FormStorageCodec {
+public:
+    /**
+     * @brief Whether the value is in the binary encoding.
+     * @param value The stored value.
+     * @return Returns true if it starts with the tag and a known version.
+     */
+    static bool IsEncoded(const std::string &value);
+
+    /**
+     * @brief Encode a form data.
+     * @param formDBInfo The form data.
+     * @return Returns the encoded value.
+     */
+    static std::string EncodeFormDBInfo(const FormDBInfo &formDBInfo);
+
+    /**
+     * @brief Decode a form data, binary or json.
+     * @param value The stored value.
+     * @param formDBInfo The decoded form data.
+     * @return Returns true on success, false if the value is bad.
+     */
+    static bool DecodeFormDBInfo(const std::string &value, FormDBInfo &formDBInfo);
+
+    /**
+     * @brief Encode a sequence number.
+     * @param sequence The sequence number.
+     * @return Returns the encoded value.
+     */
+    static std::string EncodeSequence(uint64_t sequence);
+
+    /**
+     * @brief Decode a sequence number.
+     * @param value The stored value.
+     * @param sequence The decoded sequence number.
+     * @return Returns true on success, false if the value is bad.
+     */
+    static bool DecodeSequence(const std::string &value, uint64_t &sequence);
+
+    static void WriteHeader(std::string &out);
+    static void WriteVarint(std::string &out, uint64_t value);
+    static void WriteSignedVarint(std::string &out, int64_t value);
+    static void WriteString(std::string &out, const std::string &value);
+
+    // the readers advance pos, and return false at the end of the input or on a bad value.
+    static bool ReadHeader(const std::string &in, size_t &pos);
+    static bool ReadVarint(const std::string &in, size_t &pos, uint64_t &value);
+    static bool ReadSignedVarint(const std::string &in, size_t &pos, int64_t &value);
+    static bool ReadString(const std::string &in, size_t &pos, std::string &value);
+
+    static constexpr uint8_t ENCODING_TAG = 0xF5;
+    static constexpr uint8_t ENCODING_VERSION = 1;
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+
+#endif // FOUNDATION_APPEXECFWK_SERVICES_FORMMGR_INCLUDE_FORM_STORAGE_CODEC_H
@@ -24,12 +24,14 @@
 #include "appexecfwk_errors.h"
 #include "distributed_kv_data_manager.h"
 #include "form_db_info.h"
+#include "form_storage_batcher.h"
 
 namespace OHOS {
 namespace AppExecFwk {
 /**
  * @class FormStorageMgr
- * Form data storage.
+ * Form data storage. The writes are committed in groups by a FormStorageBatcher, in the binary encoding of
+ * FormStorageCodec; form data written as json before is still loaded, and written again in binary.
  */
 class FormStorageMgr {
 public:
@@ -70,12 +72,29 @@ public:
      */
     ErrCode DeleteStorageFormInfo(const std::string &formId);
 
+    /**
+     * @brief Commit the pending writes to DB.
+     * @return Returns true if all writes are committed.
+     */
+    bool Flush();
+
+    /**
+     * @brief Get the sequence number of the last write committed to DB.
+     * @return Returns the sequence number.
+     */
+    uint64_t GetDurableSequence() const;
+
     void RegisterKvStoreDeathListener();
     bool ResetKvStore();
 
 private:
     void SaveEntries(
     const std::vector<DistributedKv::Entry> &allEntries, std::vector<InnerFormInfo> &innerFormInfos);
+    static void ParseEntries(const std::vector<DistributedKv::Entry> &allEntries,
+        std::vector<InnerFormInfo> &innerFormInfos, std::vector<std::string> &badKeys,
+        std::vector<size_t> &jsonForms, uint64_t &sequence);
+    bool CommitBatch(const std::vector<DistributedKv::Entry> &entries,
+        const std::vector<DistributedKv::Key> &deletedKeys);
     DistributedKv::Status GetEntries(std::vector<DistributedKv::Entry> &allEntries);
     void TryTwice(const std::function<DistributedKv::Status()> &func);
     bool CheckKvStore();
@@ -88,6 +107,7 @@ private:
     std::shared_ptr<DistributedKv::SingleKvStore> kvStorePtr_;
     // std::shared_ptr<DataChangeListener> dataChangeListener_;
     mutable std::mutex kvStorePtrMutex_;
+    std::shared_ptr<FormStorageBatcher> batcher_;
 };
 }  // namespace AppExecFwk
 }  // namespace OHOS
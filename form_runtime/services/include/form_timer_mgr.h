@@ -23,10 +23,12 @@
 #include <list>
 #include <map>
 #include <mutex>
+#include <set>
 #include <singleton.h>
 #include <stdint.h>
 #include <string>
 #include <time.h>
+#include <unordered_map>
 #include <vector>
 
 #include "common_event_subscriber.h"
@@ -36,6 +38,7 @@
 #include "thread_pool.h"
 #include "time_service_client.h"
 #include "timer.h"
+#include "want.h"
 
 namespace OHOS {
 namespace AppExecFwk {
@@ -175,6 +178,13 @@ private:
      * @param task Update at timer item.
      */
     void AddUpdateAtItem(const UpdateAtItem &atItem);
+    /**
+     * @brief Remove update at timer item.
+     * @param formId The Id of the form.
+     * @param atItem The removed update at timer item.
+     * @return Returns true if the item is found, false otherwise.
+     */
+    bool RemoveUpdateAtItem(const int64_t formId, UpdateAtItem &atItem);
     /**
      * @brief Add update interval timer task.
      * @param task Update interval timer task.
@@ -185,6 +195,18 @@ private:
      * @brief interval timer task timeout.
      */
     void OnIntervalTimeOut();
+    /**
+     * @brief Collect the interval timer tasks that are due and schedule their next refresh.
+     * @param currentTime Current time(ms).
+     * @param updateList The due tasks.
+     */
+    void CollectDueIntervalTasks(const int64_t currentTime, std::vector<FormTimer> &updateList);
+    /**
+     * @brief Get the time from which an interval timer task is due.
+     * @param task Interval timer task.
+     * @return Returns the due time(ms).
+     */
+    int64_t GetIntervalDueTime(const FormTimer &task) const;
     /**
      * @brief Get remind tasks.
      * @param remindTasks Remind tasks.
@@ -197,6 +219,10 @@ private:
      * @param flag Enable flag.
      */
     void SetIntervalEnableFlag(int64_t formId, bool flag);
+    /**
+     * @brief Put the interval timer tasks limited when they were due back to the due queue.
+     */
+    void RequeueLimitedIntervalTasks();
     /**
      * @brief Update Interval timer task value.
      * @param formId The Id of the form.
@@ -284,6 +310,19 @@ private:
      */
     void ExecTimerTask(const FormTimer &task);
 
+    /**
+     * @brief Execute Form timer tasks that are triggered together, one task per provider bundle.
+     * @param timerTasks Form timer tasks.
+     */
+    void ExecTimerTasks(const std::vector<FormTimer> &timerTasks);
+
+    /**
+     * @brief Create the want used to refresh the form of a timer task.
+     * @param timerTask Form timer task.
+     * @return Returns the want.
+     */
+    AAFwk::Want CreateTimerTaskWant(const FormTimer &timerTask);
+
     /**
      * @brief Init.
      */
@@ -360,7 +399,14 @@ private:
     mutable std::mutex refreshMutex_;
     FormRefreshLimiter refreshLimiter_;
     std::map<int64_t, FormTimer> intervalTimerTasks_;
-    std::list<UpdateAtItem> updateAtTimerTasks_;
+    // (due time, form id) of every enabled interval timer task that is not limited, so a tick only visits the
+    // tasks that are due.
+    std::set<std::pair<int64_t, int64_t>> intervalDueQueue_;
+    // ids of the interval timer tasks limited when they were due, queued again when the limiter is reset.
+    std::set<int64_t> limitedIntervalTasks_;
+    // update at time -> item, and form id -> item.
+    std::multimap<long, UpdateAtItem> updateAtTimerTasks_;
+    std::unordered_map<int64_t, std::multimap<long, UpdateAtItem>::iterator> updateAtIndex_;
     std::vector<DynamicRefreshItem> dynamicRefreshTasks_;
     std::shared_ptr<TimerReceiver> timerReceiver_ = nullptr;
     std::unique_ptr<ThreadPool> taskExecutor_ = nullptr;
@@ -14,16 +14,32 @@
  */
 
 #include "form_bms_helper.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
 #include "ability_manager_interface.h"
 #include "appexecfwk_errors.h"
 #include "hilog_wrapper.h"
 #include "if_system_ability_manager.h"
+#include "in_process_call_wrapper.h"
 #include "ipc_skeleton.h"
 #include "iservice_registry.h"
 #include "system_ability_definition.h"
 
 namespace OHOS {
 namespace AppExecFwk {
+namespace {
+constexpr int32_t INVALID_UID = -1;
+constexpr int32_t UID_CALLINGUID_TRANSFORM_DIVISOR = 200000;
+// a launcher shows the forms of a few dozen providers at most.
+constexpr size_t MAX_CACHED_BUNDLES = 256;
+const char *BMS_CALL_NAMES[] = {
+    "GetUidByBundleName", "GetBundleNameForUid", "CheckIsSystemAppByUid", "GetBundleInfo",
+};
+}
+
 FormBmsHelper::FormBmsHelper()
 {}
 
@@ -65,6 +81,225 @@ void FormBmsHelper::SetBundleManager(const sptr<IBundleMgr> &bundleManager)
     HILOG_INFO("%{public}s called.", __func__);
 
     iBundleMgr_ = bundleManager;
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    cacheGeneration_++;
+    bundleCache_.clear();
+    uidBundleNames_.clear();
+    hitCount_ = 0;
+    missCount_ = 0;
+    for (auto &stats : callStats_) {
+        stats = BmsCallStats();
+    }
+}
+
+int32_t FormBmsHelper::GetUidByBundleName(const std::string &bundleName, const int32_t userId)
+{
+    BundleKey key(bundleName, userId);
+    uint64_t generation = 0;
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        auto it = bundleCache_.find(key);
+        if (it != bundleCache_.end() && it->second.hasUid) {
+            hitCount_++;
+            return it->second.uid;
+        }
+        missCount_++;
+        generation = cacheGeneration_;
+    }
+
+    sptr<IBundleMgr> iBundleMgr = GetBundleMgr();
+    if (iBundleMgr == nullptr) {
+        HILOG_ERROR("%{public}s, failed to get IBundleMgr.", __func__);
+        return INVALID_UID;
+    }
+    int64_t startTime = GetTimeMicros();
+    int32_t uid = IN_PROCESS_CALL(iBundleMgr->GetUidByBundleName(bundleName, userId));
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    RecordBmsCall(BMS_CALL_GET_UID, startTime);
+    if (uid != INVALID_UID && generation == cacheGeneration_) {
+        auto &item = GetCacheItem(key);
+        item.hasUid = true;
+        item.uid = uid;
+    }
+    return uid;
+}
+
+bool FormBmsHelper::GetBundleNameForUid(const int32_t uid, std::string &bundleName)
+{
+    uint64_t generation = 0;
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        auto it = uidBundleNames_.find(uid);
+        if (it != uidBundleNames_.end()) {
+            hitCount_++;
+            bundleName = it->second;
+            return true;
+        }
+        missCount_++;
+        generation = cacheGeneration_;
+    }
+
+    sptr<IBundleMgr> iBundleMgr = GetBundleMgr();
+    if (iBundleMgr == nullptr) {
+        HILOG_ERROR("%{public}s, failed to get IBundleMgr.", __func__);
+        return false;
+    }
+    int64_t startTime = GetTimeMicros();
+    bool result = IN_PROCESS_CALL(iBundleMgr->GetBundleNameForUid(uid, bundleName));
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    RecordBmsCall(BMS_CALL_GET_BUNDLE_NAME, startTime);
+    if (result && !bundleName.empty() && generation == cacheGeneration_) {
+        if (uidBundleNames_.size() >= MAX_CACHED_BUNDLES) {
+            uidBundleNames_.clear();
+        }
+        uidBundleNames_[uid] = bundleName;
+    }
+    return result;
+}
+
+bool FormBmsHelper::CheckIsSystemAppByBundleName(const std::string &bundleName, const int32_t userId)
+{
+    BundleKey key(bundleName, userId);
+    uint64_t generation = 0;
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        auto it = bundleCache_.find(key);
+        if (it != bundleCache_.end() && it->second.hasSystemApp) {
+            hitCount_++;
+            return it->second.isSystemApp;
+        }
+        missCount_++;
+        generation = cacheGeneration_;
+    }
+
+    int32_t uid = GetUidByBundleName(bundleName, userId);
+    if (uid == INVALID_UID) {
+        HILOG_WARN("%{public}s fail, can not get the uid of %{public}s", __func__, bundleName.c_str());
+        return false;
+    }
+    sptr<IBundleMgr> iBundleMgr = GetBundleMgr();
+    if (iBundleMgr == nullptr) {
+        HILOG_ERROR("%{public}s, failed to get IBundleMgr.", __func__);
+        return false;
+    }
+    int64_t startTime = GetTimeMicros();
+    bool isSystemApp = IN_PROCESS_CALL(iBundleMgr->CheckIsSystemAppByUid(uid));
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    RecordBmsCall(BMS_CALL_CHECK_SYSTEM_APP, startTime);
+    if (generation == cacheGeneration_) {
+        auto &item = GetCacheItem(key);
+        item.hasSystemApp = true;
+        item.isSystemApp = isSystemApp;
+    }
+    return isSystemApp;
+}
+
+bool FormBmsHelper::GetBundleInfoWithAbilities(const std::string &bundleName, const int32_t userId,
+    BundleInfo &bundleInfo)
+{
+    BundleKey key(bundleName, userId);
+    uint64_t generation = 0;
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        auto it = bundleCache_.find(key);
+        if (it != bundleCache_.end() && it->second.bundleInfo != nullptr) {
+            hitCount_++;
+            bundleInfo = *it->second.bundleInfo;
+            return true;
+        }
+        missCount_++;
+        generation = cacheGeneration_;
+    }
+
+    sptr<IBundleMgr> iBundleMgr = GetBundleMgr();
+    if (iBundleMgr == nullptr) {
+        HILOG_ERROR("%{public}s, failed to get IBundleMgr.", __func__);
+        return false;
+    }
+    int64_t startTime = GetTimeMicros();
+    bool result = IN_PROCESS_CALL(iBundleMgr->GetBundleInfo(bundleName, BundleFlag::GET_BUNDLE_WITH_ABILITIES,
+        bundleInfo, userId));
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    RecordBmsCall(BMS_CALL_GET_BUNDLE_INFO, startTime);
+    if (result && generation == cacheGeneration_) {
+        auto &item = GetCacheItem(key);
+        item.bundleInfo = std::make_shared<BundleInfo>(bundleInfo);
+    }
+    return result;
+}
+
+void FormBmsHelper::InvalidateBundle(const std::string &bundleName)
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    cacheGeneration_++;
+    auto it = bundleCache_.lower_bound(BundleKey(bundleName, INT32_MIN));
+    while (it != bundleCache_.end() && it->first.first == bundleName) {
+        it = bundleCache_.erase(it);
+    }
+    for (auto iter = uidBundleNames_.begin(); iter != uidBundleNames_.end();) {
+        if (iter->second == bundleName) {
+            iter = uidBundleNames_.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+}
+
+void FormBmsHelper::InvalidateUser(const int32_t userId)
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    cacheGeneration_++;
+    for (auto it = bundleCache_.begin(); it != bundleCache_.end();) {
+        if (it->first.second == userId) {
+            it = bundleCache_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    for (auto iter = uidBundleNames_.begin(); iter != uidBundleNames_.end();) {
+        if (iter->first / UID_CALLINGUID_TRANSFORM_DIVISOR == userId) {
+            iter = uidBundleNames_.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+}
+
+void FormBmsHelper::DumpCacheInfo(std::string &cacheInfo) const
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    cacheInfo += "  BundleCache: bundles #" + std::to_string(bundleCache_.size()) +
+        ", uids #" + std::to_string(uidBundleNames_.size()) +
+        ", hit #" + std::to_string(hitCount_) + ", miss #" + std::to_string(missCount_) + "\n";
+    for (int32_t type = 0; type < BMS_CALL_TYPE_COUNT; type++) {
+        const auto &stats = callStats_[type];
+        int64_t average = (stats.count == 0) ? 0 : stats.totalTime / static_cast<int64_t>(stats.count);
+        cacheInfo += "  BmsCall " + std::string(BMS_CALL_NAMES[type]) + ": count #" + std::to_string(stats.count) +
+            ", average #" + std::to_string(average) + "us, max #" + std::to_string(stats.maxTime) + "us\n";
+    }
+}
+
+FormBmsHelper::BundleCacheItem &FormBmsHelper::GetCacheItem(const BundleKey &key)
+{
+    if (bundleCache_.size() >= MAX_CACHED_BUNDLES && bundleCache_.find(key) == bundleCache_.end()) {
+        bundleCache_.clear();
+    }
+    return bundleCache_[key];
+}
+
+void FormBmsHelper::RecordBmsCall(BmsCallType type, int64_t startTime)
+{
+    int64_t time = GetTimeMicros() - startTime;
+    auto &stats = callStats_[type];
+    stats.count++;
+    stats.totalTime += time;
+    stats.maxTime = std::max(stats.maxTime, time);
+}
+
+int64_t FormBmsHelper::GetTimeMicros()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
 }
 /**
  * @brief Notify module removable.
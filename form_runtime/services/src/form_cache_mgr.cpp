@@ -13,9 +13,12 @@
  * limitations under the License.
  */
 
-#include "hilog_wrapper.h"
 #include "form_cache_mgr.h"
 
+#include <cinttypes>
+
+#include "hilog_wrapper.h"
+
 namespace OHOS {
 namespace AppExecFwk {
 FormCacheMgr::FormCacheMgr()
@@ -35,30 +38,62 @@ FormCacheMgr::~FormCacheMgr()
  * @return Returns true if this function is successfully called; returns false otherwise.
  */
 bool FormCacheMgr::GetData(const int64_t formId, std::string &data,
-    std::map<std::string, std::pair<sptr<FormAshmem>, int32_t>> &imageMap) const
+    std::map<std::string, std::pair<sptr<FormAshmem>, int32_t>> &imageMap)
+{
+    std::shared_ptr<const FormCacheData> cacheData;
+    if (!GetData(formId, cacheData)) {
+        return false;
+    }
+    data = cacheData->data;
+    imageMap = cacheData->imageMap;
+    return true;
+}
+
+/**
+ * @brief Get form data without copying it.
+ * @param formId, Form id.
+ * @param cacheData, Shared cache data.
+ * @return Returns true if this function is successfully called; returns false otherwise.
+ */
+bool FormCacheMgr::GetData(const int64_t formId, std::shared_ptr<const FormCacheData> &cacheData)
 {
     HILOG_INFO("get cache data");
     std::lock_guard<std::mutex> lock(cacheMutex_);
-    if (cacheData_.empty() && cacheImageMap_.empty()) {
+    if (cacheItems_.empty()) {
         HILOG_ERROR("form cache is empty");
+        missCount_++;
         return false;
     }
-    auto formData = cacheData_.find(formId);
-    if (formData != cacheData_.end()) {
-        data = formData->second;
-    }
-
-    auto imageMapIt = cacheImageMap_.find(formId);
-    if (imageMapIt != cacheImageMap_.end()) {
-        imageMap = imageMapIt->second;
+    auto indexIter = cacheIndex_.find(formId);
+    if (indexIter == cacheIndex_.end() ||
+        (indexIter->second->cacheData->data.empty() && indexIter->second->cacheData->imageMap.empty())) {
+        HILOG_ERROR("form cache not find");
+        missCount_++;
+        return false;
     }
+    // move to the front as the most recently used.
+    cacheItems_.splice(cacheItems_.begin(), cacheItems_, indexIter->second);
+    cacheData = indexIter->second->cacheData;
+    hitCount_++;
+    return true;
+}
 
-    if (data.empty() && imageMap.empty()) {
-        HILOG_ERROR("form cache not find");
+/**
+ * @brief Get form data without touching the recently used order or the hit rate.
+ * @param formId, Form id.
+ * @param cacheData, Form cache data.
+ * @return Returns true if the form data is cached; returns false otherwise.
+ */
+bool FormCacheMgr::PeekData(const int64_t formId, std::shared_ptr<const FormCacheData> &cacheData) const
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    auto indexIter = cacheIndex_.find(formId);
+    if (indexIter == cacheIndex_.end() ||
+        (indexIter->second->cacheData->data.empty() && indexIter->second->cacheData->imageMap.empty())) {
         return false;
-    } else {
-        return true;
     }
+    cacheData = indexIter->second->cacheData;
+    return true;
 }
 
 /**
@@ -72,10 +107,11 @@ bool FormCacheMgr::AddData(const int64_t formId, const std::string &data,
     const std::map<std::string, std::pair<sptr<FormAshmem>, int32_t>> &imageMap)
 {
     HILOG_INFO("add new cache data");
+    auto cacheData = std::make_shared<FormCacheData>();
+    cacheData->data = data;
+    cacheData->imageMap = imageMap;
     std::lock_guard<std::mutex> lock(cacheMutex_);
-    cacheData_[formId] = data;
-    cacheImageMap_[formId] = imageMap;
-    return true;
+    return PutItem(formId, cacheData);
 }
 
 /**
@@ -87,19 +123,11 @@ bool FormCacheMgr::DeleteData(const int64_t formId)
 {
     HILOG_INFO("delete cache data");
     std::lock_guard<std::mutex> lock(cacheMutex_);
-    auto formData = cacheData_.find(formId);
-    if (formData != cacheData_.end()) {
-        cacheData_.erase(formId);
-    } else {
+    if (cacheIndex_.find(formId) == cacheIndex_.end()) {
         HILOG_WARN("cache data is not exist");
+        return true;
     }
-
-    auto imageMap = cacheImageMap_.find(formId);
-    if (imageMap != cacheImageMap_.end()) {
-        cacheImageMap_.erase(formId);
-    } else {
-        HILOG_WARN("image data is not exist");
-    }
+    RemoveItem(formId);
     return true;
 }
 
@@ -113,14 +141,17 @@ bool FormCacheMgr::UpdateData(const int64_t formId, const std::string &data)
 {
     HILOG_INFO("update cache data");
     std::lock_guard<std::mutex> lock(cacheMutex_);
-    auto formData = cacheData_.find(formId);
-    if (formData == cacheData_.end()) {
+    auto indexIter = cacheIndex_.find(formId);
+    if (indexIter == cacheIndex_.end()) {
         HILOG_ERROR("cache data is not exist");
         return false;
     }
 
-    formData->second = data;
-    return true;
+    // readers may still hold the old data, so the updated data is cached as a new copy.
+    auto cacheData = std::make_shared<FormCacheData>();
+    cacheData->data = data;
+    cacheData->imageMap = indexIter->second->cacheData->imageMap;
+    return PutItem(formId, cacheData);
 }
 /**
  * @brief Check if form data is exist or not.
@@ -131,17 +162,90 @@ bool FormCacheMgr::IsExist(const int64_t formId) const
 {
     HILOG_INFO("get cache data");
     std::lock_guard<std::mutex> lock(cacheMutex_);
-    if (cacheData_.empty()) {
+    if (cacheItems_.empty()) {
         HILOG_ERROR("form cache is empty");
         return false;
     }
-    auto formData = cacheData_.find(formId);
-    if (formData == cacheData_.end()) {
+    if (cacheIndex_.find(formId) == cacheIndex_.end()) {
         HILOG_ERROR("cache data not find");
         return false;
     }
 
     return true;
 }
+
+/**
+ * @brief Set the max bytes of the cache, the least recently used forms are evicted when it is exceeded.
+ * @param maxCacheSize The max bytes of the cache.
+ */
+void FormCacheMgr::SetMaxCacheSize(const size_t maxCacheSize)
+{
+    HILOG_INFO("set max cache size: %{public}zu", maxCacheSize);
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    maxCacheSize_ = maxCacheSize;
+    EvictItems();
+}
+
+/**
+ * @brief Dump the size and the hit rate of the cache.
+ * @param cacheInfo Cache dump info.
+ */
+void FormCacheMgr::Dump(std::string &cacheInfo) const
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    uint64_t getCount = hitCount_ + missCount_;
+    uint64_t hitRate = (getCount == 0) ? 0 : hitCount_ * 100 / getCount;
+    cacheInfo += "  FormCache: entries #" + std::to_string(cacheItems_.size()) +
+        ", size #" + std::to_string(cacheSize_) + "/" + std::to_string(maxCacheSize_) +
+        ", hit #" + std::to_string(hitCount_) + ", miss #" + std::to_string(missCount_) +
+        ", hit rate #" + std::to_string(hitRate) + "%" + ", evict #" + std::to_string(evictCount_) + "\n";
+}
+
+bool FormCacheMgr::PutItem(const int64_t formId, const std::shared_ptr<const FormCacheData> &cacheData)
+{
+    RemoveItem(formId);
+    size_t size = GetCacheSize(*cacheData);
+    if (size > maxCacheSize_) {
+        HILOG_WARN("cache data is too large, size: %{public}zu", size);
+        return false;
+    }
+    cacheItems_.push_front({ formId, size, cacheData });
+    cacheIndex_[formId] = cacheItems_.begin();
+    cacheSize_ += size;
+    EvictItems();
+    return true;
+}
+
+void FormCacheMgr::RemoveItem(const int64_t formId)
+{
+    auto indexIter = cacheIndex_.find(formId);
+    if (indexIter == cacheIndex_.end()) {
+        return;
+    }
+    cacheSize_ -= indexIter->second->size;
+    cacheItems_.erase(indexIter->second);
+    cacheIndex_.erase(indexIter);
+}
+
+void FormCacheMgr::EvictItems()
+{
+    while (cacheSize_ > maxCacheSize_ && !cacheItems_.empty()) {
+        HILOG_INFO("evict cache data, formId: %{public}" PRId64 "", cacheItems_.back().formId);
+        RemoveItem(cacheItems_.back().formId);
+        evictCount_++;
+    }
+}
+
+size_t FormCacheMgr::GetCacheSize(const FormCacheData &cacheData)
+{
+    size_t size = cacheData.data.size();
+    for (const auto &image : cacheData.imageMap) {
+        size += image.first.size();
+        if (image.second.first != nullptr && image.second.first->GetAshmemSize() > 0) {
+            size += static_cast<size_t>(image.second.first->GetAshmemSize());
+        }
+    }
+    return size;
+}
 }  // namespace AppExecFwk
 }  // namespace OHOS
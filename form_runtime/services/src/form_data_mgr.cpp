@@ -104,18 +104,17 @@ bool FormDataMgr::AllotFormHostRecord(const FormItemInfo &info, const sptr<IRemo
 {
     HILOG_INFO("%{public}s, allot form Host info", __func__);
     std::lock_guard<std::mutex> lock(formHostRecordMutex_);
-    for (auto &record : clientRecords_) {
-        if (callerToken == record.GetClientStub()) {
-            record.AddForm(formId);
-            HILOG_INFO("%{public}s end", __func__);
-            return true;
-        }
+    auto iter = FindHostRecordNolock(callerToken);
+    if (iter != clientRecords_.end()) {
+        iter->AddForm(formId);
+        HILOG_INFO("%{public}s end", __func__);
+        return true;
     }
     FormHostRecord hostRecord;
     bool isCreated = CreateHostRecord(info, callerToken, callingUid, hostRecord);
     if (isCreated) {
         hostRecord.AddForm(formId);
-        clientRecords_.emplace_back(hostRecord);
+        AddHostRecordNolock(hostRecord);
         HILOG_INFO("%{public}s end", __func__);
         return true;
     }
@@ -466,15 +465,11 @@ bool FormDataMgr::DeleteHostRecord(const sptr<IRemoteObject> &callerToken, const
 {
     HILOG_INFO("%{public}s start, delete form host record", __func__);
     std::lock_guard<std::mutex> lock(formHostRecordMutex_);
-    std::vector<FormHostRecord>::iterator iter;
-    for (iter = clientRecords_.begin(); iter != clientRecords_.end(); ++iter) {
-        if (callerToken == iter->GetClientStub()) {
-            iter->DelForm(formId);
-            if (iter->IsEmpty()) {
-                iter->CleanResource();
-                iter = clientRecords_.erase(iter);
-            }
-            break;
+    auto iter = FindHostRecordNolock(callerToken);
+    if (iter != clientRecords_.end()) {
+        iter->DelForm(formId);
+        if (iter->IsEmpty()) {
+            EraseHostRecordNolock(iter);
         }
     }
     HILOG_INFO("%{public}s end", __func__);
@@ -489,7 +484,7 @@ void FormDataMgr::CleanHostRemovedForms(const std::vector<int64_t> &removedFormI
     HILOG_INFO("%{public}s start, delete form host record by formId list", __func__);
     std::vector<int64_t> matchedIds;
     std::lock_guard<std::mutex> lock(formHostRecordMutex_);
-    std::vector<FormHostRecord>::iterator itHostRecord;
+    std::list<FormHostRecord>::iterator itHostRecord;
     for (itHostRecord = clientRecords_.begin(); itHostRecord != clientRecords_.end(); itHostRecord++) {
         for (const int64_t& formId : removedFormIds) {
             if (itHostRecord->Contains(formId)) {
@@ -514,32 +509,24 @@ void FormDataMgr::HandleHostDied(const sptr<IRemoteObject> &remoteHost)
     std::vector<int64_t> recordTempForms;
     {
         std::lock_guard<std::mutex> lock(formHostRecordMutex_);
-        std::vector<FormHostRecord>::iterator itHostRecord;
-        for (itHostRecord = clientRecords_.begin(); itHostRecord != clientRecords_.end();) {
-            if (remoteHost == itHostRecord->GetClientStub()) {
-                HandleHostDiedForTempForms(*itHostRecord, recordTempForms);
-                HILOG_INFO("find died client, remove it");
-                itHostRecord->CleanResource();
-                itHostRecord = clientRecords_.erase(itHostRecord);
-                break;
-            } else {
-                itHostRecord++;
-            }
+        auto itHostRecord = FindHostRecordNolock(remoteHost);
+        if (itHostRecord != clientRecords_.end()) {
+            HandleHostDiedForTempForms(*itHostRecord, recordTempForms);
+            HILOG_INFO("find died client, remove it");
+            EraseHostRecordNolock(itHostRecord);
         }
     }
     {
         std::lock_guard<std::mutex> lock(formRecordMutex_);
-        std::map<int64_t, FormRecord>::iterator itFormRecord;
-        for (itFormRecord = formRecords_.begin(); itFormRecord != formRecords_.end();) {
-            int64_t formId = itFormRecord->first;
-            // if temp form, remove it
-            if (std::find(recordTempForms.begin(), recordTempForms.end(), formId) != recordTempForms.end()) {
-                FormRecord formRecord = itFormRecord->second;
-                itFormRecord = formRecords_.erase(itFormRecord);
-                FormProviderMgr::GetInstance().NotifyProviderFormDelete(formId, formRecord);
-            } else {
-                itFormRecord++;
+        // temp forms of the died host are removed
+        for (const int64_t formId : recordTempForms) {
+            auto itFormRecord = formRecords_.find(formId);
+            if (itFormRecord == formRecords_.end()) {
+                continue;
             }
+            FormRecord formRecord = itFormRecord->second;
+            formRecords_.erase(itFormRecord);
+            FormProviderMgr::GetInstance().NotifyProviderFormDelete(formId, formRecord);
         }
     }
     {
@@ -669,11 +656,10 @@ bool FormDataMgr::GetMatchedHostClient(const sptr<IRemoteObject> &callerToken, F
 {
     HILOG_INFO("%{public}s, get the matched form host record by client stub.", __func__);
     std::lock_guard<std::mutex> lock(formHostRecordMutex_);
-    for (const FormHostRecord &record : clientRecords_) {
-        if (callerToken == record.GetClientStub()) {
-            formHostRecord = record;
-            return true;
-        }
+    auto iter = clientRecordMap_.find(callerToken.GetRefPtr());
+    if (iter != clientRecordMap_.end()) {
+        formHostRecord = *iter->second;
+        return true;
     }
 
     HILOG_ERROR("%{public}s, form host record not find.", __func__);
@@ -907,7 +893,7 @@ void FormDataMgr::SetVersionUpgrade(const int64_t formId, const bool versionUpgr
 void FormDataMgr::UpdateHostNeedRefresh(const int64_t formId, const bool needRefresh)
 {
     std::lock_guard<std::mutex> lock(formHostRecordMutex_);
-    std::vector<FormHostRecord>::iterator itHostRecord;
+    std::list<FormHostRecord>::iterator itHostRecord;
     for (itHostRecord = clientRecords_.begin(); itHostRecord != clientRecords_.end(); itHostRecord++) {
         if (itHostRecord->Contains(formId)) {
             itHostRecord->SetNeedRefresh(formId, needRefresh);
@@ -925,7 +911,7 @@ bool FormDataMgr::UpdateHostForm(const int64_t formId, const FormRecord &formRec
 {
     bool isUpdated = false;
     std::lock_guard<std::mutex> lock(formHostRecordMutex_);
-    std::vector<FormHostRecord>::iterator itHostRecord;
+    std::list<FormHostRecord>::iterator itHostRecord;
     for (itHostRecord = clientRecords_.begin(); itHostRecord != clientRecords_.end(); itHostRecord++) {
         bool enableRefresh = formRecord.isVisible || itHostRecord->IsEnableUpdate(formId) ||
                              itHostRecord->IsEnableRefresh(formId);
@@ -1016,13 +1002,11 @@ ErrCode FormDataMgr::UpdateHostFormFlag(const std::vector<int64_t> &formIds, con
 {
     HILOG_INFO("%{public}s start, flag: %{public}d", __func__, flag);
     std::lock_guard<std::mutex> lock(formHostRecordMutex_);
-    std::vector<FormHostRecord>::iterator itHostRecord;
-    for (itHostRecord = clientRecords_.begin(); itHostRecord != clientRecords_.end(); itHostRecord++) {
-        if (callerToken == itHostRecord->GetClientStub()) {
-            HandleUpdateHostFormFlag(formIds, flag, isOnlyEnableUpdate, *itHostRecord, refreshForms);
-            HILOG_INFO("%{public}s end.", __func__);
-            return ERR_OK;
-        }
+    auto itHostRecord = FindHostRecordNolock(callerToken);
+    if (itHostRecord != clientRecords_.end()) {
+        HandleUpdateHostFormFlag(formIds, flag, isOnlyEnableUpdate, *itHostRecord, refreshForms);
+        HILOG_INFO("%{public}s end.", __func__);
+        return ERR_OK;
     }
     HILOG_ERROR("%{public}s, can't find target client", __func__);
     return ERR_APPEXECFWK_FORM_OPERATION_NOT_SELF;
@@ -1057,11 +1041,10 @@ int64_t FormDataMgr::FindMatchedFormId(const int64_t formId)
 void FormDataMgr::ClearHostDataByUId(const int uId)
 {
     std::lock_guard<std::mutex> lock(formHostRecordMutex_);
-    std::vector<FormHostRecord>::iterator itHostRecord;
+    std::list<FormHostRecord>::iterator itHostRecord;
     for (itHostRecord = clientRecords_.begin(); itHostRecord != clientRecords_.end();) {
         if (itHostRecord->GetCallerUid() == uId) {
-            itHostRecord->CleanResource();
-            itHostRecord = clientRecords_.erase(itHostRecord);
+            itHostRecord = EraseHostRecordNolock(itHostRecord);
         } else {
             itHostRecord++;
         }
@@ -1255,20 +1238,17 @@ ErrCode FormDataMgr::NotifyFormsVisible(const std::vector<int64_t> &formIds, boo
     {
         HILOG_INFO("%{public}s, get the matched form host record by client stub.", __func__);
         std::lock_guard<std::mutex> lock(formHostRecordMutex_);
-        for (const FormHostRecord &record : clientRecords_) {
-            if (callerToken != record.GetClientStub()) {
-                continue;
-            }
+        auto iter = FindHostRecordNolock(callerToken);
+        if (iter != clientRecords_.end()) {
             for (int64_t formId : formIds) {
                 int64_t matchedFormId = FormDataMgr::GetInstance().FindMatchedFormId(formId);
-                if (!record.Contains(matchedFormId)) {
+                if (!iter->Contains(matchedFormId)) {
                     HILOG_ERROR("%{public}s fail, form is not self-owned, form:%{public}" PRId64 ".", __func__,
                         matchedFormId);
                 } else {
                     foundFormIds.push_back(matchedFormId);
                 }
             }
-            break;
         }
     }
 
@@ -1469,7 +1449,7 @@ int32_t FormDataMgr::ClearHostDataByInvalidForms(int32_t callingUid, std::map<in
 {
     HILOG_INFO("DeleteInvalidForms host start");
     std::lock_guard<std::mutex> lock(formHostRecordMutex_);
-    std::vector<FormHostRecord>::iterator itHostRecord;
+    std::list<FormHostRecord>::iterator itHostRecord;
     for (itHostRecord = clientRecords_.begin(); itHostRecord != clientRecords_.end();) {
         if (itHostRecord->GetCallerUid() != callingUid) {
             itHostRecord++;
@@ -1481,8 +1461,7 @@ int32_t FormDataMgr::ClearHostDataByInvalidForms(int32_t callingUid, std::map<in
             }
         }
         if (itHostRecord->IsEmpty()) {
-            itHostRecord->CleanResource();
-            itHostRecord = clientRecords_.erase(itHostRecord);
+            itHostRecord = EraseHostRecordNolock(itHostRecord);
         } else {
             itHostRecord++;
         }
@@ -1490,5 +1469,44 @@ int32_t FormDataMgr::ClearHostDataByInvalidForms(int32_t callingUid, std::map<in
     HILOG_INFO("DeleteInvalidForms host done");
     return ERR_OK;
 }
+
+/**
+ * @brief Find the form host record by client stub.(NoLock)
+ * @param callerToken The client stub of the form host record.
+ * @return Returns the form host record, clientRecords_.end() if not found.
+ */
+std::list<FormHostRecord>::iterator FormDataMgr::FindHostRecordNolock(const sptr<IRemoteObject> &callerToken)
+{
+    auto iter = clientRecordMap_.find(callerToken.GetRefPtr());
+    if (iter == clientRecordMap_.end()) {
+        return clientRecords_.end();
+    }
+    return iter->second;
+}
+
+/**
+ * @brief Add a form host record.(NoLock)
+ * @param record The form host record.
+ */
+void FormDataMgr::AddHostRecordNolock(const FormHostRecord &record)
+{
+    auto iter = clientRecords_.emplace(clientRecords_.end(), record);
+    clientRecordMap_.emplace(record.GetClientStub().GetRefPtr(), iter);
+}
+
+/**
+ * @brief Clean and erase a form host record.(NoLock)
+ * @param iter The form host record.
+ * @return Returns the form host record after it.
+ */
+std::list<FormHostRecord>::iterator FormDataMgr::EraseHostRecordNolock(std::list<FormHostRecord>::iterator iter)
+{
+    auto itIndex = clientRecordMap_.find(iter->GetClientStub().GetRefPtr());
+    if (itIndex != clientRecordMap_.end() && itIndex->second == iter) {
+        clientRecordMap_.erase(itIndex);
+    }
+    iter->CleanResource();
+    return clientRecords_.erase(iter);
+}
 }  // namespace AppExecFwk
 }  // namespace OHOS
@@ -30,7 +30,6 @@ FormDbCache::FormDbCache()
 {
     HILOG_INFO("FormDbCache is created");
     dataStorage_ = std::make_shared<FormStorageMgr>();
-    formDBInfos_.clear();
 }
 
 FormDbCache::~FormDbCache()
@@ -55,7 +54,10 @@ void FormDbCache::Start()
 
     for (unsigned int i = 0; i < innerFormInfos.size(); i++) {
         FormDBInfo formDBInfo = innerFormInfos.at(i).GetFormDBInfo();
-        formDBInfos_.emplace_back(formDBInfo);
+        if (formDBInfoMap_.find(formDBInfo.formId) != formDBInfoMap_.end()) {
+            continue;
+        }
+        AddFormIndex(formDBInfos_.emplace(formDBInfos_.end(), formDBInfo));
     }
 }
 
@@ -68,22 +70,7 @@ ErrCode FormDbCache::SaveFormInfo(const FormDBInfo &formDBInfo)
 {
     HILOG_INFO("%{public}s called, formId:%{public}" PRId64 "", __func__, formDBInfo.formId);
     std::lock_guard<std::mutex> lock(formDBInfosMutex_);
-    auto iter = find(formDBInfos_.begin(), formDBInfos_.end(), formDBInfo);
-    if (iter != formDBInfos_.end()) {
-        if (iter->Compare(formDBInfo) == false) {
-            HILOG_WARN("%{public}s, need update, formId[%{public}" PRId64 "].", __func__, formDBInfo.formId);
-            *iter = formDBInfo;
-            InnerFormInfo innerFormInfo(formDBInfo);
-            return dataStorage_->ModifyStorageFormInfo(innerFormInfo);
-        } else {
-            HILOG_WARN("%{public}s, already exist, formId[%{public}" PRId64 "].", __func__, formDBInfo.formId);
-            return ERR_OK;
-        }
-    } else {
-        formDBInfos_.emplace_back(formDBInfo);
-        InnerFormInfo innerFormInfo(formDBInfo);
-        return dataStorage_->SaveStorageFormInfo(innerFormInfo);
-    }
+    return SaveFormInfoNolock(formDBInfo);
 }
 
 /**
@@ -94,11 +81,14 @@ ErrCode FormDbCache::SaveFormInfo(const FormDBInfo &formDBInfo)
 ErrCode FormDbCache::SaveFormInfoNolock(const FormDBInfo &formDBInfo)
 {
     HILOG_INFO("%{public}s called, formId:%{public}" PRId64 "", __func__, formDBInfo.formId);
-    auto iter = find(formDBInfos_.begin(), formDBInfos_.end(), formDBInfo);
-    if (iter != formDBInfos_.end()) {
-        if (iter->Compare(formDBInfo) == false) {
+    auto iter = formDBInfoMap_.find(formDBInfo.formId);
+    if (iter != formDBInfoMap_.end()) {
+        FormDBInfoIter itRecord = iter->second;
+        if (itRecord->Compare(formDBInfo) == false) {
             HILOG_WARN("%{public}s, need update, formId[%{public}" PRId64 "].", __func__, formDBInfo.formId);
-            *iter = formDBInfo;
+            RemoveFormIndex(*itRecord);
+            *itRecord = formDBInfo;
+            AddFormIndex(itRecord);
             InnerFormInfo innerFormInfo(formDBInfo);
             return dataStorage_->ModifyStorageFormInfo(innerFormInfo);
         } else {
@@ -106,7 +96,7 @@ ErrCode FormDbCache::SaveFormInfoNolock(const FormDBInfo &formDBInfo)
             return ERR_OK;
         }
     } else {
-        formDBInfos_.emplace_back(formDBInfo);
+        AddFormIndex(formDBInfos_.emplace(formDBInfos_.end(), formDBInfo));
         InnerFormInfo innerFormInfo(formDBInfo);
         return dataStorage_->SaveStorageFormInfo(innerFormInfo);
     }
@@ -120,13 +110,10 @@ ErrCode FormDbCache::SaveFormInfoNolock(const FormDBInfo &formDBInfo)
 ErrCode FormDbCache::DeleteFormInfo(int64_t formId)
 {
     std::lock_guard<std::mutex> lock(formDBInfosMutex_);
-    FormDBInfo tmpForm;
-    tmpForm.formId = formId;
-    auto iter = find(formDBInfos_.begin(), formDBInfos_.end(), tmpForm);
-    if (iter == formDBInfos_.end()) {
+    if (formDBInfoMap_.find(formId) == formDBInfoMap_.end()) {
         HILOG_WARN("%{public}s, not find formId[%{public}" PRId64 "]", __func__, formId);
     } else {
-        formDBInfos_.erase(iter);
+        EraseFormInfoNolock(formId);
     }
     if (dataStorage_->DeleteStorageFormInfo(std::to_string(formId)) == ERR_OK) {
         return ERR_OK;
@@ -144,18 +131,22 @@ ErrCode FormDbCache::DeleteFormInfoByBundleName(const std::string &bundleName, c
     std::vector<FormDBInfo> &removedDBForms)
 {
     std::lock_guard<std::mutex> lock(formDBInfosMutex_);
-    std::vector<FormDBInfo>::iterator itRecord;
-    for (itRecord = formDBInfos_.begin(); itRecord != formDBInfos_.end(); ) {
-        if ((bundleName == itRecord->bundleName) && (userId == itRecord->userId)) {
-            int64_t formId = itRecord->formId;
-            if (dataStorage_->DeleteStorageFormInfo(std::to_string(formId)) == ERR_OK) {
-                removedDBForms.emplace_back(*itRecord);
-                itRecord = formDBInfos_.erase(itRecord);
-            } else {
-                itRecord++;
-            }
-        } else {
-            itRecord++;
+    auto itBundle = bundleFormIds_.find(bundleName);
+    if (itBundle == bundleFormIds_.end()) {
+        return ERR_OK;
+    }
+    std::vector<int64_t> formIds;
+    for (const auto &module : itBundle->second) {
+        formIds.insert(formIds.end(), module.second.begin(), module.second.end());
+    }
+    for (const int64_t formId : formIds) {
+        const FormDBInfo &dbInfo = *formDBInfoMap_[formId];
+        if (userId != dbInfo.userId) {
+            continue;
+        }
+        if (dataStorage_->DeleteStorageFormInfo(std::to_string(formId)) == ERR_OK) {
+            removedDBForms.emplace_back(dbInfo);
+            EraseFormInfoNolock(formId);
         }
     }
     return ERR_OK;
@@ -170,7 +161,7 @@ void FormDbCache::GetAllFormInfo(std::vector<FormDBInfo> &formDBInfos)
 {
     HILOG_INFO("%{public}s called.", __func__);
     std::lock_guard<std::mutex> lock(formDBInfosMutex_);
-    formDBInfos = formDBInfos_;
+    formDBInfos.assign(formDBInfos_.begin(), formDBInfos_.end());
 }
 
 /**
@@ -182,16 +173,16 @@ void FormDbCache::GetAllFormInfo(std::vector<FormDBInfo> &formDBInfos)
 ErrCode FormDbCache::GetDBRecord(const int64_t formId, FormRecord &record) const
 {
     std::lock_guard<std::mutex> lock(formDBInfosMutex_);
-    for (const FormDBInfo &dbInfo : formDBInfos_) {
-        if (dbInfo.formId == formId) {
-            record.userId = dbInfo.userId;
-            record.formName = dbInfo.formName;
-            record.bundleName = dbInfo.bundleName;
-            record.moduleName = dbInfo.moduleName;
-            record.abilityName = dbInfo.abilityName;
-            record.formUserUids = dbInfo.formUserUids;
-            return ERR_OK;
-        }
+    auto iter = formDBInfoMap_.find(formId);
+    if (iter != formDBInfoMap_.end()) {
+        const FormDBInfo &dbInfo = *iter->second;
+        record.userId = dbInfo.userId;
+        record.formName = dbInfo.formName;
+        record.bundleName = dbInfo.bundleName;
+        record.moduleName = dbInfo.moduleName;
+        record.abilityName = dbInfo.abilityName;
+        record.formUserUids = dbInfo.formUserUids;
+        return ERR_OK;
     }
     HILOG_ERROR("%{public}s, not find formId[%{public}" PRId64 "]", __func__, formId);
     return ERR_APPEXECFWK_FORM_NOT_EXIST_ID;
@@ -205,11 +196,10 @@ ErrCode FormDbCache::GetDBRecord(const int64_t formId, FormRecord &record) const
 ErrCode FormDbCache::GetDBRecord(const int64_t formId, FormDBInfo &record) const
 {
     std::lock_guard<std::mutex> lock(formDBInfosMutex_);
-    for (const FormDBInfo &dbInfo : formDBInfos_) {
-        if (dbInfo.formId == formId) {
-            record = dbInfo;
-            return ERR_OK;
-        }
+    auto iter = formDBInfoMap_.find(formId);
+    if (iter != formDBInfoMap_.end()) {
+        record = *iter->second;
+        return ERR_OK;
     }
     HILOG_ERROR("%{public}s, not find formId[%{public}" PRId64 "]", __func__, formId);
     return ERR_APPEXECFWK_FORM_NOT_EXIST_ID;
@@ -266,15 +256,16 @@ ErrCode FormDbCache::GetNoHostDBForms(const int uid, std::map<FormIdKey,
  */
 int FormDbCache::GetMatchCount(const std::string &bundleName, const std::string &moduleName)
 {
-    int32_t matchCount {0};
-    std::vector<FormDBInfo> formDBInfos;
     std::lock_guard<std::mutex> lock(formDBInfosMutex_);
-    for (FormDBInfo &dbInfo : formDBInfos_) {
-        if (dbInfo.bundleName == bundleName && dbInfo.moduleName == moduleName) {
-            ++matchCount;
-        }
+    auto itBundle = bundleFormIds_.find(bundleName);
+    if (itBundle == bundleFormIds_.end()) {
+        return 0;
     }
-    return matchCount;
+    auto itModule = itBundle->second.find(moduleName);
+    if (itModule == itBundle->second.end()) {
+        return 0;
+    }
+    return static_cast<int>(itModule->second.size());
 }
 /**
  * @brief delete forms bu userId.
@@ -284,18 +275,16 @@ int FormDbCache::GetMatchCount(const std::string &bundleName, const std::string
 void FormDbCache::DeleteDBFormsByUserId(const int32_t userId)
 {
     std::lock_guard<std::mutex> lock(formDBInfosMutex_);
-    std::vector<FormDBInfo>::iterator itRecord;
-    for (itRecord = formDBInfos_.begin(); itRecord != formDBInfos_.end();) {
-        if (userId == itRecord->userId) {
-            int64_t formId = itRecord->formId;
-            if (dataStorage_->DeleteStorageFormInfo(std::to_string(formId)) == ERR_OK) {
-                itRecord = formDBInfos_.erase(itRecord);
-            } else {
-                HILOG_ERROR("%{public}s, failed to delete form, formId[%{public}" PRId64 "]", __func__, formId);
-                itRecord++;
-            }
+    auto itUser = userFormIds_.find(userId);
+    if (itUser == userFormIds_.end()) {
+        return;
+    }
+    std::vector<int64_t> formIds(itUser->second.begin(), itUser->second.end());
+    for (const int64_t formId : formIds) {
+        if (dataStorage_->DeleteStorageFormInfo(std::to_string(formId)) == ERR_OK) {
+            EraseFormInfoNolock(formId);
         } else {
-            itRecord++;
+            HILOG_ERROR("%{public}s, failed to delete form, formId[%{public}" PRId64 "]", __func__, formId);
         }
     }
 }
@@ -304,6 +293,61 @@ std::shared_ptr<FormStorageMgr> FormDbCache::GetDataStorage() const
     return dataStorage_;
 }
 
+/**
+ * @brief Add a form data to the indexes.(NoLock)
+ * @param iter The form data.
+ */
+void FormDbCache::AddFormIndex(const FormDBInfoIter &iter)
+{
+    formDBInfoMap_[iter->formId] = iter;
+    bundleFormIds_[iter->bundleName][iter->moduleName].emplace(iter->formId);
+    userFormIds_[iter->userId].emplace(iter->formId);
+}
+
+/**
+ * @brief Remove a form data from the indexes.(NoLock)
+ * @param formDBInfo The form data.
+ */
+void FormDbCache::RemoveFormIndex(const FormDBInfo &formDBInfo)
+{
+    auto itBundle = bundleFormIds_.find(formDBInfo.bundleName);
+    if (itBundle != bundleFormIds_.end()) {
+        auto itModule = itBundle->second.find(formDBInfo.moduleName);
+        if (itModule != itBundle->second.end()) {
+            itModule->second.erase(formDBInfo.formId);
+            if (itModule->second.empty()) {
+                itBundle->second.erase(itModule);
+            }
+        }
+        if (itBundle->second.empty()) {
+            bundleFormIds_.erase(itBundle);
+        }
+    }
+    auto itUser = userFormIds_.find(formDBInfo.userId);
+    if (itUser != userFormIds_.end()) {
+        itUser->second.erase(formDBInfo.formId);
+        if (itUser->second.empty()) {
+            userFormIds_.erase(itUser);
+        }
+    }
+}
+
+/**
+ * @brief Erase a form data from DbCache and the indexes.(NoLock)
+ * @param formId Form data Id.
+ */
+void FormDbCache::EraseFormInfoNolock(const int64_t formId)
+{
+    auto iter = formDBInfoMap_.find(formId);
+    if (iter == formDBInfoMap_.end()) {
+        return;
+    }
+    FormDBInfoIter itRecord = iter->second;
+    formDBInfoMap_.erase(iter);
+    RemoveFormIndex(*itRecord);
+    formDBInfos_.erase(itRecord);
+}
+
 /**
  * @brief handle get no host invalid DB forms.
  * @param userId User ID.
@@ -317,13 +361,13 @@ void FormDbCache::GetNoHostInvalidDBForms(int32_t userId, int32_t callingUid, st
                                           std::map<int64_t, bool> &foundFormsMap)
 {
     std::lock_guard<std::mutex> lock(formDBInfosMutex_);
-    for (auto &formRecord: formDBInfos_) {
-        int64_t formId = formRecord.formId;
-
-        // check userID
-        if (userId != formRecord.userId) {
-            continue;
-        }
+    auto itUser = userFormIds_.find(userId);
+    if (itUser == userFormIds_.end()) {
+        return;
+    }
+    std::vector<int64_t> formIds(itUser->second.begin(), itUser->second.end());
+    for (const int64_t formId : formIds) {
+        FormDBInfo &formRecord = *formDBInfoMap_[formId];
         // check UID
         auto iter = std::find(formRecord.formUserUids.begin(), formRecord.formUserUids.end(), callingUid);
         if (iter == formRecord.formUserUids.end()) {
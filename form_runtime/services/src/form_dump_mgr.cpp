@@ -12,6 +12,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include "form_bms_helper.h"
 #include "form_cache_mgr.h"
 #include "hilog_wrapper.h"
 #include "form_dump_mgr.h"
@@ -87,11 +88,10 @@ void FormDumpMgr::DumpFormInfos(const std::vector<FormRecord> &formRecordInfos,
         }
 
         // formCacheData
-        std::string strCacheData;
-        std::map<std::string, std::pair<sptr<FormAshmem>, int32_t>> imageMap;
-        if (FormCacheMgr::GetInstance().GetData(info.formId, strCacheData, imageMap)) {
+        std::shared_ptr<const FormCacheData> cacheData;
+        if (FormCacheMgr::GetInstance().PeekData(info.formId, cacheData)) {
             formInfos += "    formCacheData [";
-            formInfos += strCacheData;
+            formInfos += cacheData->data;
             formInfos += "]\n" + LINE_SEPARATOR;
         }
     }
@@ -163,15 +163,32 @@ void FormDumpMgr::DumpFormInfo(const FormRecord &formRecordInfo, std::string &fo
     }
 
     // formCacheData
-    std::string strCacheData;
-    std::map<std::string, std::pair<sptr<FormAshmem>, int32_t>> imageMap;
-    if (FormCacheMgr::GetInstance().GetData(formRecordInfo.formId, strCacheData, imageMap)) {
+    std::shared_ptr<const FormCacheData> cacheData;
+    if (FormCacheMgr::GetInstance().PeekData(formRecordInfo.formId, cacheData)) {
         formInfo += "    formCacheData[";
-        formInfo += strCacheData;
+        formInfo += cacheData->data;
         formInfo += "]\n" + LINE_SEPARATOR;
     }
 
     HILOG_INFO("%{public}s success. Form infos:%{public}s", __func__, formInfo.c_str());
 }
+/**
+ * @brief Dump the size and the hit rate of the form cache.
+ * @param formInfos Form cache dump info.
+ */
+void FormDumpMgr::DumpFormCacheInfo(std::string &formInfos) const
+{
+    HILOG_INFO("%{public}s called.", __func__);
+    FormCacheMgr::GetInstance().Dump(formInfos);
+}
+/**
+ * @brief Dump the size and the hit rate of the bundle cache, and the time of the bundle manager calls.
+ * @param formInfos Bundle cache dump info.
+ */
+void FormDumpMgr::DumpBundleCacheInfo(std::string &formInfos) const
+{
+    HILOG_INFO("%{public}s called.", __func__);
+    FormBmsHelper::GetInstance().DumpCacheInfo(formInfos);
+}
 }  // namespace AppExecFwk
 }  // namespace OHOS
\ No newline at end of file
@@ -311,7 +311,7 @@ ErrCode BundleFormInfo::UpdateFormInfoStorageLocked()
             HILOG_ERROR("bad form infos.");
             return ERR_APPEXECFWK_PARSE_BAD_PROFILE;
         }
-        std::string formInfoStoragesStr = jsonObject.dump(Constants::DUMP_INDENT);
+        std::string formInfoStoragesStr = jsonObject.dump();
         errCode = FormInfoStorageMgr::GetInstance().UpdateBundleFormInfos(bundleName_, formInfoStoragesStr);
     }
     return errCode;
@@ -17,6 +17,7 @@
 #include <thread>
 #include <unistd.h>
 #include "form_mgr_errors.h"
+#include "form_storage_codec.h"
 #include "hilog_wrapper.h"
 #include "kvstore_death_recipient_callback.h"
 
@@ -66,17 +67,24 @@ FormInfoStorageMgr::FormInfoStorageMgr()
         HILOG_WARN("distribute database ipc error and try to call again, result = %{public}d", status);
     }
     RegisterKvStoreDeathListener();
+    batcher_ = std::make_shared<FormStorageBatcher>(
+        [this](const std::vector<DistributedKv::Entry> &entries, const std::vector<DistributedKv::Key> &deletedKeys) {
+            return CommitBatch(entries, deletedKeys);
+        }, FormStorageBatcher::GetFlushHandler());
     HILOG_INFO("FormInfoStorageMgr is created");
 }
 
 FormInfoStorageMgr::~FormInfoStorageMgr()
 {
+    Flush();
+    batcher_.reset();
     dataManager_.CloseKvStore(appId_, kvStorePtr_);
 }
 
 ErrCode FormInfoStorageMgr::LoadFormInfos(std::vector<std::pair<std::string, std::string>> &formInfoStorages)
 {
     HILOG_INFO("FormInfoStorageMgr load all form infos");
+    Flush();
     {
         std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
         if (!CheckKvStore()) {
@@ -99,7 +107,14 @@ ErrCode FormInfoStorageMgr::LoadFormInfos(std::vector<std::pair<std::string, std
     }
 
     for (const auto &item: allEntries) {
-        formInfoStorages.emplace_back(item.key.ToString(), item.value.ToString());
+        std::string key = item.key.ToString();
+        if (key == FormStorageBatcher::SEQUENCE_KEY) {
+            uint64_t sequence = 0;
+            FormStorageCodec::DecodeSequence(item.value.ToString(), sequence);
+            batcher_->SetDurableSequence(sequence);
+            continue;
+        }
+        formInfoStorages.emplace_back(key, item.value.ToString());
     }
 
     return ERR_OK;
@@ -113,6 +128,14 @@ ErrCode FormInfoStorageMgr::GetBundleFormInfos(const std::string &bundleName, st
     }
 
     HILOG_INFO("FormInfoStorageMgr get form info, bundleName=%{public}s", bundleName.c_str());
+    bool deleted = false;
+    if (batcher_->GetPending(bundleName, formInfoStorages, deleted)) {
+        if (deleted) {
+            HILOG_ERROR("%{public}s not match any FormInfo", bundleName.c_str());
+            return ERR_APPEXECFWK_FORM_COMMON_CODE;
+        }
+        return ERR_OK;
+    }
     {
         std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
         if (!CheckKvStore()) {
@@ -151,29 +174,7 @@ ErrCode FormInfoStorageMgr::SaveBundleFormInfos(const std::string &bundleName, c
     }
 
     HILOG_INFO("FormInfoStorageMgr save form info, bundleName=%{public}s", bundleName.c_str());
-    {
-        std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
-        if (!CheckKvStore()) {
-            HILOG_ERROR("kvStore is nullptr");
-            return ERR_APPEXECFWK_FORM_COMMON_CODE;
-        }
-    }
-
-    DistributedKv::Key key(bundleName);
-    DistributedKv::Value value(formInfoStorages);
-    DistributedKv::Status status;
-    {
-        std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
-        status = kvStorePtr_->Put(key, value);
-        if (status == DistributedKv::Status::IPC_ERROR) {
-            status = kvStorePtr_->Put(key, value);
-            HILOG_WARN("distribute database ipc error and try to call again, result = %{public}d", status);
-        }
-    }
-    if (status != DistributedKv::Status::SUCCESS) {
-        HILOG_ERROR("save formInfoStorages to kvStore error: %{public}d", status);
-        return ERR_APPEXECFWK_FORM_COMMON_CODE;
-    }
+    batcher_->Put(bundleName, formInfoStorages);
     return ERR_OK;
 }
 
@@ -185,29 +186,7 @@ ErrCode FormInfoStorageMgr::RemoveBundleFormInfos(const std::string &bundleName)
     }
 
     HILOG_INFO("FormInfoStorageMgr remove form info, bundleName=%{public}s", bundleName.c_str());
-    {
-        std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
-        if (!CheckKvStore()) {
-            HILOG_ERROR("kvStore is nullptr");
-            return ERR_APPEXECFWK_FORM_COMMON_CODE;
-        }
-    }
-
-    DistributedKv::Key key(bundleName);
-    DistributedKv::Status status;
-    {
-        std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
-        status = kvStorePtr_->Delete(key);
-        if (status == DistributedKv::Status::IPC_ERROR) {
-            status = kvStorePtr_->Delete(key);
-            HILOG_WARN("distribute database ipc error and try to call again, result = %{public}d", status);
-        }
-    }
-
-    if (status != DistributedKv::Status::SUCCESS) {
-        HILOG_ERROR("remove formInfoStorages from kvStore error: %{public}d", status);
-        return ERR_APPEXECFWK_FORM_COMMON_CODE;
-    }
+    batcher_->Delete(bundleName);
     return ERR_OK;
 }
 
@@ -219,37 +198,46 @@ ErrCode FormInfoStorageMgr::UpdateBundleFormInfos(const std::string &bundleName,
     }
 
     HILOG_INFO("FormInfoStorageMgr update form info, bundleName=%{public}s", bundleName.c_str());
-    {
-        std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
-        if (!CheckKvStore()) {
-            HILOG_ERROR("kvStore is nullptr");
-            return ERR_APPEXECFWK_FORM_COMMON_CODE;
-        }
-    }
-    DistributedKv::Key key(bundleName);
-    DistributedKv::Status status;
+    // a put replaces the stored value.
+    batcher_->Put(bundleName, formInfoStorages);
+    return ERR_OK;
+}
+
+bool FormInfoStorageMgr::Flush()
+{
+    return batcher_ == nullptr || batcher_->Flush();
+}
+
+bool FormInfoStorageMgr::CommitBatch(const std::vector<DistributedKv::Entry> &entries,
+    const std::vector<DistributedKv::Key> &deletedKeys)
+{
     std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
-    status = kvStorePtr_->Delete(key);
-    if (status == DistributedKv::Status::IPC_ERROR) {
-        status = kvStorePtr_->Delete(key);
-        HILOG_WARN("distribute database ipc error and try to call again, result = %{public}d", status);
+    if (!CheckKvStore()) {
+        HILOG_ERROR("kvStore is nullptr");
+        return false;
     }
-    if (status != DistributedKv::Status::SUCCESS && status != DistributedKv::Status::KEY_NOT_FOUND) {
-        HILOG_ERROR("update formInfoStorages to kvStore error: %{public}d", status);
-        return ERR_APPEXECFWK_FORM_COMMON_CODE;
+    DistributedKv::Status status;
+    if (!deletedKeys.empty()) {
+        status = kvStorePtr_->DeleteBatch(deletedKeys);
+        if (status == DistributedKv::Status::IPC_ERROR) {
+            status = kvStorePtr_->DeleteBatch(deletedKeys);
+            HILOG_WARN("distribute database ipc error and try to call again, result = %{public}d", status);
+        }
+        if (status != DistributedKv::Status::SUCCESS && status != DistributedKv::Status::KEY_NOT_FOUND) {
+            HILOG_ERROR("remove formInfoStorages from kvStore error: %{public}d", status);
+            return false;
+        }
     }
-
-    DistributedKv::Value value(formInfoStorages);
-    status = kvStorePtr_->Put(key, value);
+    status = kvStorePtr_->PutBatch(entries);
     if (status == DistributedKv::Status::IPC_ERROR) {
-        status = kvStorePtr_->Put(key, value);
+        status = kvStorePtr_->PutBatch(entries);
         HILOG_WARN("distribute database ipc error and try to call again, result = %{public}d", status);
     }
     if (status != DistributedKv::Status::SUCCESS) {
-        HILOG_ERROR("update formInfoStorages to kvStore error: %{public}d", status);
-        return ERR_APPEXECFWK_FORM_COMMON_CODE;
+        HILOG_ERROR("save formInfoStorages to kvStore error: %{public}d", status);
+        return false;
     }
-    return ERR_OK;
+    return true;
 }
 
 DistributedKv::Status FormInfoStorageMgr::GetKvStore()
@@ -396,17 +396,10 @@ int FormMgrAdapter::UpdateForm(const int64_t formId,
         return ERR_APPEXECFWK_FORM_INVALID_PARAM;
     }
 
-    // get IBundleMgr
-    sptr<IBundleMgr> iBundleMgr = FormBmsHelper::GetInstance().GetBundleMgr();
-    if (iBundleMgr == nullptr) {
-        HILOG_ERROR("%{public}s error, failed to get IBundleMgr.", __func__);
-        return ERR_APPEXECFWK_FORM_GET_BMS_FAILED;
-    }
-
     // check bundle uid for permission
     int callingUid = IPCSkeleton::GetCallingUid();
     int32_t userId = GetCurrentUserId(callingUid);
-    int32_t bundleUid = IN_PROCESS_CALL(iBundleMgr->GetUidByBundleName(bundleName, userId));
+    int32_t bundleUid = FormBmsHelper::GetInstance().GetUidByBundleName(bundleName, userId);
     if (bundleUid != callingUid) {
         HILOG_ERROR("%{public}s error, permission denied, the updated form is not your own.", __func__);
         return ERR_APPEXECFWK_FORM_INVALID_PARAM;
@@ -496,14 +489,10 @@ ErrCode FormMgrAdapter::NotifyWhetherVisibleForms(const std::vector<int64_t> &fo
         return ERR_APPEXECFWK_FORM_INVALID_PARAM;
     }
 
-    sptr<IBundleMgr> iBundleMgr = FormBmsHelper::GetInstance().GetBundleMgr();
-    if (iBundleMgr == nullptr) {
-        HILOG_ERROR("%{public}s fail, failed to get IBundleMgr.", __func__);
-        return ERR_APPEXECFWK_FORM_GET_BMS_FAILED;
-    }
-
     int64_t matchedFormId;
     std::map<std::string, std::vector<int64_t>> eventMaps;
+    // the forms of a provider are usually many, check each provider once.
+    std::map<std::string, bool> systemAppProviders;
     for (int64_t formId : formIds) {
         if (formId <= 0) {
             HILOG_WARN("%{public}s, formId %{public}" PRId64 " is less than 0", __func__, formId);
@@ -517,7 +506,12 @@ ErrCode FormMgrAdapter::NotifyWhetherVisibleForms(const std::vector<int64_t> &fo
         }
 
         // Check if the form provider is system app
-        if (!CheckIsSystemAppByBundleName(iBundleMgr, formRecord.bundleName)) {
+        auto providerIter = systemAppProviders.find(formRecord.bundleName);
+        if (providerIter == systemAppProviders.end()) {
+            providerIter = systemAppProviders.emplace(formRecord.bundleName,
+                CheckIsSystemAppByBundleName(formRecord.bundleName)).first;
+        }
+        if (!providerIter->second) {
             continue;
         }
 
@@ -646,6 +640,8 @@ int FormMgrAdapter::DumpStorageFormInfos(std::string &formInfos) const
             return formDBInfoA.formId < formDBInfoB.formId;
         });
         FormDumpMgr::GetInstance().DumpStorageFormInfos(formDBInfos, formInfos);
+        FormDumpMgr::GetInstance().DumpFormCacheInfo(formInfos);
+        FormDumpMgr::GetInstance().DumpBundleCacheInfo(formInfos);
         return ERR_OK;
     } else {
         return ERR_APPEXECFWK_FORM_NOT_EXIST_ID;
@@ -852,11 +848,10 @@ ErrCode FormMgrAdapter::AddExistFormRecord(const FormItemInfo &info, const sptr<
     }
 
     // create form info for js
-    std::string cacheData;
-    std::map<std::string, std::pair<sptr<FormAshmem>, int32_t>> imageMap;
-    if (FormCacheMgr::GetInstance().GetData(formId, cacheData, imageMap)) {
-        formInfo.formData = cacheData;
-        formInfo.formProviderData.SetImageDataMap(imageMap);
+    std::shared_ptr<const FormCacheData> cacheData;
+    if (FormCacheMgr::GetInstance().GetData(formId, cacheData)) {
+        formInfo.formData = cacheData->data;
+        formInfo.formProviderData.SetImageDataMap(cacheData->imageMap);
     }
     FormDataMgr::GetInstance().CreateFormInfo(formId, record, formInfo);
 
@@ -1045,14 +1040,8 @@ ErrCode FormMgrAdapter::GetBundleInfo(const AAFwk::Want &want, BundleInfo &bundl
         return ERR_APPEXECFWK_FORM_INVALID_PARAM;
     }
 
-    sptr<IBundleMgr> iBundleMgr = FormBmsHelper::GetInstance().GetBundleMgr();
-    if (iBundleMgr == nullptr) {
-        HILOG_ERROR("GetBundleMgr, failed to get IBundleMgr.");
-        return ERR_APPEXECFWK_FORM_GET_BMS_FAILED;
-    }
-
-    if (!IN_PROCESS_CALL(iBundleMgr->GetBundleInfo(bundleName, AppExecFwk::BundleFlag::GET_BUNDLE_WITH_ABILITIES,
-        bundleInfo, FormUtil::GetCurrentAccountId()))) {
+    if (!FormBmsHelper::GetInstance().GetBundleInfoWithAbilities(bundleName, FormUtil::GetCurrentAccountId(),
+        bundleInfo)) {
         HILOG_ERROR("GetBundleInfo, failed to get bundle info.");
         return ERR_APPEXECFWK_FORM_GET_INFO_FAILED;
     }
@@ -1187,14 +1176,9 @@ ErrCode FormMgrAdapter::CreateFormItemInfo(const BundleInfo &bundleInfo,
     itemInfo.SetVersionName(bundleInfo.versionName);
     itemInfo.SetCompatibleVersion(bundleInfo.compatibleVersion);
 
-    sptr<IBundleMgr> iBundleMgr = FormBmsHelper::GetInstance().GetBundleMgr();
-    if (iBundleMgr == nullptr) {
-        HILOG_ERROR("GetFormInfo, failed to get IBundleMgr.");
-        return ERR_APPEXECFWK_FORM_GET_BMS_FAILED;
-    }
     std::string hostBundleName {};
     auto callingUid = IPCSkeleton::GetCallingUid();
-    if (!IN_PROCESS_CALL(iBundleMgr->GetBundleNameForUid(callingUid, hostBundleName))) {
+    if (!FormBmsHelper::GetInstance().GetBundleNameForUid(callingUid, hostBundleName)) {
         HILOG_ERROR("GetFormsInfoByModule, failed to get form config info.");
         return ERR_APPEXECFWK_FORM_GET_INFO_FAILED;
     }
@@ -1254,18 +1238,11 @@ int FormMgrAdapter::SetNextRefreshTime(const int64_t formId, const int64_t nextT
         return ERR_APPEXECFWK_FORM_GET_BUNDLE_FAILED;
     }
 
-    // get IBundleMgr
-    sptr<IBundleMgr> iBundleMgr = FormBmsHelper::GetInstance().GetBundleMgr();
-    if (iBundleMgr == nullptr) {
-        HILOG_ERROR("%{public}s error, failed to get IBundleMgr.", __func__);
-        return ERR_APPEXECFWK_FORM_GET_BMS_FAILED;
-    }
-
     int callingUid = IPCSkeleton::GetCallingUid();
     int32_t userId = GetCurrentUserId(callingUid);
     HILOG_INFO("%{public}s, userId:%{public}d, callingUid:%{public}d.", __func__, userId, callingUid);
 
-    int32_t bundleUid = IN_PROCESS_CALL(iBundleMgr->GetUidByBundleName(bundleName, userId));
+    int32_t bundleUid = FormBmsHelper::GetInstance().GetUidByBundleName(bundleName, userId);
     if (bundleUid != callingUid) {
         HILOG_ERROR("%{public}s error, permission denied, the form is not your own.", __func__);
         return ERR_APPEXECFWK_FORM_INVALID_PARAM;
@@ -1527,14 +1504,8 @@ int FormMgrAdapter::RouterEvent(const int64_t formId, Want &want)
         return ERR_APPEXECFWK_FORM_NOT_EXIST_ID;
     }
 
-    sptr<IBundleMgr> iBundleMgr = FormBmsHelper::GetInstance().GetBundleMgr();
-    if (iBundleMgr == nullptr) {
-        HILOG_ERROR("%{public}s fail, failed to get IBundleMgr.", __func__);
-        return ERR_APPEXECFWK_FORM_GET_BMS_FAILED;
-    }
-
     if (record.bundleName != want.GetBundle()) {
-        if (!CheckIsSystemAppByBundleName(iBundleMgr, record.bundleName)) {
+        if (!CheckIsSystemAppByBundleName(record.bundleName)) {
             HILOG_WARN("Only system apps can launch the ability of the other apps.");
             want.SetBundle(record.bundleName);
         }
@@ -1773,13 +1744,17 @@ bool FormMgrAdapter::UpdateProviderInfoToHost(const int64_t matchedFormId, const
 
     // If the form need refrsh flag is true and form visibleType is FORM_VISIBLE, refresh the form host.
     if (formRecord.needRefresh && formVisibleType == Constants::FORM_VISIBLE) {
-        std::string cacheData;
-        std::map<std::string, std::pair<sptr<FormAshmem>, int32_t>> imageMap;
+        std::shared_ptr<const FormCacheData> cacheData;
         // If the form has business cache, refresh the form host.
-        if (FormCacheMgr::GetInstance().GetData(matchedFormId, cacheData, imageMap)) {
-            formRecord.formProviderInfo.SetFormDataString(cacheData);
-            formRecord.formProviderInfo.SetImageDataMap(imageMap);
+        if (FormCacheMgr::GetInstance().GetData(matchedFormId, cacheData)) {
+            formRecord.formProviderInfo.SetFormDataString(cacheData->data);
+            formRecord.formProviderInfo.SetImageDataMap(cacheData->imageMap);
             formHostRecord.OnUpdate(matchedFormId, formRecord);
+        } else {
+            // The business cache has been evicted, ask the provider for the form data again.
+            Want want;
+            want.SetParam(Constants::PARAM_FORM_USER_ID, formRecord.userId);
+            FormProviderMgr::GetInstance().RefreshForm(matchedFormId, want, true);
         }
     }
     return true;
@@ -1791,22 +1766,13 @@ bool FormMgrAdapter::UpdateProviderInfoToHost(const int64_t matchedFormId, const
  * @param bundleName BundleName
  * @return Returns true if the form provider is system app, false if not.
  */
-bool FormMgrAdapter::CheckIsSystemAppByBundleName(const sptr<IBundleMgr> &iBundleMgr, const std::string &bundleName)
+bool FormMgrAdapter::CheckIsSystemAppByBundleName(const std::string &bundleName)
 {
-    BundleInfo bundleInfo;
-    if (IN_PROCESS_CALL(iBundleMgr->GetBundleInfo(bundleName, BundleFlag::GET_BUNDLE_DEFAULT,
-        bundleInfo, FormUtil::GetCurrentAccountId()))) {
-        HILOG_DEBUG("%{public}s, get bundle uid success", __func__);
-        if (!IN_PROCESS_CALL(iBundleMgr->CheckIsSystemAppByUid(bundleInfo.uid))) {
-            HILOG_WARN("%{public}s fail, form provider is not system app, bundleName: %{public}s",
-                __func__, bundleName.c_str());
-            return false;
-        }
-    } else {
-        HILOG_WARN("%{public}s fail, can not get bundleInfo's uid", __func__);
+    if (!FormBmsHelper::GetInstance().CheckIsSystemAppByBundleName(bundleName, FormUtil::GetCurrentAccountId())) {
+        HILOG_WARN("%{public}s fail, form provider is not system app, bundleName: %{public}s",
+            __func__, bundleName.c_str());
         return false;
     }
-
     return true;
 }
 
@@ -2087,13 +2053,7 @@ int FormMgrAdapter::UpdateRouterAction(const int64_t formId, std::string &action
         return ERR_APPEXECFWK_FORM_NOT_EXIST_ID;
     }
 
-    sptr<IBundleMgr> iBundleMgr = FormBmsHelper::GetInstance().GetBundleMgr();
-    if (iBundleMgr == nullptr) {
-        HILOG_ERROR("%{public}s fail, failed to get IBundleMgr.", __func__);
-        return ERR_APPEXECFWK_FORM_GET_BMS_FAILED;
-    }
-
-    if (CheckIsSystemAppByBundleName(iBundleMgr, record.bundleName)) {
+    if (CheckIsSystemAppByBundleName(record.bundleName)) {
         return ERR_OK;
     }
 
@@ -29,6 +29,7 @@
 #include "form_data_mgr.h"
 #include "form_db_cache.h"
 #include "form_info_mgr.h"
+#include "form_info_storage_mgr.h"
 #include "form_mgr_adapter.h"
 #include "form_mgr_errors.h"
 #include "form_task_mgr.h"
@@ -156,15 +157,9 @@ int FormMgrService::ReleaseForm(const int64_t formId, const sptr<IRemoteObject>
  */
 int FormMgrService::UpdateForm(const int64_t formId, const FormProviderData &formBindingData)
 {
-    // get IBundleMgr
-    sptr<IBundleMgr> bundleMgr = FormBmsHelper::GetInstance().GetBundleMgr();
-    if (bundleMgr == nullptr) {
-        HILOG_ERROR("%{public}s error, failed to get bundleMgr.", __func__);
-        return ERR_APPEXECFWK_FORM_GET_BMS_FAILED;
-    }
     std::string callerBundleName;
     auto callingUid = IPCSkeleton::GetCallingUid();
-    if (!IN_PROCESS_CALL(bundleMgr->GetBundleNameForUid(callingUid, callerBundleName))) {
+    if (!FormBmsHelper::GetInstance().GetBundleNameForUid(callingUid, callerBundleName)) {
         HILOG_ERROR("GetFormsInfoByModule, failed to get form config info.");
         return ERR_APPEXECFWK_FORM_GET_INFO_FAILED;
     }
@@ -456,6 +451,14 @@ void FormMgrService::OnStop()
 
     state_ = ServiceRunningState::STATE_NOT_START;
 
+    // the form data written behind reaches the DB before the service is gone.
+    if (!FormDbCache::GetInstance().GetDataStorage()->Flush()) {
+        HILOG_ERROR("%{public}s, flush form data failed", __func__);
+    }
+    if (!FormInfoStorageMgr::GetInstance().Flush()) {
+        HILOG_ERROR("%{public}s, flush form infos failed", __func__);
+    }
+
     if (handler_) {
         handler_.reset();
     }
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "form_storage_batcher.h"
+
+#include <algorithm>
+#include <cinttypes>
+
+#include "form_storage_codec.h"
+#include "hilog_wrapper.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace {
+const std::string FLUSH_RUNNER_NAME = "FormStorageFlush";
+// a group failing to commit is tried again after this.
+constexpr int64_t RETRY_DELAY_MS = 1000;
+}  // namespace
+
+// no form id or bundle name starts with '#'.
+const std::string FormStorageBatcher::SEQUENCE_KEY = "#sequence";
+
+FormStorageBatcher::FormStorageBatcher(const CommitFunc &commit, const std::shared_ptr<EventHandler> &handler,
+    int64_t delayMs, size_t maxBatchSize)
+    : commit_(commit), handler_(handler), delayMs_(delayMs), maxBatchSize_(std::max(maxBatchSize, size_t(1)))
+{}
+
+FormStorageBatcher::~FormStorageBatcher()
+{
+    if (!Flush()) {
+        HILOG_ERROR("%{public}zu writes are lost", pending_.size());
+    }
+}
+
+uint64_t FormStorageBatcher::Put(const std::string &key, const std::string &value)
+{
+    return Write(key, value, false);
+}
+
+uint64_t FormStorageBatcher::Delete(const std::string &key)
+{
+    return Write(key, "", true);
+}
+
+bool FormStorageBatcher::GetPending(const std::string &key, std::string &value, bool &deleted)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = pending_.find(key);
+    if (it == pending_.end()) {
+        it = committing_.find(key);
+        if (it == committing_.end()) {
+            return false;
+        }
+    }
+    deleted = it->second.deleted;
+    value = it->second.value;
+    return true;
+}
+
+bool FormStorageBatcher::Flush()
+{
+    return CommitPending();
+}
+
+uint64_t FormStorageBatcher::GetDurableSequence()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return durableSequence_;
+}
+
+void FormStorageBatcher::SetDurableSequence(uint64_t sequence)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    durableSequence_ = sequence;
+    nextSequence_ = std::max(nextSequence_, sequence + 1);
+}
+
+size_t FormStorageBatcher::GetPendingCount()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pending_.size();
+}
+
+std::shared_ptr<EventHandler> FormStorageBatcher::GetFlushHandler()
+{
+    static std::shared_ptr<EventHandler> handler =
+        std::make_shared<EventHandler>(EventRunner::Create(FLUSH_RUNNER_NAME));
+    return handler;
+}
+
+uint64_t FormStorageBatcher::Write(const std::string &key, const std::string &value, bool deleted)
+{
+    uint64_t sequence;
+    bool commitNow = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        sequence = nextSequence_++;
+        PendingWrite &write = pending_[key];
+        write.sequence = sequence;
+        write.deleted = deleted;
+        write.value = value;
+        if (pending_.size() < maxBatchSize_) {
+            ScheduleLocked(delayMs_);
+        } else if (handler_ != nullptr) {
+            ScheduleLocked(0);
+        } else {
+            commitNow = true;
+        }
+    }
+    if (commitNow) {
+        CommitPending();
+    }
+    return sequence;
+}
+
+void FormStorageBatcher::ScheduleLocked(int64_t delayMs)
+{
+    // a full group goes at once, whether a delayed commit is posted or not.
+    bool &scheduled = delayMs == 0 ? urgentScheduled_ : scheduled_;
+    if (handler_ == nullptr || scheduled) {
+        return;
+    }
+    auto task = [weak = weak_from_this()]() {
+        auto self = weak.lock();
+        if (self != nullptr) {
+            self->OnFlushTask();
+        }
+    };
+    scheduled = handler_->PostTask(task, delayMs);
+}
+
+void FormStorageBatcher::OnFlushTask()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        scheduled_ = false;
+        urgentScheduled_ = false;
+    }
+    if (!CommitPending()) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ScheduleLocked(RETRY_DELAY_MS);
+    }
+}
+
+bool FormStorageBatcher::CommitPending()
+{
+    std::lock_guard<std::mutex> commitLock(commitMutex_);
+    uint64_t lastSequence = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (pending_.empty()) {
+            return true;
+        }
+        committing_.swap(pending_);
+    }
+
+    // committing_ is changed under both locks only, so it is read here without mutex_.
+    std::vector<DistributedKv::Entry> entries;
+    std::vector<DistributedKv::Key> deletedKeys;
+    entries.reserve(committing_.size() + 1);
+    for (const auto &item : committing_) {
+        lastSequence = std::max(lastSequence, item.second.sequence);
+        if (item.second.deleted) {
+            deletedKeys.emplace_back(item.first);
+            continue;
+        }
+        DistributedKv::Entry entry;
+        entry.key = item.first;
+        entry.value = item.second.value;
+        entries.emplace_back(entry);
+    }
+    DistributedKv::Entry sequenceEntry;
+    sequenceEntry.key = SEQUENCE_KEY;
+    sequenceEntry.value = FormStorageCodec::EncodeSequence(lastSequence);
+    entries.emplace_back(sequenceEntry);
+
+    bool result = commit_ != nullptr && commit_(entries, deletedKeys);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (result) {
+        durableSequence_ = lastSequence;
+        HILOG_DEBUG("committed %{public}zu writes, durable sequence: %{public}" PRIu64,
+            committing_.size(), lastSequence);
+    } else {
+        // kept unless written again meanwhile.
+        for (auto &item : committing_) {
+            pending_.emplace(item.first, std::move(item.second));
+        }
+        HILOG_ERROR("commit failed, %{public}zu writes pending", pending_.size());
+    }
+    committing_.clear();
+    return result;
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
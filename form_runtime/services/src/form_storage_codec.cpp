@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "form_storage_codec.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace {
+constexpr uint32_t VARINT_SHIFT = 7;
+constexpr uint8_t VARINT_MASK = 0x7F;
+constexpr uint8_t VARINT_MORE = 0x80;
+constexpr uint32_t VARINT_MAX_SHIFT = 63;
+// more uids than this in a form is a bad value.
+constexpr uint64_t MAX_USER_UIDS = 0x10000;
+}  // namespace
+
+bool FormStorageCodec::IsEncoded(const std::string &value)
+{
+    size_t pos = 0;
+    return ReadHeader(value, pos);
+}
+
+std::string FormStorageCodec::EncodeFormDBInfo(const FormDBInfo &formDBInfo)
+{
+    std::string out;
+    WriteHeader(out);
+    WriteSignedVarint(out, formDBInfo.formId);
+    WriteSignedVarint(out, formDBInfo.userId);
+    WriteString(out, formDBInfo.formName);
+    WriteString(out, formDBInfo.bundleName);
+    WriteString(out, formDBInfo.moduleName);
+    WriteString(out, formDBInfo.abilityName);
+    WriteVarint(out, formDBInfo.formUserUids.size());
+    for (int uid : formDBInfo.formUserUids) {
+        WriteSignedVarint(out, uid);
+    }
+    return out;
+}
+
+bool FormStorageCodec::DecodeFormDBInfo(const std::string &value, FormDBInfo &formDBInfo)
+{
+    size_t pos = 0;
+    if (!ReadHeader(value, pos)) {
+        nlohmann::json jsonObject = nlohmann::json::parse(value, nullptr, false);
+        if (jsonObject.is_discarded()) {
+            return false;
+        }
+        InnerFormInfo innerFormInfo;
+        if (!innerFormInfo.FromJson(jsonObject)) {
+            return false;
+        }
+        formDBInfo = innerFormInfo.GetFormDBInfo();
+        return true;
+    }
+
+    int64_t formId = 0;
+    int64_t userId = 0;
+    uint64_t uidCount = 0;
+    FormDBInfo info;
+    if (!ReadSignedVarint(value, pos, formId) || !ReadSignedVarint(value, pos, userId) ||
+        !ReadString(value, pos, info.formName) || !ReadString(value, pos, info.bundleName) ||
+        !ReadString(value, pos, info.moduleName) || !ReadString(value, pos, info.abilityName) ||
+        !ReadVarint(value, pos, uidCount) || uidCount > MAX_USER_UIDS) {
+        return false;
+    }
+    info.formId = formId;
+    info.userId = static_cast<int32_t>(userId);
+    info.formUserUids.reserve(uidCount);
+    for (uint64_t i = 0; i < uidCount; i++) {
+        int64_t uid = 0;
+        if (!ReadSignedVarint(value, pos, uid)) {
+            return false;
+        }
+        info.formUserUids.emplace_back(static_cast<int>(uid));
+    }
+    if (pos != value.size()) {
+        return false;
+    }
+    formDBInfo = std::move(info);
+    return true;
+}
+
+std::string FormStorageCodec::EncodeSequence(uint64_t sequence)
+{
+    std::string out;
+    WriteHeader(out);
+    WriteVarint(out, sequence);
+    return out;
+}
+
+bool FormStorageCodec::DecodeSequence(const std::string &value, uint64_t &sequence)
+{
+    size_t pos = 0;
+    return ReadHeader(value, pos) && ReadVarint(value, pos, sequence) && pos == value.size();
+}
+
+void FormStorageCodec::WriteHeader(std::string &out)
+{
+    out.push_back(static_cast<char>(ENCODING_TAG));
+    out.push_back(static_cast<char>(ENCODING_VERSION));
+}
+
+void FormStorageCodec::WriteVarint(std::string &out, uint64_t value)
+{
+    while (value > VARINT_MASK) {
+        out.push_back(static_cast<char>((value & VARINT_MASK) | VARINT_MORE));
+        value >>= VARINT_SHIFT;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+void FormStorageCodec::WriteSignedVarint(std::string &out, int64_t value)
+{
+    // zigzag, so small negative values stay short.
+    WriteVarint(out, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> VARINT_MAX_SHIFT));
+}
+
+void FormStorageCodec::WriteString(std::string &out, const std::string &value)
+{
+    WriteVarint(out, value.size());
+    out.append(value);
+}
+
+bool FormStorageCodec::ReadHeader(const std::string &in, size_t &pos)
+{
+    if (in.size() < pos + 2 || static_cast<uint8_t>(in[pos]) != ENCODING_TAG ||
+        static_cast<uint8_t>(in[pos + 1]) != ENCODING_VERSION) {
+        return false;
+    }
+    pos += 2;
+    return true;
+}
+
+bool FormStorageCodec::ReadVarint(const std::string &in, size_t &pos, uint64_t &value)
+{
+    uint64_t result = 0;
+    for (uint32_t shift = 0; shift <= VARINT_MAX_SHIFT; shift += VARINT_SHIFT) {
+        if (pos >= in.size()) {
+            return false;
+        }
+        uint8_t byte = static_cast<uint8_t>(in[pos++]);
+        result |= static_cast<uint64_t>(byte & VARINT_MASK) << shift;
+        if ((byte & VARINT_MORE) == 0) {
+            value = result;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FormStorageCodec::ReadSignedVarint(const std::string &in, size_t &pos, int64_t &value)
+{
+    uint64_t result = 0;
+    if (!ReadVarint(in, pos, result)) {
+        return false;
+    }
+    value = static_cast<int64_t>(result >> 1) ^ -static_cast<int64_t>(result & 1);
+    return true;
+}
+
+bool FormStorageCodec::ReadString(const std::string &in, size_t &pos, std::string &value)
+{
+    uint64_t size = 0;
+    if (!ReadVarint(in, pos, size) || size > in.size() - pos) {
+        return false;
+    }
+    value.assign(in, pos, size);
+    pos += size;
+    return true;
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
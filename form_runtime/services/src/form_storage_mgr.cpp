@@ -15,6 +15,7 @@
 
 #include "form_storage_mgr.h"
 
+#include <chrono>
 #include <cinttypes>
 #include <dirent.h>
 #include <fstream>
@@ -23,8 +24,10 @@
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <unordered_set>
 
 #include "form_mgr_errors.h"
+#include "form_storage_codec.h"
 #include "form_storage_mgr.h"
 #include "hilog_wrapper.h"
 #include "kvstore_death_recipient_callback.h"
@@ -44,49 +47,68 @@ FormStorageMgr::FormStorageMgr()
     HILOG_INFO("instance is created");
     TryTwice([this] { return GetKvStore(); });
     RegisterKvStoreDeathListener();
+    batcher_ = std::make_shared<FormStorageBatcher>(
+        [this](const std::vector<DistributedKv::Entry> &entries, const std::vector<DistributedKv::Key> &deletedKeys) {
+            return CommitBatch(entries, deletedKeys);
+        }, FormStorageBatcher::GetFlushHandler());
 }
 
 FormStorageMgr::~FormStorageMgr()
 {
     HILOG_INFO("instance is destroyed");
+    Flush();
+    batcher_.reset();
     dataManager_.CloseKvStore(appId_, kvStorePtr_);
 }
 
 void FormStorageMgr::SaveEntries(
     const std::vector<DistributedKv::Entry> &allEntries, std::vector<InnerFormInfo> &innerFormInfos)
 {
-    for (const auto &item : allEntries) {
-        std::string formId;
-        InnerFormInfo innerFormInfo;
+    std::vector<std::string> badKeys;
+    std::vector<size_t> jsonForms;
+    uint64_t sequence = 0;
+    ParseEntries(allEntries, innerFormInfos, badKeys, jsonForms, sequence);
+    batcher_->SetDurableSequence(sequence);
+    for (const auto &key : badKeys) {
+        HILOG_ERROR("error key: %{private}s", key.c_str());
+        // it's an bad value, delete it
+        batcher_->Delete(key);
+    }
+    // written again in binary, so they load faster next time.
+    for (size_t index : jsonForms) {
+        const InnerFormInfo &innerFormInfo = innerFormInfos[index];
+        batcher_->Put(std::to_string(innerFormInfo.GetFormId()),
+            FormStorageCodec::EncodeFormDBInfo(innerFormInfo.GetFormDBInfo()));
+    }
+    HILOG_INFO("SaveEntries end, forms: %{public}zu, durable sequence: %{public}" PRIu64,
+        innerFormInfos.size(), sequence);
+}
 
-        nlohmann::json jsonObject = nlohmann::json::parse(item.value.ToString(), nullptr, false);
-        if (jsonObject.is_discarded()) {
-            HILOG_ERROR("error key: %{private}s", item.key.ToString().c_str());
-            // it's an bad json, delete it
-            {
-                std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
-                kvStorePtr_->Delete(item.key);
-            }
+void FormStorageMgr::ParseEntries(const std::vector<DistributedKv::Entry> &allEntries,
+    std::vector<InnerFormInfo> &innerFormInfos, std::vector<std::string> &badKeys,
+    std::vector<size_t> &jsonForms, uint64_t &sequence)
+{
+    std::unordered_set<int64_t> formIds;
+    innerFormInfos.reserve(innerFormInfos.size() + allEntries.size());
+    for (const auto &item : allEntries) {
+        std::string value = item.value.ToString();
+        if (item.key.ToString() == FormStorageBatcher::SEQUENCE_KEY) {
+            FormStorageCodec::DecodeSequence(value, sequence);
             continue;
         }
-        if (innerFormInfo.FromJson(jsonObject) != true) {
-            HILOG_ERROR("error key: %{private}s", item.key.ToString().c_str());
-            // it's an error value, delete it
-            {
-                std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
-                kvStorePtr_->Delete(item.key);
-            }
+        FormDBInfo formDBInfo;
+        if (!FormStorageCodec::DecodeFormDBInfo(value, formDBInfo)) {
+            badKeys.emplace_back(item.key.ToString());
             continue;
         }
-
-        if (std::find(innerFormInfos.begin(), innerFormInfos.end(), innerFormInfo) == innerFormInfos.end()) {
-            HILOG_DEBUG("emplace FormInfos: %{public}s", formId.c_str());
-            std::map<std::string, InnerFormInfo> allDevicesInfos;
-            allDevicesInfos.emplace(formId, innerFormInfo);
-            innerFormInfos.emplace_back(innerFormInfo);
+        if (!formIds.insert(formDBInfo.formId).second) {
+            continue;
         }
+        if (!FormStorageCodec::IsEncoded(value)) {
+            jsonForms.emplace_back(innerFormInfos.size());
+        }
+        innerFormInfos.emplace_back(formDBInfo);
     }
-    HILOG_DEBUG("SaveEntries end");
 }
 
 /**
@@ -98,6 +120,8 @@ ErrCode FormStorageMgr::LoadFormData(std::vector<InnerFormInfo> &innerFormInfos)
 {
     HILOG_INFO("%{public}s called.", __func__);
     bool ret = ERR_OK;
+    auto start = std::chrono::steady_clock::now();
+    Flush();
     {
         std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
         if (!CheckKvStore()) {
@@ -119,7 +143,10 @@ ErrCode FormStorageMgr::LoadFormData(std::vector<InnerFormInfo> &innerFormInfos)
         SaveEntries(allEntries, innerFormInfos);
     }
 
-    HILOG_INFO("%{public}s, readdir over", __func__);
+    int64_t duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start).count();
+    HILOG_INFO("%{public}s, readdir over, forms: %{public}zu, cost: %{public}" PRId64 " ms", __func__,
+        innerFormInfos.size(), duration);
     return ret;
 }
 
@@ -133,6 +160,18 @@ ErrCode FormStorageMgr::GetStorageFormInfoById(const std::string &formId, InnerF
     ErrCode ret = ERR_OK;
     HILOG_DEBUG("%{public}s called, formId[%{public}s]", __func__, formId.c_str());
 
+    std::string value;
+    bool deleted = false;
+    if (batcher_->GetPending(formId, value, deleted)) {
+        FormDBInfo formDBInfo;
+        if (deleted || !FormStorageCodec::DecodeFormDBInfo(value, formDBInfo)) {
+            HILOG_ERROR("%{public}s not match any FormInfo", formId.c_str());
+            return ERR_APPEXECFWK_FORM_COMMON_CODE;
+        }
+        innerFormInfo.SetFormDBInfo(formDBInfo);
+        return ERR_OK;
+    }
+
     {
         std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
         if (!CheckKvStore()) {
@@ -142,30 +181,25 @@ ErrCode FormStorageMgr::GetStorageFormInfoById(const std::string &formId, InnerF
     }
 
     DistributedKv::Status status = DistributedKv::Status::ERROR;
-    std::vector<DistributedKv::Entry> allEntries;
     DistributedKv::Key key(formId);
+    DistributedKv::Value storedValue;
     if (kvStorePtr_) {
-        // sync call GetEntries, the callback will be trigger at once
-        status = kvStorePtr_->GetEntries(key, allEntries);
+        status = kvStorePtr_->Get(key, storedValue);
     }
 
-    if (status != DistributedKv::Status::SUCCESS) {
+    if (status == DistributedKv::Status::KEY_NOT_FOUND) {
+        HILOG_ERROR("%{public}s not match any FormInfo", formId.c_str());
+        ret = ERR_APPEXECFWK_FORM_COMMON_CODE;
+    } else if (status != DistributedKv::Status::SUCCESS) {
         HILOG_ERROR("get entries error: %{public}d", status);
         ret = ERR_APPEXECFWK_FORM_COMMON_CODE;
     } else {
-        if (allEntries.empty()) {
-            HILOG_ERROR("%{public}s not match any FormInfo", formId.c_str());
+        FormDBInfo formDBInfo;
+        if (!FormStorageCodec::DecodeFormDBInfo(storedValue.ToString(), formDBInfo)) {
+            HILOG_ERROR("error key: %{private}s", formId.c_str());
             ret = ERR_APPEXECFWK_FORM_COMMON_CODE;
         } else {
-            nlohmann::json jsonObject = nlohmann::json::parse(allEntries.front().value.ToString(), nullptr, false);
-            if (jsonObject.is_discarded()) {
-                HILOG_ERROR("error key: %{private}s", allEntries.front().key.ToString().c_str());
-                ret = ERR_APPEXECFWK_FORM_COMMON_CODE;
-            }
-            if (innerFormInfo.FromJson(jsonObject) != true) {
-                HILOG_ERROR("error key: %{private}s", allEntries.front().key.ToString().c_str());
-                ret = ERR_APPEXECFWK_FORM_COMMON_CODE;
-            }
+            innerFormInfo.SetFormDBInfo(formDBInfo);
         }
     }
 
@@ -180,33 +214,9 @@ ErrCode FormStorageMgr::GetStorageFormInfoById(const std::string &formId, InnerF
 ErrCode FormStorageMgr::SaveStorageFormInfo(const InnerFormInfo &innerFormInfo)
 {
     HILOG_INFO("%{public}s called, formId[%{public}" PRId64 "]", __func__, innerFormInfo.GetFormId());
-    ErrCode ret = ERR_OK;
     std::string formId = std::to_string(innerFormInfo.GetFormId());
-
-    {
-        std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
-        if (!CheckKvStore()) {
-            HILOG_ERROR("kvStore is nullptr");
-            return ERR_APPEXECFWK_FORM_COMMON_CODE;
-        }
-    }
-
-    DistributedKv::Key key(formId);
-    DistributedKv::Value value(innerFormInfo.ToString());
-    DistributedKv::Status status;
-    {
-        std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
-        status = kvStorePtr_->Put(key, value);
-        if (status == DistributedKv::Status::IPC_ERROR) {
-            status = kvStorePtr_->Put(key, value);
-            HILOG_WARN("distribute database ipc error and try to call again, result = %{public}d", status);
-        }
-    }
-    if (status != DistributedKv::Status::SUCCESS) {
-        HILOG_ERROR("put innerFormInfo to kvStore error: %{public}d", status);
-        ret = ERR_APPEXECFWK_FORM_COMMON_CODE;
-    }
-    return ret;
+    batcher_->Put(formId, FormStorageCodec::EncodeFormDBInfo(innerFormInfo.GetFormDBInfo()));
+    return ERR_OK;
 }
 
 /**
@@ -217,15 +227,8 @@ ErrCode FormStorageMgr::SaveStorageFormInfo(const InnerFormInfo &innerFormInfo)
 ErrCode FormStorageMgr::ModifyStorageFormInfo(const InnerFormInfo &innerFormInfo)
 {
     HILOG_INFO("%{public}s called, formId[%{public}" PRId64 "]", __func__, innerFormInfo.GetFormId());
-
-    ErrCode ret = ERR_OK;
-    std::string formId = std::to_string(innerFormInfo.GetFormId());
-    ret = DeleteStorageFormInfo(formId);
-    if (ret == ERR_OK) {
-        SaveStorageFormInfo(innerFormInfo);
-    }
-
-    return ret;
+    // a put replaces the stored value.
+    return SaveStorageFormInfo(innerFormInfo);
 }
 
 /**
@@ -236,34 +239,56 @@ ErrCode FormStorageMgr::ModifyStorageFormInfo(const InnerFormInfo &innerFormInfo
 ErrCode FormStorageMgr::DeleteStorageFormInfo(const std::string &formId)
 {
     HILOG_INFO("%{public}s called, formId[%{public}s]", __func__, formId.c_str());
+    batcher_->Delete(formId);
+    return ERR_OK;
+}
 
-    {
-        std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
-        if (!CheckKvStore()) {
-            HILOG_ERROR("kvStore is nullptr");
-            return ERR_APPEXECFWK_FORM_COMMON_CODE;
-        }
-    }
-    DistributedKv::Key key(formId);
-    DistributedKv::Status status;
+/**
+ * @brief Commit the pending writes to DB.
+ * @return Returns true if all writes are committed.
+ */
+bool FormStorageMgr::Flush()
+{
+    return batcher_ == nullptr || batcher_->Flush();
+}
 
-    {
-        std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
-        status = kvStorePtr_->Delete(key);
-        if (status == DistributedKv::Status::IPC_ERROR) {
-            status = kvStorePtr_->Delete(key);
-            HILOG_WARN("distribute database ipc error and try to call again, result = %{public}d", status);
+/**
+ * @brief Get the sequence number of the last write committed to DB.
+ * @return Returns the sequence number.
+ */
+uint64_t FormStorageMgr::GetDurableSequence() const
+{
+    return batcher_->GetDurableSequence();
+}
+
+bool FormStorageMgr::CommitBatch(const std::vector<DistributedKv::Entry> &entries,
+    const std::vector<DistributedKv::Key> &deletedKeys)
+{
+    std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
+    if (!CheckKvStore()) {
+        HILOG_ERROR("kvStore is nullptr");
+        return false;
+    }
+    DistributedKv::Status status = DistributedKv::Status::SUCCESS;
+    if (!deletedKeys.empty()) {
+        TryTwice([this, &status, &deletedKeys] {
+            status = kvStorePtr_->DeleteBatch(deletedKeys);
+            return status;
+        });
+        if (status != DistributedKv::Status::SUCCESS && status != DistributedKv::Status::KEY_NOT_FOUND) {
+            HILOG_ERROR("delete keys error: %{public}d", status);
+            return false;
         }
     }
-
+    TryTwice([this, &status, &entries] {
+        status = kvStorePtr_->PutBatch(entries);
+        return status;
+    });
     if (status != DistributedKv::Status::SUCCESS) {
-        HILOG_ERROR("delete key error: %{public}d", status);
-        return ERR_APPEXECFWK_FORM_COMMON_CODE;
-    } else {
-        HILOG_ERROR("delete value to kvStore success");
+        HILOG_ERROR("put innerFormInfos to kvStore error: %{public}d", status);
+        return false;
     }
-
-    return ERR_OK;
+    return true;
 }
 
 void FormStorageMgr::RegisterKvStoreDeathListener()
@@ -64,6 +64,15 @@ void FormSysEventReceiver::OnReceiveEvent(const EventFwk::CommonEventData &event
         return;
     }
     HILOG_INFO("%{public}s, action:%{public}s.", __func__, action.c_str());
+    if (action == EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_ADDED ||
+        action == EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_CHANGED ||
+        action == EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_REMOVED ||
+        action == EventFwk::CommonEventSupport::COMMON_EVENT_ABILITY_UPDATED) {
+        // drop the cached bundle metadata now, before the requests that follow the event.
+        FormBmsHelper::GetInstance().InvalidateBundle(bundleName);
+    } else if (action == EventFwk::CommonEventSupport::COMMON_EVENT_USER_REMOVED && eventData.GetCode() != -1) {
+        FormBmsHelper::GetInstance().InvalidateUser(eventData.GetCode());
+    }
     if (action == EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_ADDED ||
         action == EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_CHANGED) {
         // install or update
@@ -23,6 +23,7 @@
 #include "common_event_support.h"
 #include "context/context.h"
 #include "form_constants.h"
+#include "form_data_mgr.h"
 #include "form_provider_mgr.h"
 #include "form_refresh_limiter.h"
 #include "form_timer_option.h"
@@ -186,7 +187,12 @@ bool FormTimerMgr::UpdateIntervalValue(const int64_t formId, const FormTimerCfg
     std::lock_guard<std::mutex> lock(intervalMutex_);
     auto intervalTask = intervalTimerTasks_.find(formId);
     if (intervalTask != intervalTimerTasks_.end()) {
+        // a disabled or limited task is not queued, it is queued with the new period when it is back.
+        bool queued = intervalDueQueue_.erase(std::make_pair(GetIntervalDueTime(intervalTask->second), formId)) > 0;
         intervalTask->second.period = timerCfg.updateDuration / timeSpeed_;
+        if (queued) {
+            intervalDueQueue_.emplace(GetIntervalDueTime(intervalTask->second), formId);
+        }
         return true;
     } else {
         HILOG_ERROR("%{public}s failed, the interval timer is not exist", __func__);
@@ -208,17 +214,8 @@ bool FormTimerMgr::UpdateAtTimerValue(const int64_t formId, const FormTimerCfg &
     }
     {
         std::lock_guard<std::mutex> lock(updateAtMutex_);
-        std::list<UpdateAtItem>::iterator itItem;
         UpdateAtItem changedItem;
-        for (itItem = updateAtTimerTasks_.begin(); itItem != updateAtTimerTasks_.end(); itItem++) {
-            if (itItem->refreshTask.formId == formId) {
-                changedItem = *itItem;
-                updateAtTimerTasks_.erase(itItem);
-                break;
-            }
-        }
-
-        if (changedItem.refreshTask.formId == 0) {
+        if (!RemoveUpdateAtItem(formId, changedItem)) {
             HILOG_ERROR("%{public}s failed, the update at timer is not exist", __func__);
             return false;
         }
@@ -253,6 +250,8 @@ bool FormTimerMgr::IntervalToAtTimer(const int64_t formId, const FormTimerCfg &t
     auto intervalTask = intervalTimerTasks_.find(formId);
     if (intervalTask != intervalTimerTasks_.end()) {
         timerTask = intervalTask->second;
+        intervalDueQueue_.erase(std::make_pair(GetIntervalDueTime(timerTask), formId));
+        limitedIntervalTasks_.erase(formId);
         intervalTimerTasks_.erase(intervalTask);
 
         timerTask.isUpdateAt = true;
@@ -285,14 +284,7 @@ bool FormTimerMgr::AtTimerToIntervalTimer(const int64_t formId, const FormTimerC
     UpdateAtItem targetItem;
     {
         std::lock_guard<std::mutex> lock(updateAtMutex_);
-        std::list<UpdateAtItem>::iterator itItem;
-        for (itItem = updateAtTimerTasks_.begin(); itItem != updateAtTimerTasks_.end(); itItem++) {
-            if (itItem->refreshTask.formId == formId) {
-                targetItem = *itItem;
-                updateAtTimerTasks_.erase(itItem);
-                break;
-            }
-        }
+        RemoveUpdateAtItem(formId, targetItem);
     }
 
     if (!UpdateAtTimerAlarm()) {
@@ -381,13 +373,7 @@ bool FormTimerMgr::SetNextRefreshTime(const int64_t formId, const long nextGapTi
 
 void FormTimerMgr::SetEnableFlag(int64_t formId, bool flag)
 {
-    // try interval list
-    auto iter = intervalTimerTasks_.find(formId);
-    if (iter != intervalTimerTasks_.end()) {
-        iter->second.isEnable = flag;
-        HILOG_INFO("%{public}s, formId:%{public}" PRId64 ", isEnable:%{public}d", __func__, formId, flag ? 1 : 0);
-        return;
-    }
+    SetIntervalEnableFlag(formId, flag);
 }
 
 /**
@@ -418,12 +404,9 @@ bool FormTimerMgr::AddUpdateAtTimer(const FormTimer &task)
     HILOG_INFO("%{public}s start", __func__);
     {
         std::lock_guard<std::mutex> lock(updateAtMutex_);
-        for (auto &updateAtTimer : updateAtTimerTasks_) {
-            if (updateAtTimer.refreshTask.formId == task.formId) {
-                HILOG_WARN(
-                    "%{public}s, already exist formTimer, formId:%{public}" PRId64 " task", __func__, task.formId);
-                return true;
-            }
+        if (updateAtIndex_.find(task.formId) != updateAtIndex_.end()) {
+            HILOG_WARN("%{public}s, already exist formTimer, formId:%{public}" PRId64 " task", __func__, task.formId);
+            return true;
         }
 
         UpdateAtItem atItem;
@@ -460,6 +443,9 @@ bool FormTimerMgr::AddIntervalTimer(const FormTimer &task)
             return true;
         }
         intervalTimerTasks_.emplace(task.formId, task);
+        if (task.isEnable) {
+            intervalDueQueue_.emplace(GetIntervalDueTime(task), task.formId);
+        }
     }
     if (!UpdateLimiterAlarm()) {
         HILOG_ERROR("%{public}s, failed to UpdateLimiterAlarm", __func__);
@@ -473,30 +459,26 @@ bool FormTimerMgr::AddIntervalTimer(const FormTimer &task)
  */
 void FormTimerMgr::AddUpdateAtItem(const UpdateAtItem &atItem)
 {
-    if (updateAtTimerTasks_.empty()) {
-        updateAtTimerTasks_.emplace_back(atItem);
-        return;
-    }
-
-    UpdateAtItem firstItem = updateAtTimerTasks_.front();
-    if (atItem.updateAtTime < firstItem.updateAtTime) {
-        updateAtTimerTasks_.emplace_front(atItem);
-        return;
-    }
-
-    bool isInsert = false;
-    std::list<UpdateAtItem>::iterator itItem;
-    for (itItem = updateAtTimerTasks_.begin(); itItem != updateAtTimerTasks_.end(); itItem++) {
-        if (atItem.updateAtTime < itItem->updateAtTime) {
-            updateAtTimerTasks_.insert(itItem, atItem);
-            isInsert = true;
-            break;
-        }
-    }
-
-    if (!isInsert) {
-        updateAtTimerTasks_.emplace_back(atItem);
+    // items of the same time keep the order they are added in.
+    auto itItem = updateAtTimerTasks_.emplace(atItem.updateAtTime, atItem);
+    updateAtIndex_[atItem.refreshTask.formId] = itItem;
+}
+/**
+ * @brief Remove update at timer item.
+ * @param formId The Id of the form.
+ * @param atItem The removed update at timer item.
+ * @return Returns true if the item is found, false otherwise.
+ */
+bool FormTimerMgr::RemoveUpdateAtItem(const int64_t formId, UpdateAtItem &atItem)
+{
+    auto indexIter = updateAtIndex_.find(formId);
+    if (indexIter == updateAtIndex_.end()) {
+        return false;
     }
+    atItem = indexIter->second->second;
+    updateAtTimerTasks_.erase(indexIter->second);
+    updateAtIndex_.erase(indexIter);
+    return true;
 }
 /**
  * @brief Handle system time changed.
@@ -523,11 +505,10 @@ bool FormTimerMgr::HandleResetLimiter()
 
     std::vector<FormTimer> remindTasks;
     bool bGetTasks = GetRemindTasks(remindTasks);
+    RequeueLimitedIntervalTasks();
     if (bGetTasks) {
         HILOG_INFO("%{public}s failed, remind when reset limiter", __func__);
-        for (auto &task : remindTasks) {
-            ExecTimerTask(task);
-        }
+        ExecTimerTasks(remindTasks);
     }
 
     HILOG_INFO("%{public}s end", __func__);
@@ -541,13 +522,13 @@ bool FormTimerMgr::HandleResetLimiter()
 bool FormTimerMgr::OnUpdateAtTrigger(long updateTime)
 {
     HILOG_INFO("%{public}s start, updateTime:%{public}ld", __func__, updateTime);
-    std::vector<UpdateAtItem> updateList;
+    std::vector<FormTimer> updateList;
     {
         std::lock_guard<std::mutex> lock(updateAtMutex_);
-        std::list<UpdateAtItem>::iterator itItem;
-        for (itItem = updateAtTimerTasks_.begin(); itItem != updateAtTimerTasks_.end(); itItem++) {
-            if (itItem->updateAtTime == updateTime && itItem->refreshTask.isEnable) {
-                updateList.emplace_back(*itItem);
+        auto range = updateAtTimerTasks_.equal_range(updateTime);
+        for (auto itItem = range.first; itItem != range.second; itItem++) {
+            if (itItem->second.refreshTask.isEnable) {
+                updateList.emplace_back(itItem->second.refreshTask);
             }
         }
     }
@@ -559,9 +540,7 @@ bool FormTimerMgr::OnUpdateAtTrigger(long updateTime)
 
     if (!updateList.empty()) {
         HILOG_INFO("%{public}s, update at timer triggered, trigged time: %{public}ld", __func__, updateTime);
-        for (auto &item : updateList) {
-            ExecTimerTask(item.refreshTask);
-        }
+        ExecTimerTasks(updateList);
     }
 
     HILOG_INFO("%{public}s end", __func__);
@@ -604,9 +583,7 @@ bool FormTimerMgr::OnDynamicTimeTrigger(int64_t updateTime)
 
     if (!updateList.empty()) {
         HILOG_INFO("%{public}s triggered, trigged time: %{public}" PRId64 "", __func__, updateTime);
-        for (auto &task : updateList) {
-            ExecTimerTask(task);
-        }
+        ExecTimerTasks(updateList);
     }
 
     HILOG_INFO("%{public}s end", __func__);
@@ -650,11 +627,36 @@ void FormTimerMgr::SetIntervalEnableFlag(int64_t formId, bool flag)
     // try interval list
     auto refreshTask = intervalTimerTasks_.find(formId);
     if (refreshTask != intervalTimerTasks_.end()) {
+        if (refreshTask->second.isEnable == flag) {
+            return;
+        }
         refreshTask->second.isEnable = flag;
         HILOG_INFO("%{public}s, formId:%{public}" PRId64 ", isEnable:%{public}d", __func__, formId, flag ? 1 : 0);
+        // a disabled task leaves the due queue, and is due at once when it is enabled after its period passed.
+        auto dueItem = std::make_pair(GetIntervalDueTime(refreshTask->second), formId);
+        if (!flag) {
+            intervalDueQueue_.erase(dueItem);
+        } else if (limitedIntervalTasks_.find(formId) == limitedIntervalTasks_.end()) {
+            intervalDueQueue_.emplace(dueItem);
+        }
         return;
     }
 }
+/**
+ * @brief Put the interval timer tasks limited when they were due back to the due queue, called when the
+ * limiter is reset.
+ */
+void FormTimerMgr::RequeueLimitedIntervalTasks()
+{
+    std::lock_guard<std::mutex> lock(intervalMutex_);
+    for (const auto &formId : limitedIntervalTasks_) {
+        auto intervalTask = intervalTimerTasks_.find(formId);
+        if (intervalTask != intervalTimerTasks_.end() && intervalTask->second.isEnable) {
+            intervalDueQueue_.emplace(GetIntervalDueTime(intervalTask->second), formId);
+        }
+    }
+    limitedIntervalTasks_.clear();
+}
 /**
  * @brief Get interval timer task.
  * @param formId The Id of the form.
@@ -683,14 +685,12 @@ bool FormTimerMgr::GetUpdateAtTimer(const int64_t formId, UpdateAtItem &updateAt
     HILOG_INFO("%{public}s start", __func__);
     {
         std::lock_guard<std::mutex> lock(updateAtMutex_);
-        std::list<UpdateAtItem>::iterator itItem;
-        for (itItem = updateAtTimerTasks_.begin(); itItem != updateAtTimerTasks_.end(); itItem++) {
-            if (itItem->refreshTask.formId == formId) {
-                updateAtItem.refreshTask = itItem->refreshTask;
-                updateAtItem.updateAtTime = itItem->updateAtTime;
-                HILOG_INFO("%{public}s, get update at timer successfully", __func__);
-                return true;
-            }
+        auto indexIter = updateAtIndex_.find(formId);
+        if (indexIter != updateAtIndex_.end()) {
+            updateAtItem.refreshTask = indexIter->second->second.refreshTask;
+            updateAtItem.updateAtTime = indexIter->second->second.updateAtTime;
+            HILOG_INFO("%{public}s, get update at timer successfully", __func__);
+            return true;
         }
     }
     HILOG_INFO("%{public}s, update at timer not find", __func__);
@@ -741,6 +741,8 @@ bool FormTimerMgr::DeleteIntervalTimer(const int64_t formId)
     std::lock_guard<std::mutex> lock(intervalMutex_);
     auto intervalTask = intervalTimerTasks_.find(formId);
     if (intervalTask != intervalTimerTasks_.end()) {
+        intervalDueQueue_.erase(std::make_pair(GetIntervalDueTime(intervalTask->second), formId));
+        limitedIntervalTasks_.erase(formId);
         intervalTimerTasks_.erase(intervalTask);
         isExist = true;
     }
@@ -761,13 +763,8 @@ bool FormTimerMgr::DeleteUpdateAtTimer(const int64_t formId)
     HILOG_INFO("%{public}s start", __func__);
     {
         std::lock_guard<std::mutex> lock(updateAtMutex_);
-        std::list<UpdateAtItem>::iterator itItem;
-        for (itItem = updateAtTimerTasks_.begin(); itItem != updateAtTimerTasks_.end(); itItem++) {
-            if (itItem->refreshTask.formId == formId) {
-                updateAtTimerTasks_.erase(itItem);
-                break;
-            }
-        }
+        UpdateAtItem removedItem;
+        RemoveUpdateAtItem(formId, removedItem);
     }
 
     if (!UpdateAtTimerAlarm()) {
@@ -810,26 +807,63 @@ bool FormTimerMgr::DeleteDynamicItem(const int64_t formId)
 void FormTimerMgr::OnIntervalTimeOut()
 {
     HILOG_INFO("%{public}s start", __func__);
-    std::lock_guard<std::mutex> lock(intervalMutex_);
     std::vector<FormTimer> updateList;
-    int64_t currentTime = FormUtil::GetCurrentNanosecond() / Constants::TIME_1000000;
-    for (auto &intervalPair : intervalTimerTasks_) {
-        FormTimer &intervalTask = intervalPair.second;
-        if ((intervalTask.refreshTime == INT64_MAX || (currentTime - intervalTask.refreshTime) >= intervalTask.period ||
-            std::abs((currentTime - intervalTask.refreshTime) - intervalTask.period) < Constants::ABS_TIME) &&
-            intervalTask.isEnable && refreshLimiter_.IsEnableRefresh(intervalTask.formId)) {
-            intervalTask.refreshTime = currentTime;
-            updateList.emplace_back(intervalTask);
-        }
+    {
+        std::lock_guard<std::mutex> lock(intervalMutex_);
+        int64_t currentTime = FormUtil::GetCurrentNanosecond() / Constants::TIME_1000000;
+        CollectDueIntervalTasks(currentTime, updateList);
     }
 
     if (!updateList.empty()) {
-        for (auto &task : updateList) {
-            ExecTimerTask(task);
-        }
+        ExecTimerTasks(updateList);
     }
     HILOG_INFO("%{public}s end", __func__);
 }
+/**
+ * @brief Collect the interval timer tasks that are due and schedule their next refresh.
+ * @param currentTime Current time(ms).
+ * @param updateList The due tasks.
+ */
+void FormTimerMgr::CollectDueIntervalTasks(const int64_t currentTime, std::vector<FormTimer> &updateList)
+{
+    std::vector<std::pair<int64_t, int64_t>> nextDueList;
+    for (auto dueIter = intervalDueQueue_.begin();
+        dueIter != intervalDueQueue_.end() && dueIter->first <= currentTime;) {
+        auto intervalPair = intervalTimerTasks_.find(dueIter->second);
+        if (intervalPair == intervalTimerTasks_.end()) {
+            dueIter = intervalDueQueue_.erase(dueIter);
+            continue;
+        }
+        dueIter = intervalDueQueue_.erase(dueIter);
+        // a disabled task is queued again when it is enabled, a limited one when the limiter is reset.
+        FormTimer &intervalTask = intervalPair->second;
+        if (!intervalTask.isEnable) {
+            continue;
+        }
+        if (!refreshLimiter_.IsEnableRefresh(intervalTask.formId)) {
+            limitedIntervalTasks_.emplace(intervalTask.formId);
+            continue;
+        }
+        intervalTask.refreshTime = currentTime;
+        updateList.emplace_back(intervalTask);
+        nextDueList.emplace_back(GetIntervalDueTime(intervalTask), intervalTask.formId);
+    }
+    intervalDueQueue_.insert(nextDueList.begin(), nextDueList.end());
+}
+/**
+ * @brief Get the time from which an interval timer task is due.
+ * @param task Interval timer task.
+ * @return Returns the due time(ms).
+ */
+int64_t FormTimerMgr::GetIntervalDueTime(const FormTimer &task) const
+{
+    // a task that has never been refreshed is due at once.
+    if (task.refreshTime == INT64_MAX) {
+        return INT64_MIN;
+    }
+    // due when the period has passed, or is less than ABS_TIME away.
+    return task.refreshTime + task.period - Constants::ABS_TIME + 1;
+}
 
 /**
  * @brief Update at timer task alarm.
@@ -1157,17 +1191,11 @@ bool FormTimerMgr::FindNextAtTimerItem(const long nowTime, UpdateAtItem &updateA
     }
 
     std::lock_guard<std::mutex> lock(updateAtMutex_);
-    std::list<UpdateAtItem>::iterator itItem;
-    for (itItem = updateAtTimerTasks_.begin(); itItem != updateAtTimerTasks_.end(); itItem++) {
-        if (itItem->updateAtTime > nowTime) {
-            updateAtItem = *itItem;
-            break;
-        }
-    }
-
+    auto itItem = updateAtTimerTasks_.upper_bound(nowTime);
     if (itItem == updateAtTimerTasks_.end()) {
-        updateAtItem = updateAtTimerTasks_.front();
+        itItem = updateAtTimerTasks_.begin();
     }
+    updateAtItem = itItem->second;
     HILOG_INFO("%{public}s end", __func__);
     return true;
 }
@@ -1226,17 +1254,7 @@ void FormTimerMgr::ExecTimerTask(const FormTimer &timerTask)
     CreatTaskThreadExecutor();
     if (taskExecutor_ != nullptr) {
         HILOG_INFO("%{public}s run", __func__);
-        AAFwk::Want want;
-        if (timerTask.isCountTimer) {
-            want.SetParam(Constants::KEY_IS_TIMER, true);
-        }
-        // multi user
-        if (IsActiveUser(timerTask.userId)) {
-            HILOG_INFO("timerTask.userId is current user");
-            want.SetParam(Constants::PARAM_FORM_USER_ID, timerTask.userId);
-        }
-        HILOG_INFO("%{public}s, userId:%{public}d", __func__, timerTask.userId);
-
+        AAFwk::Want want = CreateTimerTaskWant(timerTask);
         auto task = std::bind(&FormProviderMgr::RefreshForm, &FormProviderMgr::GetInstance(), timerTask.formId, want,
             false);
         taskExecutor_->AddTask(task);
@@ -1244,6 +1262,63 @@ void FormTimerMgr::ExecTimerTask(const FormTimer &timerTask)
     HILOG_INFO("%{public}s end", __func__);
 }
 
+/**
+ * @brief Execute Form timer tasks that are triggered together, one task per provider bundle.
+ * @param timerTasks Form timer tasks.
+ */
+void FormTimerMgr::ExecTimerTasks(const std::vector<FormTimer> &timerTasks)
+{
+    HILOG_INFO("%{public}s start, size:%{public}zu", __func__, timerTasks.size());
+    if (timerTasks.size() == 1) {
+        ExecTimerTask(timerTasks.front());
+        return;
+    }
+    CreatTaskThreadExecutor();
+    if (taskExecutor_ == nullptr) {
+        return;
+    }
+
+    std::map<std::string, std::vector<std::pair<int64_t, AAFwk::Want>>> bundleTasks;
+    for (const auto &timerTask : timerTasks) {
+        FormRecord formRecord;
+        std::string bundleName;
+        if (FormDataMgr::GetInstance().GetFormRecord(timerTask.formId, formRecord)) {
+            bundleName = formRecord.bundleName;
+        }
+        bundleTasks[bundleName].emplace_back(timerTask.formId, CreateTimerTaskWant(timerTask));
+    }
+    for (auto &bundleTask : bundleTasks) {
+        auto forms = std::move(bundleTask.second);
+        auto task = [forms]() {
+            for (const auto &form : forms) {
+                FormProviderMgr::GetInstance().RefreshForm(form.first, form.second, false);
+            }
+        };
+        taskExecutor_->AddTask(task);
+    }
+    HILOG_INFO("%{public}s end, bundle size:%{public}zu", __func__, bundleTasks.size());
+}
+
+/**
+ * @brief Create the want used to refresh the form of a timer task.
+ * @param timerTask Form timer task.
+ * @return Returns the want.
+ */
+AAFwk::Want FormTimerMgr::CreateTimerTaskWant(const FormTimer &timerTask)
+{
+    AAFwk::Want want;
+    if (timerTask.isCountTimer) {
+        want.SetParam(Constants::KEY_IS_TIMER, true);
+    }
+    // multi user
+    if (IsActiveUser(timerTask.userId)) {
+        HILOG_INFO("timerTask.userId is current user");
+        want.SetParam(Constants::PARAM_FORM_USER_ID, timerTask.userId);
+    }
+    HILOG_INFO("%{public}s, userId:%{public}d", __func__, timerTask.userId);
+    return want;
+}
+
 /**
  * @brief Init.
  */
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+#define private public
+#include "form_data_mgr.h"
+#include "form_db_cache.h"
+#undef private
+#include "form_item_info.h"
+#include "mock_form_host_client.h"
+
+using namespace std;
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace {
+constexpr int32_t HOST_COUNT = 50;
+constexpr int32_t FORMS_PER_HOST = 100;
+constexpr int32_t BUNDLE_COUNT = 10;
+constexpr int32_t MODULE_COUNT = 5;
+constexpr int32_t CALLING_UID = 20000000;
+constexpr int32_t USER_ID = 100;
+// form ids with a udid hash, as FormDataMgr::GenerateFormId makes them.
+constexpr int64_t FORM_ID_BASE = 0x100000000L;
+const std::string BUNDLE_NAME_PREFIX = "com.form.provider";
+const std::string MODULE_NAME_PREFIX = "entry";
+const std::string ABILITY_NAME = "FormAbility";
+const std::string FORM_NAME = "widget";
+
+class FormDataMgrTest : public benchmark::Fixture {
+public:
+    FormDataMgrTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~FormDataMgrTest() override = default;
+
+    // 5000 forms, 100 on each of 50 hosts, in both the form data and the DB cache.
+    void SetUp(const ::benchmark::State &state) override
+    {
+        for (int32_t host = 0; host < HOST_COUNT; host++) {
+            hosts_.emplace_back(new MockFormHostClient());
+            hostFormIds_.emplace_back();
+            for (int32_t form = 0; form < FORMS_PER_HOST; form++) {
+                int64_t formId = FORM_ID_BASE + host * FORMS_PER_HOST + form;
+                AddForm(host, formId);
+                hostFormIds_[host].emplace_back(formId);
+
+                FormDBInfo formDBInfo;
+                formDBInfo.formId = formId;
+                formDBInfo.userId = USER_ID;
+                formDBInfo.formName = FORM_NAME;
+                formDBInfo.bundleName = GetBundleName(formId);
+                formDBInfo.moduleName = GetModuleName(formId);
+                formDBInfo.abilityName = ABILITY_NAME;
+                formDBInfo.formUserUids.emplace_back(CALLING_UID);
+                // straight into the cache, the storage is not what is measured.
+                auto &dbCache = FormDbCache::GetInstance();
+                dbCache.AddFormIndex(dbCache.formDBInfos_.emplace(dbCache.formDBInfos_.end(), formDBInfo));
+            }
+        }
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+        for (const auto &host : hosts_) {
+            FormDataMgr::GetInstance().HandleHostDied(host);
+        }
+        FormDataMgr::GetInstance().ClearFormRecords();
+        for (const auto &formIds : hostFormIds_) {
+            for (int64_t formId : formIds) {
+                FormDbCache::GetInstance().EraseFormInfoNolock(formId);
+            }
+        }
+        hosts_.clear();
+        hostFormIds_.clear();
+    }
+
+    void AddForm(int32_t host, int64_t formId)
+    {
+        FormItemInfo info;
+        info.SetFormId(formId);
+        info.SetProviderBundleName(GetBundleName(formId));
+        info.SetModuleName(GetModuleName(formId));
+        info.SetAbilityName(ABILITY_NAME);
+        info.SetFormName(FORM_NAME);
+        FormDataMgr::GetInstance().AllotFormRecord(info, CALLING_UID, USER_ID);
+        FormDataMgr::GetInstance().AllotFormHostRecord(info, hosts_[host], formId, CALLING_UID);
+    }
+
+    static std::string GetBundleName(int64_t formId)
+    {
+        return BUNDLE_NAME_PREFIX + std::to_string(formId % BUNDLE_COUNT);
+    }
+
+    static std::string GetModuleName(int64_t formId)
+    {
+        return MODULE_NAME_PREFIX + std::to_string(formId % MODULE_COUNT);
+    }
+
+protected:
+    const int32_t repetitions = 3;
+    const int32_t iterations = 1000;
+    std::vector<sptr<MockFormHostClient>> hosts_;
+    std::vector<std::vector<int64_t>> hostFormIds_;
+};
+
+// Add a form to the last host and delete it again.
+BENCHMARK_F(FormDataMgrTest, AddDeleteFormTestCase)(
+    benchmark::State &state)
+{
+    int32_t host = HOST_COUNT - 1;
+    int64_t formId = FORM_ID_BASE + HOST_COUNT * FORMS_PER_HOST;
+    while (state.KeepRunning()) {
+        AddForm(host, formId);
+        FormDataMgr::GetInstance().DeleteHostRecord(hosts_[host], formId);
+        FormDataMgr::GetInstance().DeleteFormRecord(formId);
+    }
+}
+
+// Make all forms of the last host visible, then invisible.
+BENCHMARK_F(FormDataMgrTest, NotifyFormsVisibleTestCase)(
+    benchmark::State &state)
+{
+    int32_t host = HOST_COUNT - 1;
+    bool isVisible = true;
+    while (state.KeepRunning()) {
+        if (FormDataMgr::GetInstance().NotifyFormsVisible(hostFormIds_[host], isVisible, hosts_[host]) != ERR_OK) {
+            state.SkipWithError("NotifyFormsVisibleTestCase failed.");
+        }
+        isVisible = !isVisible;
+    }
+}
+
+// The last host dies, its forms are added back untimed.
+BENCHMARK_F(FormDataMgrTest, HostDiedTestCase)(
+    benchmark::State &state)
+{
+    int32_t host = HOST_COUNT - 1;
+    while (state.KeepRunning()) {
+        FormDataMgr::GetInstance().HandleHostDied(hosts_[host]);
+        state.PauseTiming();
+        for (int64_t formId : hostFormIds_[host]) {
+            AddForm(host, formId);
+        }
+        state.ResumeTiming();
+    }
+}
+
+// Look a form up in the DB cache and count the forms of its module, as deleting a form does.
+BENCHMARK_F(FormDataMgrTest, GetDBRecordTestCase)(
+    benchmark::State &state)
+{
+    int64_t formId = FORM_ID_BASE + HOST_COUNT * FORMS_PER_HOST - 1;
+    while (state.KeepRunning()) {
+        FormDBInfo formDBInfo;
+        if (FormDbCache::GetInstance().GetDBRecord(formId, formDBInfo) != ERR_OK) {
+            state.SkipWithError("GetDBRecordTestCase failed.");
+        }
+        benchmark::DoNotOptimize(
+            FormDbCache::GetInstance().GetMatchCount(formDBInfo.bundleName, formDBInfo.moduleName));
+    }
+}
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
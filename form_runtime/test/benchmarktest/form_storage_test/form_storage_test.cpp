@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "form_storage_batcher.h"
+#include "form_storage_codec.h"
+#define private public
+#include "form_storage_mgr.h"
+#undef private
+
+using namespace std;
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace {
+constexpr int32_t FORM_COUNT = 10000;
+constexpr int32_t BUNDLE_COUNT = 100;
+constexpr int32_t CALLING_UID = 20000000;
+constexpr int32_t USER_ID = 100;
+constexpr int64_t FORM_ID_BASE = 0x100000000L;
+const std::string BUNDLE_NAME_PREFIX = "com.form.provider";
+
+class FormStorageTest : public benchmark::Fixture {
+public:
+    FormStorageTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~FormStorageTest() override = default;
+
+    // the entries of 10000 forms as the DB returns them at boot, in json as written before and in binary.
+    void SetUp(const ::benchmark::State &state) override
+    {
+        for (int32_t i = 0; i < FORM_COUNT; i++) {
+            FormDBInfo formDBInfo;
+            formDBInfo.formId = FORM_ID_BASE + i;
+            formDBInfo.userId = USER_ID;
+            formDBInfo.formName = "widget";
+            formDBInfo.bundleName = BUNDLE_NAME_PREFIX + std::to_string(i % BUNDLE_COUNT);
+            formDBInfo.moduleName = "entry";
+            formDBInfo.abilityName = "FormAbility";
+            formDBInfo.formUserUids.emplace_back(CALLING_UID);
+            formDBInfos_.emplace_back(formDBInfo);
+
+            DistributedKv::Entry entry;
+            entry.key = std::to_string(formDBInfo.formId);
+            entry.value = InnerFormInfo(formDBInfo).ToString();
+            jsonEntries_.emplace_back(entry);
+            entry.value = FormStorageCodec::EncodeFormDBInfo(formDBInfo);
+            binaryEntries_.emplace_back(entry);
+        }
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+        formDBInfos_.clear();
+        jsonEntries_.clear();
+        binaryEntries_.clear();
+    }
+
+    static void Load(benchmark::State &state, const std::vector<DistributedKv::Entry> &entries)
+    {
+        while (state.KeepRunning()) {
+            std::vector<InnerFormInfo> innerFormInfos;
+            std::vector<std::string> badKeys;
+            std::vector<size_t> jsonForms;
+            uint64_t sequence = 0;
+            FormStorageMgr::ParseEntries(entries, innerFormInfos, badKeys, jsonForms, sequence);
+            if (innerFormInfos.size() != FORM_COUNT) {
+                state.SkipWithError("Load failed.");
+            }
+        }
+    }
+
+protected:
+    const int32_t repetitions = 3;
+    const int32_t iterations = 10;
+    std::vector<FormDBInfo> formDBInfos_;
+    std::vector<DistributedKv::Entry> jsonEntries_;
+    std::vector<DistributedKv::Entry> binaryEntries_;
+};
+
+// Load 10000 forms written in json.
+BENCHMARK_F(FormStorageTest, LoadJsonTestCase)(
+    benchmark::State &state)
+{
+    Load(state, jsonEntries_);
+}
+
+// Load 10000 forms written in binary.
+BENCHMARK_F(FormStorageTest, LoadBinaryTestCase)(
+    benchmark::State &state)
+{
+    Load(state, binaryEntries_);
+}
+
+// Save 10000 forms to a store in memory in groups, counting the commits reaching it.
+BENCHMARK_F(FormStorageTest, BatchSaveTestCase)(
+    benchmark::State &state)
+{
+    std::map<std::string, std::string> store;
+    int64_t commits = 0;
+    auto commit = [&store, &commits](const std::vector<DistributedKv::Entry> &entries,
+        const std::vector<DistributedKv::Key> &deletedKeys) {
+        commits++;
+        for (const auto &entry : entries) {
+            store[entry.key.ToString()] = entry.value.ToString();
+        }
+        return true;
+    };
+    while (state.KeepRunning()) {
+        auto batcher = std::make_shared<FormStorageBatcher>(commit, nullptr);
+        for (const auto &formDBInfo : formDBInfos_) {
+            batcher->Put(std::to_string(formDBInfo.formId), FormStorageCodec::EncodeFormDBInfo(formDBInfo));
+        }
+        if (!batcher->Flush()) {
+            state.SkipWithError("BatchSaveTestCase failed.");
+        }
+    }
+    state.counters["commits"] = benchmark::Counter(commits, benchmark::Counter::kAvgIterations);
+}
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+
+#include "form_bms_helper.h"
+#include "hilog_wrapper.h"
+#include "mock_bundle_manager.h"
+
+using namespace testing::ext;
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace {
+const std::string FORM_HOST_BUNDLE_NAME = "com.form.host.app600";
+const std::string FORM_PROVIDER_BUNDLE_NAME = "com.form.provider.service";
+constexpr int32_t FORM_HOST_UID = 600;
+constexpr int32_t USER_ID = 100;
+constexpr int32_t OTHER_USER_ID = 101;
+
+// counts the calls that reach the bundle manager.
+class CountingBundleMgrService : public BundleMgrService {
+public:
+    int GetUidByBundleName(const std::string &bundleName, const int userId) override
+    {
+        getUidCount_++;
+        return BundleMgrService::GetUidByBundleName(bundleName, userId);
+    }
+
+    bool GetBundleNameForUid(const int uid, std::string &bundleName) override
+    {
+        getBundleNameCount_++;
+        return BundleMgrService::GetBundleNameForUid(uid, bundleName);
+    }
+
+    int32_t getUidCount_ = 0;
+    int32_t getBundleNameCount_ = 0;
+};
+
+class FmsFormBmsHelperTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+
+protected:
+    sptr<CountingBundleMgrService> bundleMgr_;
+};
+
+void FmsFormBmsHelperTest::SetUpTestCase()
+{}
+
+void FmsFormBmsHelperTest::TearDownTestCase()
+{}
+
+void FmsFormBmsHelperTest::SetUp()
+{
+    bundleMgr_ = new CountingBundleMgrService();
+    FormBmsHelper::GetInstance().SetBundleManager(bundleMgr_);
+}
+
+void FmsFormBmsHelperTest::TearDown()
+{
+    FormBmsHelper::GetInstance().SetBundleManager(nullptr);
+    bundleMgr_ = nullptr;
+}
+
+/*
+ * Feature: FormBmsHelper
+ * Function: GetUidByBundleName
+ * FunctionPoints: FormBmsHelper bundle cache
+ * EnvConditions: Mobile that can run ohos test framework
+ * CaseDescription: the uid of a bundle is asked from the bundle manager once per user.
+ */
+HWTEST_F(FmsFormBmsHelperTest, FmsFormBmsHelperTest_001, TestSize.Level0)
+{
+    HILOG_INFO("fms_form_bms_helper_test_001 start");
+    EXPECT_EQ(FORM_HOST_UID, FormBmsHelper::GetInstance().GetUidByBundleName(FORM_HOST_BUNDLE_NAME, USER_ID));
+    EXPECT_EQ(FORM_HOST_UID, FormBmsHelper::GetInstance().GetUidByBundleName(FORM_HOST_BUNDLE_NAME, USER_ID));
+    EXPECT_EQ(1, bundleMgr_->getUidCount_);
+
+    EXPECT_EQ(FORM_HOST_UID, FormBmsHelper::GetInstance().GetUidByBundleName(FORM_HOST_BUNDLE_NAME, OTHER_USER_ID));
+    EXPECT_EQ(2, bundleMgr_->getUidCount_);
+    HILOG_INFO("fms_form_bms_helper_test_001 end");
+}
+
+/*
+ * Feature: FormBmsHelper
+ * Function: InvalidateBundle
+ * FunctionPoints: FormBmsHelper bundle cache
+ * EnvConditions: Mobile that can run ohos test framework
+ * CaseDescription: a changed bundle is asked from the bundle manager again, the other bundles are kept.
+ */
+HWTEST_F(FmsFormBmsHelperTest, FmsFormBmsHelperTest_002, TestSize.Level0)
+{
+    HILOG_INFO("fms_form_bms_helper_test_002 start");
+    FormBmsHelper::GetInstance().GetUidByBundleName(FORM_HOST_BUNDLE_NAME, USER_ID);
+    FormBmsHelper::GetInstance().GetUidByBundleName(FORM_PROVIDER_BUNDLE_NAME, USER_ID);
+    EXPECT_EQ(2, bundleMgr_->getUidCount_);
+
+    FormBmsHelper::GetInstance().InvalidateBundle(FORM_HOST_BUNDLE_NAME);
+    FormBmsHelper::GetInstance().GetUidByBundleName(FORM_HOST_BUNDLE_NAME, USER_ID);
+    FormBmsHelper::GetInstance().GetUidByBundleName(FORM_PROVIDER_BUNDLE_NAME, USER_ID);
+    EXPECT_EQ(3, bundleMgr_->getUidCount_);
+    HILOG_INFO("fms_form_bms_helper_test_002 end");
+}
+
+/*
+ * Feature: FormBmsHelper
+ * Function: InvalidateUser
+ * FunctionPoints: FormBmsHelper bundle cache
+ * EnvConditions: Mobile that can run ohos test framework
+ * CaseDescription: the bundles of a removed user are asked from the bundle manager again.
+ */
+HWTEST_F(FmsFormBmsHelperTest, FmsFormBmsHelperTest_003, TestSize.Level0)
+{
+    HILOG_INFO("fms_form_bms_helper_test_003 start");
+    FormBmsHelper::GetInstance().GetUidByBundleName(FORM_HOST_BUNDLE_NAME, USER_ID);
+    FormBmsHelper::GetInstance().GetUidByBundleName(FORM_HOST_BUNDLE_NAME, OTHER_USER_ID);
+    EXPECT_EQ(2, bundleMgr_->getUidCount_);
+
+    FormBmsHelper::GetInstance().InvalidateUser(OTHER_USER_ID);
+    FormBmsHelper::GetInstance().GetUidByBundleName(FORM_HOST_BUNDLE_NAME, USER_ID);
+    FormBmsHelper::GetInstance().GetUidByBundleName(FORM_HOST_BUNDLE_NAME, OTHER_USER_ID);
+    EXPECT_EQ(3, bundleMgr_->getUidCount_);
+    HILOG_INFO("fms_form_bms_helper_test_003 end");
+}
+
+/*
+ * Feature: FormBmsHelper
+ * Function: GetBundleNameForUid
+ * FunctionPoints: FormBmsHelper bundle cache
+ * EnvConditions: Mobile that can run ohos test framework
+ * CaseDescription: the bundle name of a uid is asked from the bundle manager until its bundle changes.
+ */
+HWTEST_F(FmsFormBmsHelperTest, FmsFormBmsHelperTest_004, TestSize.Level0)
+{
+    HILOG_INFO("fms_form_bms_helper_test_004 start");
+    std::string bundleName;
+    EXPECT_TRUE(FormBmsHelper::GetInstance().GetBundleNameForUid(FORM_HOST_UID, bundleName));
+    EXPECT_EQ(FORM_PROVIDER_BUNDLE_NAME, bundleName);
+    bundleName.clear();
+    EXPECT_TRUE(FormBmsHelper::GetInstance().GetBundleNameForUid(FORM_HOST_UID, bundleName));
+    EXPECT_EQ(FORM_PROVIDER_BUNDLE_NAME, bundleName);
+    EXPECT_EQ(1, bundleMgr_->getBundleNameCount_);
+
+    FormBmsHelper::GetInstance().InvalidateBundle(FORM_PROVIDER_BUNDLE_NAME);
+    EXPECT_TRUE(FormBmsHelper::GetInstance().GetBundleNameForUid(FORM_HOST_UID, bundleName));
+    EXPECT_EQ(2, bundleMgr_->getBundleNameCount_);
+    HILOG_INFO("fms_form_bms_helper_test_004 end");
+}
+
+/*
+ * Feature: FormBmsHelper
+ * Function: DumpCacheInfo
+ * FunctionPoints: FormBmsHelper bundle cache
+ * EnvConditions: Mobile that can run ohos test framework
+ * CaseDescription: the dump has the cache size, the hits and misses, and the bundle manager calls.
+ */
+HWTEST_F(FmsFormBmsHelperTest, FmsFormBmsHelperTest_005, TestSize.Level0)
+{
+    HILOG_INFO("fms_form_bms_helper_test_005 start");
+    FormBmsHelper::GetInstance().GetUidByBundleName(FORM_HOST_BUNDLE_NAME, USER_ID);
+    FormBmsHelper::GetInstance().GetUidByBundleName(FORM_HOST_BUNDLE_NAME, USER_ID);
+
+    std::string cacheInfo;
+    FormBmsHelper::GetInstance().DumpCacheInfo(cacheInfo);
+    EXPECT_NE(std::string::npos, cacheInfo.find("BundleCache: bundles #1, uids #0, hit #1, miss #1"));
+    EXPECT_NE(std::string::npos, cacheInfo.find("BmsCall GetUidByBundleName: count #1"));
+    HILOG_INFO("fms_form_bms_helper_test_005 end");
+}
+}
@@ -26,6 +26,7 @@ using namespace OHOS::AppExecFwk;
 
 const int64_t PARAM_FORM_ID_FIRST = 1001;
 const int64_t PARAM_FORM_ID_SECOND = 1002;
+const int64_t PARAM_FORM_ID_THIRD = 1003;
 
 namespace {
 class FmsFormCacheMgrTest : public testing::Test {
@@ -36,8 +37,11 @@ public:
     void SetUp();
     void TearDown();
 
+    std::string GetCacheData(int64_t formId);
+
 protected:
     FormCacheMgr formCacheMgr_;
+    std::map<std::string, std::pair<sptr<FormAshmem>, int32_t>> imageMap_;
 };
 
 
@@ -53,6 +57,15 @@ void FmsFormCacheMgrTest::SetUp()
 void FmsFormCacheMgrTest::TearDown()
 {}
 
+std::string FmsFormCacheMgrTest::GetCacheData(int64_t formId)
+{
+    std::shared_ptr<const FormCacheData> cacheData;
+    if (!formCacheMgr_.GetData(formId, cacheData)) {
+        return "";
+    }
+    return cacheData->data;
+}
+
 /*
  * Feature: FormCacheMgr
  * Function: GetData
@@ -65,8 +78,8 @@ HWTEST_F(FmsFormCacheMgrTest, FmsFormCacheMgrTest_001, TestSize.Level0)
     HILOG_INFO("fms_form_cache_mgr_test_001 start");
 
     std::string dataResult = "";
-    formCacheMgr_.cacheData_[PARAM_FORM_ID_FIRST]= "{'a':'1','b':'2'}";
-    EXPECT_TRUE(formCacheMgr_.GetData(PARAM_FORM_ID_FIRST, dataResult));
+    formCacheMgr_.AddData(PARAM_FORM_ID_FIRST, "{'a':'1','b':'2'}", imageMap_);
+    EXPECT_TRUE(formCacheMgr_.GetData(PARAM_FORM_ID_FIRST, dataResult, imageMap_));
     EXPECT_EQ("{'a':'1','b':'2'}", dataResult);
 
     GTEST_LOG_(INFO) << "fms_form_cache_mgr_test_001 end";
@@ -85,8 +98,8 @@ HWTEST_F(FmsFormCacheMgrTest, FmsFormCacheMgrTest_002, TestSize.Level0)
     HILOG_INFO("fms_form_cache_mgr_test_002 start");
 
     std::string dataResult = "";
-    formCacheMgr_.cacheData_[PARAM_FORM_ID_FIRST]= "{'a':'1','b':'2'}";
-    EXPECT_FALSE(formCacheMgr_.GetData(PARAM_FORM_ID_SECOND, dataResult));
+    formCacheMgr_.AddData(PARAM_FORM_ID_FIRST, "{'a':'1','b':'2'}", imageMap_);
+    EXPECT_FALSE(formCacheMgr_.GetData(PARAM_FORM_ID_SECOND, dataResult, imageMap_));
 
     GTEST_LOG_(INFO) << "fms_form_cache_mgr_test_002 end";
 }
@@ -103,8 +116,8 @@ HWTEST_F(FmsFormCacheMgrTest, FmsFormCacheMgrTest_003, TestSize.Level0)
     HILOG_INFO("fms_form_cache_mgr_test_003 start");
 
     std::string dataResult = "{'a':'1','b':'2'}";
-    EXPECT_TRUE(formCacheMgr_.AddData(PARAM_FORM_ID_FIRST, dataResult));
-    EXPECT_EQ(formCacheMgr_.cacheData_[PARAM_FORM_ID_FIRST], dataResult);
+    EXPECT_TRUE(formCacheMgr_.AddData(PARAM_FORM_ID_FIRST, dataResult, imageMap_));
+    EXPECT_EQ(GetCacheData(PARAM_FORM_ID_FIRST), dataResult);
 
     GTEST_LOG_(INFO) << "fms_form_cache_mgr_test_003 end";
 }
@@ -122,9 +135,9 @@ HWTEST_F(FmsFormCacheMgrTest, FmsFormCacheMgrTest_004, TestSize.Level0)
 
     std::string dataResult1 = "{'a':'1','b':'2'}";
     std::string dataResult2 = "{'a':'2','b':'2'}";
-    formCacheMgr_.AddData(PARAM_FORM_ID_FIRST, dataResult1);
-    EXPECT_TRUE(formCacheMgr_.AddData(PARAM_FORM_ID_SECOND, dataResult2));
-    EXPECT_EQ(formCacheMgr_.cacheData_[PARAM_FORM_ID_SECOND], dataResult2);
+    formCacheMgr_.AddData(PARAM_FORM_ID_FIRST, dataResult1, imageMap_);
+    EXPECT_TRUE(formCacheMgr_.AddData(PARAM_FORM_ID_SECOND, dataResult2, imageMap_));
+    EXPECT_EQ(GetCacheData(PARAM_FORM_ID_SECOND), dataResult2);
 
     GTEST_LOG_(INFO) << "fms_form_cache_mgr_test_004 end";
 }
@@ -142,8 +155,8 @@ HWTEST_F(FmsFormCacheMgrTest, FmsFormCacheMgrTest_010, TestSize.Level0)
 
     std::string dataResult1 = "{'a':'1','b':'2'}";
     std::string dataResult2 = "{'a':'2','b':'2'}";
-    formCacheMgr_.AddData(PARAM_FORM_ID_FIRST, dataResult1);
-    EXPECT_TRUE(formCacheMgr_.AddData(PARAM_FORM_ID_FIRST, dataResult2));
+    formCacheMgr_.AddData(PARAM_FORM_ID_FIRST, dataResult1, imageMap_);
+    EXPECT_TRUE(formCacheMgr_.AddData(PARAM_FORM_ID_FIRST, dataResult2, imageMap_));
 
     GTEST_LOG_(INFO) << "fms_form_cache_mgr_test_010 end";
 }
@@ -162,11 +175,11 @@ HWTEST_F(FmsFormCacheMgrTest, FmsFormCacheMgrTest_005, TestSize.Level0)
     std::string dataResult = "";
     std::string dataResult1 = "{'a':'1','b':'2'}";
     std::string dataResult2 = "{'a':'2','b':'2'}";
-    formCacheMgr_.AddData(PARAM_FORM_ID_FIRST, dataResult1);
-    formCacheMgr_.AddData(PARAM_FORM_ID_SECOND, dataResult2);
+    formCacheMgr_.AddData(PARAM_FORM_ID_FIRST, dataResult1, imageMap_);
+    formCacheMgr_.AddData(PARAM_FORM_ID_SECOND, dataResult2, imageMap_);
     EXPECT_TRUE(formCacheMgr_.DeleteData(PARAM_FORM_ID_SECOND));
-    EXPECT_FALSE(formCacheMgr_.GetData(PARAM_FORM_ID_SECOND, dataResult));
-    EXPECT_EQ(formCacheMgr_.cacheData_[PARAM_FORM_ID_FIRST], dataResult1);
+    EXPECT_FALSE(formCacheMgr_.GetData(PARAM_FORM_ID_SECOND, dataResult, imageMap_));
+    EXPECT_EQ(GetCacheData(PARAM_FORM_ID_FIRST), dataResult1);
 
     GTEST_LOG_(INFO) << "fms_form_cache_mgr_test_005 end";
 }
@@ -201,9 +214,9 @@ HWTEST_F(FmsFormCacheMgrTest, FmsFormCacheMgrTest_007, TestSize.Level0)
     std::string dataResult = "";
     std::string dataResult1 = "{'a':'1','b':'2'}";
     std::string dataResult2 = "{'a':'2','b':'2'}";
-    formCacheMgr_.AddData(PARAM_FORM_ID_FIRST, dataResult1);
+    formCacheMgr_.AddData(PARAM_FORM_ID_FIRST, dataResult1, imageMap_);
     EXPECT_TRUE(formCacheMgr_.UpdateData(PARAM_FORM_ID_FIRST, dataResult2));
-    EXPECT_EQ(formCacheMgr_.cacheData_[PARAM_FORM_ID_FIRST], dataResult2);
+    EXPECT_EQ(GetCacheData(PARAM_FORM_ID_FIRST), dataResult2);
 
     GTEST_LOG_(INFO) << "fms_form_cache_mgr_test_007 end";
 }
@@ -224,4 +237,105 @@ HWTEST_F(FmsFormCacheMgrTest, FmsFormCacheMgrTest_008, TestSize.Level0)
 
     GTEST_LOG_(INFO) << "fms_form_cache_mgr_test_008 end";
 }
-}
\ No newline at end of file
+
+/*
+ * Feature: FormCacheMgr
+ * Function: AddData
+ * FunctionPoints: FormCacheMgr AddData interface
+ * EnvConditions: Mobile that can run ohos test framework
+ * CaseDescription: the least recently used data is evicted when the cache is full
+ */
+HWTEST_F(FmsFormCacheMgrTest, FmsFormCacheMgrTest_009, TestSize.Level0)
+{
+    HILOG_INFO("fms_form_cache_mgr_test_009 start");
+
+    std::string dataResult1 = "{'a':'1','b':'2'}";
+    std::string dataResult2 = "{'a':'2','b':'2'}";
+    std::string dataResult3 = "{'a':'3','b':'2'}";
+    formCacheMgr_.SetMaxCacheSize(dataResult1.size() * 2);
+    EXPECT_TRUE(formCacheMgr_.AddData(PARAM_FORM_ID_FIRST, dataResult1, imageMap_));
+    EXPECT_TRUE(formCacheMgr_.AddData(PARAM_FORM_ID_SECOND, dataResult2, imageMap_));
+    EXPECT_EQ(GetCacheData(PARAM_FORM_ID_FIRST), dataResult1);
+    EXPECT_TRUE(formCacheMgr_.AddData(PARAM_FORM_ID_THIRD, dataResult3, imageMap_));
+    EXPECT_TRUE(formCacheMgr_.IsExist(PARAM_FORM_ID_FIRST));
+    EXPECT_FALSE(formCacheMgr_.IsExist(PARAM_FORM_ID_SECOND));
+    EXPECT_TRUE(formCacheMgr_.IsExist(PARAM_FORM_ID_THIRD));
+    EXPECT_EQ(formCacheMgr_.cacheSize_, dataResult1.size() * 2);
+    EXPECT_EQ(formCacheMgr_.evictCount_, 1u);
+
+    GTEST_LOG_(INFO) << "fms_form_cache_mgr_test_009 end";
+}
+
+/*
+ * Feature: FormCacheMgr
+ * Function: AddData
+ * FunctionPoints: FormCacheMgr AddData interface
+ * EnvConditions: Mobile that can run ohos test framework
+ * CaseDescription: data larger than the cache is not cached
+ */
+HWTEST_F(FmsFormCacheMgrTest, FmsFormCacheMgrTest_011, TestSize.Level0)
+{
+    HILOG_INFO("fms_form_cache_mgr_test_011 start");
+
+    std::string dataResult1 = "{'a':'1','b':'2'}";
+    formCacheMgr_.SetMaxCacheSize(dataResult1.size() - 1);
+    EXPECT_FALSE(formCacheMgr_.AddData(PARAM_FORM_ID_FIRST, dataResult1, imageMap_));
+    EXPECT_FALSE(formCacheMgr_.IsExist(PARAM_FORM_ID_FIRST));
+    EXPECT_EQ(formCacheMgr_.cacheSize_, 0u);
+
+    GTEST_LOG_(INFO) << "fms_form_cache_mgr_test_011 end";
+}
+
+/*
+ * Feature: FormCacheMgr
+ * Function: GetData
+ * FunctionPoints: FormCacheMgr GetData interface
+ * EnvConditions: Mobile that can run ohos test framework
+ * CaseDescription: the shared data got before an update is not changed by the update
+ */
+HWTEST_F(FmsFormCacheMgrTest, FmsFormCacheMgrTest_012, TestSize.Level0)
+{
+    HILOG_INFO("fms_form_cache_mgr_test_012 start");
+
+    std::string dataResult1 = "{'a':'1','b':'2'}";
+    std::string dataResult2 = "{'a':'2','b':'2'}";
+    formCacheMgr_.AddData(PARAM_FORM_ID_FIRST, dataResult1, imageMap_);
+    std::shared_ptr<const FormCacheData> cacheData;
+    EXPECT_TRUE(formCacheMgr_.GetData(PARAM_FORM_ID_FIRST, cacheData));
+    EXPECT_TRUE(formCacheMgr_.UpdateData(PARAM_FORM_ID_FIRST, dataResult2));
+    EXPECT_EQ(cacheData->data, dataResult1);
+    EXPECT_EQ(GetCacheData(PARAM_FORM_ID_FIRST), dataResult2);
+
+    std::string cacheInfo;
+    formCacheMgr_.Dump(cacheInfo);
+    EXPECT_NE(cacheInfo.find("hit #2"), std::string::npos);
+
+    GTEST_LOG_(INFO) << "fms_form_cache_mgr_test_012 end";
+}
+
+/*
+ * Feature: FormCacheMgr
+ * Function: PeekData
+ * FunctionPoints: FormCacheMgr PeekData interface
+ * EnvConditions: Mobile that can run ohos test framework
+ * CaseDescription: peeking at a form gets its data and does not change the recently used order or the hit rate
+ */
+HWTEST_F(FmsFormCacheMgrTest, FmsFormCacheMgrTest_013, TestSize.Level0)
+{
+    HILOG_INFO("fms_form_cache_mgr_test_013 start");
+
+    std::string dataResult1 = "{'a':'1','b':'2'}";
+    std::string dataResult2 = "{'a':'2','b':'2'}";
+    formCacheMgr_.AddData(PARAM_FORM_ID_FIRST, dataResult1, imageMap_);
+    formCacheMgr_.AddData(PARAM_FORM_ID_SECOND, dataResult2, imageMap_);
+    std::shared_ptr<const FormCacheData> cacheData;
+    EXPECT_TRUE(formCacheMgr_.PeekData(PARAM_FORM_ID_FIRST, cacheData));
+    EXPECT_EQ(cacheData->data, dataResult1);
+    EXPECT_FALSE(formCacheMgr_.PeekData(PARAM_FORM_ID_THIRD, cacheData));
+    EXPECT_EQ(formCacheMgr_.cacheItems_.front().formId, PARAM_FORM_ID_SECOND);
+    EXPECT_EQ(formCacheMgr_.hitCount_, 0u);
+    EXPECT_EQ(formCacheMgr_.missCount_, 0u);
+
+    GTEST_LOG_(INFO) << "fms_form_cache_mgr_test_013 end";
+}
+}
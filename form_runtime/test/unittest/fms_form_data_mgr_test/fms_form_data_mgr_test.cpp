@@ -64,7 +64,8 @@ void FmsFormDataMgrTest::TearDown(void)
         formDataMgr_.formRecords_.erase(formDataMgr_.formRecords_.begin());
     }
     if (!formDataMgr_.clientRecords_.empty()) {
-        formDataMgr_.clientRecords_.erase(formDataMgr_.clientRecords_.begin(), formDataMgr_.clientRecords_.end());
+        formDataMgr_.clientRecords_.clear();
+        formDataMgr_.clientRecordMap_.clear();
     }
     if (!formDataMgr_.tempForms_.empty()) {
         formDataMgr_.tempForms_.erase(formDataMgr_.tempForms_.begin(), formDataMgr_.tempForms_.end());
@@ -357,7 +358,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_AllotFormHostRecord_001, TestSiz
     // create clientRecords_
     FormHostRecord formHostRecord;
     formHostRecord.SetClientStub(token_);
-    formDataMgr_.clientRecords_.push_back(formHostRecord);
+    formDataMgr_.AddHostRecordNolock(formHostRecord);
 
     EXPECT_EQ(true, formDataMgr_.AllotFormHostRecord(formItemInfo, token_, formId, callingUid));
     EXPECT_EQ(true, formDataMgr_.clientRecords_.begin()->forms_[formId]);
@@ -974,7 +975,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetFormHostRecord_002, TestSize.
     FormHostRecord form_host_record;
     form_host_record.SetClientStub(token_);
     form_host_record.AddForm(formId);
-    formDataMgr_.clientRecords_.push_back(form_host_record);
+    formDataMgr_.AddHostRecordNolock(form_host_record);
 
     EXPECT_EQ(true, formDataMgr_.GetFormHostRecord(formId, formHostRecord));
     EXPECT_EQ(true, formHostRecord.forms_[formId]);
@@ -999,7 +1000,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_DeleteHostRecord_001, TestSize.L
     FormHostRecord formHostRecord;
     formHostRecord.SetClientStub(token_);
     formHostRecord.AddForm(formId);
-    formDataMgr_.clientRecords_.push_back(formHostRecord);
+    formDataMgr_.AddHostRecordNolock(formHostRecord);
 
     EXPECT_EQ(true, formDataMgr_.DeleteHostRecord(token_, formId));
     EXPECT_EQ(true, formDataMgr_.clientRecords_.empty());
@@ -1026,7 +1027,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_CleanHostRemovedForms_001, TestS
     FormHostRecord formHostRecord;
     formHostRecord.SetClientStub(token_);
     formHostRecord.AddForm(formId);
-    formDataMgr_.clientRecords_.push_back(formHostRecord);
+    formDataMgr_.AddHostRecordNolock(formHostRecord);
 
     formDataMgr_.CleanHostRemovedForms(removedFormIds);
 
@@ -1053,7 +1054,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_HandleHostDied_001, TestSize.Lev
     FormHostRecord formHostRecord;
     formHostRecord.SetClientStub(token_);
     formHostRecord.AddForm(formId);
-    formDataMgr_.clientRecords_.push_back(formHostRecord);
+    formDataMgr_.AddHostRecordNolock(formHostRecord);
 
     // create formRecords
     int callingUid = 0;
@@ -1088,7 +1089,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_HandleHostDied_002, TestSize.Lev
     FormHostRecord formHostRecord;
     formHostRecord.SetClientStub(token_);
     formHostRecord.AddForm(formId);
-    formDataMgr_.clientRecords_.push_back(formHostRecord);
+    formDataMgr_.AddHostRecordNolock(formHostRecord);
 
     // create formRecords
     int callingUid = 0;
@@ -1120,7 +1121,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_HandleHostDied_003, TestSize.Lev
     FormHostRecord formHostRecord;
     formHostRecord.SetClientStub(token_2);
     formHostRecord.AddForm(formId);
-    formDataMgr_.clientRecords_.push_back(formHostRecord);
+    formDataMgr_.AddHostRecordNolock(formHostRecord);
 
     // create formRecords
     int callingUid = 0;
@@ -1169,7 +1170,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_IsEnableRefresh_002, TestSize.Le
     FormHostRecord formHostRecord;
     formHostRecord.SetClientStub(token_);
     formHostRecord.AddForm(formId);
-    formDataMgr_.clientRecords_.push_back(formHostRecord);
+    formDataMgr_.AddHostRecordNolock(formHostRecord);
 
     EXPECT_EQ(true, formDataMgr_.IsEnableRefresh(formId));
 
@@ -1246,7 +1247,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_GetMatchedHostClient_002, TestSi
     FormHostRecord formHostRecord;
     formHostRecord.SetClientStub(token_);
     formHostRecord.AddForm(formId);
-    formDataMgr_.clientRecords_.push_back(formHostRecord);
+    formDataMgr_.AddHostRecordNolock(formHostRecord);
 
     FormHostRecord formHostRecordOutput;
 
@@ -1825,7 +1826,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_UpdateHostNeedRefresh_001, TestS
     // create clientRecords_
     FormHostRecord formHostRecord;
     formHostRecord.AddForm(formId);
-    formDataMgr_.clientRecords_.push_back(formHostRecord);
+    formDataMgr_.AddHostRecordNolock(formHostRecord);
 
     formDataMgr_.UpdateHostNeedRefresh(formId, needRefresh);
 
@@ -1847,7 +1848,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_UpdateHostForm_001, TestSize.Lev
     // create clientRecords_
     FormHostRecord formHostRecord;
     formHostRecord.AddForm(formId);
-    formDataMgr_.clientRecords_.push_back(formHostRecord);
+    formDataMgr_.AddHostRecordNolock(formHostRecord);
 
     EXPECT_EQ(true, formDataMgr_.UpdateHostForm(formId, formRecord));
 
@@ -1904,7 +1905,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_UpdateHostFormFlag_002, TestSize
     formHostRecord.AddForm(formId);
     // SetNeedRefresh:true
     formHostRecord.SetNeedRefresh(formId, true);
-    formDataMgr_.clientRecords_.push_back(formHostRecord);
+    formDataMgr_.AddHostRecordNolock(formHostRecord);
 
     // create formRecords
     int callingUid = 0;
@@ -1945,7 +1946,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_UpdateHostFormFlag_003, TestSize
     formHostRecord.AddForm(formId);
     // SetNeedRefresh:true
     formHostRecord.SetNeedRefresh(formId, true);
-    formDataMgr_.clientRecords_.push_back(formHostRecord);
+    formDataMgr_.AddHostRecordNolock(formHostRecord);
 
     // create formRecords
     int callingUid = 0;
@@ -1986,7 +1987,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_UpdateHostFormFlag_004, TestSize
     formHostRecord.AddForm(formId);
     // SetNeedRefresh:false
     formHostRecord.SetNeedRefresh(formId, false);
-    formDataMgr_.clientRecords_.push_back(formHostRecord);
+    formDataMgr_.AddHostRecordNolock(formHostRecord);
 
     // create formRecords
     int callingUid = 0;
@@ -2024,7 +2025,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_UpdateHostFormFlag_005, TestSize
     FormHostRecord formHostRecord;
     formHostRecord.SetClientStub(token_);
     formHostRecord.AddForm(otherformId);
-    formDataMgr_.clientRecords_.push_back(formHostRecord);
+    formDataMgr_.AddHostRecordNolock(formHostRecord);
 
     // create formRecords
     int callingUid = 0;
@@ -2061,7 +2062,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_UpdateHostFormFlag_006, TestSize
     FormHostRecord formHostRecord;
     formHostRecord.SetClientStub(token_);
     formHostRecord.AddForm(formId);
-    formDataMgr_.clientRecords_.push_back(formHostRecord);
+    formDataMgr_.AddHostRecordNolock(formHostRecord);
 
     // create formRecords
     int callingUid = 0;
@@ -2098,7 +2099,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_UpdateHostFormFlag_007, TestSize
     FormHostRecord formHostRecord;
     formHostRecord.SetClientStub(token_);
     formHostRecord.AddForm(formId);
-    formDataMgr_.clientRecords_.push_back(formHostRecord);
+    formDataMgr_.AddHostRecordNolock(formHostRecord);
 
     // create formRecords
     int callingUid = 0;
@@ -2137,7 +2138,7 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_UpdateHostFormFlag_008, TestSize
     FormHostRecord formHostRecord;
     formHostRecord.SetClientStub(token_);
     formHostRecord.AddForm(formId);
-    formDataMgr_.clientRecords_.push_back(formHostRecord);
+    formDataMgr_.AddHostRecordNolock(formHostRecord);
 
     // create formRecords
     int64_t otherFormId = 800;
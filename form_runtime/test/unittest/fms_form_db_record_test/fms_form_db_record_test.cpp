@@ -21,6 +21,7 @@
 #include "form_mgr_adapter.h"
 #include "form_storage_mgr.h"
 #undef private
+#include "form_mgr_errors.h"
 #include "form_record.h"
 #include "hilog_wrapper.h"
 
@@ -183,4 +184,35 @@ HWTEST_F(FmsFormDbRecordTest, FmsFormDbRecordTest_008, TestSize.Level0) // Delet
     EXPECT_EQ(ERR_OK, FormDbCache::GetInstance().DeleteFormInfo(2));
     GTEST_LOG_(INFO) << "FmsFormDbRecordTest_008 end";
 }
+
+HWTEST_F(FmsFormDbRecordTest, FmsFormDbRecordTest_009, TestSize.Level0) // GetMatchCount after modify and delete
+{
+    GTEST_LOG_(INFO) << "FmsFormDbRecordTest_009 start";
+    InitFormRecord();
+    formRecord_.userId = 100;
+    FormDbCache::GetInstance().UpdateDBRecord(3, formRecord_);
+    FormDbCache::GetInstance().UpdateDBRecord(4, formRecord_);
+    formRecord_.userId = 101;
+    FormDbCache::GetInstance().UpdateDBRecord(5, formRecord_);
+    EXPECT_EQ(3, FormDbCache::GetInstance().GetMatchCount(formRecord_.bundleName, formRecord_.moduleName));
+
+    // form 5 moves to another module
+    formRecord_.moduleName = "OtherModuleName";
+    FormDbCache::GetInstance().UpdateDBRecord(5, formRecord_);
+    EXPECT_EQ(2, FormDbCache::GetInstance().GetMatchCount(formRecord_.bundleName, "TestModuleName"));
+    EXPECT_EQ(1, FormDbCache::GetInstance().GetMatchCount(formRecord_.bundleName, "OtherModuleName"));
+
+    // only the forms of user 100 are removed
+    std::vector<FormDBInfo> removedDBForms;
+    FormDbCache::GetInstance().DeleteFormInfoByBundleName(formRecord_.bundleName, 100, removedDBForms);
+    EXPECT_EQ(2, static_cast<int>(removedDBForms.size()));
+    EXPECT_EQ(0, FormDbCache::GetInstance().GetMatchCount(formRecord_.bundleName, "TestModuleName"));
+    FormRecord record;
+    EXPECT_EQ(ERR_OK, FormDbCache::GetInstance().GetDBRecord(5, record));
+
+    FormDbCache::GetInstance().DeleteDBFormsByUserId(101);
+    EXPECT_EQ(ERR_APPEXECFWK_FORM_NOT_EXIST_ID, FormDbCache::GetInstance().GetDBRecord(5, record));
+    EXPECT_EQ(0, FormDbCache::GetInstance().GetMatchCount(formRecord_.bundleName, "OtherModuleName"));
+    GTEST_LOG_(INFO) << "FmsFormDbRecordTest_009 end";
+}
 }
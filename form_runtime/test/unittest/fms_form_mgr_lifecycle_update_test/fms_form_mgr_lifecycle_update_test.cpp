@@ -161,7 +161,7 @@ HWTEST_F(FmsFormMgrLifecycleUpdateTest, FmsFormMgrLifecycleUpdateTest_LifecycleU
     formHostRecord.SetClientStub(token_);
     formHostRecord.AddForm(formId);
     formHostRecord.SetNeedRefresh(formId, true);
-    FormDataMgr::GetInstance().clientRecords_.push_back(formHostRecord);
+    FormDataMgr::GetInstance().AddHostRecordNolock(formHostRecord);
 
     EXPECT_EQ(ERR_OK, FormMgr::GetInstance().LifecycleUpdate(formIds, token_, updateType));
 
@@ -192,7 +192,7 @@ HWTEST_F(FmsFormMgrLifecycleUpdateTest, FmsFormMgrLifecycleUpdateTest_LifecycleU
     formHostRecord.SetClientStub(token_);
     formHostRecord.AddForm(formId);
     formHostRecord.SetNeedRefresh(formId, true);
-    FormDataMgr::GetInstance().clientRecords_.push_back(formHostRecord);
+    FormDataMgr::GetInstance().AddHostRecordNolock(formHostRecord);
 
     // create formRecords
     int callingUid = 0;
@@ -233,7 +233,7 @@ HWTEST_F(FmsFormMgrLifecycleUpdateTest, FmsFormMgrLifecycleUpdateTest_LifecycleU
     formHostRecord.AddForm(formId);
     // needRefresh:true
     formHostRecord.SetNeedRefresh(formId, true);
-    FormDataMgr::GetInstance().clientRecords_.push_back(formHostRecord);
+    FormDataMgr::GetInstance().AddHostRecordNolock(formHostRecord);
 
     // create formRecords
     int callingUid = 0;
@@ -249,7 +249,7 @@ HWTEST_F(FmsFormMgrLifecycleUpdateTest, FmsFormMgrLifecycleUpdateTest_LifecycleU
     EXPECT_EQ(ERR_OK, FormMgr::GetInstance().LifecycleUpdate(formIds, token_, updateType));
 
     // judge hostrecord's needRefresh_ is false.
-    EXPECT_EQ(false, FormDataMgr::GetInstance().clientRecords_.at(0).IsNeedRefresh(formId));
+    EXPECT_EQ(false, FormDataMgr::GetInstance().clientRecords_.front().IsNeedRefresh(formId));
 
     GTEST_LOG_(INFO) << "FmsFormMgrLifecycleUpdateTest_LifecycleUpdate_006 end";
 }
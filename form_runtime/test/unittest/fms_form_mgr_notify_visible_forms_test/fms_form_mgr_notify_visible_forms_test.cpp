@@ -21,6 +21,7 @@
 #include "appexecfwk_errors.h"
 #define private public
 #include "form_bms_helper.h"
+#include "form_cache_mgr.h"
 #include "form_constants.h"
 #include "form_data_mgr.h"
 #include "form_mgr.h"
@@ -346,4 +347,49 @@ HWTEST_F(FmsFormMgrNotifyVisibleFormsTest, FmsFormMgrNotifyVisibleFormsTest_Noti
     EXPECT_EQ(ERR_OK, FormMgr::GetInstance().NotifyWhetherVisibleForms(formIds, token_, Constants::FORM_VISIBLE));
     GTEST_LOG_(INFO) << "FmsFormMgrNotifyVisibleFormsTest_NotifyVisibleForms_008 end";
 }
+
+/**
+ * @tc.number: FmsFormMgrNotifyVisibleFormsTest_NotifyVisibleForms_009
+ * @tc.name: NotifyVisibleForms
+ * @tc.desc: Verify that the return value is ERR_OK.
+ * @tc.info: The business cache of the form is evicted before the form becomes visible.
+ */
+HWTEST_F(FmsFormMgrNotifyVisibleFormsTest, FmsFormMgrNotifyVisibleFormsTest_NotifyVisibleForms_009, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "FmsFormMgrNotifyVisibleFormsTest_NotifyVisibleForms_009 start";
+
+    // create formIds
+    int64_t formId = 1000;
+    std::vector<int64_t> formIds;
+    formIds.push_back(formId);
+
+    // create formRecords
+    FormItemInfo formiteminfo1;
+    formiteminfo1.SetFormId(formId);
+    formiteminfo1.SetProviderBundleName(FORM_PROVIDER_BUNDLE_NAME);
+    formiteminfo1.SetAbilityName(FORM_PROVIDER_ABILITY_NAME);
+    formiteminfo1.SetFormVisibleNotify(true);
+    formiteminfo1.SetTemporaryFlag(false);
+    FormDataMgr::GetInstance().AllotFormRecord(formiteminfo1, 0);
+    FormDataMgr::GetInstance().SetNeedRefresh(formId, true);
+
+    // create formHostRecord
+    FormDataMgr::GetInstance().AllotFormHostRecord(formiteminfo1, token_, formId, 0);
+
+    // evict the business cache of the form
+    std::map<std::string, std::pair<sptr<FormAshmem>, int32_t>> imageMap;
+    EXPECT_TRUE(FormCacheMgr::GetInstance().AddData(formId, "{\"a\":\"1\"}", imageMap));
+    FormCacheMgr::GetInstance().SetMaxCacheSize(0);
+    FormCacheMgr::GetInstance().SetMaxCacheSize(FormCacheMgr::DEFAULT_MAX_CACHE_SIZE);
+    EXPECT_FALSE(FormCacheMgr::GetInstance().IsExist(formId));
+
+    // the form provider is asked for the form data again
+    EXPECT_EQ(ERR_OK, FormMgr::GetInstance().NotifyWhetherVisibleForms(formIds, token_, Constants::FORM_VISIBLE));
+    FormRecord formRecord;
+    EXPECT_TRUE(FormDataMgr::GetInstance().GetFormRecord(formId, formRecord));
+    EXPECT_EQ(Constants::FORM_VISIBLE, formRecord.formVisibleNotifyState);
+
+    FormDataMgr::GetInstance().DeleteFormRecord(formId);
+    GTEST_LOG_(INFO) << "FmsFormMgrNotifyVisibleFormsTest_NotifyVisibleForms_009 end";
+}
 }
@@ -0,0 +1,337 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <gtest/gtest.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "form_db_info.h"
+#include "form_storage_batcher.h"
+#include "form_storage_codec.h"
+#include "hilog_wrapper.h"
+
+using namespace testing::ext;
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace {
+const std::string FORM_KEY = "1001";
+const std::string OTHER_FORM_KEY = "1002";
+constexpr int64_t FLUSH_DELAY_MS = 10;
+constexpr int32_t WAIT_TIMES = 100;
+constexpr auto WAIT_INTERVAL = std::chrono::milliseconds(10);
+
+// a kv store in memory, standing in for the distributed one.
+class MemoryKvStore {
+public:
+    bool Commit(const std::vector<DistributedKv::Entry> &entries, const std::vector<DistributedKv::Key> &deletedKeys)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        commitCount_++;
+        if (failures_ > 0) {
+            failures_--;
+            return false;
+        }
+        for (const auto &key : deletedKeys) {
+            data_.erase(key.ToString());
+        }
+        for (const auto &entry : entries) {
+            data_[entry.key.ToString()] = entry.value.ToString();
+        }
+        return true;
+    }
+
+    FormStorageBatcher::CommitFunc GetCommitFunc()
+    {
+        return [this](const std::vector<DistributedKv::Entry> &entries,
+            const std::vector<DistributedKv::Key> &deletedKeys) { return Commit(entries, deletedKeys); };
+    }
+
+    bool Get(const std::string &key, std::string &value)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            return false;
+        }
+        value = it->second;
+        return true;
+    }
+
+    uint64_t GetSequence()
+    {
+        std::string value;
+        uint64_t sequence = 0;
+        if (Get(FormStorageBatcher::SEQUENCE_KEY, value)) {
+            FormStorageCodec::DecodeSequence(value, sequence);
+        }
+        return sequence;
+    }
+
+    int32_t GetCommitCount()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return commitCount_;
+    }
+
+    void SetFailures(int32_t failures)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        failures_ = failures;
+    }
+
+private:
+    std::mutex mutex_;
+    std::map<std::string, std::string> data_;
+    int32_t commitCount_ = 0;
+    int32_t failures_ = 0;
+};
+
+class FmsFormStorageBatcherTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+
+protected:
+    MemoryKvStore kvStore_;
+};
+
+void FmsFormStorageBatcherTest::SetUpTestCase()
+{}
+
+void FmsFormStorageBatcherTest::TearDownTestCase()
+{}
+
+void FmsFormStorageBatcherTest::SetUp()
+{}
+
+void FmsFormStorageBatcherTest::TearDown()
+{}
+
+/*
+ * Feature: FormStorageBatcher
+ * Function: Put/Delete/Flush
+ * FunctionPoints: FormStorageBatcher group commit
+ * EnvConditions: Mobile that can run ohos test framework
+ * CaseDescription: the writes are committed in one group, the last write of a key wins.
+ */
+HWTEST_F(FmsFormStorageBatcherTest, FmsFormStorageBatcherTest_001, TestSize.Level0)
+{
+    HILOG_INFO("fms_form_storage_batcher_test_001 start");
+    auto batcher = std::make_shared<FormStorageBatcher>(kvStore_.GetCommitFunc(), nullptr);
+    batcher->Put(FORM_KEY, "1");
+    batcher->Put(FORM_KEY, "2");
+    batcher->Put(OTHER_FORM_KEY, "3");
+    EXPECT_EQ(4, batcher->Delete(OTHER_FORM_KEY));
+    EXPECT_EQ(2, batcher->GetPendingCount());
+    EXPECT_EQ(0, kvStore_.GetCommitCount());
+
+    EXPECT_TRUE(batcher->Flush());
+    EXPECT_EQ(1, kvStore_.GetCommitCount());
+    std::string value;
+    EXPECT_TRUE(kvStore_.Get(FORM_KEY, value));
+    EXPECT_EQ("2", value);
+    EXPECT_FALSE(kvStore_.Get(OTHER_FORM_KEY, value));
+    EXPECT_EQ(4, kvStore_.GetSequence());
+    EXPECT_EQ(4, batcher->GetDurableSequence());
+    HILOG_INFO("fms_form_storage_batcher_test_001 end");
+}
+
+/*
+ * Feature: FormStorageBatcher
+ * Function: GetPending
+ * FunctionPoints: FormStorageBatcher group commit
+ * EnvConditions: Mobile that can run ohos test framework
+ * CaseDescription: a write not committed yet is read back, a committed one is not pending.
+ */
+HWTEST_F(FmsFormStorageBatcherTest, FmsFormStorageBatcherTest_002, TestSize.Level0)
+{
+    HILOG_INFO("fms_form_storage_batcher_test_002 start");
+    auto batcher = std::make_shared<FormStorageBatcher>(kvStore_.GetCommitFunc(), nullptr);
+    std::string value;
+    bool deleted = true;
+    batcher->Put(FORM_KEY, "1");
+    EXPECT_TRUE(batcher->GetPending(FORM_KEY, value, deleted));
+    EXPECT_EQ("1", value);
+    EXPECT_FALSE(deleted);
+
+    batcher->Delete(FORM_KEY);
+    EXPECT_TRUE(batcher->GetPending(FORM_KEY, value, deleted));
+    EXPECT_TRUE(deleted);
+
+    batcher->Flush();
+    EXPECT_FALSE(batcher->GetPending(FORM_KEY, value, deleted));
+    HILOG_INFO("fms_form_storage_batcher_test_002 end");
+}
+
+/*
+ * Feature: FormStorageBatcher
+ * Function: Flush
+ * FunctionPoints: FormStorageBatcher group commit
+ * EnvConditions: Mobile that can run ohos test framework
+ * CaseDescription: a group failing to commit is kept, a newer write of a key replaces it.
+ */
+HWTEST_F(FmsFormStorageBatcherTest, FmsFormStorageBatcherTest_003, TestSize.Level0)
+{
+    HILOG_INFO("fms_form_storage_batcher_test_003 start");
+    auto batcher = std::make_shared<FormStorageBatcher>(kvStore_.GetCommitFunc(), nullptr);
+    kvStore_.SetFailures(1);
+    batcher->Put(FORM_KEY, "1");
+    batcher->Put(OTHER_FORM_KEY, "1");
+    EXPECT_FALSE(batcher->Flush());
+    EXPECT_EQ(2, batcher->GetPendingCount());
+    EXPECT_EQ(0, batcher->GetDurableSequence());
+
+    batcher->Put(FORM_KEY, "2");
+    EXPECT_TRUE(batcher->Flush());
+    std::string value;
+    EXPECT_TRUE(kvStore_.Get(FORM_KEY, value));
+    EXPECT_EQ("2", value);
+    EXPECT_TRUE(kvStore_.Get(OTHER_FORM_KEY, value));
+    EXPECT_EQ(3, kvStore_.GetSequence());
+    HILOG_INFO("fms_form_storage_batcher_test_003 end");
+}
+
+/*
+ * Feature: FormStorageBatcher
+ * Function: Put
+ * FunctionPoints: FormStorageBatcher group commit
+ * EnvConditions: Mobile that can run ohos test framework
+ * CaseDescription: a full group is committed by the write filling it.
+ */
+HWTEST_F(FmsFormStorageBatcherTest, FmsFormStorageBatcherTest_004, TestSize.Level0)
+{
+    HILOG_INFO("fms_form_storage_batcher_test_004 start");
+    constexpr size_t maxBatchSize = 4;
+    auto batcher = std::make_shared<FormStorageBatcher>(kvStore_.GetCommitFunc(), nullptr,
+        FormStorageBatcher::DEFAULT_DELAY_MS, maxBatchSize);
+    for (size_t i = 0; i < maxBatchSize; i++) {
+        batcher->Put(std::to_string(i), "1");
+    }
+    EXPECT_EQ(1, kvStore_.GetCommitCount());
+    EXPECT_EQ(0, batcher->GetPendingCount());
+    EXPECT_EQ(maxBatchSize, kvStore_.GetSequence());
+    HILOG_INFO("fms_form_storage_batcher_test_004 end");
+}
+
+/*
+ * Feature: FormStorageBatcher
+ * Function: ~FormStorageBatcher
+ * FunctionPoints: FormStorageBatcher group commit
+ * EnvConditions: Mobile that can run ohos test framework
+ * CaseDescription: the pending writes are committed when the batcher is destroyed.
+ */
+HWTEST_F(FmsFormStorageBatcherTest, FmsFormStorageBatcherTest_005, TestSize.Level0)
+{
+    HILOG_INFO("fms_form_storage_batcher_test_005 start");
+    {
+        auto batcher = std::make_shared<FormStorageBatcher>(kvStore_.GetCommitFunc(), nullptr);
+        batcher->Put(FORM_KEY, "1");
+    }
+    std::string value;
+    EXPECT_TRUE(kvStore_.Get(FORM_KEY, value));
+    EXPECT_EQ(1, kvStore_.GetSequence());
+    HILOG_INFO("fms_form_storage_batcher_test_005 end");
+}
+
+/*
+ * Feature: FormStorageBatcher
+ * Function: SetDurableSequence
+ * FunctionPoints: FormStorageBatcher durable sequence
+ * EnvConditions: Mobile that can run ohos test framework
+ * CaseDescription: the sequence numbers go on from the one loaded.
+ */
+HWTEST_F(FmsFormStorageBatcherTest, FmsFormStorageBatcherTest_006, TestSize.Level0)
+{
+    HILOG_INFO("fms_form_storage_batcher_test_006 start");
+    constexpr uint64_t loadedSequence = 100;
+    auto batcher = std::make_shared<FormStorageBatcher>(kvStore_.GetCommitFunc(), nullptr);
+    batcher->SetDurableSequence(loadedSequence);
+    EXPECT_EQ(loadedSequence, batcher->GetDurableSequence());
+    EXPECT_EQ(loadedSequence + 1, batcher->Put(FORM_KEY, "1"));
+    batcher->Flush();
+    EXPECT_EQ(loadedSequence + 1, kvStore_.GetSequence());
+    HILOG_INFO("fms_form_storage_batcher_test_006 end");
+}
+
+/*
+ * Feature: FormStorageBatcher
+ * Function: Put
+ * FunctionPoints: FormStorageBatcher group commit
+ * EnvConditions: Mobile that can run ohos test framework
+ * CaseDescription: a group is committed on the flush handler without Flush.
+ */
+HWTEST_F(FmsFormStorageBatcherTest, FmsFormStorageBatcherTest_007, TestSize.Level0)
+{
+    HILOG_INFO("fms_form_storage_batcher_test_007 start");
+    auto batcher = std::make_shared<FormStorageBatcher>(kvStore_.GetCommitFunc(),
+        FormStorageBatcher::GetFlushHandler(), FLUSH_DELAY_MS);
+    batcher->Put(FORM_KEY, "1");
+    batcher->Put(OTHER_FORM_KEY, "1");
+    std::string value;
+    for (int32_t i = 0; i < WAIT_TIMES && !kvStore_.Get(FORM_KEY, value); i++) {
+        std::this_thread::sleep_for(WAIT_INTERVAL);
+    }
+    EXPECT_EQ("1", value);
+    EXPECT_EQ(1, kvStore_.GetCommitCount());
+    EXPECT_EQ(2, kvStore_.GetSequence());
+    HILOG_INFO("fms_form_storage_batcher_test_007 end");
+}
+
+/*
+ * Feature: FormStorageCodec
+ * Function: EncodeFormDBInfo/DecodeFormDBInfo
+ * FunctionPoints: FormStorageCodec binary encoding
+ * EnvConditions: Mobile that can run ohos test framework
+ * CaseDescription: a form data is decoded from the binary encoding and from json, a cut value is bad.
+ */
+HWTEST_F(FmsFormStorageBatcherTest, FmsFormStorageBatcherTest_008, TestSize.Level0)
+{
+    HILOG_INFO("fms_form_storage_batcher_test_008 start");
+    FormDBInfo formDBInfo;
+    formDBInfo.formId = 0x100000001L;
+    formDBInfo.userId = 100;
+    formDBInfo.formName = "widget";
+    formDBInfo.bundleName = "com.form.provider.service";
+    formDBInfo.moduleName = "entry";
+    formDBInfo.abilityName = "FormAbility";
+    formDBInfo.formUserUids = { 20000000, -1 };
+
+    std::string value = FormStorageCodec::EncodeFormDBInfo(formDBInfo);
+    EXPECT_TRUE(FormStorageCodec::IsEncoded(value));
+    FormDBInfo decoded;
+    EXPECT_TRUE(FormStorageCodec::DecodeFormDBInfo(value, decoded));
+    EXPECT_EQ(formDBInfo.formId, decoded.formId);
+    EXPECT_EQ(formDBInfo.userId, decoded.userId);
+    EXPECT_EQ(formDBInfo.abilityName, decoded.abilityName);
+    EXPECT_EQ(formDBInfo.formUserUids, decoded.formUserUids);
+    EXPECT_FALSE(FormStorageCodec::DecodeFormDBInfo(value.substr(0, value.size() - 1), decoded));
+
+    std::string json = InnerFormInfo(formDBInfo).ToString();
+    EXPECT_FALSE(FormStorageCodec::IsEncoded(json));
+    FormDBInfo decodedJson;
+    EXPECT_TRUE(FormStorageCodec::DecodeFormDBInfo(json, decodedJson));
+    EXPECT_EQ(formDBInfo.formId, decodedJson.formId);
+    EXPECT_EQ(formDBInfo.bundleName, decodedJson.bundleName);
+    EXPECT_LT(value.size(), json.size());
+    HILOG_INFO("fms_form_storage_batcher_test_008 end");
+}
+}
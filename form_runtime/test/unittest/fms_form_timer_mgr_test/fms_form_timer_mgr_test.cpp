@@ -20,7 +20,9 @@
 #include "common_event_support.h"
 #include "form_constants.h"
 #include "form_refresh_limiter.h"
+#define private public
 #include "form_timer_mgr.h"
+#undef private
 
 using namespace testing::ext;
 using namespace OHOS;
@@ -33,6 +35,31 @@ const int64_t PARAM_FORM_ID_VALUE_3 = 20210714;
 const int64_t PARAM_FORM_ID_VALUE_4 = 20210715;
 const int64_t PARAM_FORM_ID_VALUE_5 = 20210716;
 const int64_t PARAM_FORM_ID_VALUE_6 = 20210717;
+const int64_t PARAM_FORM_ID_VALUE_7 = 20210718;
+const int64_t PARAM_FORM_ID_VALUE_8 = 20210719;
+const int64_t PARAM_FORM_ID_VALUE_9 = 20210720;
+const int64_t PARAM_FORM_ID_VALUE_10 = 20210721;
+const int64_t PARAM_CURRENT_TIME = 1000000000;
+
+bool ContainsFormTimer(const std::vector<FormTimer> &timerTasks, int64_t formId)
+{
+    for (const auto &timerTask : timerTasks) {
+        if (timerTask.formId == formId) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool IsIntervalTimerQueued(const FormTimerMgr &timerMgr, int64_t formId)
+{
+    for (const auto &dueItem : timerMgr.intervalDueQueue_) {
+        if (dueItem.second == formId) {
+            return true;
+        }
+    }
+    return false;
+}
 
 class FmsFormTimerMgrTest : public testing::Test {
 public:
@@ -541,4 +568,112 @@ HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0027, Function | MediumTest | Lev
     EXPECT_EQ(isAddOk4, true);
     GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0027 end";
 }
+
+/**
+ * @tc.number: Fms_FormTimerMgr_0028
+ * @tc.name: CollectDueIntervalTasks.
+ * @tc.desc: Only the interval timers whose period has passed are due.
+ */
+HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0028, Function | MediumTest | Level1)
+{
+    GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0028 start";
+    FormTimerMgr &timerMgr = FormTimerMgr::GetInstance();
+    EXPECT_EQ(timerMgr.AddFormTimer(PARAM_FORM_ID_VALUE_7, Constants::MIN_PERIOD), true);
+    EXPECT_EQ(timerMgr.AddFormTimer(PARAM_FORM_ID_VALUE_8, 2 * Constants::MIN_PERIOD), true);
+
+    // timers that have never been refreshed are due at once.
+    std::vector<FormTimer> updateList;
+    timerMgr.CollectDueIntervalTasks(PARAM_CURRENT_TIME, updateList);
+    EXPECT_EQ(ContainsFormTimer(updateList, PARAM_FORM_ID_VALUE_7), true);
+    EXPECT_EQ(ContainsFormTimer(updateList, PARAM_FORM_ID_VALUE_8), true);
+
+    updateList.clear();
+    timerMgr.CollectDueIntervalTasks(PARAM_CURRENT_TIME + Constants::MIN_PERIOD - Constants::ABS_TIME, updateList);
+    EXPECT_EQ(ContainsFormTimer(updateList, PARAM_FORM_ID_VALUE_7), false);
+    EXPECT_EQ(ContainsFormTimer(updateList, PARAM_FORM_ID_VALUE_8), false);
+
+    updateList.clear();
+    timerMgr.CollectDueIntervalTasks(PARAM_CURRENT_TIME + Constants::MIN_PERIOD, updateList);
+    EXPECT_EQ(ContainsFormTimer(updateList, PARAM_FORM_ID_VALUE_7), true);
+    EXPECT_EQ(ContainsFormTimer(updateList, PARAM_FORM_ID_VALUE_8), false);
+
+    // a disabled timer leaves the due queue until it is enabled again.
+    timerMgr.SetIntervalEnableFlag(PARAM_FORM_ID_VALUE_8, false);
+    EXPECT_EQ(IsIntervalTimerQueued(timerMgr, PARAM_FORM_ID_VALUE_8), false);
+    updateList.clear();
+    timerMgr.CollectDueIntervalTasks(PARAM_CURRENT_TIME + 2 * Constants::MIN_PERIOD, updateList);
+    EXPECT_EQ(ContainsFormTimer(updateList, PARAM_FORM_ID_VALUE_7), true);
+    EXPECT_EQ(ContainsFormTimer(updateList, PARAM_FORM_ID_VALUE_8), false);
+    timerMgr.SetIntervalEnableFlag(PARAM_FORM_ID_VALUE_8, true);
+    updateList.clear();
+    timerMgr.CollectDueIntervalTasks(PARAM_CURRENT_TIME + 2 * Constants::MIN_PERIOD + 1, updateList);
+    EXPECT_EQ(ContainsFormTimer(updateList, PARAM_FORM_ID_VALUE_8), true);
+
+    EXPECT_EQ(timerMgr.RemoveFormTimer(PARAM_FORM_ID_VALUE_7), true);
+    EXPECT_EQ(timerMgr.RemoveFormTimer(PARAM_FORM_ID_VALUE_8), true);
+    updateList.clear();
+    timerMgr.CollectDueIntervalTasks(PARAM_CURRENT_TIME + 4 * Constants::MIN_PERIOD, updateList);
+    EXPECT_EQ(ContainsFormTimer(updateList, PARAM_FORM_ID_VALUE_7), false);
+    EXPECT_EQ(ContainsFormTimer(updateList, PARAM_FORM_ID_VALUE_8), false);
+    GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0028 end";
+}
+
+/**
+ * @tc.number: Fms_FormTimerMgr_0029
+ * @tc.name: GetUpdateAtTimer.
+ * @tc.desc: Update at timers of the same time are found by form id and removed from the index.
+ */
+HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0029, Function | MediumTest | Level1)
+{
+    GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0029 start";
+    FormTimerMgr &timerMgr = FormTimerMgr::GetInstance();
+    EXPECT_EQ(timerMgr.AddFormTimer(PARAM_FORM_ID_VALUE_9, 3, 15, 0), true);
+    EXPECT_EQ(timerMgr.AddFormTimer(PARAM_FORM_ID_VALUE_10, 3, 15, 0), true);
+
+    UpdateAtItem updateAtItem;
+    EXPECT_EQ(timerMgr.GetUpdateAtTimer(PARAM_FORM_ID_VALUE_10, updateAtItem), true);
+    EXPECT_EQ(updateAtItem.refreshTask.formId, PARAM_FORM_ID_VALUE_10);
+    EXPECT_EQ(updateAtItem.refreshTask.hour, 3);
+    EXPECT_EQ(updateAtItem.refreshTask.min, 15);
+
+    EXPECT_EQ(timerMgr.RemoveFormTimer(PARAM_FORM_ID_VALUE_9), true);
+    EXPECT_EQ(timerMgr.GetUpdateAtTimer(PARAM_FORM_ID_VALUE_9, updateAtItem), false);
+    EXPECT_EQ(timerMgr.GetUpdateAtTimer(PARAM_FORM_ID_VALUE_10, updateAtItem), true);
+    EXPECT_EQ(timerMgr.RemoveFormTimer(PARAM_FORM_ID_VALUE_10), true);
+    EXPECT_EQ(timerMgr.updateAtIndex_.count(PARAM_FORM_ID_VALUE_10), 0);
+    GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0029 end";
+}
+
+/**
+ * @tc.number: Fms_FormTimerMgr_0030
+ * @tc.name: CollectDueIntervalTasks.
+ * @tc.desc: An interval timer limited when it is due leaves the due queue until the limiter is reset.
+ */
+HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0030, Function | MediumTest | Level1)
+{
+    GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0030 start";
+    FormTimerMgr &timerMgr = FormTimerMgr::GetInstance();
+    EXPECT_EQ(timerMgr.AddFormTimer(PARAM_FORM_ID_VALUE_7, Constants::MIN_PERIOD), true);
+    for (int i = 0; i < Constants::LIMIT_COUNT; i++) {
+        timerMgr.IncreaseRefreshCount(PARAM_FORM_ID_VALUE_7);
+    }
+
+    std::vector<FormTimer> updateList;
+    timerMgr.CollectDueIntervalTasks(PARAM_CURRENT_TIME, updateList);
+    EXPECT_EQ(ContainsFormTimer(updateList, PARAM_FORM_ID_VALUE_7), false);
+    EXPECT_EQ(IsIntervalTimerQueued(timerMgr, PARAM_FORM_ID_VALUE_7), false);
+    EXPECT_EQ(timerMgr.limitedIntervalTasks_.count(PARAM_FORM_ID_VALUE_7), 1);
+
+    timerMgr.refreshLimiter_.ResetLimit();
+    timerMgr.RequeueLimitedIntervalTasks();
+    EXPECT_EQ(timerMgr.limitedIntervalTasks_.empty(), true);
+    EXPECT_EQ(IsIntervalTimerQueued(timerMgr, PARAM_FORM_ID_VALUE_7), true);
+    updateList.clear();
+    timerMgr.CollectDueIntervalTasks(PARAM_CURRENT_TIME + 1, updateList);
+    EXPECT_EQ(ContainsFormTimer(updateList, PARAM_FORM_ID_VALUE_7), true);
+
+    EXPECT_EQ(timerMgr.RemoveFormTimer(PARAM_FORM_ID_VALUE_7), true);
+    EXPECT_EQ(IsIntervalTimerQueued(timerMgr, PARAM_FORM_ID_VALUE_7), false);
+    GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0030 end";
+}
 }
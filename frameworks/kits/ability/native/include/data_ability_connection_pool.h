@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_OHOS_DATA_ABILITY_CONNECTION_POOL_H
+#define FOUNDATION_APPEXECFWK_OHOS_DATA_ABILITY_CONNECTION_POOL_H
+
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "ability_scheduler_interface.h"
+#include "iremote_object.h"
+#include "uri.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+/**
+ * @class DataAbilityConnectionPool
+ * DataAbilityConnectionPool keeps the data abilities acquired by DataAbilityHelpers that are not bound to a uri,
+ * so that repeated operations on the same provider reuse one scheduler proxy instead of acquiring and releasing
+ * it from the ability manager every time. Connections are keyed by provider and caller token, released after
+ * they have been idle for a while, and dropped when the provider dies.
+ */
+class DataAbilityConnectionPool {
+public:
+    static DataAbilityConnectionPool &GetInstance();
+
+    /**
+     * @brief Acquire the data ability of the uri, a pooled connection is reused if there is one.
+     *
+     * @param uri Indicates the path of the data to operate.
+     * @param tryBind Whether to bind the caller to the data ability.
+     * @param token Indicates the caller token.
+     * @return Returns the scheduler proxy of the data ability, or nullptr on failure.
+     */
+    sptr<AAFwk::IAbilityScheduler> Acquire(const Uri &uri, bool tryBind, const sptr<IRemoteObject> &token);
+
+    /**
+     * @brief Return a connection got by Acquire to the pool.
+     *
+     * @param uri Indicates the path of the data to operate.
+     * @param tryBind Whether the caller is bound to the data ability.
+     * @param token Indicates the caller token.
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    int Release(const Uri &uri, bool tryBind, const sptr<IRemoteObject> &token);
+
+    /**
+     * @brief Release the connections that are not in use and have been idle for the idle timeout.
+     */
+    void ReleaseIdleConnections();
+
+    /**
+     * @brief Set the time a connection is kept after its last use.
+     *
+     * @param idleTimeout The idle timeout in milliseconds.
+     */
+    void SetIdleTimeout(int64_t idleTimeout);
+
+private:
+    struct Connection {
+        sptr<AAFwk::IAbilityScheduler> dataAbilityProxy;
+        sptr<IRemoteObject> token;
+        sptr<IRemoteObject::DeathRecipient> deathRecipient;
+        int32_t useCount = 0;
+        int64_t lastUseTime = 0;
+    };
+
+    DataAbilityConnectionPool() = default;
+    ~DataAbilityConnectionPool() = default;
+
+    static bool MakeKey(const Uri &uri, bool tryBind, const sptr<IRemoteObject> &token, std::string &key);
+    static int64_t GetCurrentTime();
+    void OnDataAbilityDied(const wptr<IRemoteObject> &remote);
+    void ScheduleReleaseIdleConnections();
+
+    static constexpr int64_t DEFAULT_IDLE_TIMEOUT = 10000;
+
+    std::mutex mutex_;
+    std::map<std::string, Connection> connections_;
+    int64_t idleTimeout_ = DEFAULT_IDLE_TIMEOUT;
+    bool releaseScheduled_ = false;
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif  // FOUNDATION_APPEXECFWK_OHOS_DATA_ABILITY_CONNECTION_POOL_H
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "data_ability_connection_pool.h"
+
+#include <chrono>
+#include <vector>
+
+#include "ability_manager_client.h"
+#include "data_ability_helper.h"
+#include "hilog_wrapper.h"
+#include "task_handler_client.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+using AbilityManagerClient = OHOS::AAFwk::AbilityManagerClient;
+
+DataAbilityConnectionPool &DataAbilityConnectionPool::GetInstance()
+{
+    static DataAbilityConnectionPool instance;
+    return instance;
+}
+
+bool DataAbilityConnectionPool::MakeKey(
+    const Uri &uri, bool tryBind, const sptr<IRemoteObject> &token, std::string &key)
+{
+    // the data ability is resolved by the first path segment of the uri.
+    std::vector<std::string_view> pathSegments;
+    uri.GetPathSegments(pathSegments);
+    if (pathSegments.empty()) {
+        return false;
+    }
+    key = std::string(uri.GetAuthorityView()) + "/" + std::string(pathSegments[0]) + "|" +
+        std::to_string(tryBind) + "|" + std::to_string(reinterpret_cast<uintptr_t>(token.GetRefPtr()));
+    return true;
+}
+
+int64_t DataAbilityConnectionPool::GetCurrentTime()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+sptr<AAFwk::IAbilityScheduler> DataAbilityConnectionPool::Acquire(
+    const Uri &uri, bool tryBind, const sptr<IRemoteObject> &token)
+{
+    std::string key;
+    if (!MakeKey(uri, tryBind, token, key)) {
+        HILOG_ERROR("DataAbilityConnectionPool::Acquire failed, invalid uri path.");
+        return nullptr;
+    }
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        auto iter = connections_.find(key);
+        if (iter != connections_.end()) {
+            iter->second.useCount++;
+            return iter->second.dataAbilityProxy;
+        }
+    }
+
+    HILOG_INFO("DataAbilityConnectionPool::Acquire before AcquireDataAbility.");
+    sptr<AAFwk::IAbilityScheduler> dataAbilityProxy =
+        AbilityManagerClient::GetInstance()->AcquireDataAbility(uri, tryBind, token);
+    HILOG_INFO("DataAbilityConnectionPool::Acquire after AcquireDataAbility.");
+    if (dataAbilityProxy == nullptr) {
+        return nullptr;
+    }
+
+    sptr<AAFwk::IAbilityScheduler> redundantProxy = nullptr;
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        auto iter = connections_.find(key);
+        if (iter != connections_.end()) {
+            // acquired by another thread meanwhile, keep the pooled one.
+            iter->second.useCount++;
+            redundantProxy = dataAbilityProxy;
+            dataAbilityProxy = iter->second.dataAbilityProxy;
+        } else {
+            Connection connection;
+            connection.dataAbilityProxy = dataAbilityProxy;
+            connection.token = token;
+            connection.useCount = 1;
+            connection.deathRecipient = new (std::nothrow) DataAbilityDeathRecipient(
+                [](const wptr<IRemoteObject> &remote) {
+                    DataAbilityConnectionPool::GetInstance().OnDataAbilityDied(remote);
+                });
+            auto remoteObject = dataAbilityProxy->AsObject();
+            if (remoteObject != nullptr && connection.deathRecipient != nullptr) {
+                remoteObject->AddDeathRecipient(connection.deathRecipient);
+            }
+            connections_.emplace(key, connection);
+        }
+    }
+    if (redundantProxy != nullptr) {
+        AbilityManagerClient::GetInstance()->ReleaseDataAbility(redundantProxy, token);
+    }
+    return dataAbilityProxy;
+}
+
+int DataAbilityConnectionPool::Release(const Uri &uri, bool tryBind, const sptr<IRemoteObject> &token)
+{
+    std::string key;
+    if (!MakeKey(uri, tryBind, token, key)) {
+        return ERR_OK;
+    }
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto iter = connections_.find(key);
+    if (iter == connections_.end()) {
+        // the data ability died while it was in use.
+        return ERR_OK;
+    }
+    if (iter->second.useCount > 0) {
+        iter->second.useCount--;
+    }
+    iter->second.lastUseTime = GetCurrentTime();
+    if (iter->second.useCount == 0) {
+        ScheduleReleaseIdleConnections();
+    }
+    return ERR_OK;
+}
+
+void DataAbilityConnectionPool::ReleaseIdleConnections()
+{
+    std::vector<Connection> idleConnections;
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        releaseScheduled_ = false;
+        int64_t currentTime = GetCurrentTime();
+        bool hasIdleConnection = false;
+        for (auto iter = connections_.begin(); iter != connections_.end();) {
+            if (iter->second.useCount > 0) {
+                ++iter;
+                continue;
+            }
+            if (currentTime - iter->second.lastUseTime >= idleTimeout_) {
+                idleConnections.emplace_back(iter->second);
+                iter = connections_.erase(iter);
+            } else {
+                hasIdleConnection = true;
+                ++iter;
+            }
+        }
+        if (hasIdleConnection) {
+            ScheduleReleaseIdleConnections();
+        }
+    }
+
+    for (auto &connection : idleConnections) {
+        auto remoteObject = connection.dataAbilityProxy->AsObject();
+        if (remoteObject != nullptr && connection.deathRecipient != nullptr) {
+            remoteObject->RemoveDeathRecipient(connection.deathRecipient);
+        }
+        HILOG_INFO("DataAbilityConnectionPool::ReleaseIdleConnections before ReleaseDataAbility.");
+        int err = AbilityManagerClient::GetInstance()->ReleaseDataAbility(
+            connection.dataAbilityProxy, connection.token);
+        if (err != ERR_OK) {
+            HILOG_ERROR("DataAbilityConnectionPool::ReleaseIdleConnections failed to ReleaseDataAbility "
+                "err = %{public}d", err);
+        }
+    }
+}
+
+void DataAbilityConnectionPool::SetIdleTimeout(int64_t idleTimeout)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    idleTimeout_ = idleTimeout;
+}
+
+void DataAbilityConnectionPool::OnDataAbilityDied(const wptr<IRemoteObject> &remote)
+{
+    HILOG_INFO("DataAbilityConnectionPool::OnDataAbilityDied start.");
+    std::lock_guard<std::mutex> guard(mutex_);
+    for (auto iter = connections_.begin(); iter != connections_.end();) {
+        auto remoteObject = iter->second.dataAbilityProxy->AsObject();
+        if (remoteObject != nullptr && remoteObject.GetRefPtr() == remote.GetRefPtr()) {
+            iter = connections_.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+}
+
+void DataAbilityConnectionPool::ScheduleReleaseIdleConnections()
+{
+    if (releaseScheduled_) {
+        return;
+    }
+    auto task = []() {
+        DataAbilityConnectionPool::GetInstance().ReleaseIdleConnections();
+    };
+    releaseScheduled_ = TaskHandlerClient::GetInstance()->PostTask(task, idleTimeout_);
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#define private public
+#include "data_ability_connection_pool.h"
+#undef private
+#include "mock_ability_manager_client.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+using namespace testing::ext;
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace {
+const std::string URI_FIRST = "dataability:///com.example.first.DataAbility/table";
+const std::string URI_FIRST_OTHER_PATH = "dataability:///com.example.first.DataAbility/other";
+const std::string URI_SECOND = "dataability:///com.example.second.DataAbility/table";
+}
+
+class DataAbilityConnectionPoolTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    sptr<IRemoteObject> token_ = new (std::nothrow) MockAbilityThread();
+};
+
+void DataAbilityConnectionPoolTest::SetUpTestCase(void)
+{}
+
+void DataAbilityConnectionPoolTest::TearDownTestCase(void)
+{}
+
+void DataAbilityConnectionPoolTest::SetUp(void)
+{}
+
+void DataAbilityConnectionPoolTest::TearDown(void)
+{
+    auto &pool = DataAbilityConnectionPool::GetInstance();
+    pool.SetIdleTimeout(0);
+    pool.ReleaseIdleConnections();
+    pool.connections_.clear();
+    pool.SetIdleTimeout(DataAbilityConnectionPool::DEFAULT_IDLE_TIMEOUT);
+}
+
+/**
+ * @tc.number: AaFwk_DataAbilityConnectionPool_Acquire_0100
+ * @tc.name: Acquire
+ * @tc.desc: Test the connection of a provider is reused by uris of the same provider.
+ */
+HWTEST_F(DataAbilityConnectionPoolTest, AaFwk_DataAbilityConnectionPool_Acquire_0100, Function | MediumTest | Level1)
+{
+    GTEST_LOG_(INFO) << "AaFwk_DataAbilityConnectionPool_Acquire_0100 start";
+    auto &pool = DataAbilityConnectionPool::GetInstance();
+    Uri uriFirst(URI_FIRST);
+    Uri uriFirstOtherPath(URI_FIRST_OTHER_PATH);
+    Uri uriSecond(URI_SECOND);
+
+    auto proxyFirst = pool.Acquire(uriFirst, false, token_);
+    EXPECT_NE(proxyFirst, nullptr);
+    EXPECT_EQ(pool.Release(uriFirst, false, token_), ERR_OK);
+    EXPECT_EQ(pool.Acquire(uriFirstOtherPath, false, token_), proxyFirst);
+    EXPECT_EQ(pool.connections_.size(), 1u);
+
+    auto proxySecond = pool.Acquire(uriSecond, false, token_);
+    EXPECT_NE(proxySecond, nullptr);
+    EXPECT_NE(proxySecond, proxyFirst);
+    EXPECT_EQ(pool.connections_.size(), 2u);
+
+    EXPECT_EQ(pool.Release(uriFirstOtherPath, false, token_), ERR_OK);
+    EXPECT_EQ(pool.Release(uriSecond, false, token_), ERR_OK);
+    GTEST_LOG_(INFO) << "AaFwk_DataAbilityConnectionPool_Acquire_0100 end";
+}
+
+/**
+ * @tc.number: AaFwk_DataAbilityConnectionPool_ReleaseIdleConnections_0100
+ * @tc.name: ReleaseIdleConnections
+ * @tc.desc: Test only the connections that are not in use are released when they are idle.
+ */
+HWTEST_F(DataAbilityConnectionPoolTest, AaFwk_DataAbilityConnectionPool_ReleaseIdleConnections_0100,
+    Function | MediumTest | Level1)
+{
+    GTEST_LOG_(INFO) << "AaFwk_DataAbilityConnectionPool_ReleaseIdleConnections_0100 start";
+    auto &pool = DataAbilityConnectionPool::GetInstance();
+    Uri uriFirst(URI_FIRST);
+    Uri uriSecond(URI_SECOND);
+    pool.SetIdleTimeout(0);
+
+    auto proxyFirst = pool.Acquire(uriFirst, false, token_);
+    auto proxySecond = pool.Acquire(uriSecond, false, token_);
+    EXPECT_EQ(pool.Release(uriFirst, false, token_), ERR_OK);
+    pool.ReleaseIdleConnections();
+    EXPECT_EQ(pool.connections_.size(), 1u);
+    EXPECT_EQ(pool.Acquire(uriSecond, false, token_), proxySecond);
+    EXPECT_NE(pool.Acquire(uriFirst, false, token_), proxyFirst);
+    GTEST_LOG_(INFO) << "AaFwk_DataAbilityConnectionPool_ReleaseIdleConnections_0100 end";
+}
+
+/**
+ * @tc.number: AaFwk_DataAbilityConnectionPool_OnDataAbilityDied_0100
+ * @tc.name: OnDataAbilityDied
+ * @tc.desc: Test the connection of a died provider is not reused.
+ */
+HWTEST_F(DataAbilityConnectionPoolTest, AaFwk_DataAbilityConnectionPool_OnDataAbilityDied_0100,
+    Function | MediumTest | Level1)
+{
+    GTEST_LOG_(INFO) << "AaFwk_DataAbilityConnectionPool_OnDataAbilityDied_0100 start";
+    auto &pool = DataAbilityConnectionPool::GetInstance();
+    Uri uriFirst(URI_FIRST);
+
+    auto proxyFirst = pool.Acquire(uriFirst, false, token_);
+    EXPECT_NE(proxyFirst, nullptr);
+    pool.OnDataAbilityDied(proxyFirst->AsObject());
+    EXPECT_TRUE(pool.connections_.empty());
+    EXPECT_EQ(pool.Release(uriFirst, false, token_), ERR_OK);
+    EXPECT_NE(pool.Acquire(uriFirst, false, token_), proxyFirst);
+    GTEST_LOG_(INFO) << "AaFwk_DataAbilityConnectionPool_OnDataAbilityDied_0100 end";
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
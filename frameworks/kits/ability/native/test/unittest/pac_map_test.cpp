@@ -743,5 +743,100 @@ HWTEST_F(PacMapTest, AppExecFwk_PacMap_Marshalling_0300, Function | MediumTest |
     EXPECT_EQ(true, unmarshingMap != nullptr);
     GTEST_LOG_(INFO) << "AppExecFwk_PacMap_Marshalling_0300 end";
 }
+/**
+ * @tc.number: AppExecFwk_PacMap_Marshalling_0400
+ * @tc.name: Marshalling and Unmarshalling
+ * @tc.desc: Verify the binary encoding keeps full float and double precision.
+ */
+HWTEST_F(PacMapTest, AppExecFwk_PacMap_Marshalling_0400, Function | MediumTest | Level1)
+{
+    GTEST_LOG_(INFO) << "AppExecFwk_PacMap_Marshalling_0400 start";
+
+    Parcel parcel;
+    double doubleValue = 0.1234567890123456789;
+    float floatValue = 0.123456789f;
+    pacmap_->PutDoubleValue("key_double", doubleValue);
+    pacmap_->PutFloatValue("key_float", floatValue);
+    EXPECT_EQ(true, pacmap_->Marshalling(parcel));
+
+    PacMap *unmarshingMap = PacMap::Unmarshalling(parcel);
+    EXPECT_EQ(true, unmarshingMap != nullptr);
+    if (unmarshingMap != nullptr) {
+        EXPECT_EQ(doubleValue, unmarshingMap->GetDoubleValue("key_double"));
+        EXPECT_EQ(floatValue, unmarshingMap->GetFloatValue("key_float"));
+        delete unmarshingMap;
+        unmarshingMap = nullptr;
+    }
+    GTEST_LOG_(INFO) << "AppExecFwk_PacMap_Marshalling_0400 end";
+}
+
+/**
+ * @tc.number: AppExecFwk_PacMap_Marshalling_0500
+ * @tc.name: Unmarshalling
+ * @tc.desc: Verify Unmarshalling() still accepts the legacy JSON encoding.
+ */
+HWTEST_F(PacMapTest, AppExecFwk_PacMap_Marshalling_0500, Function | MediumTest | Level1)
+{
+    GTEST_LOG_(INFO) << "AppExecFwk_PacMap_Marshalling_0500 start";
+
+    Parcel parcel;
+    FillData(*pacmap_.get());
+    FillData2(*pacmap2_.get(), *pacmap_.get());
+    EXPECT_EQ(true, parcel.WriteString("PACMAP"));
+    EXPECT_EQ(true, parcel.WriteString(pacmap2_->ToString()));
+
+    PacMap *unmarshingMap = PacMap::Unmarshalling(parcel);
+    EXPECT_EQ(true, unmarshingMap != nullptr);
+    if (unmarshingMap != nullptr) {
+        EXPECT_EQ(true, pacmap2_->Equals(unmarshingMap));
+        delete unmarshingMap;
+        unmarshingMap = nullptr;
+    }
+    GTEST_LOG_(INFO) << "AppExecFwk_PacMap_Marshalling_0500 end";
+}
+
+/**
+ * @tc.number: AppExecFwk_PacMap_Marshalling_0600
+ * @tc.name: Unmarshalling
+ * @tc.desc: Verify Unmarshalling() rejects a truncated binary encoding.
+ */
+HWTEST_F(PacMapTest, AppExecFwk_PacMap_Marshalling_0600, Function | MediumTest | Level1)
+{
+    GTEST_LOG_(INFO) << "AppExecFwk_PacMap_Marshalling_0600 start";
+
+    Parcel parcel;
+    EXPECT_EQ(true, parcel.WriteString("PACMAP_BINARY"));
+    EXPECT_EQ(true, parcel.WriteInt32(1));
+    EXPECT_EQ(true, parcel.WriteString("key_int"));
+
+    PacMap *unmarshingMap = PacMap::Unmarshalling(parcel);
+    EXPECT_EQ(true, unmarshingMap == nullptr);
+    GTEST_LOG_(INFO) << "AppExecFwk_PacMap_Marshalling_0600 end";
+}
+
+/**
+ * @tc.number: AppExecFwk_PacMap_DeepCopy_0200
+ * @tc.name: DeepCopy
+ * @tc.desc: Verify the copy does not share nested PacMaps or arrays with the source.
+ */
+HWTEST_F(PacMapTest, AppExecFwk_PacMap_DeepCopy_0200, Function | MediumTest | Level1)
+{
+    GTEST_LOG_(INFO) << "AppExecFwk_PacMap_DeepCopy_0200 start";
+
+    FillData(*pacmap_.get());
+    FillData2(*pacmap2_.get(), *pacmap_.get());
+
+    PacMap copyMap(*pacmap2_.get());
+    EXPECT_EQ(true, copyMap.Equals(*pacmap2_.get()));
+
+    std::map<std::string, PacMapObject::INTERFACE> source = pacmap2_->GetAll();
+    std::map<std::string, PacMapObject::INTERFACE> copied = copyMap.GetAll();
+    EXPECT_NE(source["key_map"].GetRefPtr(), copied["key_map"].GetRefPtr());
+    EXPECT_NE(source["key_int_array"].GetRefPtr(), copied["key_int_array"].GetRefPtr());
+
+    pacmap2_->PutIntValue("key_int", 0);
+    EXPECT_EQ(PAC_MPA_TEST_INT, copyMap.GetIntValue("key_int"));
+    GTEST_LOG_(INFO) << "AppExecFwk_PacMap_DeepCopy_0200 end";
+}
 }  // namespace AppExecFwk
-}  // namespace OHOS
\ No newline at end of file
+}  // namespace OHOS
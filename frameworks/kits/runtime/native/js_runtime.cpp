@@ -18,7 +18,8 @@
 #include <cerrno>
 #include <climits>
 #include <cstdlib>
-#include <fstream>
+#include <mutex>
+#include <unordered_map>
 
 #include "native_engine/impl/ark/ark_native_engine.h"
 #ifdef SUPPORT_GRAPHICS
@@ -28,6 +29,7 @@
 #include "event_handler.h"
 #include "hilog_wrapper.h"
 #include "js_runtime_utils.h"
+#include "mapped_file_cache.h"
 
 #ifdef ENABLE_HITRACE
 #include "hitrace/trace.h"
@@ -41,6 +43,10 @@ namespace {
 constexpr uint8_t SYSCAP_MAX_SIZE = 64;
 constexpr int64_t DEFAULT_GC_POOL_SIZE = 0x10000000; // 256MB
 constexpr int64_t ASSET_FILE_MAX_SIZE = 20 * 1024 * 1024;
+constexpr char COMPLETE_TASK_NAME[] = "completeTask";
+// the engines of the initialized runtimes, GetJsEngine of other engines, such as the ones of ace, is not a runtime.
+std::mutex g_runtimeEnginesMutex;
+std::unordered_map<NativeEngine*, JsRuntime*> g_runtimeEngines;
 #if defined(_ARM64_)
 constexpr char ARK_DEBUGGER_LIB_PATH[] = "/system/lib64/libark_debugger.z.so";
 #else
@@ -306,25 +312,11 @@ void RegisterInitWorkerFunc(NativeEngine& engine)
 
 bool GetResourceData(const std::string& filePath, std::vector<uint8_t>& content)
 {
-    std::ifstream stream(filePath);
-    if (!stream.is_open()) {
-        HILOG_ERROR("GetResourceData failed with file can't open, check uri.");
+    // the same assets are read again by every worker, so their mappings are kept.
+    if (!MappedFileCache::GetInstance().Read(filePath, content, ASSET_FILE_MAX_SIZE)) {
+        HILOG_ERROR("GetResourceData failed with file can't be read, check uri.");
         return false;
     }
-
-    stream.seekg(0, std::ios::end);
-    auto fileLen = stream.tellg();
-    if (fileLen > ASSET_FILE_MAX_SIZE) {
-        HILOG_ERROR("GetResourceData failed with file too large.");
-        stream.close();
-        return false;
-    }
-
-    content.resize(fileLen);
-    stream.seekg(0, std::ios::beg);
-    stream.read(reinterpret_cast<char*>(content.data()), content.size());
-    stream.close();
-
     return true;
 }
 
@@ -363,6 +355,8 @@ void RegisterWorker(NativeEngine& engine, const std::string& codePath)
 }
 } // namespace
 
+JsRuntime::~JsRuntime() = default;
+
 std::unique_ptr<Runtime> JsRuntime::Create(const Runtime::Options& options)
 {
     std::unique_ptr<JsRuntime> instance = std::make_unique<ArkJsRuntime>();
@@ -423,11 +417,22 @@ bool JsRuntime::Initialize(const Options& options)
 
     RegisterWorker(*nativeEngine_, options.codePath);
 
+    {
+        std::lock_guard<std::mutex> lock(g_runtimeEnginesMutex);
+        g_runtimeEngines[nativeEngine_.get()] = this;
+    }
     return true;
 }
 
 void JsRuntime::Deinitialize()
 {
+    {
+        std::lock_guard<std::mutex> lock(g_runtimeEnginesMutex);
+        auto iter = g_runtimeEngines.find(nativeEngine_.get());
+        if (iter != g_runtimeEngines.end() && iter->second == this) {
+            g_runtimeEngines.erase(iter);
+        }
+    }
     for (auto it = modules_.begin(); it != modules_.end(); it = modules_.erase(it)) {
         delete it->second;
         it->second = nullptr;
@@ -436,6 +441,12 @@ void JsRuntime::Deinitialize()
     methodRequireNapiRef_.reset();
     nativeEngine_->CancelCheckUVLoop();
     RemoveTask("idleTask");
+    RemoveTask(COMPLETE_TASK_NAME);
+    {
+        // the tasks release their references before the engine is gone.
+        std::lock_guard<std::mutex> lock(completeTasksMutex_);
+        completeTasks_.clear();
+    }
     nativeEngine_.reset();
 }
 
@@ -608,6 +619,44 @@ void JsRuntime::RemoveTask(const std::string& name)
     eventHandler_->RemoveTask(name);
 }
 
+void JsRuntime::PostCompleteTask(std::unique_ptr<AsyncTask>&& task)
+{
+    bool needPost = false;
+    {
+        std::lock_guard<std::mutex> lock(completeTasksMutex_);
+        needPost = completeTasks_.empty();
+        completeTasks_.emplace_back(std::move(task));
+    }
+    // one wake up for the tasks posted till the js thread gets to them.
+    if (needPost) {
+        eventHandler_->PostTask([this]() { RunCompleteTasks(); }, COMPLETE_TASK_NAME);
+    }
+}
+
+bool JsRuntime::PostCompleteTask(NativeEngine& engine, std::unique_ptr<AsyncTask>& task)
+{
+    // held while posting, so the runtime is not deinitialized meanwhile.
+    std::lock_guard<std::mutex> lock(g_runtimeEnginesMutex);
+    auto iter = g_runtimeEngines.find(&engine);
+    if (iter == g_runtimeEngines.end()) {
+        return false;
+    }
+    iter->second->PostCompleteTask(std::move(task));
+    return true;
+}
+
+void JsRuntime::RunCompleteTasks()
+{
+    std::vector<std::unique_ptr<AsyncTask>> tasks;
+    {
+        std::lock_guard<std::mutex> lock(completeTasksMutex_);
+        tasks.swap(completeTasks_);
+    }
+    for (auto& task : tasks) {
+        task->RunComplete(*nativeEngine_, napi_ok);
+    }
+}
+
 NativeValue* JsRuntime::SetCallbackTimer(NativeEngine& engine, NativeCallbackInfo& info, bool isInterval)
 {
     // parameter check, must have at least 2 params
@@ -15,15 +15,65 @@
 
 #include "js_runtime_utils.h"
 
+#include <mutex>
+#include <new>
+#include <vector>
+
 #include "hilog_wrapper.h"
 #include "js_runtime.h"
 
 namespace OHOS {
 namespace AbilityRuntime {
 namespace {
-std::unique_ptr<AsyncTask> CreateAsyncTaskWithLastParam(NativeEngine& engine, NativeValue* lastParam,
-    std::unique_ptr<AsyncTask::ExecuteCallback>&& execute, std::unique_ptr<AsyncTask::CompleteCallback>&& complete,
-    NativeValue** result)
+// freed tasks kept for reuse, more are given back to the heap.
+constexpr size_t MAX_FREE_ASYNC_TASKS = 64;
+
+class AsyncTaskPool {
+public:
+    void* Allocate(size_t size)
+    {
+        if (size == sizeof(AsyncTask)) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!freeList_.empty()) {
+                void* ptr = freeList_.back();
+                freeList_.pop_back();
+                return ptr;
+            }
+        }
+        return ::operator new(size);
+    }
+
+    void Free(void* ptr)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (freeList_.size() < MAX_FREE_ASYNC_TASKS) {
+                freeList_.emplace_back(ptr);
+                return;
+            }
+        }
+        ::operator delete(ptr);
+    }
+
+    static AsyncTaskPool& GetInstance()
+    {
+        // never destroyed, tasks may be freed on exit.
+        static AsyncTaskPool* pool = new AsyncTaskPool();
+        return *pool;
+    }
+
+private:
+    AsyncTaskPool()
+    {
+        freeList_.reserve(MAX_FREE_ASYNC_TASKS);
+    }
+
+    std::mutex mutex_;
+    std::vector<void*> freeList_;
+};
+
+std::unique_ptr<AsyncTask> CreateAsyncTaskWithCallbacks(NativeEngine& engine, NativeValue* lastParam,
+    AsyncTask::ExecuteCallback&& execute, AsyncTask::CompleteCallback&& complete, NativeValue** result)
 {
     if (lastParam == nullptr || lastParam->TypeOf() != NATIVE_FUNCTION) {
         NativeDeferred* nativeDeferred = nullptr;
@@ -129,19 +179,63 @@ NativeValue* HandleScope::Escape(NativeValue* value)
 // Async Task
 AsyncTask::AsyncTask(NativeDeferred* deferred, std::unique_ptr<AsyncTask::ExecuteCallback>&& execute,
     std::unique_ptr<AsyncTask::CompleteCallback>&& complete)
-    : deferred_(deferred), execute_(std::move(execute)), complete_(std::move(complete))
-{}
+    : deferred_(deferred)
+{
+    if (execute) {
+        execute_ = std::move(*execute);
+    }
+    if (complete) {
+        complete_ = std::move(*complete);
+    }
+}
 
 AsyncTask::AsyncTask(NativeReference* callbackRef, std::unique_ptr<AsyncTask::ExecuteCallback>&& execute,
     std::unique_ptr<AsyncTask::CompleteCallback>&& complete)
+    : callbackRef_(callbackRef)
+{
+    if (execute) {
+        execute_ = std::move(*execute);
+    }
+    if (complete) {
+        complete_ = std::move(*complete);
+    }
+}
+
+AsyncTask::AsyncTask(NativeDeferred* deferred, AsyncTask::ExecuteCallback&& execute,
+    AsyncTask::CompleteCallback&& complete)
+    : deferred_(deferred), execute_(std::move(execute)), complete_(std::move(complete))
+{}
+
+AsyncTask::AsyncTask(NativeReference* callbackRef, AsyncTask::ExecuteCallback&& execute,
+    AsyncTask::CompleteCallback&& complete)
     : callbackRef_(callbackRef), execute_(std::move(execute)), complete_(std::move(complete))
 {}
 
 AsyncTask::~AsyncTask() = default;
 
+void* AsyncTask::operator new(size_t size)
+{
+    return AsyncTaskPool::GetInstance().Allocate(size);
+}
+
+void AsyncTask::operator delete(void* ptr)
+{
+    if (ptr != nullptr) {
+        AsyncTaskPool::GetInstance().Free(ptr);
+    }
+}
+
 void AsyncTask::Schedule(NativeEngine& engine, std::unique_ptr<AsyncTask>&& task)
 {
-    if (task && task->Start(engine)) {
+    if (!task) {
+        return;
+    }
+    // nothing to execute on the thread pool, so no async work is needed to complete it on the js thread.
+    // an engine that is not the one of a runtime, such as a worker or an ace engine, completes it on its own.
+    if (!task->execute_ && JsRuntime::PostCompleteTask(engine, task)) {
+        return;
+    }
+    if (task->Start(engine)) {
         task.release();
     }
 }
@@ -186,8 +280,8 @@ void AsyncTask::Execute(NativeEngine* engine, void* data)
         return;
     }
     auto me = static_cast<AsyncTask*>(data);
-    if (me->execute_ && *(me->execute_)) {
-        (*me->execute_)();
+    if (me->execute_) {
+        me->execute_();
     }
 }
 
@@ -197,9 +291,14 @@ void AsyncTask::Complete(NativeEngine* engine, int32_t status, void* data)
         return;
     }
     std::unique_ptr<AsyncTask> me(static_cast<AsyncTask*>(data));
-    if (me->complete_ && *(me->complete_)) {
-        HandleScope handleScope(*engine);
-        (*me->complete_)(*engine, *me, status);
+    me->RunComplete(*engine, status);
+}
+
+void AsyncTask::RunComplete(NativeEngine& engine, int32_t status)
+{
+    if (complete_) {
+        HandleScope handleScope(engine);
+        complete_(engine, *this, status);
     }
 }
 
@@ -212,30 +311,28 @@ bool AsyncTask::Start(NativeEngine& engine)
 std::unique_ptr<AsyncTask> CreateAsyncTaskWithLastParam(NativeEngine& engine, NativeValue* lastParam,
     AsyncTask::ExecuteCallback&& execute, AsyncTask::CompleteCallback&& complete, NativeValue** result)
 {
-    return CreateAsyncTaskWithLastParam(engine, lastParam,
-        std::make_unique<AsyncTask::ExecuteCallback>(std::move(execute)),
-        std::make_unique<AsyncTask::CompleteCallback>(std::move(complete)), result);
+    return CreateAsyncTaskWithCallbacks(engine, lastParam, std::move(execute), std::move(complete), result);
 }
 
 std::unique_ptr<AsyncTask> CreateAsyncTaskWithLastParam(NativeEngine& engine, NativeValue* lastParam,
     AsyncTask::ExecuteCallback&& execute, nullptr_t, NativeValue** result)
 {
-    return CreateAsyncTaskWithLastParam(
-        engine, lastParam, std::make_unique<AsyncTask::ExecuteCallback>(std::move(execute)), nullptr, result);
+    return CreateAsyncTaskWithCallbacks(
+        engine, lastParam, std::move(execute), AsyncTask::CompleteCallback(), result);
 }
 
 std::unique_ptr<AsyncTask> CreateAsyncTaskWithLastParam(NativeEngine& engine, NativeValue* lastParam,
     nullptr_t, AsyncTask::CompleteCallback&& complete, NativeValue** result)
 {
-    return CreateAsyncTaskWithLastParam(
-        engine, lastParam, nullptr, std::make_unique<AsyncTask::CompleteCallback>(std::move(complete)), result);
+    return CreateAsyncTaskWithCallbacks(
+        engine, lastParam, AsyncTask::ExecuteCallback(), std::move(complete), result);
 }
 
 std::unique_ptr<AsyncTask> CreateAsyncTaskWithLastParam(NativeEngine& engine, NativeValue* lastParam,
     nullptr_t, nullptr_t, NativeValue** result)
 {
-    return CreateAsyncTaskWithLastParam(engine, lastParam, std::unique_ptr<AsyncTask::ExecuteCallback>(),
-        std::unique_ptr<AsyncTask::CompleteCallback>(), result);
+    return CreateAsyncTaskWithCallbacks(
+        engine, lastParam, AsyncTask::ExecuteCallback(), AsyncTask::CompleteCallback(), result);
 }
 }  // namespace AbilityRuntime
 }  // namespace OHOS
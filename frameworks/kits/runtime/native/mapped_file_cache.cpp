@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mapped_file_cache.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "hilog_wrapper.h"
+
+namespace OHOS {
+namespace AbilityRuntime {
+MappedFileCache::MappedFile::MappedFile(void* data, size_t size) : data_(data), size_(size)
+{}
+
+MappedFileCache::MappedFile::~MappedFile()
+{
+    if (data_ != nullptr) {
+        munmap(data_, size_);
+    }
+}
+
+MappedFileCache& MappedFileCache::GetInstance()
+{
+    static MappedFileCache instance;
+    return instance;
+}
+
+MappedFileCache::MappedFileCache(size_t capacity) : capacity_(std::max(capacity, size_t(1)))
+{}
+
+std::shared_ptr<MappedFileCache::MappedFile> MappedFileCache::Get(const std::string& path, size_t maxSize)
+{
+    struct stat fileStat;
+    if (stat(path.c_str(), &fileStat) != 0) {
+        HILOG_ERROR("Failed to stat file, errno = %{public}d", errno);
+        return nullptr;
+    }
+    if (!S_ISREG(fileStat.st_mode) || static_cast<uint64_t>(fileStat.st_size) > maxSize) {
+        HILOG_ERROR("Not a regular file or file too large: %{public}lld", static_cast<long long>(fileStat.st_size));
+        return nullptr;
+    }
+
+    Entry entry;
+    entry.device = fileStat.st_dev;
+    entry.inode = fileStat.st_ino;
+    entry.size = fileStat.st_size;
+    entry.modifiedSec = fileStat.st_mtim.tv_sec;
+    entry.modifiedNsec = fileStat.st_mtim.tv_nsec;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(path);
+        if (it != entries_.end()) {
+            const Entry& cached = it->second;
+            if (cached.device == entry.device && cached.inode == entry.inode && cached.size == entry.size &&
+                cached.modifiedSec == entry.modifiedSec && cached.modifiedNsec == entry.modifiedNsec) {
+                lru_.splice(lru_.begin(), lru_, cached.lruIt);
+                return cached.file;
+            }
+            lru_.erase(cached.lruIt);
+            entries_.erase(it);
+        }
+    }
+
+    // an empty file has nothing to map.
+    void* data = nullptr;
+    size_t size = static_cast<size_t>(fileStat.st_size);
+    if (size > 0) {
+        int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            HILOG_ERROR("Failed to open file, errno = %{public}d", errno);
+            return nullptr;
+        }
+        data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (data == MAP_FAILED) {
+            HILOG_ERROR("Failed to map file, errno = %{public}d", errno);
+            return nullptr;
+        }
+    }
+    entry.file = std::make_shared<MappedFile>(data, size);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(path);
+    if (it != entries_.end()) {
+        // mapped by another thread meanwhile.
+        lru_.erase(it->second.lruIt);
+        entries_.erase(it);
+    }
+    lru_.emplace_front(path);
+    entry.lruIt = lru_.begin();
+    auto file = entry.file;
+    entries_.emplace(path, std::move(entry));
+    while (entries_.size() > capacity_) {
+        entries_.erase(lru_.back());
+        lru_.pop_back();
+    }
+    return file;
+}
+
+bool MappedFileCache::Read(const std::string& path, std::vector<uint8_t>& content, size_t maxSize)
+{
+    auto file = Get(path, maxSize);
+    if (file == nullptr) {
+        return false;
+    }
+    content.assign(file->GetData(), file->GetData() + file->GetSize());
+    return true;
+}
+
+void MappedFileCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    lru_.clear();
+}
+
+size_t MappedFileCache::GetCount()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+}  // namespace AbilityRuntime
+}  // namespace OHOS
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "event_handler.h"
+#define private public
+#define protected public
+#include "js_runtime.h"
+#include "js_runtime_utils.h"
+#undef private
+#undef protected
+
+namespace OHOS {
+namespace AbilityRuntime {
+using namespace testing::ext;
+
+namespace {
+const std::chrono::seconds WAIT_TIMEOUT(5);
+constexpr int32_t WORKER_LOOP_COUNT = 500;
+constexpr std::chrono::milliseconds WORKER_LOOP_INTERVAL(10);
+}  // namespace
+
+class JsRuntimeUtilsTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    std::unique_ptr<AsyncTask> CreateCompleteOnlyTask();
+
+    std::shared_ptr<AppExecFwk::EventRunner> runner_;
+    std::shared_ptr<AppExecFwk::EventHandler> handler_;
+    std::unique_ptr<Runtime> runtime_;
+    std::thread::id jsThreadId_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool completed_ = false;
+    std::thread::id completeThreadId_;
+};
+
+void JsRuntimeUtilsTest::SetUpTestCase(void)
+{}
+
+void JsRuntimeUtilsTest::TearDownTestCase(void)
+{}
+
+void JsRuntimeUtilsTest::SetUp(void)
+{
+    runner_ = AppExecFwk::EventRunner::Create("JsRuntimeUtilsTest");
+    handler_ = std::make_shared<AppExecFwk::EventHandler>(runner_);
+    handler_->PostSyncTask([this]() {
+        Runtime::Options options;
+        options.eventRunner = runner_;
+        options.loadAce = false;
+        runtime_ = JsRuntime::Create(options);
+        jsThreadId_ = std::this_thread::get_id();
+    });
+}
+
+void JsRuntimeUtilsTest::TearDown(void)
+{
+    handler_->PostSyncTask([this]() { runtime_.reset(); });
+    runner_->Stop();
+    handler_.reset();
+    runner_.reset();
+}
+
+std::unique_ptr<AsyncTask> JsRuntimeUtilsTest::CreateCompleteOnlyTask()
+{
+    AsyncTask::CompleteCallback complete = [this](NativeEngine &engine, AsyncTask &task, int32_t status) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        completed_ = true;
+        completeThreadId_ = std::this_thread::get_id();
+        cv_.notify_one();
+    };
+    return std::make_unique<AsyncTask>(
+        static_cast<NativeDeferred *>(nullptr), AsyncTask::ExecuteCallback(), std::move(complete));
+}
+
+/**
+ * @tc.number: AsyncTask_Schedule_0100
+ * @tc.name: Schedule
+ * @tc.desc: A task without execute callback scheduled on the engine of the runtime is queued to the runtime,
+ *           and completed later on the js thread.
+ */
+HWTEST_F(JsRuntimeUtilsTest, AsyncTask_Schedule_0100, Function | MediumTest | Level1)
+{
+    ASSERT_NE(runtime_, nullptr);
+    size_t queuedCount = 0;
+    handler_->PostSyncTask([this, &queuedCount]() {
+        auto &jsRuntime = static_cast<JsRuntime &>(*runtime_);
+        AsyncTask::Schedule(jsRuntime.GetNativeEngine(), CreateCompleteOnlyTask());
+        std::lock_guard<std::mutex> lock(jsRuntime.completeTasksMutex_);
+        queuedCount = jsRuntime.completeTasks_.size();
+    });
+    EXPECT_EQ(queuedCount, 1);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    EXPECT_TRUE(cv_.wait_for(lock, WAIT_TIMEOUT, [this]() { return completed_; }));
+    EXPECT_EQ(completeThreadId_, jsThreadId_);
+}
+
+/**
+ * @tc.number: AsyncTask_Schedule_0200
+ * @tc.name: Schedule
+ * @tc.desc: A task without execute callback scheduled on an engine created from the one of the runtime, as a
+ *           worker is, goes through the async work of that engine, not to the queue of the runtime.
+ */
+HWTEST_F(JsRuntimeUtilsTest, AsyncTask_Schedule_0200, Function | MediumTest | Level1)
+{
+    ASSERT_NE(runtime_, nullptr);
+    size_t queuedCount = 0;
+    bool completed = false;
+    handler_->PostSyncTask([this, &queuedCount, &completed]() {
+        auto &jsRuntime = static_cast<JsRuntime &>(*runtime_);
+        auto workerEngine = static_cast<NativeEngine *>(jsRuntime.GetNativeEngine().CreateRuntime());
+        if (workerEngine == nullptr) {
+            return;
+        }
+        AsyncTask::Schedule(*workerEngine, CreateCompleteOnlyTask());
+        {
+            std::lock_guard<std::mutex> lock(jsRuntime.completeTasksMutex_);
+            queuedCount = jsRuntime.completeTasks_.size();
+        }
+        // nothing runs the loop of the worker engine but this thread.
+        for (int32_t i = 0; i < WORKER_LOOP_COUNT && !completed; i++) {
+            workerEngine->Loop(LOOP_NOWAIT);
+            std::lock_guard<std::mutex> lock(mutex_);
+            completed = completed_;
+            if (!completed) {
+                std::this_thread::sleep_for(WORKER_LOOP_INTERVAL);
+            }
+        }
+        delete workerEngine;
+    });
+    EXPECT_EQ(queuedCount, 0);
+    EXPECT_TRUE(completed);
+}
+
+/**
+ * @tc.number: AsyncTask_Schedule_0300
+ * @tc.name: Schedule
+ * @tc.desc: A task without execute callback scheduled on an engine whose js engine is not a runtime, as the ones
+ *           of ace are, goes through the async work of that engine, not to the queue of the runtime.
+ */
+HWTEST_F(JsRuntimeUtilsTest, AsyncTask_Schedule_0300, Function | MediumTest | Level1)
+{
+    ASSERT_NE(runtime_, nullptr);
+    size_t queuedCount = 0;
+    bool completed = false;
+    handler_->PostSyncTask([this, &queuedCount, &completed]() {
+        auto &jsRuntime = static_cast<JsRuntime &>(*runtime_);
+        auto foreignEngine = static_cast<NativeEngine *>(jsRuntime.GetNativeEngine().CreateRuntime());
+        if (foreignEngine == nullptr) {
+            return;
+        }
+        // anything but a runtime, the engine must not be taken for the one of a runtime.
+        int32_t foreignJsEngine = 0;
+        foreignEngine->jsEngine_ = &foreignJsEngine;
+        AsyncTask::Schedule(*foreignEngine, CreateCompleteOnlyTask());
+        {
+            std::lock_guard<std::mutex> lock(jsRuntime.completeTasksMutex_);
+            queuedCount = jsRuntime.completeTasks_.size();
+        }
+        for (int32_t i = 0; i < WORKER_LOOP_COUNT && !completed; i++) {
+            foreignEngine->Loop(LOOP_NOWAIT);
+            std::lock_guard<std::mutex> lock(mutex_);
+            completed = completed_;
+            if (!completed) {
+                std::this_thread::sleep_for(WORKER_LOOP_INTERVAL);
+            }
+        }
+        delete foreignEngine;
+    });
+    EXPECT_EQ(queuedCount, 0);
+    EXPECT_TRUE(completed);
+}
+}  // namespace AbilityRuntime
+}  // namespace OHOS
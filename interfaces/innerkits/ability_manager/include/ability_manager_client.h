@@ -495,9 +495,11 @@ public:
      * @param deviceId local or remote deviceid.
      * @param missionId Id of target mission.
      * @param snapshot snapshot of target mission
+     * @param isLowResolution true to get the downscaled thumbnail kept for the recents list.
      * @return Returns ERR_OK on success, others on failure.
      */
-    ErrCode GetMissionSnapshot(const std::string& deviceId, int32_t missionId, MissionSnapshot& snapshot);
+    ErrCode GetMissionSnapshot(const std::string& deviceId, int32_t missionId, MissionSnapshot& snapshot,
+        bool isLowResolution = false);
 
     /**
      * @brief Clean mission by id.
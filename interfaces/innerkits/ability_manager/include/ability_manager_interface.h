@@ -436,6 +436,16 @@ public:
 
     virtual int GetMissionSnapshot(const std::string& deviceId, int32_t missionId, MissionSnapshot& snapshot) = 0;
 
+    /**
+     * @brief Get the snapshot of a mission, or its downscaled thumbnail.
+     * @param isLowResolution true to get the thumbnail kept for the recents list.
+     */
+    virtual int GetMissionSnapshot(const std::string& deviceId, int32_t missionId, MissionSnapshot& snapshot,
+        bool isLowResolution)
+    {
+        return GetMissionSnapshot(deviceId, missionId, snapshot);
+    }
+
     virtual int CleanMission(int32_t missionId) = 0;
 
     virtual int CleanAllMissions() = 0;
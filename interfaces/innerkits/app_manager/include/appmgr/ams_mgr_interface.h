@@ -118,7 +118,9 @@ public:
      *
      * @param bundleName, bundle name in Application record.
      * @param accountId, account ID.
-     * @return ERR_OK, return back success, others fail.
+     * @return ERR_OK, return back success, others fail. The processes are asked to exit and the ones
+     *         still alive at the exit timeout are killed later, so ERR_OK is returned before they
+     *         are gone, and even when killing them fails.
      */
     virtual int KillProcessWithAccount(const std::string &bundleName, const int accountId) = 0;
 
@@ -126,7 +128,9 @@ public:
      * KillApplication, call KillApplication() through proxy object, kill the application.
      *
      * @param  bundleName, bundle name in Application record.
-     * @return ERR_OK, return back success, others fail.
+     * @return ERR_OK, return back success, others fail. The processes are asked to exit and the ones
+     *         still alive at the exit timeout are killed later, so ERR_OK is returned before they
+     *         are gone, and even when killing them fails.
      */
     virtual int KillApplication(const std::string &bundleName) = 0;
 
@@ -135,7 +139,9 @@ public:
      *
      * @param  bundleName, bundle name in Application record.
      * @param  userId, userId.
-     * @return ERR_OK, return back success, others fail.
+     * @return ERR_OK, return back success, others fail. The processes are asked to exit and the ones
+     *         still alive at the exit timeout are killed later, so ERR_OK is returned before they
+     *         are gone, and even when killing them fails.
      */
     virtual int KillApplicationByUid(const std::string &bundleName, const int uid) = 0;
 
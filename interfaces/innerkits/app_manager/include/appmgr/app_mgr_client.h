@@ -121,7 +121,9 @@ public:
      * KillApplication, call KillApplication() through proxy object, kill the application.
      *
      * @param  bundleName, bundle name in Application record.
-     * @return ERR_OK, return back success, others fail.
+     * @return ERR_OK, return back success, others fail. The processes are asked to exit and the ones
+     *         still alive at the exit timeout are killed later, so ERR_OK is returned before they
+     *         are gone, and even when killing them fails.
      */
     virtual AppMgrResultCode KillApplication(const std::string &bundleName);
 
@@ -130,7 +132,9 @@ public:
      *
      * @param  bundleName, bundle name in Application record.
      * @param  uid, uid.
-     * @return ERR_OK, return back success, others fail.
+     * @return ERR_OK, return back success, others fail. The processes are asked to exit and the ones
+     *         still alive at the exit timeout are killed later, so ERR_OK is returned before they
+     *         are gone, and even when killing them fails.
      */
     virtual AppMgrResultCode KillApplicationByUid(const std::string &bundleName, const int uid);
 
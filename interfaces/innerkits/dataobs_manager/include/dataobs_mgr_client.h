@@ -66,6 +66,17 @@ public:
      */
     ErrCode NotifyChange(const Uri &uri);
 
+    /**
+     * Registers an observer to DataObsMgr specified by the given Uri.
+     *
+     * @param uri, Indicates the path of the data to operate.
+     * @param dataObserver, Indicates the IDataAbilityObserver object.
+     * @param isDescendants, Indicates whether the observer is also notified of changes to the uris under the uri.
+     *
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    ErrCode RegisterObserverExt(const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver, bool isDescendants);
+
 private:
     /**
      * Connect dataobs manager service.
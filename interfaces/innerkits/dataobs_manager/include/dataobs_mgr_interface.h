@@ -65,6 +65,21 @@ public:
      */
     virtual int NotifyChange(const Uri &uri) = 0;
 
+    /**
+     * Registers an observer to DataObsMgr specified by the given Uri.
+     *
+     * @param uri, Indicates the path of the data to operate.
+     * @param dataObserver, Indicates the IDataAbilityObserver object.
+     * @param isDescendants, Indicates whether the observer is also notified of changes to the uris under the uri.
+     *
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    virtual int RegisterObserverExt(const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver,
+        bool isDescendants)
+    {
+        return isDescendants ? ERR_INVALID_OPERATION : RegisterObserver(uri, dataObserver);
+    }
+
     enum {
         // ipc id 1-1000 for kit
         // ipc id for RegisterObserver (1)
@@ -75,6 +90,9 @@ public:
 
         // ipc id for NotifyChange (3)
         NOTIFY_CHANGE,
+
+        // ipc id for RegisterObserverExt (4)
+        REGISTER_OBSERVER_EXT,
     };
 };
 }  // namespace AAFwk
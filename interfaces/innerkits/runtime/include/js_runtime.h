@@ -19,6 +19,7 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -32,12 +33,13 @@ namespace AppExecFwk {
 class EventHandler;
 } // namespace AppExecFwk
 namespace AbilityRuntime {
+class AsyncTask;
 class TimerTask;
 class JsRuntime : public Runtime {
 public:
     static std::unique_ptr<Runtime> Create(const Options& options);
 
-    ~JsRuntime() override = default;
+    ~JsRuntime() override;
 
     NativeEngine& GetNativeEngine() const
     {
@@ -54,6 +56,17 @@ public:
         const std::string& moduleName, NativeValue* const* argv = nullptr, size_t argc = 0);
     void PostTask(const TimerTask& task, const std::string& name, int64_t delayTime);
     void RemoveTask(const std::string& name);
+    /**
+     * PostCompleteTask, complete the task on the js thread. The tasks posted before the js thread gets to them
+     * are completed in one go.
+     */
+    void PostCompleteTask(std::unique_ptr<AsyncTask>&& task);
+    /**
+     * PostCompleteTask, complete the task on the js thread of the runtime the engine belongs to.
+     *
+     * @return false, and the task is left as it is, if the engine is not the one of a runtime.
+     */
+    static bool PostCompleteTask(NativeEngine& engine, std::unique_ptr<AsyncTask>& task);
     NativeValue* SetCallbackTimer(NativeEngine& engine, NativeCallbackInfo& info, bool isInterval);
     NativeValue* ClearCallbackTimer(NativeEngine& engine, NativeCallbackInfo& info);
     void DumpHeapSnapshot(bool isPrivate) override;
@@ -67,6 +80,7 @@ protected:
 
     virtual bool Initialize(const Options& options);
     void Deinitialize();
+    void RunCompleteTasks();
 
     bool isArkEngine_ = false;
     bool debugMode_ = false;
@@ -77,6 +91,9 @@ protected:
     std::shared_ptr<AppExecFwk::EventHandler> eventHandler_;
     uint32_t callbackId_ = 0;
 
+    std::mutex completeTasksMutex_;
+    std::vector<std::unique_ptr<AsyncTask>> completeTasks_;
+
     std::unordered_map<std::string, NativeReference*> modules_;
 };
 }  // namespace AbilityRuntime
@@ -147,17 +147,33 @@ public:
     using ExecuteCallback = std::function<void()>;
     using CompleteCallback = std::function<void(NativeEngine&, AsyncTask&, int32_t)>;
 
+    /**
+     * A task with an execute callback is executed on the thread pool. A task with none is completed on the js
+     * thread once the current task there is done, with the other tasks completed there, if the engine is of a
+     * JsRuntime.
+     */
     static void Schedule(NativeEngine& engine, std::unique_ptr<AsyncTask>&& task);
 
     AsyncTask(NativeDeferred* deferred, std::unique_ptr<ExecuteCallback>&& execute,
         std::unique_ptr<CompleteCallback>&& complete);
     AsyncTask(NativeReference* callbackRef, std::unique_ptr<ExecuteCallback>&& execute,
         std::unique_ptr<CompleteCallback>&& complete);
+    AsyncTask(NativeDeferred* deferred, ExecuteCallback&& execute, CompleteCallback&& complete);
+    AsyncTask(NativeReference* callbackRef, ExecuteCallback&& execute, CompleteCallback&& complete);
     ~AsyncTask();
 
+    // tasks are made and freed for every async call, so their memory is kept in a pool.
+    static void* operator new(size_t size);
+    static void operator delete(void* ptr);
+
     void Resolve(NativeEngine& engine, NativeValue* value);
     void Reject(NativeEngine& engine, NativeValue* error);
 
+    /**
+     * Call the complete callback, on the js thread.
+     */
+    void RunComplete(NativeEngine& engine, int32_t status);
+
 private:
     static void Execute(NativeEngine* engine, void* data);
     static void Complete(NativeEngine* engine, int32_t status, void* data);
@@ -167,8 +183,8 @@ private:
     std::unique_ptr<NativeDeferred> deferred_;
     std::unique_ptr<NativeReference> callbackRef_;
     std::unique_ptr<NativeAsyncWork> work_;
-    std::unique_ptr<ExecuteCallback> execute_;
-    std::unique_ptr<CompleteCallback> complete_;
+    ExecuteCallback execute_;
+    CompleteCallback complete_;
 };
 
 std::unique_ptr<AsyncTask> CreateAsyncTaskWithLastParam(NativeEngine& engine, NativeValue* lastParam,
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_OHOS_ABILITYRUNTIME_MAPPED_FILE_CACHE_H
+#define FOUNDATION_OHOS_ABILITYRUNTIME_MAPPED_FILE_CACHE_H
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace OHOS {
+namespace AbilityRuntime {
+/**
+ * Read only mappings of the files read by the runtime, e.g. the abc assets of workers. The files mapped last are
+ * kept, so reading one again costs a stat only. A file changed since it was mapped, as on an update of the
+ * bundle, is mapped again.
+ */
+class MappedFileCache {
+public:
+    class MappedFile {
+    public:
+        MappedFile(void* data, size_t size);
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        const uint8_t* GetData() const
+        {
+            return static_cast<const uint8_t*>(data_);
+        }
+
+        size_t GetSize() const
+        {
+            return size_;
+        }
+
+    private:
+        void* data_ = nullptr;
+        size_t size_ = 0;
+    };
+
+    static MappedFileCache& GetInstance();
+
+    explicit MappedFileCache(size_t capacity = DEFAULT_CAPACITY);
+    ~MappedFileCache() = default;
+
+    /**
+     * Get, map the file, or get it from the cache.
+     *
+     * @param maxSize, a larger file is not mapped.
+     * @return nullptr if the file can't be mapped. The mapping stays valid while held, evicted or not.
+     */
+    std::shared_ptr<MappedFile> Get(const std::string& path, size_t maxSize);
+
+    /**
+     * Read, copy the content of the file out of its mapping.
+     */
+    bool Read(const std::string& path, std::vector<uint8_t>& content, size_t maxSize);
+
+    void Clear();
+    size_t GetCount();
+
+    static constexpr size_t DEFAULT_CAPACITY = 8;
+
+private:
+    struct Entry {
+        uint64_t device = 0;
+        uint64_t inode = 0;
+        int64_t size = 0;
+        int64_t modifiedSec = 0;
+        int64_t modifiedNsec = 0;
+        std::shared_ptr<MappedFile> file;
+        std::list<std::string>::iterator lruIt;
+    };
+
+    size_t capacity_;
+    std::mutex mutex_;
+    // the most recently used first.
+    std::list<std::string> lru_;
+    std::unordered_map<std::string, Entry> entries_;
+};
+}  // namespace AbilityRuntime
+}  // namespace OHOS
+
+#endif  // FOUNDATION_OHOS_ABILITYRUNTIME_MAPPED_FILE_CACHE_H
@@ -30,7 +30,8 @@ public:
      * @brief Authorize the uri permission of fromTokenId to targetTokenId.
      *
      * @param uri The file uri.
-     * @param flag Want::FLAG_AUTH_READ_URI_PERMISSION or Want::FLAG_AUTH_WRITE_URI_PERMISSION.
+     * @param flag Want::FLAG_AUTH_READ_URI_PERMISSION or Want::FLAG_AUTH_WRITE_URI_PERMISSION, with
+     * Want::FLAG_AUTH_PREFIX_URI_PERMISSION to grant every uri under the uri as a directory.
      * @param fromTokenId The owner of uri.
      * @param targetTokenId The user of uri.
      */
@@ -474,6 +474,9 @@ public:
 
     virtual int GetMissionSnapshot(const std::string& deviceId, int32_t missionId, MissionSnapshot& snapshot) override;
 
+    virtual int GetMissionSnapshot(const std::string& deviceId, int32_t missionId, MissionSnapshot& snapshot,
+        bool isLowResolution) override;
+
     virtual int StartUserTest(const Want &want, const sptr<IRemoteObject> &observer) override;
 
     virtual int FinishUserTest(
@@ -27,6 +27,7 @@
 #include "ability_connect_manager.h"
 #include "ability_event_handler.h"
 #include "ability_manager_stub.h"
+#include "ability_resolve_cache.h"
 #include "app_scheduler.h"
 #include "bundlemgr/bundle_mgr_interface.h"
 #include "bundle_constants.h"
@@ -624,6 +625,9 @@ public:
     virtual int32_t GetMissionSnapshot(const std::string& deviceId, int32_t missionId,
         MissionSnapshot& snapshot) override;
 
+    virtual int32_t GetMissionSnapshot(const std::string& deviceId, int32_t missionId,
+        MissionSnapshot& snapshot, bool isLowResolution) override;
+
     /**
      * Set ability controller.
      *
@@ -793,6 +797,8 @@ public:
     static constexpr uint32_t MIN_DUMP_ARGUMENT_NUM = 2;
     static constexpr uint32_t MAX_WAIT_SYSTEM_UI_NUM = 600;
     static constexpr uint32_t MAX_WAIT_SETTINGS_DATA_NUM = 300;
+    static constexpr int32_t MAX_SUBSCRIBE_RESOLVE_CACHE_NUM = 10;
+    static constexpr uint32_t SUBSCRIBE_RESOLVE_CACHE_DELAY = 1000;  // ms
 
     enum DumpKey {
         KEY_DUMP_ALL = 0,
@@ -946,6 +952,8 @@ private:
     void InitConnectManager(int32_t userId, bool switchUser);
     void InitDataAbilityManager(int32_t userId, bool switchUser);
     void InitPendWantManager(int32_t userId, bool switchUser);
+    void SubscribeResolveCacheEvent(int32_t retryCount = 0);
+    void RemoveAbilityResolveCache(int32_t userId);
 
     int32_t InitAbilityInfoFromExtension(AppExecFwk::ExtensionAbilityInfo &extensionInfo,
         AppExecFwk::AbilityInfo &abilityInfo);
@@ -1033,6 +1041,8 @@ private:
     std::unordered_map<int, std::shared_ptr<PendingWantManager>> pendingWantManagers_;
     std::shared_ptr<PendingWantManager> pendingWantManager_;
     std::shared_ptr<AmsConfigurationParameter> amsConfigResolver_;
+    std::shared_ptr<AbilityResolveCache> abilityResolveCache_ = std::make_shared<AbilityResolveCache>();
+    std::shared_ptr<AbilityResolveCacheSubscriber> resolveCacheSubscriber_;
     const static std::map<std::string, AbilityManagerService::DumpKey> dumpMap;
     const static std::map<std::string, AbilityManagerService::DumpsysKey> dumpsysMap;
 
@@ -20,6 +20,8 @@
 #include <functional>
 #include <list>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 #include "ability_connect_callback_interface.h"
@@ -309,6 +311,14 @@ public:
      */
     void SetEventId(int64_t eventId);
 
+    /**
+     * get the ability record whose latest event id is eventId.
+     *
+     * @param eventId
+     * @return the ability record, or nullptr if no alive record holds the event id.
+     */
+    static std::shared_ptr<AbilityRecord> GetAbilityRecordByEventId(int64_t eventId);
+
     /**
      * get event id.
      *
@@ -701,6 +711,8 @@ protected:
     Want want_ = {};                                       // want to start this ability
     static int64_t g_abilityRecordEventId_;
     int64_t eventId_ = 0;                                  // post event id
+    static std::unordered_map<int64_t, std::weak_ptr<AbilityRecord>> eventIdRecords_;  // latest event id to record
+    static std::mutex eventIdLock_;
 
 private:
     /**
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_AAFWK_ABILITY_RESOLVE_CACHE_H
+#define OHOS_AAFWK_ABILITY_RESOLVE_CACHE_H
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ability_info.h"
+#include "common_event_subscriber.h"
+#include "nocopyable.h"
+#include "want.h"
+
+namespace OHOS {
+namespace AAFwk {
+/**
+ * @class AbilityResolveCache
+ * AbilityResolveCache keeps the ability info resolved from the bundle manager for explicit wants,
+ * so that repeated start and connect requests to the same element do not query the bundle manager again.
+ * Entries are kept per user and dropped when a bundle is added, changed or removed, or when the user switches.
+ */
+class AbilityResolveCache {
+public:
+    enum class ResolveType {
+        ABILITY = 0,
+        EXTENSION,
+    };
+
+    explicit AbilityResolveCache(size_t capacity = DEFAULT_CAPACITY);
+    ~AbilityResolveCache() = default;
+
+    /**
+     * Get the cached ability info of the element in want.
+     *
+     * @param type, the kind of query the info was resolved by.
+     * @param want, the want to resolve, only the element is used.
+     * @param flags, the flags passed to the bundle manager.
+     * @param userId, the user the want is resolved for.
+     * @param abilityInfo, the cached ability info.
+     * @return Returns true if the info is cached.
+     */
+    bool Get(ResolveType type, const Want &want, int32_t flags, int32_t userId, AppExecFwk::AbilityInfo &abilityInfo);
+
+    /**
+     * Get the generation of the cache, it changes whenever entries are invalidated.
+     * Read it before querying the bundle manager and pass it to Put, so a result that was
+     * resolved before an invalidation is not cached.
+     */
+    uint64_t GetGeneration();
+
+    /**
+     * Put the ability info resolved for the element in want, wants without an explicit element are ignored.
+     */
+    void Put(ResolveType type, const Want &want, int32_t flags, int32_t userId,
+        const AppExecFwk::AbilityInfo &abilityInfo, uint64_t generation);
+
+    /**
+     * Enable or disable the cache, a disabled cache keeps nothing and misses every lookup.
+     * It is disabled by default, until the owner can invalidate it on package events.
+     */
+    void SetEnabled(bool enabled);
+
+    void RemoveBundle(const std::string &bundleName);
+    void RemoveUser(int32_t userId);
+    void Clear();
+
+    void Dump(std::vector<std::string> &info);
+
+private:
+    struct CacheItem {
+        std::string key;
+        AppExecFwk::AbilityInfo abilityInfo;
+    };
+
+    struct UserCache {
+        std::list<CacheItem> items;
+        std::unordered_map<std::string, std::list<CacheItem>::iterator> index;
+    };
+
+    static bool MakeKey(ResolveType type, const Want &want, int32_t flags, std::string &key);
+
+    static constexpr size_t DEFAULT_CAPACITY = 128;
+
+    size_t capacity_;
+    bool enabled_ = false;
+    std::unordered_map<int32_t, UserCache> userCaches_;
+    uint64_t hitCount_ = 0;
+    uint64_t missCount_ = 0;
+    uint64_t invalidateCount_ = 0;
+    std::mutex mutex_;
+
+    DISALLOW_COPY_AND_MOVE(AbilityResolveCache);
+};
+
+/**
+ * @class AbilityResolveCacheSubscriber
+ * Drop the cached ability info of a bundle when it is added, changed or removed.
+ */
+class AbilityResolveCacheSubscriber : public EventFwk::CommonEventSubscriber {
+public:
+    AbilityResolveCacheSubscriber(const EventFwk::CommonEventSubscribeInfo &subscribeInfo,
+        const std::shared_ptr<AbilityResolveCache> &resolveCache);
+    virtual ~AbilityResolveCacheSubscriber() = default;
+
+    virtual void OnReceiveEvent(const EventFwk::CommonEventData &data) override;
+
+private:
+    std::weak_ptr<AbilityResolveCache> resolveCache_;
+};
+}  // namespace AAFwk
+}  // namespace OHOS
+#endif  // OHOS_AAFWK_ABILITY_RESOLVE_CACHE_H
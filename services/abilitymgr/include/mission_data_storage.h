@@ -16,13 +16,18 @@
 #ifndef FOUNDATION_AAFWK_SERVICES_ABILITYMGR_INCLUDE_MISSION_DATA_STORAGE_H
 #define FOUNDATION_AAFWK_SERVICES_ABILITYMGR_INCLUDE_MISSION_DATA_STORAGE_H
 
+#include <atomic>
 #include <list>
 #include <mutex>
 #include <queue>
 
 #include "event_handler.h"
 #include "inner_mission_info.h"
+#include "mission_journal.h"
 #include "mission_snapshot.h"
+#ifdef SUPPORT_GRAPHICS
+#include "mission_snapshot_codec.h"
+#endif
 
 namespace OHOS {
 namespace AAFwk {
@@ -31,15 +36,29 @@ const std::string MISSION_DATA_FILE_PATH = "MissionInfo";
 const std::string MISSION_JSON_FILE_PREFIX = "mission";
 const std::string JSON_FILE_SUFFIX = ".json";
 const std::string PNG_FILE_SUFFIX = ".png";
+const std::string THUMBNAIL_FILE_SUFFIX = "_thumbnail.snapshot";
+const std::string FLUSH_MISSION_INFO = "FlushMissionInfo";
+const std::string WRITE_MISSION_SNAPSHOT = "WriteMissionSnapshot";
+// changes to the mission infos within this window are written together, in milliseconds.
+constexpr int64_t MISSION_INFO_FLUSH_DELAY = 500;
+// the thumbnail of a snapshot is this many times smaller in each dimension.
+constexpr uint32_t MISSION_THUMBNAIL_FACTOR = 4;
+// decoded snapshots kept in memory, in bytes.
+constexpr size_t MISSION_SNAPSHOT_CACHE_SIZE = 32 * 1024 * 1024;
 
 class MissionDataStorage : public std::enable_shared_from_this<MissionDataStorage> {
 public:
-    MissionDataStorage() = default;
+    MissionDataStorage();
     MissionDataStorage(int userId);
     virtual ~MissionDataStorage();
 
     void SetEventHandler(const std::shared_ptr<AppExecFwk::EventHandler> &handler);
 
+    /**
+     * @brief Set the handler snapshots are encoded and written on, apart from the mission infos.
+     */
+    void SetSnapshotEventHandler(const std::shared_ptr<AppExecFwk::EventHandler> &handler);
+
     /**
      * @brief GeT all mission info.
      * @return Returns true if this function is successfully called; returns false otherwise.
@@ -47,7 +66,7 @@ public:
     bool LoadAllMissionInfo(std::list<InnerMissionInfo> &missionInfoList);
 
     /**
-     * @brief Save the mission data.
+     * @brief Save the mission data, saves within MISSION_INFO_FLUSH_DELAY are written together.
      * @param missionInfo Indicates the missionInfo object to be save.
      */
     void SaveMissionInfo(const InnerMissionInfo &missionInfo);
@@ -59,12 +78,24 @@ public:
     void DeleteMissionInfo(int missionId);
 
     /**
-     * @brief Save mission snapshot
+     * @brief Write the saved and deleted mission data to the journal at once.
+     */
+    void FlushMissionInfo();
+
+    /**
+     * @brief Save mission snapshot, it is written on the snapshot handler. A snapshot saved again before
+     * it is written replaces the earlier one, only the latest is written.
      * @param missionId Indicates this mission id.
      * @param missionSnapshot the mission snapshot to save
      */
     void SaveMissionSnapshot(int32_t missionId, const MissionSnapshot& missionSnapshot);
 
+    /**
+     * @brief Write the latest saved snapshot of the mission and its thumbnail.
+     * @param missionId Indicates this mission id.
+     */
+    void WriteMissionSnapshot(int32_t missionId);
+
     /**
      * @brief Delete mission snapshot
      * @param missionId Indicates this mission id.
@@ -75,9 +106,10 @@ public:
      * @brief Get the Mission Snapshot object
      * @param missionId
      * @param missionSnapshot
+     * @param isLowResolution get the thumbnail instead of the full snapshot.
      * @return Returns true if this function is successfully called; returns false otherwise.
      */
-    bool GetMissionSnapshot(int32_t missionId, MissionSnapshot& missionSnapshot);
+    bool GetMissionSnapshot(int32_t missionId, MissionSnapshot& missionSnapshot, bool isLowResolution = false);
 
 #ifdef SUPPORT_GRAPHICS
 public:
@@ -87,35 +119,60 @@ public:
      * @return Returns PixelMap of snapshot.
      */
     sptr<Media::PixelMap> GetSnapshot(int missionId) const;
-    
-    std::unique_ptr<Media::PixelMap> GetPixelMap(int missionId) const;
+
+    std::unique_ptr<Media::PixelMap> GetPixelMap(int missionId, bool isLowResolution = false) const;
+
+    static std::unique_ptr<Media::PixelMap> CreateThumbnail(const std::shared_ptr<Media::PixelMap> &pixelMap);
 
 private:
-    std::map<int32_t, std::shared_ptr<Media::PixelMap>> cachedPixelMap_;
+    using SnapshotCacheKey = std::pair<int32_t, bool>;
+    using SnapshotCacheList = std::list<std::pair<SnapshotCacheKey, std::shared_ptr<Media::PixelMap>>>;
+
+    static std::unique_ptr<Media::PixelMap> CreatePixelMap(const SnapshotImage &image);
+
+    static std::unique_ptr<Media::PixelMap> CreatePlaceholder(uint32_t width, uint32_t height, bool isLowResolution);
+
+    bool WriteSnapshotFiles(int32_t missionId, const MissionSnapshot& missionSnapshot,
+        std::shared_ptr<Media::PixelMap> &thumbnail);
+
+    void RemoveSnapshotFiles(int32_t missionId);
+
+    // the cache functions are called with snapshotMutex_ held.
+    std::shared_ptr<Media::PixelMap> GetCachedSnapshot(int32_t missionId, bool isLowResolution);
+
+    void SaveCachedSnapshot(int32_t missionId, bool isLowResolution, const std::shared_ptr<Media::PixelMap> &pixelMap);
+
+    void DeleteCachedSnapshot(int32_t missionId);
+
+    std::shared_ptr<AppExecFwk::EventHandler> snapshotHandler_;
+    // snapshots saved and not written yet, by mission id.
+    std::map<int32_t, MissionSnapshot> pendingSnapshots_;
+    // most recently used first, bounded by MISSION_SNAPSHOT_CACHE_SIZE.
+    SnapshotCacheList cachedSnapshots_;
+    std::map<SnapshotCacheKey, SnapshotCacheList::iterator> cachedSnapshotIndex_;
+    size_t cachedSnapshotBytes_ = 0;
+    // changed by every save and delete, a snapshot read from a file is cached only if it did not change meanwhile.
+    uint64_t snapshotGeneration_ = 0;
+    std::mutex snapshotMutex_;
 #endif
 
 private:
     std::string GetMissionDataDirPath() const;
 
-    std::string GetMissionDataFilePath(int missionId);
-
-    std::string GetMissionSnapshotPath(int32_t missionId) const;
+    std::string GetMissionSnapshotPath(int32_t missionId, bool isLowResolution = false) const;
 
     bool CheckFileNameValid(const std::string &fileName);
 
-    bool WriteToPng(const char* fileName, uint32_t width, uint32_t height, const uint8_t* data);
-
-    bool GetCachedSnapshot(int32_t missionId, MissionSnapshot& missionSnapshot);
-
-    bool SaveCachedSnapshot(int32_t missionId, const MissionSnapshot& missionSnapshot);
+    void ScheduleFlush();
 
-    bool DeleteCachedSnapshot(int32_t missionId);
+    bool CreateMissionDataDir() const;
 
-    void SaveSnapshotFile(int32_t missionId, const MissionSnapshot& missionSnapshot);
+    void MigrateMissionInfoFiles();
 
     int userId_ = 0;
     std::shared_ptr<AppExecFwk::EventHandler> handler_;
-    std::mutex cachedPixelMapMutex_;
+    std::unique_ptr<MissionJournal> journal_;
+    std::atomic<bool> flushPosted_ { false };
 };
 }  // namespace AAFwk
 }  // namespace OHOS
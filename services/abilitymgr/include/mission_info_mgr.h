@@ -137,10 +137,11 @@ public:
      * @param missionId mission id
      * @param abilityToken abilityToken to get current mission snapshot
      * @param missionSnapshot result of snapshot
+     * @param isLowResolution get the thumbnail of the updated snapshot instead of the full snapshot
      * @return return true if update mission snapshot success, else false
      */
     bool UpdateMissionSnapshot(int32_t missionId, const sptr<IRemoteObject>& abilityToken,
-        MissionSnapshot& missionSnapshot) const;
+        MissionSnapshot& missionSnapshot, bool isLowResolution = false) const;
 
 #ifdef SUPPORT_GRAPHICS
     /**
@@ -156,11 +157,12 @@ public:
      * @param missionId mission id
      * @param abilityToken abilityToken to get current mission snapshot
      * @param missionSnapshot result of snapshot
+     * @param isLowResolution get the downscaled thumbnail from storage.
      * @param force force get snapshot from window manager service.
      * @return true return true if get mission snapshot success, else false
      */
     bool GetMissionSnapshot(int32_t missionId, const sptr<IRemoteObject>& abilityToken,
-        MissionSnapshot& missionSnapshot, bool force = false) const;
+        MissionSnapshot& missionSnapshot, bool isLowResolution, bool force = false) const;
 
     /**
      * @brief register snapshotHandler
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_AAFWK_SERVICES_ABILITYMGR_INCLUDE_MISSION_JOURNAL_H
+#define FOUNDATION_AAFWK_SERVICES_ABILITYMGR_INCLUDE_MISSION_JOURNAL_H
+
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+
+namespace OHOS {
+namespace AAFwk {
+const std::string MISSION_JOURNAL_FILE_NAME = "missions.journal";
+const std::string MISSION_SNAPSHOT_FILE_NAME = "missions.snapshot";
+
+/**
+ * @class MissionJournal
+ * MissionJournal keeps the mission infos of one user in two files of a directory, a snapshot holding every
+ * mission and a journal appended with the changes made since the snapshot was written. Changes are staged
+ * first, staged changes to the same mission replace each other and are written together by Flush in one
+ * append. When the journal has grown large it is compacted into a new snapshot.
+ *
+ * Every record carries its length and a checksum. A record torn by a crash in the middle of an append fails
+ * the check, it and everything after it are dropped when the journal is loaded. The snapshot is replaced by
+ * rename, so it is either the old or the new one.
+ */
+class MissionJournal {
+public:
+    /**
+     * @param dirPath, the directory holding the journal and the snapshot.
+     * @param compactSize, the journal is compacted once it is larger than this, in bytes.
+     */
+    explicit MissionJournal(const std::string &dirPath, size_t compactSize = DEFAULT_COMPACT_SIZE);
+    virtual ~MissionJournal();
+
+    /**
+     * Load, read the snapshot and replay the journal on it, done once before any other access.
+     *
+     * @return true if the files are read or do not exist yet.
+     */
+    bool Load();
+
+    /**
+     * HasFiles, whether the directory had a journal or a snapshot when it was loaded.
+     */
+    bool HasFiles();
+
+    /**
+     * GetMissions, get the content of every mission, staged changes included.
+     *
+     * @param missions, mission id -> content.
+     */
+    void GetMissions(std::map<int32_t, std::string> &missions);
+
+    /**
+     * StageSave, stage the content of a mission, it replaces the content staged before.
+     *
+     * @return the count of staged missions.
+     */
+    size_t StageSave(int32_t missionId, const std::string &content);
+
+    /**
+     * StageDelete, stage the removal of a mission.
+     *
+     * @return the count of staged missions.
+     */
+    size_t StageDelete(int32_t missionId);
+
+    /**
+     * Flush, append the staged changes to the journal, compact it when it has grown too large.
+     *
+     * @return true if the changes are written.
+     */
+    bool Flush();
+
+    /**
+     * Compact, write every mission into a new snapshot and empty the journal.
+     *
+     * @return true if the snapshot is written.
+     */
+    bool Compact();
+
+    /**
+     * GetJournalSize, get the size of the journal, in bytes.
+     */
+    size_t GetJournalSize();
+
+    static constexpr size_t DEFAULT_COMPACT_SIZE = 64 * 1024;
+
+private:
+    bool LoadLocked();
+    bool FlushLocked();
+    bool CompactLocked();
+    bool OpenJournal();
+    void CloseJournal();
+    static void AppendRecord(std::string &buffer, uint32_t type, int32_t missionId, const std::string &content);
+    // apply the records of a file to missions_, returns the size of the records passing the checks.
+    size_t ReplayRecords(const std::string &data, bool allowDelete);
+    static bool ReadFile(const std::string &path, std::string &data, bool &exists);
+    static bool WriteAll(int fd, const std::string &data);
+
+    std::string dirPath_;
+    std::string journalPath_;
+    std::string snapshotPath_;
+    size_t compactSize_ = DEFAULT_COMPACT_SIZE;
+    bool loaded_ = false;
+    bool hasFiles_ = false;
+    int journalFd_ = -1;
+    size_t journalSize_ = 0;
+    std::map<int32_t, std::string> missions_;
+    std::map<int32_t, std::string> stagedSaves_;
+    std::set<int32_t> stagedDeletes_;
+    std::mutex mutex_;
+};
+}  // namespace AAFwk
+}  // namespace OHOS
+#endif  // FOUNDATION_AAFWK_SERVICES_ABILITYMGR_INCLUDE_MISSION_JOURNAL_H
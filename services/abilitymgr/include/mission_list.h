@@ -18,6 +18,7 @@
 
 #include <list>
 #include <memory>
+#include <unordered_map>
 
 #include "ability_record.h"
 #include "iremote_object.h"
@@ -76,6 +77,14 @@ public:
      */
     std::shared_ptr<AbilityRecord> GetAbilityRecordByToken(const sptr<IRemoteObject> &token) const;
 
+    /**
+     * @brief Get the mission which holds the ability of the token
+     *
+     * @param token the ability to search
+     * @return std::shared_ptr<Mission> the mission
+     */
+    std::shared_ptr<Mission> GetMissionByToken(const sptr<IRemoteObject> &token) const;
+
     /**
      * @brief remove mission by ability record
      *
@@ -191,12 +200,38 @@ public:
     int BlockAbilityByRecordId(int32_t abilityRecordId);
     #endif
 
+    /**
+     * Whether the mission is in this mission list.
+     *
+     * @param mission target mission.
+     * @return true if the mission is in this mission list.
+     */
+    bool ContainsMission(const std::shared_ptr<Mission> &mission) const;
+
+    /**
+     * Re-key the mission in the indexes of this list, its id has been updated.
+     *
+     * @param mission target mission.
+     */
+    void UpdateMissionIndex(const std::shared_ptr<Mission> &mission);
+
 private:
     std::string GetTypeName();
     bool MatchedInitialMission(const std::shared_ptr<Mission>& mission, const std::string &bundleName, int32_t uid);
+    void AddMissionIndex(const std::shared_ptr<Mission> &mission);
+    void RemoveMissionIndex(const std::shared_ptr<Mission> &mission);
 
     MissionListType type_;
     std::list<std::shared_ptr<Mission>> missions_ {};
+    // indexes of missions_ by mission id and by ability token, kept in step with missions_.
+    // the keys a mission is indexed by are kept too, so an updated mission id drops its old key.
+    struct MissionIndexKey {
+        int32_t missionId;
+        IRemoteObject *token;
+    };
+    std::unordered_map<int32_t, std::shared_ptr<Mission>> missionIdIndex_ {};
+    std::unordered_map<IRemoteObject *, std::shared_ptr<Mission>> tokenIndex_ {};
+    std::unordered_map<const Mission *, MissionIndexKey> missionIndexKeys_ {};
 };
 }  // namespace AAFwk
 }  // namespace OHOS
@@ -19,6 +19,7 @@
 #include <list>
 #include <queue>
 #include <memory>
+#include <unordered_map>
 
 #include "ability_running_info.h"
 #include "foundation/distributedhardware/devicemanager/interfaces/inner_kits/native_cpp/include/device_manager.h"
@@ -321,10 +322,11 @@ public:
      * @param missionId mission id
      * @param abilityToken abilityToken to get current mission snapshot
      * @param missionSnapshot result of snapshot
+     * @param isLowResolution true to get the downscaled thumbnail.
      * @return Returns true on success, false on failure.
      */
     bool GetMissionSnapshot(int32_t missionId, const sptr<IRemoteObject>& abilityToken,
-        MissionSnapshot& missionSnapshot);
+        MissionSnapshot& missionSnapshot, bool isLowResolution = false);
     void GetAbilityRunningInfos(std::vector<AbilityRunningInfo> &info, bool isPerm);
 
     #ifdef ABILITY_COMMAND_FOR_TEST
@@ -464,6 +466,10 @@ private:
     void AddUninstallTags(const std::string &bundleName, int32_t uid);
     void RemoveMissionLocked(int32_t missionId);
 
+    std::shared_ptr<Mission> GetMissionByTokenLocked(const sptr<IRemoteObject> &token) const;
+    bool IsMissionInListsLocked(const std::shared_ptr<Mission> &mission) const;
+    void UpdateMissionIndexLocked(const std::shared_ptr<Mission> &mission) const;
+
     int userId_;
     mutable std::recursive_mutex managerLock_;
     // launcher list is also in currentMissionLists_
@@ -474,6 +480,11 @@ private:
     std::shared_ptr<MissionList> defaultSingleList_;
     std::shared_ptr<MissionList> launcherList_;
     std::list<std::shared_ptr<AbilityRecord>> terminateAbilityList_;
+    // ability token and mission id to mission, missions move between lists so a hit is checked against its list.
+    static constexpr size_t MISSION_INDEX_SWEEP_SIZE = 64;
+    mutable std::unordered_map<IRemoteObject *, std::weak_ptr<Mission>> tokenMissionIndex_;
+    mutable std::unordered_map<int32_t, std::weak_ptr<Mission>> missionIdIndex_;
+    mutable size_t missionIndexSweepSize_ = MISSION_INDEX_SWEEP_SIZE;
 
     std::queue<AbilityRequest> waittingAbilityQueue_;
     std::shared_ptr<MissionListenerController> listenerController_;
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_AAFWK_SERVICES_ABILITYMGR_INCLUDE_MISSION_SNAPSHOT_CODEC_H
+#define FOUNDATION_AAFWK_SERVICES_ABILITYMGR_INCLUDE_MISSION_SNAPSHOT_CODEC_H
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace OHOS {
+namespace AAFwk {
+enum class SnapshotCodec {
+    // PNG compressed for speed, small on disk.
+    PNG,
+    // the pixels as they are behind a short header, the fastest to write and read back.
+    RAW,
+};
+
+/**
+ * @struct SnapshotImage
+ * SnapshotImage holds the pixels of a snapshot in RGBA_8888 with packed rows. The pixels of a private
+ * snapshot are never stored, only its size, and are left empty until the placeholder is filled in.
+ */
+struct SnapshotImage {
+    uint32_t width = 0;
+    uint32_t height = 0;
+    bool isPrivate = false;
+    std::vector<uint8_t> pixels;
+};
+
+/**
+ * @class MissionSnapshotCodec
+ * MissionSnapshotCodec writes mission snapshots to files and reads them back. A file is written aside
+ * and renamed into place, so a reader sees either the old or the new snapshot.
+ */
+class MissionSnapshotCodec {
+public:
+    /**
+     * Encode, write the pixels into a file.
+     *
+     * @param path, the file to write.
+     * @param pixels, the pixels in RGBA_8888.
+     * @param rowBytes, the distance between the starts of two rows, in bytes.
+     * @param codec, the format of the file.
+     * @return true if the file is written.
+     */
+    static bool Encode(const std::string &path, const uint8_t *pixels, uint32_t width, uint32_t height,
+        uint32_t rowBytes, SnapshotCodec codec);
+
+    /**
+     * EncodePlaceholder, write a private snapshot, which keeps the size only.
+     *
+     * @return true if the file is written.
+     */
+    static bool EncodePlaceholder(const std::string &path, uint32_t width, uint32_t height);
+
+    /**
+     * Decode, read a file written by Encode or EncodePlaceholder, the format is told by its content.
+     *
+     * @param image, the pixels read, empty for a private snapshot.
+     * @return true if the file is read.
+     */
+    static bool Decode(const std::string &path, SnapshotImage &image);
+
+    /**
+     * Downscale, shrink the pixels by averaging every factor x factor block.
+     */
+    static void Downscale(const uint8_t *pixels, uint32_t width, uint32_t height, uint32_t rowBytes,
+        uint32_t factor, SnapshotImage &image);
+
+    /**
+     * FillPlaceholder, fill the image with the blank picture shown for a private snapshot.
+     */
+    static void FillPlaceholder(SnapshotImage &image);
+
+private:
+    static bool EncodePng(FILE *file, const uint8_t *pixels, uint32_t width, uint32_t height, uint32_t rowBytes);
+    static bool EncodeRaw(FILE *file, const uint8_t *pixels, uint32_t width, uint32_t height, uint32_t rowBytes,
+        bool isPrivate);
+    static bool DecodePng(const std::string &path, SnapshotImage &image);
+    static bool DecodeRaw(FILE *file, SnapshotImage &image);
+};
+}  // namespace AAFwk
+}  // namespace OHOS
+#endif  // FOUNDATION_AAFWK_SERVICES_ABILITYMGR_INCLUDE_MISSION_SNAPSHOT_CODEC_H
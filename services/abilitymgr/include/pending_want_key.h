@@ -53,6 +53,17 @@ public:
     int32_t GetCode();
     int32_t GetUserId();
 
+    /**
+     * Get the fingerprint of the request want, it is computed once and kept until the want changes.
+     */
+    const std::string &GetRequestWantFingerprint();
+
+    /**
+     * Get the hash of the fields that identify a pending want, that is bundle name, type, request who,
+     * request code, request want, resolved type, flags and user id.
+     */
+    std::size_t GetHashCode();
+
 private:
     int32_t type_ = {};
     std::string bundleName_ = {};
@@ -64,6 +75,10 @@ private:
     int32_t flags_ = {};
     int32_t code_ = {};
     int32_t userId_ = {};
+    std::string requestWantFingerprint_ = {};
+    bool fingerprintValid_ = false;
+    std::size_t hashCode_ = 0;
+    bool hashValid_ = false;
 };
 }  // namespace AAFwk
 }  // namespace OHOS
@@ -19,6 +19,7 @@
 #include <mutex>
 #include <memory>
 #include <map>
+#include <unordered_map>
 #include <vector>
 #include <string>
 
@@ -171,8 +172,16 @@ private:
     static int32_t PendingRecordIdCreate();
     void ClearPendingWantRecordTask(const std::string &bundleName, int32_t uid);
 
+    void InsertWantRecordLocked(const std::shared_ptr<PendingWantKey> &key, const sptr<PendingWantRecord> &record);
+    void EraseWantRecordLocked(const std::shared_ptr<PendingWantKey> &key);
+    void InsertHashIndexLocked(const sptr<PendingWantRecord> &record);
+    void EraseHashIndexLocked(const sptr<PendingWantRecord> &record);
+
 private:
     std::map<std::shared_ptr<PendingWantKey>, sptr<PendingWantRecord>> wantRecords_;
+    // secondary indexes of wantRecords_, keyed by PendingWantKey::GetHashCode() and by record code.
+    std::unordered_multimap<std::size_t, sptr<PendingWantRecord>> hashIndex_;
+    std::unordered_map<int32_t, sptr<PendingWantRecord>> codeIndex_;
     std::recursive_mutex mutex_;
 };
 }  // namespace AAFwk
@@ -26,6 +26,7 @@
 namespace OHOS {
 namespace AAFwk {
 const std::string THREAD_NAME = "TaskDataStorage";
+const std::string SNAPSHOT_THREAD_NAME = "MissionSnapshotStorage";
 const std::string SAVE_MISSION_INFO = "SaveMissionInfo";
 const std::string DELETE_MISSION_INFO = "DeleteMissionInfo";
 const std::string SAVE_MISSION_SNAPSHOT = "SaveMissionSnapshot";
@@ -89,15 +90,19 @@ public:
      * @brief Get the mission snapshot object
      * @param missionId id of mission
      * @param missionSnapshot
+     * @param isLowResolution get the thumbnail instead of the full snapshot.
      * @return return true if update mission snapshot success, else false
      */
-    bool GetMissionSnapshot(int missionId, MissionSnapshot& missionSnapshot);
+    bool GetMissionSnapshot(int missionId, MissionSnapshot& missionSnapshot, bool isLowResolution = false);
 
 private:
     std::unordered_map<int, std::shared_ptr<MissionDataStorage>> missionDataStorageMgr_;
     std::shared_ptr<MissionDataStorage> currentMissionDataStorage_;
     std::shared_ptr<AppExecFwk::EventRunner> eventLoop_;
     std::shared_ptr<AppExecFwk::EventHandler> handler_;
+    // snapshots are encoded on a thread of their own, not to hold up the mission infos.
+    std::shared_ptr<AppExecFwk::EventRunner> snapshotEventLoop_;
+    std::shared_ptr<AppExecFwk::EventHandler> snapshotHandler_;
     int32_t currentUserId_ = -1;
     std::mutex mutex_;
 };
@@ -45,7 +45,7 @@ int AbilityManagerProxy::StartAbility(const Want &want, int32_t userId, int requ
     if (!WriteInterfaceToken(data)) {
         return INNER_ERR;
     }
-    if (!data.WriteParcelable(&want)) {
+    if (!want.WriteLocalParcelable(data)) {
         HILOG_ERROR("want write failed.");
         return INNER_ERR;
     }
@@ -101,7 +101,7 @@ int AbilityManagerProxy::StartAbility(const Want &want, const AbilityStartSettin
     if (!WriteInterfaceToken(data)) {
         return INNER_ERR;
     }
-    if (!data.WriteParcelable(&want)) {
+    if (!want.WriteLocalParcelable(data)) {
         HILOG_ERROR("want write failed.");
         return INNER_ERR;
     }
@@ -147,7 +147,7 @@ int AbilityManagerProxy::StartAbility(
     if (!WriteInterfaceToken(data)) {
         return INNER_ERR;
     }
-    if (!data.WriteParcelable(&want)) {
+    if (!want.WriteLocalParcelable(data)) {
         HILOG_ERROR("want write failed.");
         return INNER_ERR;
     }
@@ -189,7 +189,7 @@ int AbilityManagerProxy::StartAbility(const Want &want, const StartOptions &star
     if (!WriteInterfaceToken(data)) {
         return INNER_ERR;
     }
-    if (!data.WriteParcelable(&want)) {
+    if (!want.WriteLocalParcelable(data)) {
         HILOG_ERROR("want write failed.");
         return INNER_ERR;
     }
@@ -234,7 +234,7 @@ int AbilityManagerProxy::StartExtensionAbility(const Want &want, const sptr<IRem
     if (!WriteInterfaceToken(data)) {
         return INNER_ERR;
     }
-    if (!data.WriteParcelable(&want)) {
+    if (!want.WriteLocalParcelable(data)) {
         HILOG_ERROR("want write failed.");
         return INNER_ERR;
     }
@@ -279,7 +279,7 @@ int AbilityManagerProxy::StopExtensionAbility(const Want &want, const sptr<IRemo
     if (!WriteInterfaceToken(data)) {
         return INNER_ERR;
     }
-    if (!data.WriteParcelable(&want)) {
+    if (!want.WriteLocalParcelable(data)) {
         HILOG_ERROR("want write failed.");
         return INNER_ERR;
     }
@@ -406,7 +406,7 @@ int AbilityManagerProxy::ConnectAbility(
     if (!WriteInterfaceToken(data)) {
         return INNER_ERR;
     }
-    if (!data.WriteParcelable(&want)) {
+    if (!want.WriteLocalParcelable(data)) {
         HILOG_ERROR("want write failed.");
         return ERR_INVALID_VALUE;
     }
@@ -786,7 +786,7 @@ int AbilityManagerProxy::StopServiceAbility(const Want &want, int32_t userId)
     if (!WriteInterfaceToken(data)) {
         return INNER_ERR;
     }
-    if (!data.WriteParcelable(&want)) {
+    if (!want.WriteLocalParcelable(data)) {
         HILOG_ERROR("want write failed.");
         return INNER_ERR;
     }
@@ -818,6 +818,12 @@ int AbilityManagerProxy::GetParcelableInfos(MessageParcel &reply, std::vector<T>
 }
 
 int AbilityManagerProxy::GetMissionSnapshot(const std::string& deviceId, int32_t missionId, MissionSnapshot& snapshot)
+{
+    return GetMissionSnapshot(deviceId, missionId, snapshot, false);
+}
+
+int AbilityManagerProxy::GetMissionSnapshot(const std::string& deviceId, int32_t missionId, MissionSnapshot& snapshot,
+    bool isLowResolution)
 {
     int error;
     MessageParcel data;
@@ -835,6 +841,10 @@ int AbilityManagerProxy::GetMissionSnapshot(const std::string& deviceId, int32_t
         HILOG_ERROR("missionId write failed.");
         return ERR_INVALID_VALUE;
     }
+    if (!data.WriteBool(isLowResolution)) {
+        HILOG_ERROR("isLowResolution write failed.");
+        return ERR_INVALID_VALUE;
+    }
     error = Remote()->SendRequest(IAbilityManager::GET_MISSION_SNAPSHOT_INFO, data, reply, option);
     if (error != NO_ERROR) {
         HILOG_ERROR("Send request error: %{public}d", error);
@@ -1203,7 +1213,7 @@ int AbilityManagerProxy::GetPendingRequestWant(const sptr<IWantSender> &target,
         HILOG_ERROR("target write failed.");
         return INNER_ERR;
     }
-    if (want == nullptr || !data.WriteParcelable(want.get())) {
+    if (want == nullptr || !want->WriteLocalParcelable(data)) {
         HILOG_ERROR("want write failed.");
         return INNER_ERR;
     }
@@ -1388,7 +1398,7 @@ int AbilityManagerProxy::StartContinuation(const Want &want, const sptr<IRemoteO
     if (!WriteInterfaceToken(data)) {
         return INNER_ERR;
     }
-    if (!data.WriteParcelable(&want)) {
+    if (!want.WriteLocalParcelable(data)) {
         HILOG_ERROR("want write failed.");
         return INNER_ERR;
     }
@@ -2062,7 +2072,7 @@ int AbilityManagerProxy::StartAbilityByCall(
     if (!WriteInterfaceToken(data)) {
         return INNER_ERR;
     }
-    if (!data.WriteParcelable(&want)) {
+    if (!want.WriteLocalParcelable(data)) {
         HILOG_ERROR("want write failed.");
         return ERR_INVALID_VALUE;
     }
@@ -2200,7 +2210,7 @@ int AbilityManagerProxy::StartUserTest(const Want &want, const sptr<IRemoteObjec
     if (!WriteInterfaceToken(data)) {
         return INNER_ERR;
     }
-    if (!data.WriteParcelable(&want)) {
+    if (!want.WriteLocalParcelable(data)) {
         HILOG_ERROR("want write failed.");
         return INNER_ERR;
     }
@@ -2491,7 +2501,7 @@ int AbilityManagerProxy::FreeInstallAbilityFromRemote(const Want &want, const sp
         return INNER_ERR;
     }
 
-    if (!data.WriteParcelable(&want)) {
+    if (!want.WriteLocalParcelable(data)) {
         HILOG_ERROR("want write failed.");
         return INNER_ERR;
     }
@@ -35,6 +35,8 @@
 #include "ability_util.h"
 #include "hitrace_meter.h"
 #include "bundle_mgr_client.h"
+#include "common_event_manager.h"
+#include "common_event_support.h"
 #include "distributed_client.h"
 #include "free_install_manager.h"
 #include "hilog_wrapper.h"
@@ -236,6 +238,8 @@ bool AbilityManagerService::Init()
         HILOG_ERROR("HiviewDFX::Watchdog::GetInstance AddThread Fail");
     }
 
+    SubscribeResolveCacheEvent();
+
     auto startSystemTask = [aams = shared_from_this()]() { aams->StartSystemApplication(); };
     handler_->PostTask(startSystemTask, "StartSystemApplication");
     HILOG_INFO("Init success.");
@@ -245,11 +249,44 @@ bool AbilityManagerService::Init()
 void AbilityManagerService::OnStop()
 {
     HILOG_INFO("Stop AMS.");
+    if (resolveCacheSubscriber_ != nullptr) {
+        EventFwk::CommonEventManager::UnSubscribeCommonEvent(resolveCacheSubscriber_);
+        resolveCacheSubscriber_.reset();
+    }
     eventLoop_.reset();
     handler_.reset();
     state_ = ServiceRunningState::STATE_NOT_START;
 }
 
+void AbilityManagerService::SubscribeResolveCacheEvent(int32_t retryCount)
+{
+    if (resolveCacheSubscriber_ != nullptr) {
+        return;
+    }
+    EventFwk::MatchingSkills matchingSkills;
+    matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_ADDED);
+    matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_CHANGED);
+    matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_REMOVED);
+    matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_USER_REMOVED);
+    EventFwk::CommonEventSubscribeInfo subscribeInfo(matchingSkills);
+    auto subscriber = std::make_shared<AbilityResolveCacheSubscriber>(subscribeInfo, abilityResolveCache_);
+    if (EventFwk::CommonEventManager::SubscribeCommonEvent(subscriber)) {
+        resolveCacheSubscriber_ = subscriber;
+        // nothing was cached while package events could be missed.
+        abilityResolveCache_->SetEnabled(true);
+        return;
+    }
+
+    // the resolve cache stays disabled until the package events can be received.
+    HILOG_WARN("Subscribe resolve cache event failed, retry count: %{public}d.", retryCount);
+    if (retryCount >= MAX_SUBSCRIBE_RESOLVE_CACHE_NUM || handler_ == nullptr) {
+        HILOG_ERROR("Subscribe resolve cache event failed, resolve cache is disabled.");
+        return;
+    }
+    auto task = [aams = shared_from_this(), retryCount]() { aams->SubscribeResolveCacheEvent(retryCount + 1); };
+    handler_->PostTask(task, "SubscribeResolveCacheEvent", SUBSCRIBE_RESOLVE_CACHE_DELAY);
+}
+
 ServiceRunningState AbilityManagerService::QueryServiceState() const
 {
     return state_;
@@ -1886,13 +1923,12 @@ sptr<IAbilityScheduler> AbilityManagerService::AcquireDataAbility(
     auto bms = GetBundleManager();
     CHECK_POINTER_AND_RETURN(bms, nullptr);
 
-    auto localUri(uri);
-    if (localUri.GetScheme() != AbilityConfig::SCHEME_DATA_ABILITY) {
+    if (uri.GetSchemeView() != AbilityConfig::SCHEME_DATA_ABILITY) {
         HILOG_ERROR("Acquire data ability with invalid uri scheme.");
         return nullptr;
     }
-    std::vector<std::string> pathSegments;
-    localUri.GetPathSegments(pathSegments);
+    std::vector<std::string_view> pathSegments;
+    uri.GetPathSegments(pathSegments);
     if (pathSegments.empty()) {
         HILOG_ERROR("Acquire data ability with invalid uri path.");
         return nullptr;
@@ -1900,7 +1936,7 @@ sptr<IAbilityScheduler> AbilityManagerService::AcquireDataAbility(
 
     auto userId = GetValidUserId(INVALID_USER_ID);
     AbilityRequest abilityRequest;
-    std::string dataAbilityUri = localUri.ToString();
+    std::string dataAbilityUri = uri.ToString();
     HILOG_INFO("%{public}s, called. userId %{public}d", __func__, userId);
     bool queryResult = IN_PROCESS_CALL(bms->QueryAbilityInfoByUri(dataAbilityUri, userId, abilityRequest.abilityInfo));
     if (!queryResult || abilityRequest.abilityInfo.name.empty() || abilityRequest.abilityInfo.bundleName.empty()) {
@@ -2059,6 +2095,7 @@ void AbilityManagerService::DumpSysInner(
     DumpSysStateInner(args, info, isClient, isUserID, userId);
     DumpSysPendingInner(args, info, isClient, isUserID, userId);
     DumpSysProcess(args, info, isClient, isUserID, userId);
+    abilityResolveCache_->Dump(info);
 }
 
 void AbilityManagerService::DumpSysMissionListInner(
@@ -2687,26 +2724,35 @@ int AbilityManagerService::GenerateAbilityRequest(
     auto abilityInfoFlag = (AppExecFwk::AbilityInfoFlag::GET_ABILITY_INFO_WITH_APPLICATION |
         AppExecFwk::AbilityInfoFlag::GET_ABILITY_INFO_WITH_PERMISSION |
         AppExecFwk::AbilityInfoFlag::GET_ABILITY_INFO_WITH_METADATA);
-    HILOG_DEBUG("QueryAbilityInfo from bms, userId is %{public}d.", userId);
-    IN_PROCESS_CALL_WITHOUT_RET(bms->QueryAbilityInfo(want, abilityInfoFlag, userId, request.abilityInfo));
-    if (request.abilityInfo.name.empty() || request.abilityInfo.bundleName.empty()) {
-        // try to find extension
-        std::vector<AppExecFwk::ExtensionAbilityInfo> extensionInfos;
-        IN_PROCESS_CALL_WITHOUT_RET(bms->QueryExtensionAbilityInfos(want, abilityInfoFlag, userId, extensionInfos));
-        if (extensionInfos.size() <= 0) {
-            HILOG_ERROR("GenerateAbilityRequest error. Get extension info failed.");
-            return RESOLVE_ABILITY_ERR;
-        }
+    if (abilityResolveCache_->Get(AbilityResolveCache::ResolveType::ABILITY, want, abilityInfoFlag, userId,
+        request.abilityInfo)) {
+        HILOG_DEBUG("QueryAbilityInfo hit resolve cache, userId is %{public}d.", userId);
+    } else {
+        auto generation = abilityResolveCache_->GetGeneration();
+        HILOG_DEBUG("QueryAbilityInfo from bms, userId is %{public}d.", userId);
+        IN_PROCESS_CALL_WITHOUT_RET(bms->QueryAbilityInfo(want, abilityInfoFlag, userId, request.abilityInfo));
+        if (request.abilityInfo.name.empty() || request.abilityInfo.bundleName.empty()) {
+            // try to find extension
+            std::vector<AppExecFwk::ExtensionAbilityInfo> extensionInfos;
+            IN_PROCESS_CALL_WITHOUT_RET(
+                bms->QueryExtensionAbilityInfos(want, abilityInfoFlag, userId, extensionInfos));
+            if (extensionInfos.size() <= 0) {
+                HILOG_ERROR("GenerateAbilityRequest error. Get extension info failed.");
+                return RESOLVE_ABILITY_ERR;
+            }
 
-        AppExecFwk::ExtensionAbilityInfo extensionInfo = extensionInfos.front();
-        if (extensionInfo.bundleName.empty() || extensionInfo.name.empty()) {
-            HILOG_ERROR("extensionInfo empty.");
-            return RESOLVE_ABILITY_ERR;
+            AppExecFwk::ExtensionAbilityInfo extensionInfo = extensionInfos.front();
+            if (extensionInfo.bundleName.empty() || extensionInfo.name.empty()) {
+                HILOG_ERROR("extensionInfo empty.");
+                return RESOLVE_ABILITY_ERR;
+            }
+            HILOG_DEBUG("Extension ability info found, name=%{public}s.",
+                extensionInfo.name.c_str());
+            // For compatibility translates to AbilityInfo
+            InitAbilityInfoFromExtension(extensionInfo, request.abilityInfo);
         }
-        HILOG_DEBUG("Extension ability info found, name=%{public}s.",
-            extensionInfo.name.c_str());
-        // For compatibility translates to AbilityInfo
-        InitAbilityInfoFromExtension(extensionInfo, request.abilityInfo);
+        abilityResolveCache_->Put(AbilityResolveCache::ResolveType::ABILITY, want, abilityInfoFlag, userId,
+            request.abilityInfo, generation);
     }
     HILOG_DEBUG("QueryAbilityInfo success, ability name: %{public}s, is stage mode: %{public}d.",
         request.abilityInfo.name.c_str(), request.abilityInfo.isStageBasedModel);
@@ -2743,24 +2789,32 @@ int AbilityManagerService::GenerateExtensionAbilityRequest(
     auto abilityInfoFlag = (AppExecFwk::AbilityInfoFlag::GET_ABILITY_INFO_WITH_APPLICATION |
         AppExecFwk::AbilityInfoFlag::GET_ABILITY_INFO_WITH_PERMISSION |
         AppExecFwk::AbilityInfoFlag::GET_ABILITY_INFO_WITH_METADATA);
-    HILOG_DEBUG("QueryExtensionAbilityInfo from bms, userId is %{public}d.", userId);
-    // try to find extension
-    std::vector<AppExecFwk::ExtensionAbilityInfo> extensionInfos;
-    IN_PROCESS_CALL_WITHOUT_RET(bms->QueryExtensionAbilityInfos(want, abilityInfoFlag, userId, extensionInfos));
-    if (extensionInfos.size() <= 0) {
-        HILOG_ERROR("GenerateAbilityRequest error. Get extension info failed.");
-        return RESOLVE_ABILITY_ERR;
-    }
+    if (abilityResolveCache_->Get(AbilityResolveCache::ResolveType::EXTENSION, want, abilityInfoFlag, userId,
+        request.abilityInfo)) {
+        HILOG_DEBUG("QueryExtensionAbilityInfo hit resolve cache, userId is %{public}d.", userId);
+    } else {
+        auto generation = abilityResolveCache_->GetGeneration();
+        HILOG_DEBUG("QueryExtensionAbilityInfo from bms, userId is %{public}d.", userId);
+        // try to find extension
+        std::vector<AppExecFwk::ExtensionAbilityInfo> extensionInfos;
+        IN_PROCESS_CALL_WITHOUT_RET(bms->QueryExtensionAbilityInfos(want, abilityInfoFlag, userId, extensionInfos));
+        if (extensionInfos.size() <= 0) {
+            HILOG_ERROR("GenerateAbilityRequest error. Get extension info failed.");
+            return RESOLVE_ABILITY_ERR;
+        }
 
-    AppExecFwk::ExtensionAbilityInfo extensionInfo = extensionInfos.front();
-    if (extensionInfo.bundleName.empty() || extensionInfo.name.empty()) {
-        HILOG_ERROR("extensionInfo empty.");
-        return RESOLVE_ABILITY_ERR;
+        AppExecFwk::ExtensionAbilityInfo extensionInfo = extensionInfos.front();
+        if (extensionInfo.bundleName.empty() || extensionInfo.name.empty()) {
+            HILOG_ERROR("extensionInfo empty.");
+            return RESOLVE_ABILITY_ERR;
+        }
+        HILOG_DEBUG("Extension ability info found, name=%{public}s.",
+            extensionInfo.name.c_str());
+        // For compatibility translates to AbilityInfo
+        InitAbilityInfoFromExtension(extensionInfo, request.abilityInfo);
+        abilityResolveCache_->Put(AbilityResolveCache::ResolveType::EXTENSION, want, abilityInfoFlag, userId,
+            request.abilityInfo, generation);
     }
-    HILOG_DEBUG("Extension ability info found, name=%{public}s.",
-        extensionInfo.name.c_str());
-    // For compatibility translates to AbilityInfo
-    InitAbilityInfoFromExtension(extensionInfo, request.abilityInfo);
 
     HILOG_DEBUG("QueryAbilityInfo success, ability name: %{public}s, is stage mode: %{public}d.",
         request.abilityInfo.name.c_str(), request.abilityInfo.isStageBasedModel);
@@ -2946,6 +3000,7 @@ int AbilityManagerService::UninstallApp(const std::string &bundleName, int32_t u
     if (pendingWantManager_) {
         pendingWantManager_->ClearPendingWantRecord(bundleName, uid);
     }
+    abilityResolveCache_->RemoveBundle(bundleName);
     int ret = DelayedSingleton<AppScheduler>::GetInstance()->KillApplicationByUid(bundleName, uid);
     if (ret != ERR_OK) {
         return UNINSTALL_APP_FAILED;
@@ -3658,6 +3713,7 @@ void AbilityManagerService::ClearUserData(int32_t userId)
     connectManagers_.erase(userId);
     dataAbilityManagers_.erase(userId);
     pendingWantManagers_.erase(userId);
+    RemoveAbilityResolveCache(userId);
 }
 
 int AbilityManagerService::RegisterSnapshotHandler(const sptr<ISnapshotHandler>& handler)
@@ -3679,6 +3735,12 @@ int AbilityManagerService::RegisterSnapshotHandler(const sptr<ISnapshotHandler>&
 
 int32_t AbilityManagerService::GetMissionSnapshot(const std::string& deviceId, int32_t missionId,
     MissionSnapshot& missionSnapshot)
+{
+    return GetMissionSnapshot(deviceId, missionId, missionSnapshot, false);
+}
+
+int32_t AbilityManagerService::GetMissionSnapshot(const std::string& deviceId, int32_t missionId,
+    MissionSnapshot& missionSnapshot, bool isLowResolution)
 {
     if (VerifyMissionPermission() == CHECK_PERMISSION_FAILED) {
         HILOG_ERROR("%{public}s: Permission verification failed", __func__);
@@ -3695,7 +3757,7 @@ int32_t AbilityManagerService::GetMissionSnapshot(const std::string& deviceId, i
         return INNER_ERR;
     }
     auto token = GetAbilityTokenByMissionId(missionId);
-    bool result = currentMissionListManager_->GetMissionSnapshot(missionId, token, missionSnapshot);
+    bool result = currentMissionListManager_->GetMissionSnapshot(missionId, token, missionSnapshot, isLowResolution);
     if (!result) {
         return INNER_ERR;
     }
@@ -3757,6 +3819,11 @@ void AbilityManagerService::SwitchToUser(int32_t oldUserId, int32_t userId)
     PauseOldConnectManager(oldUserId);
 }
 
+void AbilityManagerService::RemoveAbilityResolveCache(int32_t userId)
+{
+    abilityResolveCache_->RemoveUser(userId);
+}
+
 void AbilityManagerService::SwitchManagers(int32_t userId, bool switchUser)
 {
     HILOG_INFO("%{public}s, SwitchManagers:%{public}d-----begin", __func__, userId);
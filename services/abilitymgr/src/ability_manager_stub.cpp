@@ -1187,8 +1187,9 @@ int AbilityManagerStub::GetMissionSnapshotInfoInner(MessageParcel &data, Message
 {
     std::string deviceId = data.ReadString();
     int32_t missionId = data.ReadInt32();
+    bool isLowResolution = data.ReadBool();
     MissionSnapshot missionSnapshot;
-    int32_t result = GetMissionSnapshot(deviceId, missionId, missionSnapshot);
+    int32_t result = GetMissionSnapshot(deviceId, missionId, missionSnapshot, isLowResolution);
     HILOG_INFO("snapshot: AbilityManagerStub get snapshot result = %{public}d", result);
     if (!reply.WriteParcelable(&missionSnapshot)) {
         HILOG_ERROR("GetMissionSnapshot error");
@@ -37,6 +37,8 @@ const std::string DEBUG_APP = "debugApp";
 const std::string ABILITY_OWNER_USERID = "AbilityMS_Owner_UserId";
 int64_t AbilityRecord::abilityRecordId = 0;
 int64_t AbilityRecord::g_abilityRecordEventId_ = 0;
+std::unordered_map<int64_t, std::weak_ptr<AbilityRecord>> AbilityRecord::eventIdRecords_;
+std::mutex AbilityRecord::eventIdLock_;
 const int32_t DEFAULT_USER_ID = 0;
 const std::map<AbilityState, std::string> AbilityRecord::stateToStrMap = {
     std::map<AbilityState, std::string>::value_type(INITIAL, "INITIAL"),
@@ -101,6 +103,13 @@ AbilityRecord::AbilityRecord(const Want &want, const AppExecFwk::AbilityInfo &ab
 
 AbilityRecord::~AbilityRecord()
 {
+    {
+        std::lock_guard<std::mutex> guard(eventIdLock_);
+        auto iter = eventIdRecords_.find(eventId_);
+        if (iter != eventIdRecords_.end() && iter->second.expired()) {
+            eventIdRecords_.erase(iter);
+        }
+    }
     if (scheduler_ != nullptr && schedulerDeathRecipient_ != nullptr) {
         auto object = scheduler_->AsObject();
         if (object != nullptr) {
@@ -259,7 +268,7 @@ void AbilityRecord::BackgroundAbility(const Closure &task)
     if (handler && task) {
         if (!want_.GetBoolParam(DEBUG_APP, false)) {
             g_abilityRecordEventId_++;
-            eventId_ = g_abilityRecordEventId_;
+            SetEventId(g_abilityRecordEventId_);
             // eventId_ is a unique id of the task.
             handler->PostTask(task, std::to_string(eventId_), AbilityManagerService::BACKGROUNDNEW_TIMEOUT);
         } else {
@@ -377,7 +386,35 @@ std::shared_ptr<AbilityRecord> AbilityRecord::GetNextAbilityRecord() const
 
 void AbilityRecord::SetEventId(int64_t eventId)
 {
+    auto self = weak_from_this();
+    std::lock_guard<std::mutex> guard(eventIdLock_);
+    auto iter = eventIdRecords_.find(eventId_);
+    if (iter != eventIdRecords_.end() && !iter->second.owner_before(self) && !self.owner_before(iter->second)) {
+        eventIdRecords_.erase(iter);
+    }
     eventId_ = eventId;
+    if (!self.expired()) {
+        eventIdRecords_[eventId_] = self;
+    }
+}
+
+std::shared_ptr<AbilityRecord> AbilityRecord::GetAbilityRecordByEventId(int64_t eventId)
+{
+    // declared before the guard, so the last reference is never dropped with the lock held.
+    std::shared_ptr<AbilityRecord> abilityRecord = nullptr;
+    {
+        std::lock_guard<std::mutex> guard(eventIdLock_);
+        auto iter = eventIdRecords_.find(eventId);
+        if (iter == eventIdRecords_.end()) {
+            return nullptr;
+        }
+        abilityRecord = iter->second.lock();
+        if (abilityRecord == nullptr) {
+            eventIdRecords_.erase(iter);
+            return nullptr;
+        }
+    }
+    return abilityRecord->eventId_ == eventId ? abilityRecord : nullptr;
 }
 
 int64_t AbilityRecord::GetEventId() const
@@ -477,7 +514,7 @@ void AbilityRecord::Terminate(const Closure &task)
     if (handler && task) {
         if (!want_.GetBoolParam(DEBUG_APP, false)) {
             g_abilityRecordEventId_++;
-            eventId_ = g_abilityRecordEventId_;
+            SetEventId(g_abilityRecordEventId_);
             // eventId_ is a unique id of the task.
             handler->PostTask(task, std::to_string(eventId_), AbilityManagerService::TERMINATE_TIMEOUT);
         } else {
@@ -992,7 +1029,7 @@ void AbilityRecord::SendEvent(uint32_t msg, uint32_t timeOut)
     CHECK_POINTER(handler);
 
     g_abilityRecordEventId_++;
-    eventId_ = g_abilityRecordEventId_;
+    SetEventId(g_abilityRecordEventId_);
     handler->SendEvent(msg, eventId_, timeOut);
 }
 
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ability_resolve_cache.h"
+
+#include "common_event_support.h"
+#include "hilog_wrapper.h"
+
+namespace OHOS {
+namespace AAFwk {
+AbilityResolveCache::AbilityResolveCache(size_t capacity) : capacity_(capacity)
+{}
+
+bool AbilityResolveCache::MakeKey(ResolveType type, const Want &want, int32_t flags, std::string &key)
+{
+    const auto &element = want.GetElement();
+    if (element.GetBundleName().empty() || element.GetAbilityName().empty()) {
+        return false;
+    }
+    key = std::to_string(static_cast<int32_t>(type)) + "|" + std::to_string(flags) + "|" + element.GetDeviceID() +
+        "/" + element.GetBundleName() + "/" + element.GetModuleName() + "/" + element.GetAbilityName();
+    return true;
+}
+
+bool AbilityResolveCache::Get(
+    ResolveType type, const Want &want, int32_t flags, int32_t userId, AppExecFwk::AbilityInfo &abilityInfo)
+{
+    std::string key;
+    if (!MakeKey(type, want, flags, key)) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (!enabled_) {
+        return false;
+    }
+    auto userIter = userCaches_.find(userId);
+    if (userIter == userCaches_.end()) {
+        missCount_++;
+        return false;
+    }
+    auto &userCache = userIter->second;
+    auto iter = userCache.index.find(key);
+    if (iter == userCache.index.end()) {
+        missCount_++;
+        return false;
+    }
+    // move to the front as the most recently used.
+    userCache.items.splice(userCache.items.begin(), userCache.items, iter->second);
+    abilityInfo = iter->second->abilityInfo;
+    hitCount_++;
+    return true;
+}
+
+uint64_t AbilityResolveCache::GetGeneration()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return invalidateCount_;
+}
+
+void AbilityResolveCache::Put(ResolveType type, const Want &want, int32_t flags, int32_t userId,
+    const AppExecFwk::AbilityInfo &abilityInfo, uint64_t generation)
+{
+    std::string key;
+    if (capacity_ == 0 || !MakeKey(type, want, flags, key)) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (!enabled_ || generation != invalidateCount_) {
+        return;
+    }
+    auto &userCache = userCaches_[userId];
+    auto iter = userCache.index.find(key);
+    if (iter != userCache.index.end()) {
+        iter->second->abilityInfo = abilityInfo;
+        userCache.items.splice(userCache.items.begin(), userCache.items, iter->second);
+        return;
+    }
+    if (userCache.items.size() >= capacity_) {
+        userCache.index.erase(userCache.items.back().key);
+        userCache.items.pop_back();
+    }
+    userCache.items.push_front({ key, abilityInfo });
+    userCache.index.emplace(key, userCache.items.begin());
+}
+
+void AbilityResolveCache::SetEnabled(bool enabled)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (enabled_ == enabled) {
+        return;
+    }
+    enabled_ = enabled;
+    invalidateCount_++;
+    userCaches_.clear();
+}
+
+void AbilityResolveCache::RemoveBundle(const std::string &bundleName)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    invalidateCount_++;
+    for (auto &userIter : userCaches_) {
+        auto &userCache = userIter.second;
+        for (auto iter = userCache.items.begin(); iter != userCache.items.end();) {
+            if (iter->abilityInfo.bundleName == bundleName) {
+                userCache.index.erase(iter->key);
+                iter = userCache.items.erase(iter);
+            } else {
+                ++iter;
+            }
+        }
+    }
+}
+
+void AbilityResolveCache::RemoveUser(int32_t userId)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    invalidateCount_++;
+    userCaches_.erase(userId);
+}
+
+void AbilityResolveCache::Clear()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    invalidateCount_++;
+    userCaches_.clear();
+}
+
+void AbilityResolveCache::Dump(std::vector<std::string> &info)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    size_t size = 0;
+    for (const auto &userIter : userCaches_) {
+        size += userIter.second.items.size();
+    }
+    std::string dumpInfo = "AbilityResolveCache: " + std::string(enabled_ ? "enabled" : "disabled") +
+        ", entries #" + std::to_string(size) +
+        ", hit #" + std::to_string(hitCount_) + ", miss #" + std::to_string(missCount_) +
+        ", invalidate #" + std::to_string(invalidateCount_);
+    info.push_back(dumpInfo);
+    for (const auto &userIter : userCaches_) {
+        dumpInfo = "  userId #" + std::to_string(userIter.first) +
+            "  entries #" + std::to_string(userIter.second.items.size());
+        info.push_back(dumpInfo);
+    }
+}
+
+AbilityResolveCacheSubscriber::AbilityResolveCacheSubscriber(
+    const EventFwk::CommonEventSubscribeInfo &subscribeInfo, const std::shared_ptr<AbilityResolveCache> &resolveCache)
+    : EventFwk::CommonEventSubscriber(subscribeInfo), resolveCache_(resolveCache)
+{}
+
+void AbilityResolveCacheSubscriber::OnReceiveEvent(const EventFwk::CommonEventData &data)
+{
+    auto resolveCache = resolveCache_.lock();
+    if (resolveCache == nullptr) {
+        return;
+    }
+    const Want &want = data.GetWant();
+    std::string action = want.GetAction();
+    if (action == EventFwk::CommonEventSupport::COMMON_EVENT_USER_REMOVED) {
+        resolveCache->RemoveUser(data.GetCode());
+        return;
+    }
+    std::string bundleName = want.GetElement().GetBundleName();
+    if (bundleName.empty()) {
+        HILOG_WARN("%{public}s, bundle name is empty, action: %{public}s.", __func__, action.c_str());
+        resolveCache->Clear();
+        return;
+    }
+    HILOG_DEBUG("%{public}s, action: %{public}s, bundleName: %{public}s.", __func__, action.c_str(),
+        bundleName.c_str());
+    resolveCache->RemoveBundle(bundleName);
+}
+}  // namespace AAFwk
+}  // namespace OHOS
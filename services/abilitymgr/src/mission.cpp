@@ -15,6 +15,8 @@
 
 #include "mission.h"
 
+#include "mission_list.h"
+
 namespace OHOS {
 namespace AAFwk {
 Mission::Mission(int32_t id, const std::shared_ptr<AbilityRecord> abilityRecord, const std::string &missionName,
@@ -130,6 +132,11 @@ bool Mission::UpdateMissionId(int32_t id, int32_t method)
 
     startMethod_ = method;
     missionId_ = id;
+    // the owner list indexes its missions by id, re-key this one there.
+    auto missionList = GetMissionList();
+    if (missionList) {
+        missionList->UpdateMissionIndex(shared_from_this());
+    }
     return true;
 }
 
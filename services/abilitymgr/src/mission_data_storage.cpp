@@ -15,44 +15,136 @@
 
 #include "mission_data_storage.h"
 
+#include <algorithm>
+
 #include "file_util.h"
 #include "hilog_wrapper.h"
-#include "image_source.h"
-#include "media_errors.h"
 #ifdef SUPPORT_GRAPHICS
-#include <cstdio>
-#include "png.h"
-#include "securec.h"
+#include "media_errors.h"
 #endif
 
 namespace OHOS {
 namespace AAFwk {
 #ifdef SUPPORT_GRAPHICS
-constexpr int32_t BPP = 4; // bytes per pixel
+constexpr uint32_t BPP = 4; // bytes per pixel
 #endif
 
+MissionDataStorage::MissionDataStorage() : MissionDataStorage(0)
+{}
+
 MissionDataStorage::MissionDataStorage(int userId)
 {
     userId_ = userId;
+    journal_ = std::make_unique<MissionJournal>(GetMissionDataDirPath());
 }
 
 MissionDataStorage::~MissionDataStorage()
-{}
+{
+    FlushMissionInfo();
+}
 
 void MissionDataStorage::SetEventHandler(const std::shared_ptr<AppExecFwk::EventHandler> &handler)
 {
     handler_ = handler;
 }
 
+void MissionDataStorage::SetSnapshotEventHandler(const std::shared_ptr<AppExecFwk::EventHandler> &handler)
+{
+#ifdef SUPPORT_GRAPHICS
+    snapshotHandler_ = handler;
+#endif
+}
+
 bool MissionDataStorage::LoadAllMissionInfo(std::list<InnerMissionInfo> &missionInfoList)
+{
+    if (!journal_->Load()) {
+        HILOG_ERROR("load mission journal failed.");
+        return false;
+    }
+    if (!journal_->HasFiles()) {
+        MigrateMissionInfoFiles();
+    }
+
+    std::map<int32_t, std::string> missions;
+    journal_->GetMissions(missions);
+    for (const auto &item : missions) {
+        InnerMissionInfo misssionInfo;
+        if (!misssionInfo.FromJsonStr(item.second)) {
+            HILOG_ERROR("parse mission info failed. missionId: %{public}d", item.first);
+            continue;
+        }
+        missionInfoList.push_back(misssionInfo);
+    }
+    return true;
+}
+
+void MissionDataStorage::SaveMissionInfo(const InnerMissionInfo &missionInfo)
+{
+    journal_->StageSave(missionInfo.missionInfo.id, missionInfo.ToJsonStr());
+    ScheduleFlush();
+}
+
+void MissionDataStorage::DeleteMissionInfo(int missionId)
+{
+    journal_->StageDelete(missionId);
+    ScheduleFlush();
+    DeleteMissionSnapshot(missionId);
+}
+
+void MissionDataStorage::FlushMissionInfo()
+{
+    flushPosted_ = false;
+    if (!CreateMissionDataDir()) {
+        return;
+    }
+    if (!journal_->Flush()) {
+        HILOG_ERROR("flush mission journal failed, userId: %{public}d.", userId_);
+    }
+}
+
+void MissionDataStorage::ScheduleFlush()
+{
+    if (!handler_) {
+        FlushMissionInfo();
+        return;
+    }
+    if (flushPosted_.exchange(true)) {
+        return;
+    }
+    std::weak_ptr<MissionDataStorage> weakPtr = weak_from_this();
+    auto flushTask = [weakPtr]() {
+        auto missionDataStorage = weakPtr.lock();
+        if (missionDataStorage) {
+            missionDataStorage->FlushMissionInfo();
+        }
+    };
+    if (!handler_->PostTask(flushTask, FLUSH_MISSION_INFO, MISSION_INFO_FLUSH_DELAY)) {
+        FlushMissionInfo();
+    }
+}
+
+bool MissionDataStorage::CreateMissionDataDir() const
+{
+    std::string dirPath = GetMissionDataDirPath();
+    if (!OHOS::HiviewDFX::FileUtil::FileExists(dirPath)) {
+        bool createDir = OHOS::HiviewDFX::FileUtil::ForceCreateDirectory(dirPath);
+        if (!createDir) {
+            HILOG_ERROR("create dir %{public}s failed.", dirPath.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+void MissionDataStorage::MigrateMissionInfoFiles()
 {
     std::vector<std::string> fileNameVec;
     std::string dirPath = GetMissionDataDirPath();
     OHOS::HiviewDFX::FileUtil::GetDirFiles(dirPath, fileNameVec);
 
+    std::vector<std::string> migratedFiles;
     for (auto fileName : fileNameVec) {
         if (!CheckFileNameValid(fileName)) {
-            HILOG_ERROR("load mission info: file name %{public}s invalid.", fileName.c_str());
             continue;
         }
 
@@ -68,39 +160,21 @@ bool MissionDataStorage::LoadAllMissionInfo(std::list<InnerMissionInfo> &mission
             HILOG_ERROR("parse mission info failed. file: %{public}s", fileName.c_str());
             continue;
         }
-        missionInfoList.push_back(misssionInfo);
-    }
-    return true;
-}
-
-void MissionDataStorage::SaveMissionInfo(const InnerMissionInfo &missionInfo)
-{
-    std::string filePath = GetMissionDataFilePath(missionInfo.missionInfo.id);
-    std::string dirPath = OHOS::HiviewDFX::FileUtil::ExtractFilePath(filePath);
-    if (!OHOS::HiviewDFX::FileUtil::FileExists(dirPath)) {
-        bool createDir = OHOS::HiviewDFX::FileUtil::ForceCreateDirectory(dirPath);
-        if (!createDir) {
-            HILOG_ERROR("create dir %{public}s failed.", dirPath.c_str());
-            return;
-        }
+        journal_->StageSave(misssionInfo.missionInfo.id, content);
+        migratedFiles.push_back(fileName);
     }
-
-    std::string jsonStr = missionInfo.ToJsonStr();
-    bool saveMissionFile = OHOS::HiviewDFX::FileUtil::SaveStringToFile(filePath, jsonStr, true);
-    if (!saveMissionFile) {
-        HILOG_ERROR("save mission file %{public}s failed.", filePath.c_str());
+    if (migratedFiles.empty()) {
+        return;
     }
-}
 
-void MissionDataStorage::DeleteMissionInfo(int missionId)
-{
-    std::string filePath = GetMissionDataFilePath(missionId);
-    bool removeMissionFile = OHOS::HiviewDFX::FileUtil::RemoveFile(filePath);
-    if (!removeMissionFile) {
-        HILOG_ERROR("remove mission file %{public}s failed.", filePath.c_str());
+    HILOG_INFO("migrate %{public}zu mission files into journal.", migratedFiles.size());
+    if (!journal_->Flush() || !journal_->Compact()) {
+        HILOG_ERROR("migrate mission files failed.");
         return;
     }
-    DeleteMissionSnapshot(missionId);
+    for (const auto &fileName : migratedFiles) {
+        OHOS::HiviewDFX::FileUtil::RemoveFile(fileName);
+    }
 }
 
 std::string MissionDataStorage::GetMissionDataDirPath() const
@@ -108,12 +182,6 @@ std::string MissionDataStorage::GetMissionDataDirPath() const
     return TASK_DATA_FILE_BASE_PATH + "/" + std::to_string(userId_) + "/" + MISSION_DATA_FILE_PATH;
 }
 
-std::string MissionDataStorage::GetMissionDataFilePath(int missionId)
-{
-    return GetMissionDataDirPath() + "/"
-        + MISSION_JSON_FILE_PREFIX + "_" + std::to_string(missionId) + JSON_FILE_SUFFIX;
-}
-
 bool MissionDataStorage::CheckFileNameValid(const std::string &fileName)
 {
     std::string fileNameExcludePath = OHOS::HiviewDFX::FileUtil::ExtractFileName(fileName);
@@ -140,99 +208,160 @@ bool MissionDataStorage::CheckFileNameValid(const std::string &fileName)
     return true;
 }
 
-void MissionDataStorage::SaveSnapshotFile(int32_t missionId, const MissionSnapshot& missionSnapshot)
+void MissionDataStorage::SaveMissionSnapshot(int32_t missionId, const MissionSnapshot& missionSnapshot)
 {
-    std::string filePath = GetMissionSnapshotPath(missionId);
-    std::string dirPath = OHOS::HiviewDFX::FileUtil::ExtractFilePath(filePath);
-    if (!OHOS::HiviewDFX::FileUtil::FileExists(dirPath)) {
-        bool createDir = OHOS::HiviewDFX::FileUtil::ForceCreateDirectory(dirPath);
-        if (!createDir) {
-            HILOG_ERROR("snapshot: create dir %{public}s failed.", dirPath.c_str());
+#ifdef SUPPORT_GRAPHICS
+    if (!missionSnapshot.snapshot) {
+        HILOG_ERROR("snapshot: save snapshot failed, pixel map is nullptr, missionId = %{public}d", missionId);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(snapshotMutex_);
+        snapshotGeneration_++;
+        DeleteCachedSnapshot(missionId);
+        bool posted = pendingSnapshots_.find(missionId) != pendingSnapshots_.end();
+        pendingSnapshots_[missionId] = missionSnapshot;
+        if (posted) {
+            HILOG_DEBUG("snapshot: replace the snapshot not written yet, missionId = %{public}d", missionId);
             return;
         }
     }
-#ifdef SUPPORT_GRAPHICS
-    bool saveMissionFile = false;
-    if (missionSnapshot.isPrivate) {
-        ssize_t dataLength = missionSnapshot.snapshot->GetWidth() * missionSnapshot.snapshot->GetHeight() * BPP;
-        uint8_t* data = (uint8_t*) malloc(dataLength);
-        if (memset_s(data, dataLength, 0xff, dataLength) == EOK) {
-            saveMissionFile = WriteToPng(filePath.c_str(), missionSnapshot.snapshot->GetWidth(),
-                missionSnapshot.snapshot->GetHeight(), data);
-        }
-        free(data);
-    } else {
-        const uint8_t* data = missionSnapshot.snapshot->GetPixels();
-        saveMissionFile = WriteToPng(filePath.c_str(), missionSnapshot.snapshot->GetWidth(),
-            missionSnapshot.snapshot->GetHeight(), data);
+    if (!snapshotHandler_) {
+        WriteMissionSnapshot(missionId);
+        return;
     }
-
-    if (!saveMissionFile) {
-        HILOG_ERROR("snapshot: save mission snapshot failed, path = %{public}s.", filePath.c_str());
+    std::weak_ptr<MissionDataStorage> weakPtr = weak_from_this();
+    auto writeTask = [weakPtr, missionId]() {
+        auto missionDataStorage = weakPtr.lock();
+        if (missionDataStorage) {
+            missionDataStorage->WriteMissionSnapshot(missionId);
+        }
+    };
+    if (!snapshotHandler_->PostTask(writeTask, WRITE_MISSION_SNAPSHOT)) {
+        WriteMissionSnapshot(missionId);
     }
 #endif
 }
 
-void MissionDataStorage::SaveMissionSnapshot(int32_t missionId, const MissionSnapshot& missionSnapshot)
+void MissionDataStorage::WriteMissionSnapshot(int32_t missionId)
 {
-    HILOG_INFO("snapshot: save snapshot from cache, missionId = %{public}d", missionId);
-    SaveCachedSnapshot(missionId, missionSnapshot);
-    SaveSnapshotFile(missionId, missionSnapshot);
-    HILOG_INFO("snapshot: delete snapshot from cache, missionId = %{public}d", missionId);
-    DeleteCachedSnapshot(missionId);
+#ifdef SUPPORT_GRAPHICS
+    while (true) {
+        MissionSnapshot missionSnapshot;
+        {
+            std::lock_guard<std::mutex> lock(snapshotMutex_);
+            auto pending = pendingSnapshots_.find(missionId);
+            if (pending == pendingSnapshots_.end()) {
+                return;
+            }
+            missionSnapshot = pending->second;
+        }
+
+        std::shared_ptr<Media::PixelMap> thumbnail;
+        bool written = WriteSnapshotFiles(missionId, missionSnapshot, thumbnail);
+
+        std::lock_guard<std::mutex> lock(snapshotMutex_);
+        auto pending = pendingSnapshots_.find(missionId);
+        if (pending == pendingSnapshots_.end()) {
+            // deleted while it was written.
+            RemoveSnapshotFiles(missionId);
+            return;
+        }
+        if (pending->second.snapshot != missionSnapshot.snapshot ||
+            pending->second.isPrivate != missionSnapshot.isPrivate) {
+            // saved again while it was written, write the newer one.
+            continue;
+        }
+        pendingSnapshots_.erase(pending);
+        if (!written) {
+            HILOG_ERROR("snapshot: write snapshot failed, missionId = %{public}d", missionId);
+            return;
+        }
+        if (!missionSnapshot.isPrivate) {
+            SaveCachedSnapshot(missionId, false, missionSnapshot.snapshot);
+            SaveCachedSnapshot(missionId, true, thumbnail);
+        }
+        return;
+    }
+#endif
 }
 
-bool MissionDataStorage::GetCachedSnapshot(int32_t missionId, MissionSnapshot& missionSnapshot)
+void MissionDataStorage::DeleteMissionSnapshot(int32_t missionId)
 {
 #ifdef SUPPORT_GRAPHICS
-    std::lock_guard<std::mutex> lock(cachedPixelMapMutex_);
-    auto pixelMap = cachedPixelMap_.find(missionId);
-    if (pixelMap != cachedPixelMap_.end()) {
-        missionSnapshot.snapshot = pixelMap->second;
-        return true;
+    {
+        std::lock_guard<std::mutex> lock(snapshotMutex_);
+        snapshotGeneration_++;
+        pendingSnapshots_.erase(missionId);
+        DeleteCachedSnapshot(missionId);
     }
 #endif
-    return false;
+    RemoveSnapshotFiles(missionId);
 }
 
-bool MissionDataStorage::SaveCachedSnapshot(int32_t missionId, const MissionSnapshot& missionSnapshot)
+void MissionDataStorage::RemoveSnapshotFiles(int32_t missionId)
 {
-#ifdef SUPPORT_GRAPHICS
-    std::lock_guard<std::mutex> lock(cachedPixelMapMutex_);
-    auto result = cachedPixelMap_.insert_or_assign(missionId, missionSnapshot.snapshot);
-    if (!result.second) {
-        HILOG_ERROR("snapshot: save snapshot cache failed, missionId = %{public}d", missionId);
-        return false;
+    for (bool isLowResolution : { false, true }) {
+        std::string filePath = GetMissionSnapshotPath(missionId, isLowResolution);
+        if (!OHOS::HiviewDFX::FileUtil::FileExists(filePath)) {
+            continue;
+        }
+        bool removeResult = OHOS::HiviewDFX::FileUtil::RemoveFile(filePath);
+        if (!removeResult) {
+            HILOG_ERROR("snapshot: remove snapshot file %{public}s failed.", filePath.c_str());
+        }
     }
-#endif
-    return true;
 }
 
-bool MissionDataStorage::DeleteCachedSnapshot(int32_t missionId)
+bool MissionDataStorage::GetMissionSnapshot(int32_t missionId, MissionSnapshot& missionSnapshot,
+    bool isLowResolution)
 {
 #ifdef SUPPORT_GRAPHICS
-    std::lock_guard<std::mutex> lock(cachedPixelMapMutex_);
-    auto result = cachedPixelMap_.erase(missionId);
-    if (result != 1) {
-        HILOG_ERROR("snapshot: delete snapshot cache failed, missionId = %{public}d", missionId);
+    uint64_t generation = 0;
+    std::shared_ptr<Media::PixelMap> pendingPixelMap;
+    {
+        std::lock_guard<std::mutex> lock(snapshotMutex_);
+        auto pending = pendingSnapshots_.find(missionId);
+        if (pending != pendingSnapshots_.end() && (pending->second.isPrivate || !isLowResolution)) {
+            const auto &pixelMap = pending->second.snapshot;
+            missionSnapshot.isPrivate = pending->second.isPrivate;
+            missionSnapshot.snapshot = pending->second.isPrivate ?
+                CreatePlaceholder(pixelMap->GetWidth(), pixelMap->GetHeight(), isLowResolution) : pixelMap;
+            return missionSnapshot.snapshot != nullptr;
+        }
+        auto cached = GetCachedSnapshot(missionId, isLowResolution);
+        if (cached) {
+            HILOG_DEBUG("snapshot: GetMissionSnapshot from cache, missionId = %{public}d", missionId);
+            missionSnapshot.snapshot = cached;
+            return true;
+        }
+        if (pending != pendingSnapshots_.end()) {
+            // the thumbnail of a snapshot not written yet is downscaled from it, out of the lock.
+            pendingPixelMap = pending->second.snapshot;
+        }
+        generation = snapshotGeneration_;
+    }
+
+    std::shared_ptr<Media::PixelMap> pixelMap = pendingPixelMap ?
+        CreateThumbnail(pendingPixelMap) : GetPixelMap(missionId, isLowResolution);
+    if (!pixelMap) {
+        HILOG_ERROR("%{public}s: GetPixelMap failed.", __func__);
         return false;
     }
+    missionSnapshot.snapshot = pixelMap;
+
+    std::lock_guard<std::mutex> lock(snapshotMutex_);
+    if (generation == snapshotGeneration_) {
+        SaveCachedSnapshot(missionId, isLowResolution, pixelMap);
+    }
 #endif
     return true;
 }
 
-void MissionDataStorage::DeleteMissionSnapshot(int32_t missionId)
+std::string MissionDataStorage::GetMissionSnapshotPath(int32_t missionId, bool isLowResolution) const
 {
-    std::string filePath = GetMissionSnapshotPath(missionId);
-    std::string dirPath = OHOS::HiviewDFX::FileUtil::ExtractFilePath(filePath);
-    if (!OHOS::HiviewDFX::FileUtil::FileExists(filePath)) {
-        HILOG_WARN("snapshot: remove snapshot file %{public}s failed, file not exists", filePath.c_str());
-        return;
-    }
-    bool removeResult = OHOS::HiviewDFX::FileUtil::RemoveFile(filePath);
-    if (!removeResult) {
-        HILOG_ERROR("snapshot: remove snapshot file %{public}s failed.", filePath.c_str());
-    }
+    return GetMissionDataDirPath() + "/" + MISSION_JSON_FILE_PREFIX + "_" + std::to_string(missionId) +
+        (isLowResolution ? THUMBNAIL_FILE_SUFFIX : PNG_FILE_SUFFIX);
 }
 
 #ifdef SUPPORT_GRAPHICS
@@ -246,109 +375,142 @@ sptr<Media::PixelMap> MissionDataStorage::GetSnapshot(int missionId) const
     return sptr<Media::PixelMap>(pixelMapPtr.release());
 }
 
-std::unique_ptr<Media::PixelMap> MissionDataStorage::GetPixelMap(int missionId) const
+std::unique_ptr<Media::PixelMap> MissionDataStorage::GetPixelMap(int missionId, bool isLowResolution) const
 {
-    std::string filePath = GetMissionSnapshotPath(missionId);
+    std::string filePath = GetMissionSnapshotPath(missionId, isLowResolution);
     if (!OHOS::HiviewDFX::FileUtil::FileExists(filePath)) {
         HILOG_INFO("snapshot: storage snapshot not exists, missionId = %{public}d", missionId);
         return nullptr;
     }
-    uint32_t errCode = 0;
-    Media::SourceOptions sourceOptions;
-    auto imageSource = Media::ImageSource::CreateImageSource(filePath, sourceOptions, errCode);
-    if (errCode != OHOS::Media::SUCCESS) {
-        HILOG_ERROR("snapshot: CreateImageSource failed, errCode = %{public}d", errCode);
+    SnapshotImage image;
+    if (!MissionSnapshotCodec::Decode(filePath, image)) {
         return nullptr;
     }
-    Media::DecodeOptions decodeOptions;
-    auto pixelMapPtr = imageSource->CreatePixelMap(decodeOptions, errCode);
-    if (errCode != OHOS::Media::SUCCESS) {
-        HILOG_ERROR("snapshot: CreatePixelMap failed, errCode = %{public}d", errCode);
-        return nullptr;
+    if (image.isPrivate) {
+        MissionSnapshotCodec::FillPlaceholder(image);
     }
-    return pixelMapPtr;
+    return CreatePixelMap(image);
 }
-#endif
 
-bool MissionDataStorage::GetMissionSnapshot(int32_t missionId, MissionSnapshot& missionSnapshot)
+std::unique_ptr<Media::PixelMap> MissionDataStorage::CreatePixelMap(const SnapshotImage &image)
 {
-#ifdef SUPPORT_GRAPHICS
-    if (GetCachedSnapshot(missionId, missionSnapshot)) {
-        HILOG_INFO("snapshot: GetMissionSnapshot from cache, missionId = %{public}d", missionId);
-        return true;
-    }
-
-    auto pixelMap = GetPixelMap(missionId);
+    Media::InitializationOptions options;
+    options.size.width = static_cast<int32_t>(image.width);
+    options.size.height = static_cast<int32_t>(image.height);
+    options.pixelFormat = Media::PixelFormat::RGBA_8888;
+    auto pixelMap = Media::PixelMap::Create(options);
     if (!pixelMap) {
-        HILOG_ERROR("%{public}s: GetPixelMap failed.", __func__);
-        return false;
+        HILOG_ERROR("snapshot: create pixel map failed.");
+        return nullptr;
     }
-    missionSnapshot.snapshot = std::move(pixelMap);
-#endif
-    return true;
+    uint32_t errCode = pixelMap->WritePixels(image.pixels.data(), image.pixels.size());
+    if (errCode != OHOS::Media::SUCCESS) {
+        HILOG_ERROR("snapshot: write pixels failed, errCode = %{public}u", errCode);
+        return nullptr;
+    }
+    return pixelMap;
 }
 
-std::string MissionDataStorage::GetMissionSnapshotPath(int32_t missionId) const
+std::unique_ptr<Media::PixelMap> MissionDataStorage::CreatePlaceholder(uint32_t width, uint32_t height,
+    bool isLowResolution)
 {
-    return GetMissionDataDirPath() + "/"
-        + MISSION_JSON_FILE_PREFIX + "_" + std::to_string(missionId) + PNG_FILE_SUFFIX;
+    SnapshotImage image;
+    image.width = isLowResolution ? std::max(width / MISSION_THUMBNAIL_FACTOR, 1U) : width;
+    image.height = isLowResolution ? std::max(height / MISSION_THUMBNAIL_FACTOR, 1U) : height;
+    image.isPrivate = true;
+    MissionSnapshotCodec::FillPlaceholder(image);
+    return CreatePixelMap(image);
 }
 
-bool MissionDataStorage::WriteToPng(const char* fileName, uint32_t width, uint32_t height, const uint8_t* data)
+std::unique_ptr<Media::PixelMap> MissionDataStorage::CreateThumbnail(const std::shared_ptr<Media::PixelMap> &pixelMap)
 {
-#ifdef SUPPORT_GRAPHICS
-    if (data == nullptr) {
-        HILOG_ERROR("snapshot: data error, nullptr!\n");
-        return false;
-    }
-    const int BITMAP_DEPTH = 8; // color depth
-    png_structp png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
-    if (png_ptr == nullptr) {
-        HILOG_ERROR("snapshot: png_create_write_struct error, nullptr!\n");
-        return false;
-    }
-    png_infop info_ptr = png_create_info_struct(png_ptr);
-    if (png_ptr == nullptr) {
-        HILOG_ERROR("snapshot: png_create_info_struct error, nullptr!\n");
-        png_destroy_write_struct(&png_ptr, nullptr);
+    SnapshotImage image;
+    MissionSnapshotCodec::Downscale(pixelMap->GetPixels(), static_cast<uint32_t>(pixelMap->GetWidth()),
+        static_cast<uint32_t>(pixelMap->GetHeight()), static_cast<uint32_t>(pixelMap->GetRowBytes()),
+        MISSION_THUMBNAIL_FACTOR, image);
+    return CreatePixelMap(image);
+}
+
+bool MissionDataStorage::WriteSnapshotFiles(int32_t missionId, const MissionSnapshot& missionSnapshot,
+    std::shared_ptr<Media::PixelMap> &thumbnail)
+{
+    if (!CreateMissionDataDir()) {
         return false;
     }
-    FILE* fp = fopen(fileName, "wb");
-    if (fp == nullptr) {
-        HILOG_ERROR("snapshot: open file [%s] error, nullptr!\n", fileName);
-        png_destroy_write_struct(&png_ptr, &info_ptr);
-        return false;
+    const auto &pixelMap = missionSnapshot.snapshot;
+    uint32_t width = static_cast<uint32_t>(pixelMap->GetWidth());
+    uint32_t height = static_cast<uint32_t>(pixelMap->GetHeight());
+    std::string filePath = GetMissionSnapshotPath(missionId);
+    std::string thumbnailPath = GetMissionSnapshotPath(missionId, true);
+    if (missionSnapshot.isPrivate) {
+        // the size is all a private snapshot keeps, there are no pixels to encode.
+        return MissionSnapshotCodec::EncodePlaceholder(filePath, width, height) &&
+            MissionSnapshotCodec::EncodePlaceholder(thumbnailPath, std::max(width / MISSION_THUMBNAIL_FACTOR, 1U),
+                std::max(height / MISSION_THUMBNAIL_FACTOR, 1U));
     }
 
-    if (setjmp(png_jmpbuf(png_ptr))) {
-        /* If we get here, we had a problem writing the file. */
-        fclose(fp);
-        png_destroy_write_struct(&png_ptr, &info_ptr);
+    const uint8_t *pixels = pixelMap->GetPixels();
+    uint32_t rowBytes = static_cast<uint32_t>(pixelMap->GetRowBytes());
+    SnapshotImage image;
+    MissionSnapshotCodec::Downscale(pixels, width, height, rowBytes, MISSION_THUMBNAIL_FACTOR, image);
+    if (!MissionSnapshotCodec::Encode(thumbnailPath, image.pixels.data(), image.width, image.height,
+        image.width * BPP, SnapshotCodec::RAW)) {
         return false;
     }
-    png_init_io(png_ptr, fp);
+    thumbnail = CreatePixelMap(image);
+    return MissionSnapshotCodec::Encode(filePath, pixels, width, height, rowBytes, SnapshotCodec::PNG);
+}
 
-    // set png header
-    png_set_IHDR(png_ptr, info_ptr,
-        width, height,
-        BITMAP_DEPTH,
-        PNG_COLOR_TYPE_RGBA,
-        PNG_INTERLACE_NONE,
-        PNG_COMPRESSION_TYPE_BASE,
-        PNG_FILTER_TYPE_BASE);
-    png_set_packing(png_ptr);
-    png_write_info(png_ptr, info_ptr);
+std::shared_ptr<Media::PixelMap> MissionDataStorage::GetCachedSnapshot(int32_t missionId, bool isLowResolution)
+{
+    auto index = cachedSnapshotIndex_.find(SnapshotCacheKey(missionId, isLowResolution));
+    if (index == cachedSnapshotIndex_.end()) {
+        return nullptr;
+    }
+    cachedSnapshots_.splice(cachedSnapshots_.begin(), cachedSnapshots_, index->second);
+    return index->second->second;
+}
 
-    for (uint32_t i = 0; i < height; i++) {
-        png_write_row(png_ptr, data + (i * width * BPP));
+void MissionDataStorage::SaveCachedSnapshot(int32_t missionId, bool isLowResolution,
+    const std::shared_ptr<Media::PixelMap> &pixelMap)
+{
+    if (!pixelMap) {
+        return;
     }
-    png_write_end(png_ptr, info_ptr);
+    size_t byteCount = static_cast<size_t>(pixelMap->GetByteCount());
+    if (byteCount > MISSION_SNAPSHOT_CACHE_SIZE) {
+        return;
+    }
+    SnapshotCacheKey key(missionId, isLowResolution);
+    auto index = cachedSnapshotIndex_.find(key);
+    if (index != cachedSnapshotIndex_.end()) {
+        cachedSnapshotBytes_ -= static_cast<size_t>(index->second->second->GetByteCount());
+        cachedSnapshots_.erase(index->second);
+        cachedSnapshotIndex_.erase(index);
+    }
+    while (!cachedSnapshots_.empty() && cachedSnapshotBytes_ + byteCount > MISSION_SNAPSHOT_CACHE_SIZE) {
+        auto &oldest = cachedSnapshots_.back();
+        cachedSnapshotBytes_ -= static_cast<size_t>(oldest.second->GetByteCount());
+        cachedSnapshotIndex_.erase(oldest.first);
+        cachedSnapshots_.pop_back();
+    }
+    cachedSnapshots_.emplace_front(key, pixelMap);
+    cachedSnapshotIndex_.emplace(key, cachedSnapshots_.begin());
+    cachedSnapshotBytes_ += byteCount;
+}
 
-    // free memory
-    png_destroy_write_struct(&png_ptr, &info_ptr);
-    (void)fclose(fp);
-#endif
-    return true;
+void MissionDataStorage::DeleteCachedSnapshot(int32_t missionId)
+{
+    for (bool isLowResolution : { false, true }) {
+        auto index = cachedSnapshotIndex_.find(SnapshotCacheKey(missionId, isLowResolution));
+        if (index == cachedSnapshotIndex_.end()) {
+            continue;
+        }
+        cachedSnapshotBytes_ -= static_cast<size_t>(index->second->second->GetByteCount());
+        cachedSnapshots_.erase(index->second);
+        cachedSnapshotIndex_.erase(index);
+    }
 }
+#endif
 }  // namespace AAFwk
 }  // namespace OHOS
@@ -408,7 +408,7 @@ void MissionInfoMgr::RegisterSnapshotHandler(const sptr<ISnapshotHandler>& handl
 }
 
 bool MissionInfoMgr::UpdateMissionSnapshot(int32_t missionId, const sptr<IRemoteObject>& abilityToken,
-    MissionSnapshot& missionSnapshot) const
+    MissionSnapshot& missionSnapshot, bool isLowResolution) const
 {
     HILOG_INFO("Update mission snapshot, missionId:%{public}d.", missionId);
     std::lock_guard<std::recursive_mutex> lock(mutex_);
@@ -441,6 +441,16 @@ bool MissionInfoMgr::UpdateMissionSnapshot(int32_t missionId, const sptr<IRemote
         HILOG_ERROR("snapshot: save mission snapshot failed");
         return false;
     }
+#ifdef SUPPORT_GRAPHICS
+    if (isLowResolution && missionSnapshot.snapshot) {
+        // the full snapshot is saved, the caller gets its thumbnail.
+        missionSnapshot.snapshot = MissionDataStorage::CreateThumbnail(missionSnapshot.snapshot);
+        if (!missionSnapshot.snapshot) {
+            HILOG_ERROR("snapshot: create thumbnail failed");
+            return false;
+        }
+    }
+#endif
     HILOG_INFO("snapshot: update mission snapshot success");
     return true;
 }
@@ -466,7 +476,7 @@ sptr<Media::PixelMap> MissionInfoMgr::GetSnapshot(int32_t missionId) const
 #endif
 
 bool MissionInfoMgr::GetMissionSnapshot(int32_t missionId, const sptr<IRemoteObject>& abilityToken,
-    MissionSnapshot& missionSnapshot, bool force) const
+    MissionSnapshot& missionSnapshot, bool isLowResolution, bool force) const
 {
     HILOG_INFO("mission_list_info GetMissionSnapshot, missionId:%{public}d, force:%{public}d", missionId, force);
     std::lock_guard<std::recursive_mutex> lock(mutex_);
@@ -484,16 +494,16 @@ bool MissionInfoMgr::GetMissionSnapshot(int32_t missionId, const sptr<IRemoteObj
 
     if (force) {
         HILOG_INFO("force to get snapshot");
-        return UpdateMissionSnapshot(missionId, abilityToken, missionSnapshot);
+        return UpdateMissionSnapshot(missionId, abilityToken, missionSnapshot, isLowResolution);
     }
 
-    if (taskDataPersistenceMgr_->GetMissionSnapshot(missionId, missionSnapshot)) {
+    if (taskDataPersistenceMgr_->GetMissionSnapshot(missionId, missionSnapshot, isLowResolution)) {
         missionSnapshot.topAbility = it->missionInfo.want.GetElement();
         HILOG_ERROR("mission_list_info GetMissionSnapshot, find snapshot OK, missionId:%{public}d", missionId);
         return true;
     }
     HILOG_INFO("snapshot: storage mission snapshot not exists, create new snapshot");
-    return UpdateMissionSnapshot(missionId, abilityToken, missionSnapshot);
+    return UpdateMissionSnapshot(missionId, abilityToken, missionSnapshot, isLowResolution);
 }
 }  // namespace AAFwk
 }  // namespace OHOS
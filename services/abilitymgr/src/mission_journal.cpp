@@ -0,0 +1,376 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mission_journal.h"
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "hilog_wrapper.h"
+
+namespace OHOS {
+namespace AAFwk {
+namespace {
+constexpr uint32_t RECORD_MAGIC = 0x4D4A524E;
+constexpr uint32_t RECORD_SAVE = 1;
+constexpr uint32_t RECORD_DELETE = 2;
+constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+constexpr uint32_t HASH_FOLD_SHIFT = 32;
+const std::string TEMP_FILE_SUFFIX = ".tmp";
+
+struct RecordHeader {
+    uint32_t magic;
+    uint32_t type;
+    int32_t missionId;
+    uint32_t length;
+    uint32_t checksum;
+};
+
+// FNV-1a taking eight bytes a step, the records are checked on every load.
+uint64_t HashBytes(uint64_t hash, const void *data, size_t size)
+{
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    size_t offset = 0;
+    for (; offset + sizeof(uint64_t) <= size; offset += sizeof(uint64_t)) {
+        uint64_t word = 0;
+        memcpy(&word, bytes + offset, sizeof(word));
+        hash = (hash ^ word) * FNV_PRIME;
+    }
+    for (; offset < size; offset++) {
+        hash = (hash ^ bytes[offset]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+uint32_t GetChecksum(uint32_t type, int32_t missionId, const char *content, uint32_t length)
+{
+    uint64_t hash = HashBytes(FNV_OFFSET_BASIS, &type, sizeof(type));
+    hash = HashBytes(hash, &missionId, sizeof(missionId));
+    hash = HashBytes(hash, &length, sizeof(length));
+    hash = HashBytes(hash, content, length);
+    return static_cast<uint32_t>(hash ^ (hash >> HASH_FOLD_SHIFT));
+}
+}
+
+MissionJournal::MissionJournal(const std::string &dirPath, size_t compactSize)
+    : dirPath_(dirPath), journalPath_(dirPath + "/" + MISSION_JOURNAL_FILE_NAME),
+      snapshotPath_(dirPath + "/" + MISSION_SNAPSHOT_FILE_NAME), compactSize_(compactSize)
+{}
+
+MissionJournal::~MissionJournal()
+{
+    CloseJournal();
+}
+
+bool MissionJournal::Load()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return LoadLocked();
+}
+
+bool MissionJournal::HasFiles()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    LoadLocked();
+    return hasFiles_;
+}
+
+void MissionJournal::GetMissions(std::map<int32_t, std::string> &missions)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    LoadLocked();
+    missions = missions_;
+    for (auto missionId : stagedDeletes_) {
+        missions.erase(missionId);
+    }
+    for (const auto &item : stagedSaves_) {
+        missions[item.first] = item.second;
+    }
+}
+
+size_t MissionJournal::StageSave(int32_t missionId, const std::string &content)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    stagedDeletes_.erase(missionId);
+    stagedSaves_[missionId] = content;
+    return stagedSaves_.size() + stagedDeletes_.size();
+}
+
+size_t MissionJournal::StageDelete(int32_t missionId)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    stagedSaves_.erase(missionId);
+    stagedDeletes_.insert(missionId);
+    return stagedSaves_.size() + stagedDeletes_.size();
+}
+
+bool MissionJournal::Flush()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return FlushLocked();
+}
+
+bool MissionJournal::Compact()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!LoadLocked()) {
+        return false;
+    }
+    return CompactLocked();
+}
+
+size_t MissionJournal::GetJournalSize()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    LoadLocked();
+    return journalSize_;
+}
+
+bool MissionJournal::LoadLocked()
+{
+    if (loaded_) {
+        return true;
+    }
+
+    missions_.clear();
+    std::string data;
+    bool exists = false;
+    if (!ReadFile(snapshotPath_, data, exists)) {
+        return false;
+    }
+    hasFiles_ = exists;
+    size_t valid = ReplayRecords(data, false);
+    if (valid != data.size()) {
+        HILOG_ERROR("mission snapshot is damaged at %{public}zu of %{public}zu.", valid, data.size());
+    }
+
+    if (!ReadFile(journalPath_, data, exists)) {
+        return false;
+    }
+    hasFiles_ = hasFiles_ || exists;
+    valid = ReplayRecords(data, true);
+    if (valid != data.size()) {
+        // the tail was torn by a crash, cut it off so that new records follow the last good one.
+        HILOG_WARN("drop %{public}zu bytes at the end of mission journal.", data.size() - valid);
+        if (truncate(journalPath_.c_str(), static_cast<off_t>(valid)) != 0) {
+            HILOG_ERROR("truncate mission journal failed, errno: %{public}d", errno);
+            return false;
+        }
+    }
+    journalSize_ = valid;
+    // a snapshot left behind by a crash during compaction, the journal still holds its changes.
+    unlink((snapshotPath_ + TEMP_FILE_SUFFIX).c_str());
+    loaded_ = true;
+    return true;
+}
+
+bool MissionJournal::FlushLocked()
+{
+    if (!LoadLocked()) {
+        return false;
+    }
+    if (stagedSaves_.empty() && stagedDeletes_.empty()) {
+        return true;
+    }
+
+    std::string buffer;
+    for (auto missionId : stagedDeletes_) {
+        AppendRecord(buffer, RECORD_DELETE, missionId, "");
+    }
+    for (const auto &item : stagedSaves_) {
+        AppendRecord(buffer, RECORD_SAVE, item.first, item.second);
+    }
+    if (!OpenJournal()) {
+        return false;
+    }
+    if (!WriteAll(journalFd_, buffer) || fdatasync(journalFd_) != 0) {
+        HILOG_ERROR("append mission journal failed, errno: %{public}d", errno);
+        // keep the changes staged and leave no partial record behind.
+        if (ftruncate(journalFd_, static_cast<off_t>(journalSize_)) != 0) {
+            // load again before the next flush, which cuts off the partial record.
+            CloseJournal();
+            loaded_ = false;
+        }
+        return false;
+    }
+    journalSize_ += buffer.size();
+    hasFiles_ = true;
+
+    for (auto missionId : stagedDeletes_) {
+        missions_.erase(missionId);
+    }
+    for (auto &item : stagedSaves_) {
+        missions_[item.first] = std::move(item.second);
+    }
+    stagedSaves_.clear();
+    stagedDeletes_.clear();
+
+    if (journalSize_ > compactSize_) {
+        CompactLocked();
+    }
+    return true;
+}
+
+bool MissionJournal::CompactLocked()
+{
+    std::string buffer;
+    for (const auto &item : missions_) {
+        AppendRecord(buffer, RECORD_SAVE, item.first, item.second);
+    }
+
+    std::string tempPath = snapshotPath_ + TEMP_FILE_SUFFIX;
+    int fd = open(tempPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    if (fd < 0) {
+        HILOG_ERROR("open %{public}s failed, errno: %{public}d", tempPath.c_str(), errno);
+        return false;
+    }
+    bool written = WriteAll(fd, buffer) && fsync(fd) == 0;
+    close(fd);
+    if (!written || rename(tempPath.c_str(), snapshotPath_.c_str()) != 0) {
+        HILOG_ERROR("write mission snapshot failed, errno: %{public}d", errno);
+        unlink(tempPath.c_str());
+        return false;
+    }
+    int dirFd = open(dirPath_.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (dirFd >= 0) {
+        fsync(dirFd);
+        close(dirFd);
+    }
+    hasFiles_ = true;
+
+    // a crash before this point replays the journal on the new snapshot, which ends in the same missions.
+    if (!OpenJournal() || ftruncate(journalFd_, 0) != 0) {
+        HILOG_ERROR("empty mission journal failed, errno: %{public}d", errno);
+        return false;
+    }
+    journalSize_ = 0;
+    return true;
+}
+
+bool MissionJournal::OpenJournal()
+{
+    if (journalFd_ >= 0) {
+        return true;
+    }
+    journalFd_ = open(journalPath_.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    if (journalFd_ < 0) {
+        HILOG_ERROR("open %{public}s failed, errno: %{public}d", journalPath_.c_str(), errno);
+        return false;
+    }
+    return true;
+}
+
+void MissionJournal::CloseJournal()
+{
+    if (journalFd_ >= 0) {
+        close(journalFd_);
+        journalFd_ = -1;
+    }
+}
+
+void MissionJournal::AppendRecord(std::string &buffer, uint32_t type, int32_t missionId, const std::string &content)
+{
+    RecordHeader header;
+    header.magic = RECORD_MAGIC;
+    header.type = type;
+    header.missionId = missionId;
+    header.length = static_cast<uint32_t>(content.size());
+    header.checksum = GetChecksum(type, missionId, content.data(), header.length);
+    buffer.append(reinterpret_cast<const char *>(&header), sizeof(header));
+    buffer.append(content);
+}
+
+size_t MissionJournal::ReplayRecords(const std::string &data, bool allowDelete)
+{
+    size_t offset = 0;
+    while (data.size() - offset >= sizeof(RecordHeader)) {
+        RecordHeader header;
+        memcpy(&header, data.data() + offset, sizeof(header));
+        if (header.magic != RECORD_MAGIC || header.length > data.size() - offset - sizeof(header)) {
+            break;
+        }
+        const char *content = data.data() + offset + sizeof(header);
+        if (header.checksum != GetChecksum(header.type, header.missionId, content, header.length)) {
+            break;
+        }
+        if (header.type == RECORD_SAVE) {
+            missions_[header.missionId].assign(content, header.length);
+        } else if (header.type == RECORD_DELETE && allowDelete) {
+            missions_.erase(header.missionId);
+        } else {
+            break;
+        }
+        offset += sizeof(header) + header.length;
+    }
+    return offset;
+}
+
+bool MissionJournal::ReadFile(const std::string &path, std::string &data, bool &exists)
+{
+    data.clear();
+    exists = false;
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        if (errno == ENOENT) {
+            return true;
+        }
+        HILOG_ERROR("open %{public}s failed, errno: %{public}d", path.c_str(), errno);
+        return false;
+    }
+    exists = true;
+    struct stat statBuf;
+    if (fstat(fd, &statBuf) != 0) {
+        close(fd);
+        return false;
+    }
+    // read in one go, the file only grows by appends of this process.
+    data.resize(static_cast<size_t>(statBuf.st_size));
+    size_t offset = 0;
+    while (offset < data.size()) {
+        ssize_t count = read(fd, &data[offset], data.size() - offset);
+        if (count < 0 && errno == EINTR) {
+            continue;
+        }
+        if (count <= 0) {
+            break;
+        }
+        offset += static_cast<size_t>(count);
+    }
+    close(fd);
+    data.resize(offset);
+    return true;
+}
+
+bool MissionJournal::WriteAll(int fd, const std::string &data)
+{
+    size_t offset = 0;
+    while (offset < data.size()) {
+        ssize_t count = write(fd, data.data() + offset, data.size() - offset);
+        if (count < 0 && errno == EINTR) {
+            continue;
+        }
+        if (count <= 0) {
+            return false;
+        }
+        offset += static_cast<size_t>(count);
+    }
+    return true;
+}
+}  // namespace AAFwk
+}  // namespace OHOS
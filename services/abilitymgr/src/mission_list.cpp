@@ -40,6 +40,7 @@ void MissionList::AddMissionToTop(const std::shared_ptr<Mission> &mission)
 
     missions_.remove(mission);
     missions_.push_front(mission);
+    AddMissionIndex(mission);
     mission->SetMissionList(shared_from_this());
 }
 
@@ -48,11 +49,80 @@ void MissionList::RemoveMission(const std::shared_ptr<Mission> &mission)
     for (auto iter = missions_.begin(); iter != missions_.end(); iter++) {
         if (*iter == mission) {
             missions_.erase(iter);
+            RemoveMissionIndex(mission);
             return;
         }
     }
 }
 
+bool MissionList::ContainsMission(const std::shared_ptr<Mission> &mission) const
+{
+    return mission && missionIndexKeys_.find(mission.get()) != missionIndexKeys_.end();
+}
+
+void MissionList::UpdateMissionIndex(const std::shared_ptr<Mission> &mission)
+{
+    if (ContainsMission(mission)) {
+        AddMissionIndex(mission);
+    }
+}
+
+void MissionList::AddMissionIndex(const std::shared_ptr<Mission> &mission)
+{
+    MissionIndexKey key = { mission->GetMissionId(), nullptr };
+    auto abilityRecord = mission->GetAbilityRecord();
+    if (abilityRecord && abilityRecord->GetToken()) {
+        key.token = abilityRecord->GetToken()->AsObject().GetRefPtr();
+    }
+    auto keyIter = missionIndexKeys_.find(mission.get());
+    if (keyIter != missionIndexKeys_.end() &&
+        (keyIter->second.missionId != key.missionId || keyIter->second.token != key.token)) {
+        RemoveMissionIndex(mission);
+    }
+    if (key.token) {
+        tokenIndex_[key.token] = mission;
+    }
+    missionIdIndex_[key.missionId] = mission;
+    missionIndexKeys_[mission.get()] = key;
+}
+
+void MissionList::RemoveMissionIndex(const std::shared_ptr<Mission> &mission)
+{
+    auto keyIter = missionIndexKeys_.find(mission.get());
+    if (keyIter == missionIndexKeys_.end()) {
+        return;
+    }
+    MissionIndexKey key = keyIter->second;
+    missionIndexKeys_.erase(keyIter);
+    auto idIter = missionIdIndex_.find(key.missionId);
+    bool removeId = idIter != missionIdIndex_.end() && idIter->second == mission;
+    if (removeId) {
+        missionIdIndex_.erase(idIter);
+    }
+    auto tokenIter = tokenIndex_.find(key.token);
+    bool removeToken = key.token != nullptr && tokenIter != tokenIndex_.end() && tokenIter->second == mission;
+    if (removeToken) {
+        tokenIndex_.erase(tokenIter);
+    }
+    if (!removeId && !removeToken) {
+        return;
+    }
+
+    // another mission in the list may share the key, the top most one takes the index over.
+    for (auto iter = missions_.rbegin(); iter != missions_.rend(); iter++) {
+        auto otherKeyIter = missionIndexKeys_.find(iter->get());
+        if (otherKeyIter == missionIndexKeys_.end()) {
+            continue;
+        }
+        if (removeId && otherKeyIter->second.missionId == key.missionId) {
+            missionIdIndex_[key.missionId] = *iter;
+        }
+        if (removeToken && otherKeyIter->second.token == key.token) {
+            tokenIndex_[key.token] = *iter;
+        }
+    }
+}
+
 std::shared_ptr<Mission> MissionList::GetTopMission() const
 {
     if (missions_.empty()) {
@@ -79,24 +149,30 @@ std::shared_ptr<Mission> MissionList::GetSingletonMissionByName(const std::strin
 
 std::shared_ptr<AbilityRecord> MissionList::GetAbilityRecordByToken(const sptr<IRemoteObject> &token) const
 {
-    for (auto mission : missions_) {
-        if (!mission) {
-            continue;
-        }
-        std::shared_ptr<AbilityRecord> abilityRecord = mission->GetAbilityRecord();
-        if (abilityRecord && token == abilityRecord->GetToken()->AsObject()) {
-            return abilityRecord;
-        }
+    auto mission = GetMissionByToken(token);
+    return mission ? mission->GetAbilityRecord() : nullptr;
+}
+
+std::shared_ptr<Mission> MissionList::GetMissionByToken(const sptr<IRemoteObject> &token) const
+{
+    if (!token) {
+        return nullptr;
+    }
+    auto iter = tokenIndex_.find(token.GetRefPtr());
+    if (iter == tokenIndex_.end()) {
+        return nullptr;
     }
 
-    return nullptr;
+    return iter->second;
 }
 
 void MissionList::RemoveMissionByAbilityRecord(const std::shared_ptr<AbilityRecord> &abilityRecord)
 {
     for (auto iter = missions_.begin(); iter != missions_.end(); iter++) {
         if ((*iter)->GetAbilityRecord() == abilityRecord) {
+            auto mission = *iter;
             missions_.erase(iter);
+            RemoveMissionIndex(mission);
             return;
         }
     }
@@ -104,13 +180,12 @@ void MissionList::RemoveMissionByAbilityRecord(const std::shared_ptr<AbilityReco
 
 std::shared_ptr<Mission> MissionList::GetMissionById(int missionId) const
 {
-    for (auto mission : missions_) {
-        if (mission && mission->GetMissionId() == missionId) {
-            return mission;
-        }
+    auto iter = missionIdIndex_.find(missionId);
+    if (iter == missionIdIndex_.end() || iter->second->GetMissionId() != missionId) {
+        return nullptr;
     }
 
-    return nullptr;
+    return iter->second;
 }
 
 std::shared_ptr<Mission> MissionList::GetMissionBySpecifiedFlag(const AAFwk::Want &want, const std::string &flag) const
@@ -227,12 +302,11 @@ std::shared_ptr<AbilityRecord> MissionList::GetAbilityRecordByName(const AppExec
 
 sptr<IRemoteObject> MissionList::GetAbilityTokenByMissionId(int32_t missionId)
 {
-    for (auto mission : missions_) {
-        if (mission && mission->GetMissionId() == missionId) {
-            auto abilityRecord = mission->GetAbilityRecord();
-            if (abilityRecord) {
-                return abilityRecord->GetToken();
-            }
+    auto mission = GetMissionById(missionId);
+    if (mission) {
+        auto abilityRecord = mission->GetAbilityRecord();
+        if (abilityRecord) {
+            return abilityRecord->GetToken();
         }
     }
 
@@ -266,6 +340,7 @@ void MissionList::HandleUnInstallApp(const std::string &bundleName, int32_t uid)
         auto mission = *it;
         if (MatchedInitialMission(mission, bundleName, uid)) {
             missions_.erase(it++);
+            RemoveMissionIndex(mission);
         } else {
             it++;
         }
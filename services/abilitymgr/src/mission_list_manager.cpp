@@ -15,6 +15,8 @@
 
 #include "mission_list_manager.h"
 
+#include <algorithm>
+
 #include "ability_manager_errors.h"
 #include "ability_manager_service.h"
 #include "ability_util.h"
@@ -741,38 +743,99 @@ std::shared_ptr<AbilityRecord> MissionListManager::GetAbilityRecordByToken(
         }
     }
 
-    std::shared_ptr<AbilityRecord> abilityRecord = nullptr;
-    for (auto missionList : currentMissionLists_) {
-        if (missionList && (abilityRecord = missionList->GetAbilityRecordByToken(token)) != nullptr) {
-            return abilityRecord;
+    auto mission = GetMissionByTokenLocked(token);
+    return mission ? mission->GetAbilityRecord() : nullptr;
+}
+
+std::shared_ptr<Mission> MissionListManager::GetMissionByTokenLocked(const sptr<IRemoteObject> &token) const
+{
+    auto iter = tokenMissionIndex_.find(token.GetRefPtr());
+    if (iter != tokenMissionIndex_.end()) {
+        auto mission = iter->second.lock();
+        if (IsMissionInListsLocked(mission) && mission->GetAbilityRecord() &&
+            token == mission->GetAbilityRecord()->GetToken()->AsObject()) {
+            return mission;
         }
+        tokenMissionIndex_.erase(iter);
     }
 
-    if ((abilityRecord = defaultSingleList_->GetAbilityRecordByToken(token)) != nullptr) {
-        return abilityRecord;
+    std::shared_ptr<Mission> mission = nullptr;
+    for (auto missionList : currentMissionLists_) {
+        if (missionList && (mission = missionList->GetMissionByToken(token)) != nullptr) {
+            break;
+        }
     }
-
-    return defaultStandardList_->GetAbilityRecordByToken(token);
+    if (!mission) {
+        mission = defaultSingleList_->GetMissionByToken(token);
+    }
+    if (!mission) {
+        mission = defaultStandardList_->GetMissionByToken(token);
+    }
+    if (mission) {
+        UpdateMissionIndexLocked(mission);
+    }
+    return mission;
 }
 
 std::shared_ptr<Mission> MissionListManager::GetMissionById(int missionId) const
 {
+    auto iter = missionIdIndex_.find(missionId);
+    if (iter != missionIdIndex_.end()) {
+        auto mission = iter->second.lock();
+        if (IsMissionInListsLocked(mission) && mission->GetMissionId() == missionId) {
+            return mission;
+        }
+        missionIdIndex_.erase(iter);
+    }
+
     std::shared_ptr<Mission> mission = nullptr;
     for (auto missionList : currentMissionLists_) {
         if (missionList && (mission = missionList->GetMissionById(missionId)) != nullptr) {
-            return mission;
+            break;
         }
     }
-
-    if ((mission = defaultSingleList_->GetMissionById(missionId)) != nullptr) {
-        return mission;
+    if (!mission) {
+        mission = defaultSingleList_->GetMissionById(missionId);
+    }
+    if (!mission) {
+        mission = launcherList_->GetMissionById(missionId);
     }
+    if (!mission) {
+        mission = defaultStandardList_->GetMissionById(missionId);
+    }
+    if (mission) {
+        UpdateMissionIndexLocked(mission);
+    }
+    return mission;
+}
 
-    if ((mission = launcherList_->GetMissionById(missionId)) != nullptr) {
-        return mission;
+bool MissionListManager::IsMissionInListsLocked(const std::shared_ptr<Mission> &mission) const
+{
+    if (!mission) {
+        return false;
     }
+    auto missionList = mission->GetMissionList();
+    return missionList && missionList->ContainsMission(mission);
+}
 
-    return defaultStandardList_->GetMissionById(missionId);
+void MissionListManager::UpdateMissionIndexLocked(const std::shared_ptr<Mission> &mission) const
+{
+    auto abilityRecord = mission->GetAbilityRecord();
+    if (!abilityRecord || !abilityRecord->GetToken()) {
+        return;
+    }
+    if (missionIdIndex_.size() >= missionIndexSweepSize_) {
+        // drop the missions that have left the lists, then let the index grow to twice its live size.
+        for (auto iter = missionIdIndex_.begin(); iter != missionIdIndex_.end();) {
+            iter = IsMissionInListsLocked(iter->second.lock()) ? std::next(iter) : missionIdIndex_.erase(iter);
+        }
+        for (auto iter = tokenMissionIndex_.begin(); iter != tokenMissionIndex_.end();) {
+            iter = IsMissionInListsLocked(iter->second.lock()) ? std::next(iter) : tokenMissionIndex_.erase(iter);
+        }
+        missionIndexSweepSize_ = std::max(MISSION_INDEX_SWEEP_SIZE, missionIdIndex_.size() * 2);
+    }
+    missionIdIndex_[mission->GetMissionId()] = mission;
+    tokenMissionIndex_[abilityRecord->GetToken()->AsObject().GetRefPtr()] = mission;
 }
 
 int MissionListManager::AbilityTransactionDone(const sptr<IRemoteObject> &token, int state, const PacMap &saveData)
@@ -1616,7 +1679,15 @@ std::shared_ptr<AbilityRecord> MissionListManager::GetAbilityRecordByCaller(
 
 std::shared_ptr<AbilityRecord> MissionListManager::GetAbilityRecordByEventId(int64_t eventId) const
 {
-    std::shared_ptr<AbilityRecord> abilityRecord = nullptr;
+    std::shared_ptr<AbilityRecord> abilityRecord = AbilityRecord::GetAbilityRecordByEventId(eventId);
+    if (abilityRecord) {
+        auto mission = GetMissionByTokenLocked(abilityRecord->GetToken());
+        if (mission && mission->GetAbilityRecord() == abilityRecord) {
+            return abilityRecord;
+        }
+    }
+
+    abilityRecord = nullptr;
     for (auto missionList : currentMissionLists_) {
         if (missionList && (abilityRecord = missionList->GetAbilityRecordById(eventId)) != nullptr) {
             return abilityRecord;
@@ -2726,7 +2797,7 @@ void MissionListManager::RegisterSnapshotHandler(const sptr<ISnapshotHandler>& h
 }
 
 bool MissionListManager::GetMissionSnapshot(int32_t missionId, const sptr<IRemoteObject>& abilityToken,
-    MissionSnapshot& missionSnapshot)
+    MissionSnapshot& missionSnapshot, bool isLowResolution)
 {
     HILOG_INFO("snapshot: Start get mission snapshot.");
     bool forceSnapshot = false;
@@ -2738,7 +2809,7 @@ bool MissionListManager::GetMissionSnapshot(int32_t missionId, const sptr<IRemot
         }
     }
     return DelayedSingleton<MissionInfoMgr>::GetInstance()->GetMissionSnapshot(
-        missionId, abilityToken, missionSnapshot, forceSnapshot);
+        missionId, abilityToken, missionSnapshot, isLowResolution, forceSnapshot);
 }
 
 void MissionListManager::GetAbilityRunningInfos(std::vector<AbilityRunningInfo> &info, bool isPerm)
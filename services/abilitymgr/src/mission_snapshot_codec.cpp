@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mission_snapshot_codec.h"
+
+#include <algorithm>
+#include <cstring>
+#include <unistd.h>
+
+#include "hilog_wrapper.h"
+#include "png.h"
+
+namespace OHOS {
+namespace AAFwk {
+namespace {
+constexpr uint32_t BPP = 4; // bytes per pixel
+constexpr int BITMAP_DEPTH = 8; // color depth
+// zlib level 1, most of the gain of compressing at a fraction of the default level's time.
+constexpr int PNG_COMPRESSION_LEVEL = 1;
+constexpr uint32_t RAW_MAGIC = 0x504E534D;
+constexpr uint16_t RAW_VERSION = 1;
+constexpr uint16_t RAW_FLAG_PRIVATE = 0x1;
+constexpr uint32_t MAX_SNAPSHOT_SIZE = 16384;
+constexpr uint8_t PLACEHOLDER_COLOR = 0xff;
+const std::string TEMP_FILE_SUFFIX = ".tmp";
+
+struct RawHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t flags;
+    uint32_t width;
+    uint32_t height;
+};
+}
+
+bool MissionSnapshotCodec::Encode(const std::string &path, const uint8_t *pixels, uint32_t width, uint32_t height,
+    uint32_t rowBytes, SnapshotCodec codec)
+{
+    if (pixels == nullptr || width == 0 || height == 0 || rowBytes < width * BPP) {
+        HILOG_ERROR("snapshot: invalid pixels, width: %{public}u, height: %{public}u", width, height);
+        return false;
+    }
+    std::string tempPath = path + TEMP_FILE_SUFFIX;
+    FILE *file = fopen(tempPath.c_str(), "wbe");
+    if (file == nullptr) {
+        HILOG_ERROR("snapshot: open file %{public}s failed.", tempPath.c_str());
+        return false;
+    }
+    bool result = codec == SnapshotCodec::PNG ? EncodePng(file, pixels, width, height, rowBytes) :
+        EncodeRaw(file, pixels, width, height, rowBytes, false);
+    result = (fclose(file) == 0) && result;
+    if (!result || rename(tempPath.c_str(), path.c_str()) != 0) {
+        HILOG_ERROR("snapshot: write file %{public}s failed.", path.c_str());
+        unlink(tempPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool MissionSnapshotCodec::EncodePlaceholder(const std::string &path, uint32_t width, uint32_t height)
+{
+    std::string tempPath = path + TEMP_FILE_SUFFIX;
+    FILE *file = fopen(tempPath.c_str(), "wbe");
+    if (file == nullptr) {
+        HILOG_ERROR("snapshot: open file %{public}s failed.", tempPath.c_str());
+        return false;
+    }
+    bool result = EncodeRaw(file, nullptr, width, height, 0, true);
+    result = (fclose(file) == 0) && result;
+    if (!result || rename(tempPath.c_str(), path.c_str()) != 0) {
+        HILOG_ERROR("snapshot: write file %{public}s failed.", path.c_str());
+        unlink(tempPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool MissionSnapshotCodec::Decode(const std::string &path, SnapshotImage &image)
+{
+    FILE *file = fopen(path.c_str(), "rbe");
+    if (file == nullptr) {
+        return false;
+    }
+    uint8_t signature[sizeof(uint32_t)] = { 0 };
+    bool result = false;
+    if (fread(signature, 1, sizeof(signature), file) == sizeof(signature)) {
+        uint32_t magic = 0;
+        memcpy(&magic, signature, sizeof(magic));
+        if (magic == RAW_MAGIC) {
+            rewind(file);
+            result = DecodeRaw(file, image);
+        } else if (png_sig_cmp(signature, 0, sizeof(signature)) == 0) {
+            result = DecodePng(path, image);
+        }
+    }
+    fclose(file);
+    if (!result) {
+        HILOG_ERROR("snapshot: decode file %{public}s failed.", path.c_str());
+    }
+    return result;
+}
+
+void MissionSnapshotCodec::Downscale(const uint8_t *pixels, uint32_t width, uint32_t height, uint32_t rowBytes,
+    uint32_t factor, SnapshotImage &image)
+{
+    factor = std::max(factor, 1U);
+    image.width = std::max(width / factor, 1U);
+    image.height = std::max(height / factor, 1U);
+    image.isPrivate = false;
+    image.pixels.resize(static_cast<size_t>(image.width) * image.height * BPP);
+    if (pixels == nullptr) {
+        return;
+    }
+
+    std::vector<uint32_t> sums(static_cast<size_t>(image.width) * BPP);
+    uint8_t *out = image.pixels.data();
+    for (uint32_t y = 0; y < image.height; y++) {
+        std::fill(sums.begin(), sums.end(), 0);
+        uint32_t rows = std::min(factor, height - y * factor);
+        for (uint32_t row = 0; row < rows; row++) {
+            const uint8_t *in = pixels + static_cast<size_t>(y * factor + row) * rowBytes;
+            for (uint32_t x = 0; x < image.width; x++) {
+                uint32_t *sum = &sums[static_cast<size_t>(x) * BPP];
+                uint32_t columns = std::min(factor, width - x * factor);
+                const uint8_t *block = in + static_cast<size_t>(x) * factor * BPP;
+                for (uint32_t column = 0; column < columns; column++) {
+                    sum[0] += block[0];
+                    sum[1] += block[1];
+                    sum[2] += block[2];
+                    sum[3] += block[3];
+                    block += BPP;
+                }
+            }
+        }
+        for (uint32_t x = 0; x < image.width; x++) {
+            uint32_t count = rows * std::min(factor, width - x * factor);
+            for (uint32_t channel = 0; channel < BPP; channel++) {
+                *out++ = static_cast<uint8_t>(sums[static_cast<size_t>(x) * BPP + channel] / count);
+            }
+        }
+    }
+}
+
+void MissionSnapshotCodec::FillPlaceholder(SnapshotImage &image)
+{
+    image.pixels.assign(static_cast<size_t>(image.width) * image.height * BPP, PLACEHOLDER_COLOR);
+}
+
+bool MissionSnapshotCodec::EncodePng(FILE *file, const uint8_t *pixels, uint32_t width, uint32_t height,
+    uint32_t rowBytes)
+{
+    png_structp pngPtr = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
+    if (pngPtr == nullptr) {
+        HILOG_ERROR("snapshot: png_create_write_struct error, nullptr!");
+        return false;
+    }
+    png_infop infoPtr = png_create_info_struct(pngPtr);
+    if (infoPtr == nullptr) {
+        HILOG_ERROR("snapshot: png_create_info_struct error, nullptr!");
+        png_destroy_write_struct(&pngPtr, nullptr);
+        return false;
+    }
+    if (setjmp(png_jmpbuf(pngPtr))) {
+        png_destroy_write_struct(&pngPtr, &infoPtr);
+        return false;
+    }
+    png_init_io(pngPtr, file);
+    png_set_IHDR(pngPtr, infoPtr, width, height, BITMAP_DEPTH, PNG_COLOR_TYPE_RGBA, PNG_INTERLACE_NONE,
+        PNG_COMPRESSION_TYPE_BASE, PNG_FILTER_TYPE_BASE);
+    // one cheap filter instead of trying all five on every row.
+    png_set_filter(pngPtr, PNG_FILTER_TYPE_BASE, PNG_FILTER_SUB);
+    png_set_compression_level(pngPtr, PNG_COMPRESSION_LEVEL);
+    png_write_info(pngPtr, infoPtr);
+    for (uint32_t i = 0; i < height; i++) {
+        png_write_row(pngPtr, pixels + static_cast<size_t>(i) * rowBytes);
+    }
+    png_write_end(pngPtr, infoPtr);
+    png_destroy_write_struct(&pngPtr, &infoPtr);
+    return true;
+}
+
+bool MissionSnapshotCodec::EncodeRaw(FILE *file, const uint8_t *pixels, uint32_t width, uint32_t height,
+    uint32_t rowBytes, bool isPrivate)
+{
+    RawHeader header;
+    header.magic = RAW_MAGIC;
+    header.version = RAW_VERSION;
+    header.flags = isPrivate ? RAW_FLAG_PRIVATE : 0;
+    header.width = width;
+    header.height = height;
+    if (fwrite(&header, sizeof(header), 1, file) != 1) {
+        return false;
+    }
+    if (isPrivate) {
+        return true;
+    }
+    size_t packedBytes = static_cast<size_t>(width) * BPP;
+    if (rowBytes == packedBytes) {
+        return fwrite(pixels, packedBytes, height, file) == height;
+    }
+    for (uint32_t i = 0; i < height; i++) {
+        if (fwrite(pixels + static_cast<size_t>(i) * rowBytes, packedBytes, 1, file) != 1) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool MissionSnapshotCodec::DecodePng(const std::string &path, SnapshotImage &image)
+{
+    png_image png;
+    memset(&png, 0, sizeof(png));
+    png.version = PNG_IMAGE_VERSION;
+    if (!png_image_begin_read_from_file(&png, path.c_str())) {
+        return false;
+    }
+    if (png.width == 0 || png.height == 0 || png.width > MAX_SNAPSHOT_SIZE || png.height > MAX_SNAPSHOT_SIZE) {
+        png_image_free(&png);
+        return false;
+    }
+    png.format = PNG_FORMAT_RGBA;
+    image.width = png.width;
+    image.height = png.height;
+    image.isPrivate = false;
+    image.pixels.resize(PNG_IMAGE_SIZE(png));
+    if (!png_image_finish_read(&png, nullptr, image.pixels.data(), 0, nullptr)) {
+        png_image_free(&png);
+        image.pixels.clear();
+        return false;
+    }
+    return true;
+}
+
+bool MissionSnapshotCodec::DecodeRaw(FILE *file, SnapshotImage &image)
+{
+    RawHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 || header.version != RAW_VERSION) {
+        return false;
+    }
+    if (header.width == 0 || header.height == 0 || header.width > MAX_SNAPSHOT_SIZE ||
+        header.height > MAX_SNAPSHOT_SIZE) {
+        return false;
+    }
+    image.width = header.width;
+    image.height = header.height;
+    image.isPrivate = (header.flags & RAW_FLAG_PRIVATE) != 0;
+    image.pixels.clear();
+    if (image.isPrivate) {
+        return true;
+    }
+    image.pixels.resize(static_cast<size_t>(image.width) * image.height * BPP);
+    if (fread(image.pixels.data(), 1, image.pixels.size(), file) != image.pixels.size()) {
+        image.pixels.clear();
+        return false;
+    }
+    return true;
+}
+}  // namespace AAFwk
+}  // namespace OHOS
@@ -14,6 +14,9 @@
  */
 
 #include "pending_want_key.h"
+
+#include <functional>
+
 #include "iremote_object.h"
 
 namespace OHOS {
@@ -21,31 +24,38 @@ namespace AAFwk {
 void PendingWantKey::SetType(const int32_t type)
 {
     type_ = type;
+    hashValid_ = false;
 }
 
 void PendingWantKey::SetBundleName(const std::string &bundleName)
 {
     bundleName_ = bundleName;
+    hashValid_ = false;
 }
 
 void PendingWantKey::SetRequestWho(const std::string &requestWho)
 {
     requestWho_ = requestWho;
+    hashValid_ = false;
 }
 
 void PendingWantKey::SetRequestCode(int32_t requestCode)
 {
     requestCode_ = requestCode;
+    hashValid_ = false;
 }
 
 void PendingWantKey::SetRequestWant(const Want &requestWant)
 {
     requestWant_ = requestWant;
+    fingerprintValid_ = false;
+    hashValid_ = false;
 }
 
 void PendingWantKey::SetRequestResolvedType(const std::string &requestResolvedType)
 {
     requestResolvedType_ = requestResolvedType;
+    hashValid_ = false;
 }
 
 void PendingWantKey::SetAllWantsInfos(const std::vector<WantsInfo> &allWantsInfos)
@@ -56,6 +66,7 @@ void PendingWantKey::SetAllWantsInfos(const std::vector<WantsInfo> &allWantsInfo
 void PendingWantKey::SetFlags(int32_t flags)
 {
     flags_ = flags;
+    hashValid_ = false;
 }
 
 void PendingWantKey::SetCode(int32_t code)
@@ -66,6 +77,7 @@ void PendingWantKey::SetCode(int32_t code)
 void PendingWantKey::SetUserId(int32_t userId)
 {
     userId_ = userId;
+    hashValid_ = false;
 }
 
 int32_t PendingWantKey::GetType()
@@ -117,5 +129,32 @@ int32_t PendingWantKey::GetUserId()
 {
     return userId_;
 }
+
+const std::string &PendingWantKey::GetRequestWantFingerprint()
+{
+    if (!fingerprintValid_) {
+        requestWantFingerprint_ = requestWant_.ToString();
+        fingerprintValid_ = true;
+    }
+    return requestWantFingerprint_;
+}
+
+std::size_t PendingWantKey::GetHashCode()
+{
+    if (hashValid_) {
+        return hashCode_;
+    }
+    std::size_t hashCode = std::hash<std::string>()(bundleName_);
+    hashCode = hashCode * ODD_PRIME_NUMBER + std::hash<int32_t>()(type_);
+    hashCode = hashCode * ODD_PRIME_NUMBER + std::hash<std::string>()(requestWho_);
+    hashCode = hashCode * ODD_PRIME_NUMBER + std::hash<int32_t>()(requestCode_);
+    hashCode = hashCode * ODD_PRIME_NUMBER + std::hash<std::string>()(GetRequestWantFingerprint());
+    hashCode = hashCode * ODD_PRIME_NUMBER + std::hash<std::string>()(requestResolvedType_);
+    hashCode = hashCode * ODD_PRIME_NUMBER + std::hash<int32_t>()(flags_);
+    hashCode = hashCode * ODD_PRIME_NUMBER + std::hash<int32_t>()(userId_);
+    hashCode_ = hashCode;
+    hashValid_ = true;
+    return hashCode_;
+}
 }  // namespace AAFwk
 }  // namespace OHOS
\ No newline at end of file
@@ -89,17 +89,19 @@ sptr<IWantSender> PendingWantManager::GetWantSenderLocked(const int32_t callingU
     if (ref != nullptr) {
         if (!needCancel) {
             if (needUpdate && wantSenderInfo.allWants.size() > 0) {
+                EraseHashIndexLocked(ref);
                 ref->GetKey()->SetRequestWant(wantSenderInfo.allWants.back().want);
                 ref->GetKey()->SetRequestResolvedType(wantSenderInfo.allWants.back().resolvedTypes);
                 wantSenderInfo.allWants.back().want = ref->GetKey()->GetRequestWant();
                 wantSenderInfo.allWants.back().resolvedTypes = ref->GetKey()->GetRequestResolvedType();
                 ref->GetKey()->SetAllWantsInfos(wantSenderInfo.allWants);
                 ref->SetCallerUid(callingUid);
+                InsertHashIndexLocked(ref);
             }
             return ref;
         }
         MakeWantSenderCanceledLocked(*ref);
-        wantRecords_.erase(ref->GetKey());
+        EraseWantRecordLocked(ref->GetKey());
         return nullptr;
     }
 
@@ -112,7 +114,7 @@ sptr<IWantSender> PendingWantManager::GetWantSenderLocked(const int32_t callingU
     if (rec != nullptr) {
         rec->SetCallerUid(callingUid);
         pendingKey->SetCode(PendingRecordIdCreate());
-        wantRecords_.insert(std::make_pair(pendingKey, rec));
+        InsertWantRecordLocked(pendingKey, rec);
         HILOG_INFO("wantRecords_ size %{public}zu", wantRecords_.size());
         return rec;
     }
@@ -134,10 +136,10 @@ sptr<PendingWantRecord> PendingWantManager::GetPendingWantRecordByKey(const std:
     HILOG_INFO("%{public}s:begin.", __func__);
 
     std::lock_guard<std::recursive_mutex> locker(mutex_);
-    for (const auto &item : wantRecords_) {
-        const auto &pendingKey = item.first;
-        const auto &pendingRecord = item.second;
-        if ((pendingRecord != nullptr) && CheckPendingWantRecordByKey(pendingKey, key)) {
+    auto range = hashIndex_.equal_range(key->GetHashCode());
+    for (auto iter = range.first; iter != range.second; ++iter) {
+        const auto &pendingRecord = iter->second;
+        if ((pendingRecord != nullptr) && CheckPendingWantRecordByKey(pendingRecord->GetKey(), key)) {
             return pendingRecord;
         }
     }
@@ -147,6 +149,9 @@ sptr<PendingWantRecord> PendingWantManager::GetPendingWantRecordByKey(const std:
 bool PendingWantManager::CheckPendingWantRecordByKey(
     const std::shared_ptr<PendingWantKey> &inputKey, const std::shared_ptr<PendingWantKey> &key)
 {
+    if (inputKey->GetHashCode() != key->GetHashCode()) {
+        return false;
+    }
     if (inputKey->GetBundleName().compare(key->GetBundleName()) != 0) {
         return false;
     }
@@ -159,7 +164,7 @@ bool PendingWantManager::CheckPendingWantRecordByKey(
     if (inputKey->GetRequestCode() != key->GetRequestCode()) {
         return false;
     }
-    if (inputKey->GetRequestWant().ToString().compare(key->GetRequestWant().ToString()) != 0) {
+    if (inputKey->GetRequestWantFingerprint().compare(key->GetRequestWantFingerprint()) != 0) {
         return false;
     }
     if (!inputKey->GetRequestWant().OperationEquals(key->GetRequestWant())) {
@@ -216,7 +221,48 @@ void PendingWantManager::CancelWantSenderLocked(PendingWantRecord &record, bool
 
     MakeWantSenderCanceledLocked(record);
     if (cleanAbility) {
-        wantRecords_.erase(record.GetKey());
+        EraseWantRecordLocked(record.GetKey());
+    }
+}
+
+void PendingWantManager::InsertWantRecordLocked(
+    const std::shared_ptr<PendingWantKey> &key, const sptr<PendingWantRecord> &record)
+{
+    wantRecords_.insert(std::make_pair(key, record));
+    InsertHashIndexLocked(record);
+    codeIndex_[key->GetCode()] = record;
+}
+
+void PendingWantManager::EraseWantRecordLocked(const std::shared_ptr<PendingWantKey> &key)
+{
+    auto iter = wantRecords_.find(key);
+    if (iter == wantRecords_.end()) {
+        return;
+    }
+    auto record = iter->second;
+    if (record != nullptr) {
+        EraseHashIndexLocked(record);
+        auto codeIter = codeIndex_.find(key->GetCode());
+        if (codeIter != codeIndex_.end() && codeIter->second == record) {
+            codeIndex_.erase(codeIter);
+        }
+    }
+    wantRecords_.erase(iter);
+}
+
+void PendingWantManager::InsertHashIndexLocked(const sptr<PendingWantRecord> &record)
+{
+    hashIndex_.emplace(record->GetKey()->GetHashCode(), record);
+}
+
+void PendingWantManager::EraseHashIndexLocked(const sptr<PendingWantRecord> &record)
+{
+    auto range = hashIndex_.equal_range(record->GetKey()->GetHashCode());
+    for (auto iter = range.first; iter != range.second; ++iter) {
+        if (iter->second == record) {
+            hashIndex_.erase(iter);
+            return;
+        }
     }
 }
 int32_t PendingWantManager::DeviceIdDetermine(
@@ -314,10 +360,8 @@ sptr<PendingWantRecord> PendingWantManager::GetPendingWantRecordByCode(int32_t c
     HILOG_INFO("%{public}s:begin. wantRecords_ size = %{public}zu", __func__, wantRecords_.size());
 
     std::lock_guard<std::recursive_mutex> locker(mutex_);
-    auto iter = std::find_if(wantRecords_.begin(), wantRecords_.end(), [&code](const auto &pair) {
-        return pair.second->GetKey()->GetCode() == code;
-    });
-    return ((iter == wantRecords_.end()) ? nullptr : iter->second);
+    auto iter = codeIndex_.find(code);
+    return ((iter == codeIndex_.end()) ? nullptr : iter->second);
 }
 
 int32_t PendingWantManager::GetPendingWantUid(const sptr<IWantSender> &target)
@@ -498,28 +542,24 @@ void PendingWantManager::ClearPendingWantRecordTask(const std::string &bundleNam
 {
     HILOG_INFO("ClearPendingWantRecordTask, bundleName: %{public}s", bundleName.c_str());
     std::lock_guard<std::recursive_mutex> locker(mutex_);
-    auto iter = wantRecords_.begin();
-    while (iter != wantRecords_.end()) {
-        bool hasBundle = false;
-        const auto &pendingRecord = iter->second;
-        if ((pendingRecord != nullptr)) {
-            auto wantInfos = pendingRecord->GetKey()->GetAllWantsInfos();
-            for (const auto &wantInfo: wantInfos) {
-                if (wantInfo.want.GetBundle() == bundleName && uid == pendingRecord->GetUid()) {
-                    hasBundle = true;
-                    break;
-                }
-            }
-            if (hasBundle) {
-                iter = wantRecords_.erase(iter);
-                HILOG_INFO("wantRecords_ size %{public}zu", wantRecords_.size());
-            } else {
-                ++iter;
+    std::vector<std::shared_ptr<PendingWantKey>> clearKeys;
+    for (const auto &item : wantRecords_) {
+        const auto &pendingRecord = item.second;
+        if ((pendingRecord == nullptr) || (uid != pendingRecord->GetUid())) {
+            continue;
+        }
+        auto wantInfos = pendingRecord->GetKey()->GetAllWantsInfos();
+        for (const auto &wantInfo: wantInfos) {
+            if (wantInfo.want.GetBundle() == bundleName) {
+                clearKeys.emplace_back(item.first);
+                break;
             }
-        } else {
-            ++iter;
         }
     }
+    for (const auto &key : clearKeys) {
+        EraseWantRecordLocked(key);
+    }
+    HILOG_INFO("wantRecords_ size %{public}zu", wantRecords_.size());
 }
 
 void PendingWantManager::Dump(std::vector<std::string> &info)
@@ -29,6 +29,8 @@ TaskDataPersistenceMgr::~TaskDataPersistenceMgr()
 {
     eventLoop_.reset();
     handler_.reset();
+    snapshotEventLoop_.reset();
+    snapshotHandler_.reset();
     HILOG_INFO("TaskDataPersistenceMgr instance is destroyed");
 }
 
@@ -44,9 +46,21 @@ bool TaskDataPersistenceMgr::Init(int userId)
         CHECK_POINTER_RETURN_BOOL(handler_);
     }
 
+    if (!snapshotEventLoop_) {
+        snapshotEventLoop_ = AppExecFwk::EventRunner::Create(SNAPSHOT_THREAD_NAME);
+        CHECK_POINTER_RETURN_BOOL(snapshotEventLoop_);
+    }
+
+    if (!snapshotHandler_) {
+        snapshotHandler_ = std::make_shared<AppExecFwk::EventHandler>(snapshotEventLoop_);
+        CHECK_POINTER_RETURN_BOOL(snapshotHandler_);
+    }
+
     std::lock_guard<std::mutex> lock(mutex_);
     if (missionDataStorageMgr_.find(userId) == missionDataStorageMgr_.end()) {
         currentMissionDataStorage_ = std::make_shared<MissionDataStorage>(userId);
+        currentMissionDataStorage_->SetEventHandler(handler_);
+        currentMissionDataStorage_->SetSnapshotEventHandler(snapshotHandler_);
         missionDataStorageMgr_.insert(std::make_pair(userId, currentMissionDataStorage_));
     } else {
         currentMissionDataStorage_ = missionDataStorageMgr_[userId];
@@ -112,6 +126,8 @@ bool TaskDataPersistenceMgr::RemoveUserDir(int32_t userId)
         HILOG_ERROR("can not removed current user dir");
         return false;
     }
+    // drop the storage of the user first, so that its journal is not written into the removed dir.
+    missionDataStorageMgr_.erase(userId);
     std::string userDir = TASK_DATA_FILE_BASE_PATH + "/" + std::to_string(userId);
     bool ret = OHOS::HiviewDFX::FileUtil::ForceRemoveDirectory(userDir);
     if (!ret) {
@@ -124,19 +140,14 @@ bool TaskDataPersistenceMgr::RemoveUserDir(int32_t userId)
 bool TaskDataPersistenceMgr::SaveMissionSnapshot(int missionId, const MissionSnapshot& snapshot)
 {
     std::lock_guard<std::mutex> lock(mutex_);
-    if (!handler_ || !currentMissionDataStorage_) {
-        HILOG_ERROR("snapshot: handler_ or currentMissionDataStorage_ is nullptr");
+    if (!currentMissionDataStorage_) {
+        HILOG_ERROR("snapshot: currentMissionDataStorage_ is nullptr");
         return false;
     }
 
-    std::weak_ptr<MissionDataStorage> weakPtr(currentMissionDataStorage_);
-    std::function<void()> SaveMissionSnapshotFunc = [weakPtr, missionId, snapshot]() {
-        auto missionDataStorage = weakPtr.lock();
-        if (missionDataStorage) {
-            missionDataStorage->SaveMissionSnapshot(missionId, snapshot);
-        }
-    };
-    return handler_->PostTask(SaveMissionSnapshotFunc, SAVE_MISSION_SNAPSHOT);
+    // the storage keeps the snapshot at once and writes it on snapshotHandler_.
+    currentMissionDataStorage_->SaveMissionSnapshot(missionId, snapshot);
+    return true;
 }
 
 #ifdef SUPPORT_GRAPHICS
@@ -150,14 +161,14 @@ sptr<Media::PixelMap> TaskDataPersistenceMgr::GetSnapshot(int missionId) const
 }
 #endif
 
-bool TaskDataPersistenceMgr::GetMissionSnapshot(int missionId, MissionSnapshot& snapshot)
+bool TaskDataPersistenceMgr::GetMissionSnapshot(int missionId, MissionSnapshot& snapshot, bool isLowResolution)
 {
     std::lock_guard<std::mutex> lock(mutex_);
     if (!currentMissionDataStorage_) {
         HILOG_ERROR("snapshot: currentMissionDataStorage_ is nullptr");
         return false;
     }
-    return currentMissionDataStorage_->GetMissionSnapshot(missionId, snapshot);
+    return currentMissionDataStorage_->GetMissionSnapshot(missionId, snapshot, isLowResolution);
 }
 }  // namespace AAFwk
 }  // namespace OHOS
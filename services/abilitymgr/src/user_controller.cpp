@@ -255,6 +255,10 @@ void UserController::MoveUserToForeground(int32_t oldUserId, int32_t newUserId)
         return;
     }
     manager->SwitchToUser(oldUserId, newUserId);
+    if (oldUserId != USER_ID_NO_HEAD) {
+        // abilities resolved for the background user are not needed until it switches back.
+        manager->RemoveAbilityResolveCache(oldUserId);
+    }
     BroadcastUserBackground(oldUserId);
     BroadcastUserForeground(newUserId);
 }
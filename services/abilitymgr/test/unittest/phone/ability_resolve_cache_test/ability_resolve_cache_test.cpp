@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#include "ability_resolve_cache.h"
+#undef private
+#include "common_event_support.h"
+#include "want.h"
+
+using namespace testing::ext;
+using namespace OHOS::AppExecFwk;
+namespace OHOS {
+namespace AAFwk {
+namespace {
+const std::string BUNDLE_NAME = "com.example.resolve";
+const std::string OTHER_BUNDLE_NAME = "com.example.other";
+const std::string ABILITY_NAME = "MainAbility";
+constexpr int32_t FLAGS = 7;
+constexpr int32_t USER_ID = 100;
+constexpr int32_t OTHER_USER_ID = 101;
+using ResolveType = AbilityResolveCache::ResolveType;
+}
+
+class AbilityResolveCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    Want MakeWant(const std::string &bundleName, const std::string &abilityName);
+    AbilityInfo MakeAbilityInfo(const std::string &bundleName, const std::string &abilityName);
+
+    std::shared_ptr<AbilityResolveCache> cache_ = nullptr;
+};
+
+void AbilityResolveCacheTest::SetUpTestCase(void)
+{}
+void AbilityResolveCacheTest::TearDownTestCase(void)
+{}
+void AbilityResolveCacheTest::SetUp(void)
+{
+    cache_ = std::make_shared<AbilityResolveCache>();
+    cache_->SetEnabled(true);
+}
+void AbilityResolveCacheTest::TearDown(void)
+{}
+
+Want AbilityResolveCacheTest::MakeWant(const std::string &bundleName, const std::string &abilityName)
+{
+    Want want;
+    want.SetElementName(bundleName, abilityName);
+    return want;
+}
+
+AbilityInfo AbilityResolveCacheTest::MakeAbilityInfo(const std::string &bundleName, const std::string &abilityName)
+{
+    AbilityInfo abilityInfo;
+    abilityInfo.bundleName = bundleName;
+    abilityInfo.name = abilityName;
+    abilityInfo.applicationInfo.bundleName = bundleName;
+    abilityInfo.applicationInfo.name = bundleName;
+    return abilityInfo;
+}
+
+/*
+ * @tc.number    : AbilityResolveCache_0100
+ * @tc.name      : Get and Put
+ * @tc.desc      : A resolved explicit want is returned from the cache and counted as a hit.
+ */
+HWTEST_F(AbilityResolveCacheTest, AbilityResolveCache_0100, TestSize.Level1)
+{
+    Want want = MakeWant(BUNDLE_NAME, ABILITY_NAME);
+    AbilityInfo abilityInfo;
+    EXPECT_FALSE(cache_->Get(ResolveType::ABILITY, want, FLAGS, USER_ID, abilityInfo));
+
+    cache_->Put(ResolveType::ABILITY, want, FLAGS, USER_ID, MakeAbilityInfo(BUNDLE_NAME, ABILITY_NAME),
+        cache_->GetGeneration());
+    EXPECT_TRUE(cache_->Get(ResolveType::ABILITY, want, FLAGS, USER_ID, abilityInfo));
+    EXPECT_EQ(abilityInfo.bundleName, BUNDLE_NAME);
+    EXPECT_EQ(abilityInfo.name, ABILITY_NAME);
+
+    // the key covers the resolve type, the flags and the user.
+    EXPECT_FALSE(cache_->Get(ResolveType::EXTENSION, want, FLAGS, USER_ID, abilityInfo));
+    EXPECT_FALSE(cache_->Get(ResolveType::ABILITY, want, FLAGS + 1, USER_ID, abilityInfo));
+    EXPECT_FALSE(cache_->Get(ResolveType::ABILITY, want, FLAGS, OTHER_USER_ID, abilityInfo));
+    EXPECT_EQ(cache_->hitCount_, 1);
+    EXPECT_EQ(cache_->missCount_, 4);
+}
+
+/*
+ * @tc.number    : AbilityResolveCache_0200
+ * @tc.name      : Put implicit want
+ * @tc.desc      : A want without an explicit element is never cached.
+ */
+HWTEST_F(AbilityResolveCacheTest, AbilityResolveCache_0200, TestSize.Level1)
+{
+    Want want;
+    want.SetAction("action.system.home");
+    cache_->Put(ResolveType::ABILITY, want, FLAGS, USER_ID, MakeAbilityInfo(BUNDLE_NAME, ABILITY_NAME),
+        cache_->GetGeneration());
+    AbilityInfo abilityInfo;
+    EXPECT_FALSE(cache_->Get(ResolveType::ABILITY, want, FLAGS, USER_ID, abilityInfo));
+    EXPECT_TRUE(cache_->userCaches_.empty());
+}
+
+/*
+ * @tc.number    : AbilityResolveCache_0300
+ * @tc.name      : RemoveBundle and RemoveUser
+ * @tc.desc      : Invalidation drops only the entries of the bundle or user.
+ */
+HWTEST_F(AbilityResolveCacheTest, AbilityResolveCache_0300, TestSize.Level1)
+{
+    Want want = MakeWant(BUNDLE_NAME, ABILITY_NAME);
+    Want otherWant = MakeWant(OTHER_BUNDLE_NAME, ABILITY_NAME);
+    cache_->Put(ResolveType::ABILITY, want, FLAGS, USER_ID, MakeAbilityInfo(BUNDLE_NAME, ABILITY_NAME),
+        cache_->GetGeneration());
+    cache_->Put(ResolveType::ABILITY, otherWant, FLAGS, USER_ID, MakeAbilityInfo(OTHER_BUNDLE_NAME, ABILITY_NAME),
+        cache_->GetGeneration());
+    cache_->Put(ResolveType::ABILITY, want, FLAGS, OTHER_USER_ID, MakeAbilityInfo(BUNDLE_NAME, ABILITY_NAME),
+        cache_->GetGeneration());
+
+    cache_->RemoveBundle(BUNDLE_NAME);
+    AbilityInfo abilityInfo;
+    EXPECT_FALSE(cache_->Get(ResolveType::ABILITY, want, FLAGS, USER_ID, abilityInfo));
+    EXPECT_FALSE(cache_->Get(ResolveType::ABILITY, want, FLAGS, OTHER_USER_ID, abilityInfo));
+    EXPECT_TRUE(cache_->Get(ResolveType::ABILITY, otherWant, FLAGS, USER_ID, abilityInfo));
+
+    cache_->RemoveUser(USER_ID);
+    EXPECT_FALSE(cache_->Get(ResolveType::ABILITY, otherWant, FLAGS, USER_ID, abilityInfo));
+}
+
+/*
+ * @tc.number    : AbilityResolveCache_0400
+ * @tc.name      : Put after invalidation
+ * @tc.desc      : A result resolved before an invalidation is not cached.
+ */
+HWTEST_F(AbilityResolveCacheTest, AbilityResolveCache_0400, TestSize.Level1)
+{
+    Want want = MakeWant(BUNDLE_NAME, ABILITY_NAME);
+    auto generation = cache_->GetGeneration();
+    cache_->RemoveBundle(BUNDLE_NAME);
+    cache_->Put(ResolveType::ABILITY, want, FLAGS, USER_ID, MakeAbilityInfo(BUNDLE_NAME, ABILITY_NAME), generation);
+    AbilityInfo abilityInfo;
+    EXPECT_FALSE(cache_->Get(ResolveType::ABILITY, want, FLAGS, USER_ID, abilityInfo));
+}
+
+/*
+ * @tc.number    : AbilityResolveCache_0500
+ * @tc.name      : Capacity
+ * @tc.desc      : The least recently used entry is evicted when a user cache is full.
+ */
+HWTEST_F(AbilityResolveCacheTest, AbilityResolveCache_0500, TestSize.Level1)
+{
+    cache_ = std::make_shared<AbilityResolveCache>(2);
+    cache_->SetEnabled(true);
+    Want first = MakeWant(BUNDLE_NAME, "FirstAbility");
+    Want second = MakeWant(BUNDLE_NAME, "SecondAbility");
+    Want third = MakeWant(BUNDLE_NAME, "ThirdAbility");
+    cache_->Put(ResolveType::ABILITY, first, FLAGS, USER_ID, MakeAbilityInfo(BUNDLE_NAME, "FirstAbility"),
+        cache_->GetGeneration());
+    cache_->Put(ResolveType::ABILITY, second, FLAGS, USER_ID, MakeAbilityInfo(BUNDLE_NAME, "SecondAbility"),
+        cache_->GetGeneration());
+    AbilityInfo abilityInfo;
+    EXPECT_TRUE(cache_->Get(ResolveType::ABILITY, first, FLAGS, USER_ID, abilityInfo));
+    cache_->Put(ResolveType::ABILITY, third, FLAGS, USER_ID, MakeAbilityInfo(BUNDLE_NAME, "ThirdAbility"),
+        cache_->GetGeneration());
+
+    EXPECT_TRUE(cache_->Get(ResolveType::ABILITY, first, FLAGS, USER_ID, abilityInfo));
+    EXPECT_FALSE(cache_->Get(ResolveType::ABILITY, second, FLAGS, USER_ID, abilityInfo));
+    EXPECT_TRUE(cache_->Get(ResolveType::ABILITY, third, FLAGS, USER_ID, abilityInfo));
+}
+
+/*
+ * @tc.number    : AbilityResolveCache_0600
+ * @tc.name      : SetEnabled
+ * @tc.desc      : A disabled cache keeps nothing.
+ */
+HWTEST_F(AbilityResolveCacheTest, AbilityResolveCache_0600, TestSize.Level1)
+{
+    cache_->SetEnabled(false);
+    Want want = MakeWant(BUNDLE_NAME, ABILITY_NAME);
+    cache_->Put(ResolveType::ABILITY, want, FLAGS, USER_ID, MakeAbilityInfo(BUNDLE_NAME, ABILITY_NAME),
+        cache_->GetGeneration());
+    AbilityInfo abilityInfo;
+    EXPECT_FALSE(cache_->Get(ResolveType::ABILITY, want, FLAGS, USER_ID, abilityInfo));
+    EXPECT_TRUE(cache_->userCaches_.empty());
+}
+
+/*
+ * @tc.number    : AbilityResolveCache_0700
+ * @tc.name      : OnReceiveEvent
+ * @tc.desc      : Package and user events drop the matching entries.
+ */
+HWTEST_F(AbilityResolveCacheTest, AbilityResolveCache_0700, TestSize.Level1)
+{
+    Want want = MakeWant(BUNDLE_NAME, ABILITY_NAME);
+    Want otherWant = MakeWant(OTHER_BUNDLE_NAME, ABILITY_NAME);
+    cache_->Put(ResolveType::ABILITY, want, FLAGS, USER_ID, MakeAbilityInfo(BUNDLE_NAME, ABILITY_NAME),
+        cache_->GetGeneration());
+    cache_->Put(ResolveType::ABILITY, otherWant, FLAGS, OTHER_USER_ID,
+        MakeAbilityInfo(OTHER_BUNDLE_NAME, ABILITY_NAME), cache_->GetGeneration());
+
+    EventFwk::MatchingSkills matchingSkills;
+    matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_CHANGED);
+    matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_USER_REMOVED);
+    EventFwk::CommonEventSubscribeInfo subscribeInfo(matchingSkills);
+    auto subscriber = std::make_shared<AbilityResolveCacheSubscriber>(subscribeInfo, cache_);
+
+    Want eventWant;
+    eventWant.SetAction(EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_CHANGED);
+    eventWant.SetElementName(BUNDLE_NAME, "");
+    subscriber->OnReceiveEvent(EventFwk::CommonEventData(eventWant));
+    AbilityInfo abilityInfo;
+    EXPECT_FALSE(cache_->Get(ResolveType::ABILITY, want, FLAGS, USER_ID, abilityInfo));
+    EXPECT_TRUE(cache_->Get(ResolveType::ABILITY, otherWant, FLAGS, OTHER_USER_ID, abilityInfo));
+
+    Want userWant;
+    userWant.SetAction(EventFwk::CommonEventSupport::COMMON_EVENT_USER_REMOVED);
+    subscriber->OnReceiveEvent(EventFwk::CommonEventData(userWant, OTHER_USER_ID));
+    EXPECT_FALSE(cache_->Get(ResolveType::ABILITY, otherWant, FLAGS, OTHER_USER_ID, abilityInfo));
+}
+
+/*
+ * @tc.number    : AbilityResolveCache_0800
+ * @tc.name      : Dump
+ * @tc.desc      : Dump reports the hit and miss counters.
+ */
+HWTEST_F(AbilityResolveCacheTest, AbilityResolveCache_0800, TestSize.Level1)
+{
+    Want want = MakeWant(BUNDLE_NAME, ABILITY_NAME);
+    AbilityInfo abilityInfo;
+    cache_->Get(ResolveType::ABILITY, want, FLAGS, USER_ID, abilityInfo);
+    cache_->Put(ResolveType::ABILITY, want, FLAGS, USER_ID, MakeAbilityInfo(BUNDLE_NAME, ABILITY_NAME),
+        cache_->GetGeneration());
+    cache_->Get(ResolveType::ABILITY, want, FLAGS, USER_ID, abilityInfo);
+
+    std::vector<std::string> info;
+    cache_->Dump(info);
+    ASSERT_EQ(info.size(), 2);
+    EXPECT_NE(info[0].find("hit #1"), std::string::npos);
+    EXPECT_NE(info[0].find("miss #1"), std::string::npos);
+    EXPECT_NE(info[1].find("userId #100"), std::string::npos);
+}
+}  // namespace AAFwk
+}  // namespace OHOS
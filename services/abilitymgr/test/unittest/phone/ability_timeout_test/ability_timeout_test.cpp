@@ -119,8 +119,17 @@ void AbilityTimeoutTest::TearDown()
     abilityMs_->handler_->RemoveAllEvents();
     abilityMs_->currentMissionListManager_->terminateAbilityList_.clear();
     abilityMs_->currentMissionListManager_->launcherList_->missions_.clear();
+    abilityMs_->currentMissionListManager_->launcherList_->missionIdIndex_.clear();
+    abilityMs_->currentMissionListManager_->launcherList_->tokenIndex_.clear();
+    abilityMs_->currentMissionListManager_->launcherList_->missionIndexKeys_.clear();
     abilityMs_->currentMissionListManager_->defaultStandardList_->missions_.clear();
+    abilityMs_->currentMissionListManager_->defaultStandardList_->missionIdIndex_.clear();
+    abilityMs_->currentMissionListManager_->defaultStandardList_->tokenIndex_.clear();
+    abilityMs_->currentMissionListManager_->defaultStandardList_->missionIndexKeys_.clear();
     abilityMs_->currentMissionListManager_->defaultSingleList_->missions_.clear();
+    abilityMs_->currentMissionListManager_->defaultSingleList_->missionIdIndex_.clear();
+    abilityMs_->currentMissionListManager_->defaultSingleList_->tokenIndex_.clear();
+    abilityMs_->currentMissionListManager_->defaultSingleList_->missionIndexKeys_.clear();
     abilityMs_->currentMissionListManager_->currentMissionLists_.clear();
     abilityMs_->currentMissionListManager_->currentMissionLists_.push_front(
         abilityMs_->currentMissionListManager_->launcherList_);
@@ -0,0 +1,281 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fstream>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "mission_journal.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace AAFwk {
+namespace {
+const std::string TEST_DIR_TEMPLATE = "/data/local/tmp/mission_journal_XXXXXX";
+// magic, type, mission id, length and checksum.
+constexpr size_t RECORD_HEADER_SIZE = 20;
+constexpr int32_t MISSION_ID = 1;
+constexpr int32_t OTHER_MISSION_ID = 2;
+constexpr int32_t THIRD_MISSION_ID = 3;
+}
+
+class MissionJournalTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    std::string ReadFile(const std::string &name);
+    void WriteFile(const std::string &name, const std::string &data);
+    bool FileExists(const std::string &name);
+    std::map<int32_t, std::string> LoadMissions();
+
+    std::string dirPath_;
+};
+
+void MissionJournalTest::SetUpTestCase(void)
+{}
+void MissionJournalTest::TearDownTestCase(void)
+{}
+void MissionJournalTest::SetUp(void)
+{
+    dirPath_ = TEST_DIR_TEMPLATE;
+    ASSERT_NE(mkdtemp(&dirPath_[0]), nullptr);
+}
+void MissionJournalTest::TearDown(void)
+{
+    unlink((dirPath_ + "/" + MISSION_JOURNAL_FILE_NAME).c_str());
+    unlink((dirPath_ + "/" + MISSION_SNAPSHOT_FILE_NAME).c_str());
+    unlink((dirPath_ + "/" + MISSION_SNAPSHOT_FILE_NAME + ".tmp").c_str());
+    rmdir(dirPath_.c_str());
+}
+
+std::string MissionJournalTest::ReadFile(const std::string &name)
+{
+    std::ifstream stream(dirPath_ + "/" + name, std::ios::binary);
+    std::stringstream buffer;
+    buffer << stream.rdbuf();
+    return buffer.str();
+}
+
+void MissionJournalTest::WriteFile(const std::string &name, const std::string &data)
+{
+    std::ofstream stream(dirPath_ + "/" + name, std::ios::binary | std::ios::trunc);
+    stream << data;
+}
+
+bool MissionJournalTest::FileExists(const std::string &name)
+{
+    struct stat statBuf;
+    return stat((dirPath_ + "/" + name).c_str(), &statBuf) == 0;
+}
+
+std::map<int32_t, std::string> MissionJournalTest::LoadMissions()
+{
+    MissionJournal journal(dirPath_);
+    std::map<int32_t, std::string> missions;
+    EXPECT_TRUE(journal.Load());
+    journal.GetMissions(missions);
+    return missions;
+}
+
+/*
+ * @tc.number    : MissionJournal_0100
+ * @tc.name      : StageSave and Flush
+ * @tc.desc      : Saves of one mission staged before a flush are written as one record.
+ */
+HWTEST_F(MissionJournalTest, MissionJournal_0100, TestSize.Level1)
+{
+    MissionJournal journal(dirPath_);
+    EXPECT_TRUE(journal.Load());
+    EXPECT_FALSE(journal.HasFiles());
+    for (int i = 0; i < 100; i++) {
+        EXPECT_EQ(journal.StageSave(MISSION_ID, "label" + std::to_string(i)), 1U);
+    }
+    std::map<int32_t, std::string> missions;
+    journal.GetMissions(missions);
+    EXPECT_EQ(missions[MISSION_ID], "label99");
+
+    EXPECT_TRUE(journal.Flush());
+    EXPECT_TRUE(journal.HasFiles());
+    EXPECT_EQ(journal.GetJournalSize(), RECORD_HEADER_SIZE + std::string("label99").size());
+    EXPECT_EQ(ReadFile(MISSION_JOURNAL_FILE_NAME).size(), journal.GetJournalSize());
+    // nothing staged, nothing written.
+    EXPECT_TRUE(journal.Flush());
+    EXPECT_EQ(ReadFile(MISSION_JOURNAL_FILE_NAME).size(), journal.GetJournalSize());
+
+    missions = LoadMissions();
+    ASSERT_EQ(missions.size(), 1U);
+    EXPECT_EQ(missions[MISSION_ID], "label99");
+}
+
+/*
+ * @tc.number    : MissionJournal_0200
+ * @tc.name      : StageDelete
+ * @tc.desc      : A staged delete replaces the staged save and removes the mission when replayed.
+ */
+HWTEST_F(MissionJournalTest, MissionJournal_0200, TestSize.Level1)
+{
+    {
+        MissionJournal journal(dirPath_);
+        journal.StageSave(MISSION_ID, "first");
+        journal.StageSave(OTHER_MISSION_ID, "second");
+        EXPECT_TRUE(journal.Flush());
+        journal.StageSave(THIRD_MISSION_ID, "third");
+        EXPECT_EQ(journal.StageDelete(THIRD_MISSION_ID), 1U);
+        journal.StageDelete(MISSION_ID);
+        EXPECT_TRUE(journal.Flush());
+    }
+
+    auto missions = LoadMissions();
+    ASSERT_EQ(missions.size(), 1U);
+    EXPECT_EQ(missions[OTHER_MISSION_ID], "second");
+}
+
+/*
+ * @tc.number    : MissionJournal_0300
+ * @tc.name      : Load
+ * @tc.desc      : A record torn at the tail of the journal is dropped, and later records follow the last good one.
+ */
+HWTEST_F(MissionJournalTest, MissionJournal_0300, TestSize.Level1)
+{
+    size_t firstSize = 0;
+    {
+        MissionJournal journal(dirPath_);
+        journal.StageSave(MISSION_ID, "first");
+        EXPECT_TRUE(journal.Flush());
+        firstSize = journal.GetJournalSize();
+        journal.StageSave(OTHER_MISSION_ID, "second");
+        EXPECT_TRUE(journal.Flush());
+    }
+    // a crash in the middle of the second append.
+    std::string data = ReadFile(MISSION_JOURNAL_FILE_NAME);
+    WriteFile(MISSION_JOURNAL_FILE_NAME, data.substr(0, data.size() - 3));
+
+    {
+        MissionJournal journal(dirPath_);
+        EXPECT_TRUE(journal.Load());
+        EXPECT_EQ(journal.GetJournalSize(), firstSize);
+        EXPECT_EQ(ReadFile(MISSION_JOURNAL_FILE_NAME).size(), firstSize);
+        std::map<int32_t, std::string> missions;
+        journal.GetMissions(missions);
+        ASSERT_EQ(missions.size(), 1U);
+        EXPECT_EQ(missions[MISSION_ID], "first");
+
+        journal.StageSave(THIRD_MISSION_ID, "third");
+        EXPECT_TRUE(journal.Flush());
+    }
+
+    auto missions = LoadMissions();
+    ASSERT_EQ(missions.size(), 2U);
+    EXPECT_EQ(missions[MISSION_ID], "first");
+    EXPECT_EQ(missions[THIRD_MISSION_ID], "third");
+}
+
+/*
+ * @tc.number    : MissionJournal_0400
+ * @tc.name      : Load
+ * @tc.desc      : A record failing the checksum ends the replay, the records after it are dropped too.
+ */
+HWTEST_F(MissionJournalTest, MissionJournal_0400, TestSize.Level1)
+{
+    size_t firstSize = 0;
+    {
+        MissionJournal journal(dirPath_);
+        journal.StageSave(MISSION_ID, "first");
+        EXPECT_TRUE(journal.Flush());
+        firstSize = journal.GetJournalSize();
+        journal.StageSave(OTHER_MISSION_ID, "second");
+        EXPECT_TRUE(journal.Flush());
+        journal.StageSave(THIRD_MISSION_ID, "third");
+        EXPECT_TRUE(journal.Flush());
+    }
+    std::string data = ReadFile(MISSION_JOURNAL_FILE_NAME);
+    data[firstSize + RECORD_HEADER_SIZE] ^= 0x1;
+    WriteFile(MISSION_JOURNAL_FILE_NAME, data);
+
+    auto missions = LoadMissions();
+    ASSERT_EQ(missions.size(), 1U);
+    EXPECT_EQ(missions[MISSION_ID], "first");
+    EXPECT_EQ(ReadFile(MISSION_JOURNAL_FILE_NAME).size(), firstSize);
+}
+
+/*
+ * @tc.number    : MissionJournal_0500
+ * @tc.name      : Compact
+ * @tc.desc      : The journal is compacted into the snapshot once it grows past the compact size.
+ */
+HWTEST_F(MissionJournalTest, MissionJournal_0500, TestSize.Level1)
+{
+    constexpr size_t compactSize = 256;
+    {
+        MissionJournal journal(dirPath_, compactSize);
+        for (int i = 0; i < 20; i++) {
+            journal.StageSave(i % 4, "content" + std::to_string(i));
+            EXPECT_TRUE(journal.Flush());
+            EXPECT_LE(journal.GetJournalSize(), compactSize);
+        }
+        journal.StageDelete(0);
+        EXPECT_TRUE(journal.Flush());
+    }
+    EXPECT_TRUE(FileExists(MISSION_SNAPSHOT_FILE_NAME));
+
+    auto missions = LoadMissions();
+    ASSERT_EQ(missions.size(), 3U);
+    EXPECT_EQ(missions[1], "content17");
+    EXPECT_EQ(missions[2], "content18");
+    EXPECT_EQ(missions[3], "content19");
+}
+
+/*
+ * @tc.number    : MissionJournal_0600
+ * @tc.name      : Compact
+ * @tc.desc      : A crash during compaction leaves the same missions, before or after the snapshot is replaced.
+ */
+HWTEST_F(MissionJournalTest, MissionJournal_0600, TestSize.Level1)
+{
+    std::string journalData;
+    {
+        MissionJournal journal(dirPath_);
+        journal.StageSave(MISSION_ID, "first");
+        journal.StageSave(OTHER_MISSION_ID, "second");
+        EXPECT_TRUE(journal.Flush());
+        EXPECT_TRUE(journal.Compact());
+        EXPECT_EQ(journal.GetJournalSize(), 0U);
+        journal.StageSave(MISSION_ID, "updated");
+        journal.StageDelete(OTHER_MISSION_ID);
+        EXPECT_TRUE(journal.Flush());
+        journalData = ReadFile(MISSION_JOURNAL_FILE_NAME);
+        EXPECT_TRUE(journal.Compact());
+    }
+
+    // crashed after the snapshot was replaced, but before the journal was emptied.
+    WriteFile(MISSION_JOURNAL_FILE_NAME, journalData);
+    auto missions = LoadMissions();
+    ASSERT_EQ(missions.size(), 1U);
+    EXPECT_EQ(missions[MISSION_ID], "updated");
+
+    // crashed while the new snapshot was written.
+    WriteFile(MISSION_SNAPSHOT_FILE_NAME + ".tmp", "partial");
+    missions = LoadMissions();
+    ASSERT_EQ(missions.size(), 1U);
+    EXPECT_EQ(missions[MISSION_ID], "updated");
+    EXPECT_FALSE(FileExists(MISSION_SNAPSHOT_FILE_NAME + ".tmp"));
+}
+}  // namespace AAFwk
+}  // namespace OHOS
@@ -372,6 +372,71 @@ HWTEST_F(MissionListTest, mission_list_remove_ability_record_by_token_001, TestS
     EXPECT_EQ(nullptr, missionList->GetTopMission());
 }
 
+/*
+ * Feature: MissionList
+ * Function: GetMissionById and GetAbilityRecordByToken
+ * SubFunction: NA
+ * FunctionPoints: MissionList index of missions
+ * EnvConditions: NA
+ * CaseDescription: Verify the top mission is found by its new id right after the id is updated
+ */
+HWTEST_F(MissionListTest, mission_list_mission_index_001, TestSize.Level1)
+{
+    AppExecFwk::AbilityInfo abilityInfo;
+    Want want;
+    AppExecFwk::ApplicationInfo applicationInfo;
+    std::shared_ptr<AbilityRecord> abilityRecord = std::make_shared<AbilityRecord>(want, abilityInfo, applicationInfo);
+    abilityRecord->Init();
+    auto mission = std::make_shared<Mission>(1, abilityRecord, "name");
+
+    auto missionList = std::make_shared<MissionList>(MissionListType::CURRENT);
+    missionList->AddMissionToTop(mission);
+    EXPECT_TRUE(missionList->ContainsMission(mission));
+
+    EXPECT_TRUE(mission->UpdateMissionId(2, 1));
+    EXPECT_EQ(mission, missionList->GetMissionById(2));
+    EXPECT_EQ(nullptr, missionList->GetMissionById(1));
+    EXPECT_EQ(0, missionList->missionIdIndex_.count(1));
+    missionList->AddMissionToTop(mission);
+    EXPECT_EQ(mission, missionList->GetMissionById(2));
+
+    missionList->RemoveMission(mission);
+    EXPECT_FALSE(missionList->ContainsMission(mission));
+    EXPECT_EQ(nullptr, missionList->GetMissionById(2));
+    EXPECT_EQ(nullptr, missionList->GetAbilityRecordByToken(abilityRecord->GetToken()));
+}
+
+/*
+ * Feature: MissionList
+ * Function: GetMissionById
+ * SubFunction: NA
+ * FunctionPoints: MissionList index of missions
+ * EnvConditions: NA
+ * CaseDescription: Verify the other mission with the same id is found after the top one is removed
+ */
+HWTEST_F(MissionListTest, mission_list_mission_index_002, TestSize.Level1)
+{
+    AppExecFwk::AbilityInfo abilityInfo;
+    Want want;
+    AppExecFwk::ApplicationInfo applicationInfo;
+    std::shared_ptr<AbilityRecord> abilityRecord = std::make_shared<AbilityRecord>(want, abilityInfo, applicationInfo);
+    abilityRecord->Init();
+    auto mission = std::make_shared<Mission>(1, abilityRecord, "name");
+    std::shared_ptr<AbilityRecord> abilityRecord1 = std::make_shared<AbilityRecord>(want, abilityInfo, applicationInfo);
+    abilityRecord1->Init();
+    auto mission1 = std::make_shared<Mission>(1, abilityRecord1, "name");
+
+    auto missionList = std::make_shared<MissionList>(MissionListType::CURRENT);
+    missionList->AddMissionToTop(mission);
+    missionList->AddMissionToTop(mission1);
+    EXPECT_EQ(mission1, missionList->GetMissionById(1));
+
+    missionList->RemoveMissionByAbilityRecord(abilityRecord1);
+    EXPECT_EQ(mission, missionList->GetMissionById(1));
+    EXPECT_EQ(abilityRecord, missionList->GetAbilityRecordByToken(abilityRecord->GetToken()));
+    EXPECT_EQ(nullptr, missionList->GetAbilityRecordByToken(abilityRecord1->GetToken()));
+}
+
 /*
  * Feature: MissionList
  * Function: IsEmpty
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+#include <gtest/gtest.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "mission_snapshot_codec.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace AAFwk {
+namespace {
+const std::string TEST_DIR_TEMPLATE = "/data/local/tmp/mission_snapshot_XXXXXX";
+constexpr uint32_t BPP = 4;
+constexpr uint32_t WIDTH = 37;
+constexpr uint32_t HEIGHT = 23;
+// rows padded the way a pixel map may pad them.
+constexpr uint32_t ROW_BYTES = WIDTH * BPP + 12;
+}
+
+class MissionSnapshotCodecTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    static std::vector<uint8_t> MakePixels();
+    static bool SamePixels(const std::vector<uint8_t> &padded, const SnapshotImage &image);
+
+    std::string dirPath_;
+    std::string filePath_;
+};
+
+void MissionSnapshotCodecTest::SetUpTestCase(void)
+{}
+void MissionSnapshotCodecTest::TearDownTestCase(void)
+{}
+void MissionSnapshotCodecTest::SetUp(void)
+{
+    dirPath_ = TEST_DIR_TEMPLATE;
+    ASSERT_NE(mkdtemp(&dirPath_[0]), nullptr);
+    filePath_ = dirPath_ + "/mission_1.png";
+}
+void MissionSnapshotCodecTest::TearDown(void)
+{
+    unlink(filePath_.c_str());
+    rmdir(dirPath_.c_str());
+}
+
+std::vector<uint8_t> MissionSnapshotCodecTest::MakePixels()
+{
+    std::vector<uint8_t> pixels(ROW_BYTES * HEIGHT, 0);
+    for (uint32_t y = 0; y < HEIGHT; y++) {
+        for (uint32_t x = 0; x < WIDTH * BPP; x++) {
+            pixels[y * ROW_BYTES + x] = static_cast<uint8_t>(x * 7 + y * 13);
+        }
+    }
+    return pixels;
+}
+
+bool MissionSnapshotCodecTest::SamePixels(const std::vector<uint8_t> &padded, const SnapshotImage &image)
+{
+    if (image.width != WIDTH || image.height != HEIGHT || image.pixels.size() != WIDTH * HEIGHT * BPP) {
+        return false;
+    }
+    for (uint32_t y = 0; y < HEIGHT; y++) {
+        if (memcmp(&padded[y * ROW_BYTES], &image.pixels[y * WIDTH * BPP], WIDTH * BPP) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+ * @tc.number    : MissionSnapshotCodec_0100
+ * @tc.name      : Encode and Decode
+ * @tc.desc      : Snapshots written in either format are read back pixel for pixel, without the row padding.
+ */
+HWTEST_F(MissionSnapshotCodecTest, MissionSnapshotCodec_0100, TestSize.Level1)
+{
+    auto pixels = MakePixels();
+    for (auto codec : { SnapshotCodec::PNG, SnapshotCodec::RAW }) {
+        EXPECT_TRUE(MissionSnapshotCodec::Encode(filePath_, pixels.data(), WIDTH, HEIGHT, ROW_BYTES, codec));
+        SnapshotImage image;
+        EXPECT_TRUE(MissionSnapshotCodec::Decode(filePath_, image));
+        EXPECT_FALSE(image.isPrivate);
+        EXPECT_TRUE(SamePixels(pixels, image));
+    }
+    // nothing is left aside.
+    struct stat statBuf;
+    EXPECT_NE(stat((filePath_ + ".tmp").c_str(), &statBuf), 0);
+}
+
+/*
+ * @tc.number    : MissionSnapshotCodec_0200
+ * @tc.name      : EncodePlaceholder
+ * @tc.desc      : A private snapshot keeps its size only and is filled with the placeholder when read.
+ */
+HWTEST_F(MissionSnapshotCodecTest, MissionSnapshotCodec_0200, TestSize.Level1)
+{
+    EXPECT_TRUE(MissionSnapshotCodec::EncodePlaceholder(filePath_, WIDTH, HEIGHT));
+    struct stat statBuf;
+    ASSERT_EQ(stat(filePath_.c_str(), &statBuf), 0);
+    EXPECT_LT(statBuf.st_size, 64);
+
+    SnapshotImage image;
+    EXPECT_TRUE(MissionSnapshotCodec::Decode(filePath_, image));
+    EXPECT_TRUE(image.isPrivate);
+    EXPECT_EQ(image.width, WIDTH);
+    EXPECT_EQ(image.height, HEIGHT);
+    EXPECT_TRUE(image.pixels.empty());
+    MissionSnapshotCodec::FillPlaceholder(image);
+    EXPECT_EQ(image.pixels.size(), WIDTH * HEIGHT * BPP);
+    EXPECT_EQ(image.pixels.front(), 0xff);
+}
+
+/*
+ * @tc.number    : MissionSnapshotCodec_0300
+ * @tc.name      : Decode
+ * @tc.desc      : A truncated or unknown file fails to decode.
+ */
+HWTEST_F(MissionSnapshotCodecTest, MissionSnapshotCodec_0300, TestSize.Level1)
+{
+    auto pixels = MakePixels();
+    SnapshotImage image;
+    EXPECT_FALSE(MissionSnapshotCodec::Decode(filePath_, image));
+    for (auto codec : { SnapshotCodec::PNG, SnapshotCodec::RAW }) {
+        EXPECT_TRUE(MissionSnapshotCodec::Encode(filePath_, pixels.data(), WIDTH, HEIGHT, ROW_BYTES, codec));
+        struct stat statBuf;
+        ASSERT_EQ(stat(filePath_.c_str(), &statBuf), 0);
+        ASSERT_EQ(truncate(filePath_.c_str(), statBuf.st_size / 2), 0);
+        EXPECT_FALSE(MissionSnapshotCodec::Decode(filePath_, image));
+    }
+    FILE *file = fopen(filePath_.c_str(), "w");
+    ASSERT_NE(file, nullptr);
+    fputs("not a snapshot", file);
+    fclose(file);
+    EXPECT_FALSE(MissionSnapshotCodec::Decode(filePath_, image));
+}
+
+/*
+ * @tc.number    : MissionSnapshotCodec_0400
+ * @tc.name      : Downscale
+ * @tc.desc      : Every pixel of the thumbnail is the average of its block, partial blocks at the edges included.
+ */
+HWTEST_F(MissionSnapshotCodecTest, MissionSnapshotCodec_0400, TestSize.Level1)
+{
+    constexpr uint32_t factor = 4;
+    auto pixels = MakePixels();
+    SnapshotImage image;
+    MissionSnapshotCodec::Downscale(pixels.data(), WIDTH, HEIGHT, ROW_BYTES, factor, image);
+    EXPECT_EQ(image.width, WIDTH / factor);
+    EXPECT_EQ(image.height, HEIGHT / factor);
+    ASSERT_EQ(image.pixels.size(), image.width * image.height * BPP);
+
+    for (uint32_t y = 0; y < image.height; y++) {
+        for (uint32_t x = 0; x < image.width; x++) {
+            for (uint32_t channel = 0; channel < BPP; channel++) {
+                uint32_t sum = 0;
+                for (uint32_t row = 0; row < factor; row++) {
+                    for (uint32_t column = 0; column < factor; column++) {
+                        sum += pixels[(y * factor + row) * ROW_BYTES + (x * factor + column) * BPP + channel];
+                    }
+                }
+                EXPECT_EQ(image.pixels[(y * image.width + x) * BPP + channel], sum / (factor * factor));
+            }
+        }
+    }
+
+    // an image smaller than a block still gives one pixel.
+    MissionSnapshotCodec::Downscale(pixels.data(), 2, 2, ROW_BYTES, factor, image);
+    EXPECT_EQ(image.width, 1U);
+    EXPECT_EQ(image.height, 1U);
+    EXPECT_EQ(image.pixels[0], (pixels[0] + pixels[BPP] + pixels[ROW_BYTES] + pixels[ROW_BYTES + BPP]) / 4);
+}
+}  // namespace AAFwk
+}  // namespace OHOS
@@ -1042,5 +1042,56 @@ HWTEST_F(PendingWantManagerTest, PendingWantManagerTest_4100, TestSize.Level1)
         nullptr, -1, callerUid);
     EXPECT_NE(ERR_OK, result);
 }
+
+/*
+ * @tc.number    : PendingWantManagerTest_4200
+ * @tc.name      : PendingWantManager GetWantSenderLocked
+ * @tc.desc      : 1.Records updated with UPDATE_PRESENT_FLAG can still be found by key and by code.
+ */
+HWTEST_F(PendingWantManagerTest, PendingWantManagerTest_4200, TestSize.Level1)
+{
+    Want want;
+    ElementName element("device", "bundleName", "abilityName");
+    want.SetElement(element);
+    WantSenderInfo wantSenderInfo = MakeWantSenderInfo(want, 0, 0);
+    pendingManager_ = std::make_shared<PendingWantManager>();
+    EXPECT_NE(pendingManager_, nullptr);
+    auto pendingRecord = iface_cast<PendingWantRecord>(
+        pendingManager_->GetWantSenderLocked(1, 1, wantSenderInfo.userId, wantSenderInfo, nullptr)->AsObject());
+    EXPECT_NE(pendingRecord, nullptr);
+    WantSenderInfo updateInfo = MakeWantSenderInfo(want, (int32_t)Flags::UPDATE_PRESENT_FLAG, 0);
+    auto updateRecord = iface_cast<PendingWantRecord>(
+        pendingManager_->GetWantSenderLocked(1, 1, updateInfo.userId, updateInfo, nullptr)->AsObject());
+    EXPECT_EQ(pendingRecord, updateRecord);
+    EXPECT_EQ((int)pendingManager_->wantRecords_.size(), 1);
+    EXPECT_EQ((int)pendingManager_->hashIndex_.size(), 1);
+    EXPECT_EQ(pendingManager_->GetPendingWantRecordByKey(pendingRecord->GetKey()), pendingRecord);
+    EXPECT_EQ(pendingManager_->GetPendingWantRecordByCode(pendingRecord->GetKey()->GetCode()), pendingRecord);
+}
+
+/*
+ * @tc.number    : PendingWantManagerTest_4300
+ * @tc.name      : PendingWantManager CancelWantSenderLocked
+ * @tc.desc      : 1.Canceled records are removed from every index.
+ */
+HWTEST_F(PendingWantManagerTest, PendingWantManagerTest_4300, TestSize.Level1)
+{
+    Want want;
+    ElementName element("device", "bundleName", "abilityName");
+    want.SetElement(element);
+    WantSenderInfo wantSenderInfo = MakeWantSenderInfo(want, 0, 0);
+    pendingManager_ = std::make_shared<PendingWantManager>();
+    EXPECT_NE(pendingManager_, nullptr);
+    auto pendingRecord = iface_cast<PendingWantRecord>(
+        pendingManager_->GetWantSenderLocked(1, 1, wantSenderInfo.userId, wantSenderInfo, nullptr)->AsObject());
+    EXPECT_NE(pendingRecord, nullptr);
+    int32_t code = pendingRecord->GetKey()->GetCode();
+    pendingManager_->CancelWantSenderLocked(*pendingRecord, true);
+    EXPECT_EQ((int)pendingManager_->wantRecords_.size(), 0);
+    EXPECT_EQ((int)pendingManager_->hashIndex_.size(), 0);
+    EXPECT_EQ((int)pendingManager_->codeIndex_.size(), 0);
+    EXPECT_EQ(pendingManager_->GetPendingWantRecordByKey(pendingRecord->GetKey()), nullptr);
+    EXPECT_EQ(pendingManager_->GetPendingWantRecordByCode(code), nullptr);
+}
 }  // namespace AAFwk
 }  // namespace OHOS
@@ -38,6 +38,7 @@
 #include "app_process_manager.h"
 #include "remote_client_manager.h"
 #include "app_running_manager.h"
+#include "process_exit_watcher.h"
 #include "record_query_result.h"
 #include "running_process_info.h"
 #include "bundle_info.h"
@@ -198,7 +199,9 @@ public:
      *
      * @param  bundleName, bundle name in Application record.
      *
-     * @return ERR_OK, return back success, others fail.
+     * @return ERR_OK, return back success, others fail. The processes are asked to exit and the ones
+     *         still alive at the exit timeout are killed later, so ERR_OK is returned before they
+     *         are gone, and even when killing them fails.
      */
     virtual int32_t KillApplication(const std::string &bundleName);
 
@@ -207,7 +210,9 @@ public:
      *
      * @param  bundleName, bundle name in Application record.
      * @param  uid, uid.
-     * @return ERR_OK, return back success, others fail.
+     * @return ERR_OK, return back success, others fail. The processes are asked to exit and the ones
+     *         still alive at the exit timeout are killed later, so ERR_OK is returned before they
+     *         are gone, and even when killing them fails.
      */
     virtual int32_t KillApplicationByUid(const std::string &bundleName, const int uid);
 
@@ -217,7 +222,9 @@ public:
      * @param bundleName, bundle name in Application record.
      * @param userId, user ID.
      *
-     * @return ERR_OK, return back success, others fail.
+     * @return ERR_OK, return back success, others fail. The processes are asked to exit and the ones
+     *         still alive at the exit timeout are killed later, so ERR_OK is returned before they
+     *         are gone, and even when killing them fails.
      */
     virtual int32_t KillApplicationByUserId(const std::string &bundleName, const int userId);
 
@@ -512,7 +519,8 @@ public:
     void ClearAppRunningData(const std::shared_ptr<AppRunningRecord> &appRecord, bool containsApp);
 private:
 
-    void StartEmptyResidentProcess(const BundleInfo &info, const std::string &processName, int restartCount);
+    std::shared_ptr<AppRunningRecord> CreateResidentProcessRecord(
+        const BundleInfo &info, const std::string &processName, int restartCount);
 
     void RestartResidentProcess(std::shared_ptr<AppRunningRecord> appRecord);
 
@@ -553,6 +561,21 @@ private:
     void StartProcess(const std::string &appName, const std::string &processName, uint32_t startFlags,
         const std::shared_ptr<AppRunningRecord> &appRecord, const int uid, const std::string &bundleName);
 
+    /**
+     * StartProcesses, start new boot processes for a batch of app records, the spawn requests are pipelined.
+     *
+     * @param appRecords, the app records, their processes are not started yet.
+     * @param startMsgs, the spawn request of each app record, built by CreateStartMsg.
+     */
+    void StartProcesses(const std::vector<std::shared_ptr<AppRunningRecord>> &appRecords,
+        const std::vector<AppSpawnStartMsg> &startMsgs);
+
+    bool CreateStartMsg(const std::string &processName, uint32_t startFlags, const int uid,
+        const std::string &bundleName, AppSpawnStartMsg &startMsg);
+
+    void OnProcessSpawned(const std::string &appName, const std::shared_ptr<AppRunningRecord> &appRecord,
+        const AppSpawnStartMsg &startMsg, ErrCode errCode, pid_t pid);
+
     /**
      * PushAppFront, Adjust the latest application record to the top level.
      *
@@ -613,14 +636,16 @@ private:
     int32_t KillProcessByPid(const pid_t pid) const;
 
     /**
-     * WaitForRemoteProcessExit, Wait for the process to exit normally.
+     * KillProcessesOnExitTimeout, Wait for the processes to exit normally without blocking the caller, and
+     * kill the processes still alive when the exit timeout counted from startTime hits.
      *
      * @param pids, process number collection to exit.
      * @param startTime, execution process security exit start time.
-     *
-     * @return true, return back success，others fail.
+     * @param task, run on the event handler once the processes are gone, may be nullptr. It may outlive this
+     *             service, so it must only hold what it uses, never this.
      */
-    bool WaitForRemoteProcessExit(std::list<pid_t> &pids, const int64_t startTime);
+    void KillProcessesOnExitTimeout(
+        const std::list<pid_t> &pids, const int64_t startTime, const std::function<void()> &task = nullptr);
 
     /**
      * GetAllPids, Get the corresponding pid collection.
@@ -631,24 +656,6 @@ private:
      */
     bool GetAllPids(std::list<pid_t> &pids);
 
-    /**
-     * process_exist, Judge whether the process exists.
-     *
-     * @param pids, process number collection to exit.
-     *
-     * @return true, return back existed，others non-existent.
-     */
-    bool process_exist(pid_t &pid);
-
-    /**
-     * CheckAllProcessExist, Determine whether all processes exist .
-     *
-     * @param pids, process number collection to exit.
-     *
-     * @return true, Returns that a process exists and all other processes do not exist.
-     */
-    bool CheckAllProcessExist(std::list<pid_t> &pids);
-
     /**
      * SystemTimeMillis, Get system time.
      *
@@ -711,7 +718,7 @@ private:
      *
      * @return
      */
-    void NotifyAppStatus(const std::string &bundleName, const std::string &eventData);
+    static void NotifyAppStatus(const std::string &bundleName, const std::string &eventData);
     /**
      * Notify application status.
      *
@@ -734,6 +741,7 @@ private:
     std::shared_ptr<AppRunningManager> appRunningManager_;
     std::shared_ptr<AMSEventHandler> eventHandler_;
     std::shared_ptr<Configuration> configuration_;
+    std::shared_ptr<ProcessExitWatcher> processExitWatcher_;
     std::mutex userTestLock_;
     sptr<IStartSpecifiedAbilityResponse> startSpecifiedAbilityResponse_;
 };
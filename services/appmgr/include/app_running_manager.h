@@ -19,6 +19,8 @@
 #include <map>
 #include <mutex>
 #include <regex>
+#include <set>
+#include <unordered_map>
 
 #include "iremote_object.h"
 #include "refbase.h"
@@ -73,6 +75,14 @@ public:
      */
     std::shared_ptr<AppRunningRecord> GetAppRunningRecordByPid(const pid_t pid);
 
+    /**
+     * SetAppRunningRecordPid, Set the pid of a process record, so it can be found by the pid.
+     *
+     * @param appRecord, the process record.
+     * @param pid, the application pid.
+     */
+    void SetAppRunningRecordPid(const std::shared_ptr<AppRunningRecord> &appRecord, const pid_t pid);
+
     /**
      * GetAppRunningRecordByAbilityToken, Get process record by ability token.
      *
@@ -149,13 +159,32 @@ public:
     void HandleAddAbilityStageTimeOut(const int64_t eventId);
     void HandleStartSpecifiedAbilityTimeOut(const int64_t eventId);
     std::shared_ptr<AppRunningRecord> GetAppRunningRecordByRenderPid(const pid_t pid);
+    void SetAppRunningRecordRender(const std::shared_ptr<AppRunningRecord> &appRecord,
+        const std::shared_ptr<RenderRecord> &renderRecord);
     void OnRemoteRenderDied(const wptr<IRemoteObject> &remote);
 private:
     std::shared_ptr<AbilityRunningRecord> GetAbilityRunningRecord(const int64_t eventId);
 
+    /**
+     * GetSignCode, Get the sign code clipped from the appId of a bundle, it is computed once per appId.
+     */
+    std::string GetSignCode(const std::string &appId);
+
+    void RemoveRecordIndex(const std::shared_ptr<AppRunningRecord> &appRecord);
+
 private:
+    static constexpr size_t SIGN_CODE_CACHE_SIZE = 256;
+
     std::map<const int32_t, const std::shared_ptr<AppRunningRecord>> appRunningRecordMap_;
     std::map<const std::string, int> processRestartRecord_;
+    // process name -> record ids, the process name of a record never changes.
+    std::unordered_map<std::string, std::set<int32_t>> processNameIndex_;
+    // pid and render pid -> record id, kept by SetAppRunningRecordPid and SetAppRunningRecordRender.
+    std::unordered_map<pid_t, int32_t> pidIndex_;
+    std::unordered_map<pid_t, int32_t> renderPidIndex_;
+    // ability token -> record id, kept by the records as their abilities are added and removed.
+    std::shared_ptr<AbilityTokenIndex> tokenIndex_;
+    std::unordered_map<std::string, std::string> signCodeCache_;
     std::recursive_mutex lock_;
 };
 }  // namespace AppExecFwk
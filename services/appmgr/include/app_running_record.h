@@ -19,7 +19,9 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include "iremote_object.h"
 #include "irender_scheduler.h"
 #include "ability_running_record.h"
@@ -82,6 +84,23 @@ private:
     sptr<AppDeathRecipient> deathRecipient_ = nullptr;
 };
 
+/**
+ * @class AbilityTokenIndex
+ * Ability token -> app running record id, kept up to date by the records as their abilities are added and removed.
+ */
+class AbilityTokenIndex {
+public:
+    void Add(const sptr<IRemoteObject> &token, const int32_t recordId);
+    void Remove(const sptr<IRemoteObject> &token, const int32_t recordId);
+    void RemoveRecord(const int32_t recordId);
+    bool Find(const sptr<IRemoteObject> &token, int32_t &recordId);
+    void Clear();
+
+private:
+    std::mutex lock_;
+    std::unordered_map<IRemoteObject *, int32_t> tokens_;
+};
+
 class AppRunningRecord : public std::enable_shared_from_this<AppRunningRecord> {
 public:
     static int64_t appEventId_;
@@ -401,6 +420,13 @@ public:
      */
     void SetAppMgrServiceInner(const std::weak_ptr<AppMgrServiceInner> &inner);
 
+    /**
+     * @brief Setting the index the tokens of the abilities of this record are added to and removed from.
+     *
+     * @param index, the ability token index of the app running manager.
+     */
+    void SetAbilityTokenIndex(const std::shared_ptr<AbilityTokenIndex> &index);
+
     /**
      * @brief Setting application death recipient.
      *
@@ -557,6 +583,7 @@ private:
     int64_t eventId_ = 0;
     std::list<const sptr<IRemoteObject>> foregroundingAbilityTokens_;
     std::weak_ptr<AppMgrServiceInner> appMgrServiceInner_;
+    std::shared_ptr<AbilityTokenIndex> abilityTokenIndex_ = nullptr;
     sptr<AppDeathRecipient> appDeathRecipient_ = nullptr;
     std::shared_ptr<PriorityObject> priorityObject_ = nullptr;
     std::shared_ptr<AppLifeCycleDeal> appLifeCycleDeal_ = nullptr;
@@ -16,6 +16,9 @@
 #ifndef FOUNDATION_APPEXECFWK_SERVICES_APPMGR_INCLUDE_APP_SPAWN_CLIENT_H
 #define FOUNDATION_APPEXECFWK_SERVICES_APPMGR_INCLUDE_APP_SPAWN_CLIENT_H
 
+#include <functional>
+#include <vector>
+
 #include "nocopyable.h"
 #include "app_spawn_msg_wrapper.h"
 #include "app_spawn_socket.h"
@@ -26,6 +29,9 @@ enum class SpawnConnectionState { STATE_NOT_CONNECT, STATE_CONNECTED, STATE_CONN
 
 class AppSpawnClient {
 public:
+    using SocketFactory = std::function<std::shared_ptr<AppSpawnSocket>()>;
+    using StartProcessCallback = std::function<void(size_t index, ErrCode errCode, pid_t pid)>;
+
     /**
      * Constructor.
      */
@@ -59,6 +65,17 @@ public:
      */
     virtual ErrCode StartProcess(const AppSpawnStartMsg &startMsg, pid_t &pid);
 
+    /**
+     * Start a batch of processes, keeping up to MAX_PIPELINE_REQUESTS requests in flight on their own
+     * connections instead of waiting for each pid before sending the next request.
+     * A request that can't be sent is retried through StartProcess. A request sent but with no pid read back
+     * fails, it is not sent again as appspawn may have forked for it already.
+     *
+     * @param startMsgs, request messages.
+     * @param callback, called once per message, in order, with the index of the message and its result.
+     */
+    virtual void StartProcesses(const std::vector<AppSpawnStartMsg> &startMsgs, const StartProcessCallback &callback);
+
     /**
      * Get render process termination status.
      *
@@ -77,6 +94,12 @@ public:
      */
     void SetSocket(const std::shared_ptr<AppSpawnSocket> socket);
 
+    /**
+     * Set the factory of the sockets used by StartProcesses, unit test also use it.
+     * Without a factory the batch is started one by one through StartProcess.
+     */
+    void SetSocketFactory(const SocketFactory &factory);
+
 private:
     /**
      * AppSpawnClient core function,
@@ -86,8 +109,21 @@ private:
      */
     ErrCode StartProcessImpl(const AppSpawnStartMsg &startMsg, pid_t &pid);
 
+    /**
+     * Open a new connection from the socket factory and send the request on it, without waiting for the pid.
+     */
+    ErrCode SendStartMsg(const AppSpawnStartMsg &startMsg, std::shared_ptr<AppSpawnSocket> &socket);
+
+    /**
+     * Read the pid replied on a connection opened by SendStartMsg.
+     */
+    ErrCode ReadPid(const std::shared_ptr<AppSpawnSocket> &socket, pid_t &pid);
+
 private:
+    static constexpr size_t MAX_PIPELINE_REQUESTS = 8;
+
     std::shared_ptr<AppSpawnSocket> socket_;
+    SocketFactory socketFactory_;
     SpawnConnectionState state_ = SpawnConnectionState::STATE_NOT_CONNECT;
 };
 }  // namespace AppExecFwk
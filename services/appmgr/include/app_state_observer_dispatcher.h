@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_APP_STATE_OBSERVER_DISPATCHER_H
+#define OHOS_APP_STATE_OBSERVER_DISPATCHER_H
+
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "ability_state_data.h"
+#include "app_state_data.h"
+#include "event_handler.h"
+#include "iapplication_state_observer.h"
+#include "process_data.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+enum class ObserverEventType {
+    FOREGROUND_APPLICATION_CHANGED,
+    APPLICATION_STATE_CHANGED,
+    ABILITY_STATE_CHANGED,
+    EXTENSION_STATE_CHANGED,
+    PROCESS_CREATED,
+    PROCESS_DIED,
+};
+
+/**
+ * @struct ObserverEvent
+ * ObserverEvent is one notification, shared by the queues of all observers. Only the data of its type is set.
+ */
+struct ObserverEvent {
+    ObserverEventType type = ObserverEventType::PROCESS_CREATED;
+    AppStateData appStateData;
+    AbilityStateData abilityStateData;
+    ProcessData processData;
+};
+
+/**
+ * @struct ObserverStats
+ * ObserverStats counts what happened to the notifications of one observer, latencies are in milliseconds.
+ */
+struct ObserverStats {
+    uint64_t delivered = 0;
+    uint64_t coalesced = 0;
+    uint64_t dropped = 0;
+    int64_t maxLatency = 0;
+    int64_t totalLatency = 0;
+    size_t pending = 0;
+};
+
+/**
+ * @class AppStateObserverDispatcher
+ * AppStateObserverDispatcher delivers notifications to every observer through a bounded queue of its own.
+ * The queues with notifications pending are drained in turn by a small pool of delivery threads, a queue by
+ * one thread at a time, so a slow or hung observer holds one thread and delays nobody but itself.
+ * A pending state change is replaced by a newer one of the same app or ability; once a queue is full the
+ * oldest state change, or else the oldest notification, is dropped. Process and app lifecycle notifications
+ * are never replaced.
+ */
+class AppStateObserverDispatcher : public std::enable_shared_from_this<AppStateObserverDispatcher> {
+public:
+    /**
+     * @param watchdogHandler, the handler the slow observer watchdog runs on, none if nullptr.
+     */
+    AppStateObserverDispatcher(const std::shared_ptr<EventHandler> &watchdogHandler,
+        size_t workerCount = DEFAULT_WORKER_COUNT, size_t queueCapacity = DEFAULT_QUEUE_CAPACITY);
+    ~AppStateObserverDispatcher() = default;
+
+    void AddObserver(const sptr<IApplicationStateObserver> &observer);
+    void RemoveObserver(const sptr<IApplicationStateObserver> &observer);
+
+    /**
+     * Dispatch, queue the event for every observer.
+     */
+    void Dispatch(const std::shared_ptr<ObserverEvent> &event);
+
+    /**
+     * GetStats, get the counters of one observer.
+     *
+     * @return false if the observer is not added.
+     */
+    bool GetStats(const sptr<IApplicationStateObserver> &observer, ObserverStats &stats);
+
+    /**
+     * CheckSlowObservers, report the observers stuck in a callback or far behind, with their latencies.
+     */
+    void CheckSlowObservers();
+
+    static constexpr size_t DEFAULT_WORKER_COUNT = 4;
+    static constexpr size_t DEFAULT_QUEUE_CAPACITY = 128;
+
+private:
+    struct ObserverQueue {
+        sptr<IApplicationStateObserver> observer;
+        std::deque<std::shared_ptr<ObserverEvent>> events;
+        ObserverStats stats;
+        // whether the queue is in the ready list or being drained.
+        bool draining = false;
+        bool removed = false;
+        // when the callback in progress was called, 0 if none.
+        int64_t deliveryStart = 0;
+    };
+
+    void Enqueue(const std::shared_ptr<ObserverQueue> &queue, const std::shared_ptr<ObserverEvent> &event);
+    void StartDrain(const std::shared_ptr<ObserverQueue> &queue);
+    void RunWorker(size_t worker);
+    void Drain(const std::shared_ptr<ObserverQueue> &queue);
+    void Deliver(const sptr<IApplicationStateObserver> &observer, const ObserverEvent &event);
+    void ArmWatchdog();
+    static int64_t NowMillis();
+
+    std::shared_ptr<EventHandler> watchdogHandler_;
+    std::vector<std::shared_ptr<EventHandler>> workers_;
+    // whether each worker is draining the ready queues.
+    std::vector<bool> workerRunning_;
+    // the queues with notifications pending, in the order they became ready.
+    std::deque<std::shared_ptr<ObserverQueue>> readyQueues_;
+    size_t queueCapacity_;
+    bool watchdogArmed_ = false;
+    std::mutex queueLock_;
+    std::map<sptr<IRemoteObject>, std::shared_ptr<ObserverQueue>> queues_;
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif  // OHOS_APP_STATE_OBSERVER_DISPATCHER_H
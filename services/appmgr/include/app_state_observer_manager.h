@@ -22,6 +22,7 @@
 #include <vector>
 
 #include "app_running_record.h"
+#include "app_state_observer_dispatcher.h"
 #include "app_state_data.h"
 #include "iapp_state_callback.h"
 #include "iapplication_state_observer.h"
@@ -47,6 +48,7 @@ private:
     void HandleStateChangedNotifyObserver(const AbilityStateData abilityStateData, bool isAbility);
     void HandleOnProcessCreated(const std::shared_ptr<AppRunningRecord> &appRecord);
     void HandleOnProcessDied(const std::shared_ptr<AppRunningRecord> &appRecord);
+    void Dispatch(const std::shared_ptr<ObserverEvent> &event);
     bool ObserverExist(const sptr<IApplicationStateObserver> &observer);
     void AddObserverDeathRecipient(const sptr<IApplicationStateObserver> &observer);
     void RemoveObserverDeathRecipient(const sptr<IApplicationStateObserver> &observer);
@@ -58,6 +60,8 @@ private:
 
 private:
     std::shared_ptr<AppExecFwk::EventHandler> handler_;
+    // delivers the notifications to the observers, off the handler and the observer lock.
+    std::shared_ptr<AppStateObserverDispatcher> dispatcher_;
     std::vector<sptr<IApplicationStateObserver>> appStateObservers_;
     std::recursive_mutex observerLock_;
     std::map<sptr<IRemoteObject>, sptr<IRemoteObject::DeathRecipient>> recipientMap_;
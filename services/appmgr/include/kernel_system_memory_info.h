@@ -15,7 +15,8 @@
 #ifndef FOUNDATION_APPEXECFWK_SERVICES_KERNEL_SYSTEM_MEMORY_INFO_H
 #define FOUNDATION_APPEXECFWK_SERVICES_KERNEL_SYSTEM_MEMORY_INFO_H
 
-#include <map>
+#include <cstdint>
+#include <string_view>
 
 namespace OHOS {
 namespace AppExecFwk {
@@ -25,7 +26,19 @@ public:
     KernelSystemMemoryInfo() = default;
     ~KernelSystemMemoryInfo() = default;
 
-    void Init(std::map<std::string, std::string> &memInfo);
+    /**
+     * Parses the content of /proc/meminfo, the sizes are kept in bytes.
+     *
+     * @return true if all of the fields are found.
+     */
+    bool ParseMemInfo(std::string_view content);
+
+    /**
+     * Parses the content of /proc/pressure/memory.
+     *
+     * @return true if both the some and the full lines are found.
+     */
+    bool ParsePressure(std::string_view content);
 
     int64_t GetMemTotal() const;
     int64_t GetMemFree() const;
@@ -34,13 +47,37 @@ public:
     int64_t GetCached() const;
     int64_t GetSwapCached() const;
 
+    // memory pressure stall information, only valid if HasPressure returns true.
+    bool HasPressure() const;
+    double GetPressureSomeAvg10() const;
+    double GetPressureSomeAvg60() const;
+    double GetPressureSomeAvg300() const;
+    uint64_t GetPressureSomeTotal() const;
+    double GetPressureFullAvg10() const;
+    double GetPressureFullAvg60() const;
+    double GetPressureFullAvg300() const;
+    uint64_t GetPressureFullTotal() const;
+
 private:
+    struct PressureInfo {
+        double avg10 = 0;
+        double avg60 = 0;
+        double avg300 = 0;
+        // total stall time in microseconds.
+        uint64_t total = 0;
+    };
+
+    static bool ParsePressureLine(std::string_view line, PressureInfo &info);
+
     int64_t memTotal_ = 0;
     int64_t memFree_ = 0;
     int64_t memAvailable_ = 0;
     int64_t buffers_ = 0;
     int64_t cached_ = 0;
     int64_t swapCached_ = 0;
+    bool hasPressure_ = false;
+    PressureInfo pressureSome_;
+    PressureInfo pressureFull_;
 };
 }  // namespace SystemEnv
 }  // namespace AppExecFwk
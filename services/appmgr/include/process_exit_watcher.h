@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_SERVICES_APPMGR_INCLUDE_PROCESS_EXIT_WATCHER_H
+#define FOUNDATION_APPEXECFWK_SERVICES_APPMGR_INCLUDE_PROCESS_EXIT_WATCHER_H
+
+#include <functional>
+#include <list>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <unistd.h>
+
+namespace OHOS {
+namespace AppExecFwk {
+/**
+ * @class ProcessExitWatcher
+ * ProcessExitWatcher waits on its own thread for groups of processes to exit, so that the caller does not
+ * block until they are gone. Every process is watched through a pidfd in an epoll set, processes which can
+ * not be opened as pidfd are checked in /proc on a short interval, and exits reported by the owner through
+ * NotifyProcessExit are taken as they come.
+ */
+class ProcessExitWatcher {
+public:
+    /**
+     * Called once for every watch, with the pids still alive when the watch ends. The list is empty when
+     * all the processes have exited before the deadline.
+     */
+    using ExitCallback = std::function<void(const std::list<pid_t> &alivePids)>;
+
+    /**
+     * @param usePidfd, false to check every process in /proc instead of through a pidfd.
+     */
+    explicit ProcessExitWatcher(bool usePidfd = true);
+    virtual ~ProcessExitWatcher();
+
+    /**
+     * Start, start the watcher thread.
+     *
+     * @return true if the thread is running.
+     */
+    bool Start();
+
+    /**
+     * Stop, stop the watcher thread, the pending watches end with the pids still alive.
+     */
+    void Stop();
+
+    /**
+     * Watch, wait for the processes to exit without blocking the caller.
+     *
+     * @param pids, the processes to wait for.
+     * @param timeoutMs, how long to wait for the processes, in milliseconds.
+     * @param callback, called on the watcher thread when the watch ends, or on the calling thread if no
+     *                  process is alive already.
+     */
+    void Watch(const std::list<pid_t> &pids, int64_t timeoutMs, const ExitCallback &callback);
+
+    /**
+     * NotifyProcessExit, report the exit of a process learned elsewhere, such as from its death recipient.
+     *
+     * @param pid, the process which has exited.
+     */
+    void NotifyProcessExit(pid_t pid);
+
+    /**
+     * GetWatchCount, get the count of pending watches.
+     *
+     * @return the count of pending watches.
+     */
+    size_t GetWatchCount();
+
+private:
+    struct WatchRequest {
+        std::set<pid_t> pids;
+        int64_t deadline = 0;
+        ExitCallback callback;
+    };
+
+    struct WatchedProcess {
+        // -1 when the process is checked in /proc.
+        int pidfd = -1;
+        // the count of watches waiting for the process.
+        int refCount = 0;
+    };
+
+    using CompletedWatch = std::pair<ExitCallback, std::list<pid_t>>;
+
+    void Run();
+    void Wakeup();
+    bool AddProcess(pid_t pid);
+    void ReleaseProcess(pid_t pid);
+    void OnProcessExit(pid_t pid);
+    void CheckPolledProcesses();
+    void CollectCompletedWatches(int64_t now, std::list<CompletedWatch> &completed);
+    int GetWaitTimeout(int64_t now);
+    static bool IsProcessAlive(pid_t pid);
+    static int64_t NowMillis();
+
+    bool usePidfd_ = true;
+    bool running_ = false;
+    int epollFd_ = -1;
+    int eventFd_ = -1;
+    std::thread thread_;
+    std::mutex mutex_;
+    std::list<WatchRequest> requests_;
+    std::map<pid_t, WatchedProcess> processes_;
+    // the processes checked in /proc, either pidfd is not supported or could not be opened.
+    size_t polledCount_ = 0;
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif  // FOUNDATION_APPEXECFWK_SERVICES_APPMGR_INCLUDE_PROCESS_EXIT_WATCHER_H
@@ -15,12 +15,26 @@
 #ifndef FOUNDATION_APPEXECFWK_SERVICES_SYSTEM_ENVIRONMENT_INFORMATION_H
 #define FOUNDATION_APPEXECFWK_SERVICES_SYSTEM_ENVIRONMENT_INFORMATION_H
 
+#include <string>
+
 #include "kernel_system_memory_info.h"
 
 namespace OHOS {
 namespace AppExecFwk {
 namespace SystemEnv {
+/**
+ * Obtains the system memory information from a snapshot shared by all callers, the snapshot is read again
+ * from /proc once it is older than a short time.
+ */
 void GetMemInfo(KernelSystemMemoryInfo &memInfo);
+
+/**
+ * Reads the system memory information from meminfo and pressure/memory under procRoot, without the snapshot.
+ *
+ * @param procRoot, the directory procfs is mounted on, such as "/proc".
+ * @return true if meminfo is read, the pressure information is optional.
+ */
+bool ReadMemInfo(const std::string &procRoot, KernelSystemMemoryInfo &memInfo);
 }  // namespace SystemEnv
 }  // namespace AppExecFwk
 }  // namespace OHOS
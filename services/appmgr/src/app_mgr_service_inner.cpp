@@ -16,8 +16,6 @@
 #include "app_mgr_service_inner.h"
 
 #include <csignal>
-#include <securec.h>
-#include <sys/stat.h>
 #include <unistd.h>
 
 #include "accesstoken_kit.h"
@@ -63,8 +61,6 @@ constexpr int64_t NANOSECONDS = 1000000000;
 constexpr int64_t MICROSECONDS = 1000000;
 // Kill process timeout setting
 constexpr int KILL_PROCESS_TIMEOUT_MICRO_SECONDS = 1000;
-// Kill process delaytime setting
-constexpr int KILL_PROCESS_DELAYTIME_MICRO_SECONDS = 200;
 const std::string CLASS_NAME = "ohos.app.MainThread";
 const std::string FUNC_NAME = "main";
 const std::string SO_PATH = "system/lib64/libmapleappkit.z.so";
@@ -113,7 +109,8 @@ AppMgrServiceInner::AppMgrServiceInner()
     : appProcessManager_(std::make_shared<AppProcessManager>()),
       remoteClientManager_(std::make_shared<RemoteClientManager>()),
       appRunningManager_(std::make_shared<AppRunningManager>()),
-      configuration_(std::make_shared<Configuration>())
+      configuration_(std::make_shared<Configuration>()),
+      processExitWatcher_(std::make_shared<ProcessExitWatcher>())
 {}
 
 void AppMgrServiceInner::Init()
@@ -457,19 +454,9 @@ int32_t AppMgrServiceInner::KillApplication(const std::string &bundleName)
         HILOG_INFO("The process corresponding to the package name did not start");
         return result;
     }
-    if (WaitForRemoteProcessExit(pids, startTime)) {
-        HILOG_INFO("The remote process exited successfully ");
+    KillProcessesOnExitTimeout(pids, startTime, [bundleName]() {
         NotifyAppStatus(bundleName, EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_RESTARTED);
-        return result;
-    }
-    for (auto iter = pids.begin(); iter != pids.end(); ++iter) {
-        result = KillProcessByPid(*iter);
-        if (result < 0) {
-            HILOG_ERROR("KillApplication is fail bundleName: %{public}s pid: %{public}d", bundleName.c_str(), *iter);
-            return result;
-        }
-    }
-    NotifyAppStatus(bundleName, EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_RESTARTED);
+    });
     return result;
 }
 
@@ -503,17 +490,7 @@ int32_t AppMgrServiceInner::KillApplicationByUid(const std::string &bundleName,
         HILOG_INFO("The process corresponding to the package name did not start");
         return result;
     }
-    if (WaitForRemoteProcessExit(pids, startTime)) {
-        HILOG_INFO("The remote process exited successfully ");
-        return result;
-    }
-    for (auto iter = pids.begin(); iter != pids.end(); ++iter) {
-        result = KillProcessByPid(*iter);
-        if (result < 0) {
-            HILOG_ERROR("KillApplication is fail bundleName: %{public}s pid: %{public}d", bundleName.c_str(), *iter);
-            return result;
-        }
-    }
+    KillProcessesOnExitTimeout(pids, startTime);
     return result;
 }
 
@@ -570,17 +547,7 @@ int32_t AppMgrServiceInner::KillApplicationByUserIdLocked(const std::string &bun
         HILOG_INFO("The process corresponding to the package name did not start");
         return result;
     }
-    if (WaitForRemoteProcessExit(pids, startTime)) {
-        HILOG_INFO("The remote process exited successfully ");
-        return result;
-    }
-    for (auto iter = pids.begin(); iter != pids.end(); ++iter) {
-        result = KillProcessByPid(*iter);
-        if (result < 0) {
-            HILOG_ERROR("KillApplication is fail bundleName: %{public}s pid: %{public}d", bundleName.c_str(), *iter);
-            return result;
-        }
-    }
+    KillProcessesOnExitTimeout(pids, startTime);
     return result;
 }
 
@@ -709,17 +676,34 @@ int32_t AppMgrServiceInner::KillProcessByPid(const pid_t pid) const
     return ret;
 }
 
-bool AppMgrServiceInner::WaitForRemoteProcessExit(std::list<pid_t> &pids, const int64_t startTime)
+void AppMgrServiceInner::KillProcessesOnExitTimeout(
+    const std::list<pid_t> &pids, const int64_t startTime, const std::function<void()> &task)
 {
-    int64_t delayTime = SystemTimeMillis() - startTime;
-    while (delayTime < KILL_PROCESS_TIMEOUT_MICRO_SECONDS) {
-        if (CheckAllProcessExist(pids)) {
-            return true;
+    int64_t timeout = KILL_PROCESS_TIMEOUT_MICRO_SECONDS - (SystemTimeMillis() - startTime);
+    // the watch may end on the calling thread, on the watcher thread or while this service is destroyed, so
+    // it holds nothing of this service and works however the service is owned.
+    std::weak_ptr<AMSEventHandler> weakHandler = eventHandler_;
+    bool hasHandler = eventHandler_ != nullptr;
+    auto onExit = [weakHandler, hasHandler, task](const std::list<pid_t> &alivePids) {
+        for (auto pid : alivePids) {
+            HILOG_INFO("kill pid %{public}d", pid);
+            if (kill(pid, SIGNAL_KILL) < 0) {
+                HILOG_ERROR("kill process is fail, pid: %{public}d", pid);
+            }
         }
-        usleep(KILL_PROCESS_DELAYTIME_MICRO_SECONDS);
-        delayTime = SystemTimeMillis() - startTime;
-    }
-    return false;
+        if (!task) {
+            return;
+        }
+        if (!hasHandler) {
+            task();
+            return;
+        }
+        auto eventHandler = weakHandler.lock();
+        if (eventHandler) {
+            eventHandler->PostTask(task, "KillProcessesOnExitTimeout");
+        }
+    };
+    processExitWatcher_->Watch(pids, timeout, onExit);
 }
 
 bool AppMgrServiceInner::GetAllPids(std::list<pid_t> &pids)
@@ -736,37 +720,6 @@ bool AppMgrServiceInner::GetAllPids(std::list<pid_t> &pids)
     return (pids.empty() ? false : true);
 }
 
-bool AppMgrServiceInner::process_exist(pid_t &pid)
-{
-    char pid_path[128] = {0};
-    struct stat stat_buf;
-    if (!pid) {
-        return false;
-    }
-    if (snprintf_s(pid_path, sizeof(pid_path), sizeof(pid_path) - 1, "/proc/%d/status", pid) < 0) {
-        return false;
-    }
-    if (stat(pid_path, &stat_buf) == 0) {
-        return true;
-    }
-    return false;
-}
-
-bool AppMgrServiceInner::CheckAllProcessExist(std::list<pid_t> &pids)
-{
-    for (auto iter = pids.begin(); iter != pids.end();) {
-        if (!process_exist(*iter)) {
-            iter = pids.erase(iter);
-        } else {
-            iter++;
-        }
-    }
-    if (pids.empty()) {
-        return true;
-    }
-    return false;
-}
-
 int64_t AppMgrServiceInner::SystemTimeMillis()
 {
     struct timespec t;
@@ -1007,13 +960,7 @@ void AppMgrServiceInner::KillProcessByAbilityToken(const sptr<IRemoteObject> &to
     if (pid > 0) {
         pids.push_back(pid);
         appRecord->ScheduleProcessSecurityExit();
-        if (!WaitForRemoteProcessExit(pids, SystemTimeMillis())) {
-            int32_t result = KillProcessByPid(pid);
-            if (result < 0) {
-                HILOG_ERROR("KillProcessByAbilityToken kill process is fail");
-                return;
-            }
-        }
+        KillProcessesOnExitTimeout(pids, SystemTimeMillis());
     }
 }
 
@@ -1030,17 +977,7 @@ void AppMgrServiceInner::KillProcessesByUserId(int32_t userId)
         HILOG_INFO("The process corresponding to the userId did not start");
         return;
     }
-    if (WaitForRemoteProcessExit(pids, startTime)) {
-        HILOG_INFO("The remote process exited successfully ");
-        return;
-    }
-    for (auto iter = pids.begin(); iter != pids.end(); ++iter) {
-        auto result = KillProcessByPid(*iter);
-        if (result < 0) {
-            HILOG_ERROR("KillProcessByPid is failed. pid: %{public}d", *iter);
-            return;
-        }
-    }
+    KillProcessesOnExitTimeout(pids, startTime);
 }
 
 void AppMgrServiceInner::StartAbility(const sptr<IRemoteObject> &token, const sptr<IRemoteObject> &preToken,
@@ -1197,21 +1134,55 @@ void AppMgrServiceInner::StartProcess(const std::string &appName, const std::str
         return;
     }
 
+    AppSpawnStartMsg startMsg;
+    if (!CreateStartMsg(processName, startFlags, uid, bundleName, startMsg)) {
+        return;
+    }
+
+    PerfProfile::GetInstance().SetAppForkStartTime(GetTickCount());
+    pid_t pid = 0;
+    ErrCode errCode = remoteClientManager_->GetSpawnClient()->StartProcess(startMsg, pid);
+    OnProcessSpawned(appName, appRecord, startMsg, errCode, pid);
+    PerfProfile::GetInstance().SetAppForkEndTime(GetTickCount());
+}
+
+void AppMgrServiceInner::StartProcesses(const std::vector<std::shared_ptr<AppRunningRecord>> &appRecords,
+    const std::vector<AppSpawnStartMsg> &startMsgs)
+{
+    HITRACE_METER_NAME(HITRACE_TAG_APP, __PRETTY_FUNCTION__);
+    auto spawnClient = remoteClientManager_->GetSpawnClient();
+    if (!spawnClient || appRecords.size() != startMsgs.size()) {
+        HILOG_ERROR("appSpawnClient is null or the batch is invalid");
+        return;
+    }
+    if (startMsgs.empty()) {
+        return;
+    }
+
+    PerfProfile::GetInstance().SetAppForkStartTime(GetTickCount());
+    // the callback runs on this thread as each pid is read, so the pid is set before the process attaches.
+    spawnClient->StartProcesses(startMsgs, [this, &appRecords, &startMsgs](size_t index, ErrCode errCode, pid_t pid) {
+        OnProcessSpawned(appRecords[index]->GetName(), appRecords[index], startMsgs[index], errCode, pid);
+    });
+    PerfProfile::GetInstance().SetAppForkEndTime(GetTickCount());
+}
+
+bool AppMgrServiceInner::CreateStartMsg(const std::string &processName, uint32_t startFlags, const int uid,
+    const std::string &bundleName, AppSpawnStartMsg &startMsg)
+{
     auto bundleMgr_ = remoteClientManager_->GetBundleManager();
     if (bundleMgr_ == nullptr) {
         HILOG_ERROR("GetBundleManager fail");
-        return;
+        return false;
     }
 
     auto userId = GetUserIdByUid(uid);
-    AppSpawnStartMsg startMsg;
-    BundleInfo bundleInfo;
     std::vector<AppExecFwk::BundleInfo> bundleInfos;
     bool bundleMgrResult = IN_PROCESS_CALL(bundleMgr_->GetBundleInfos(AppExecFwk::BundleFlag::GET_BUNDLE_WITH_ABILITIES,
         bundleInfos, userId));
     if (!bundleMgrResult) {
         HILOG_ERROR("GetBundleInfo is fail");
-        return;
+        return false;
     }
 
     auto isExist = [&bundleName, &uid](const AppExecFwk::BundleInfo &bundleInfo) {
@@ -1220,7 +1191,7 @@ void AppMgrServiceInner::StartProcess(const std::string &appName, const std::str
     auto bundleInfoIter = std::find_if(bundleInfos.begin(), bundleInfos.end(), isExist);
     if (bundleInfoIter == bundleInfos.end()) {
         HILOG_ERROR("Get target fail.");
-        return;
+        return false;
     }
     startMsg.uid = (*bundleInfoIter).uid;
     startMsg.gid = (*bundleInfoIter).gid;
@@ -1235,28 +1206,30 @@ void AppMgrServiceInner::StartProcess(const std::string &appName, const std::str
     bundleMgrResult = IN_PROCESS_CALL(bundleMgr_->GetBundleGidsByUid(bundleName, uid, startMsg.gids));
     if (!bundleMgrResult) {
         HILOG_ERROR("GetBundleGids is fail");
-        return;
+        return false;
     }
     startMsg.procName = processName;
     startMsg.soPath = SO_PATH;
+    return true;
+}
 
-    PerfProfile::GetInstance().SetAppForkStartTime(GetTickCount());
-    pid_t pid = 0;
-    ErrCode errCode = remoteClientManager_->GetSpawnClient()->StartProcess(startMsg, pid);
+void AppMgrServiceInner::OnProcessSpawned(const std::string &appName,
+    const std::shared_ptr<AppRunningRecord> &appRecord, const AppSpawnStartMsg &startMsg, ErrCode errCode, pid_t pid)
+{
     if (FAILED(errCode)) {
         HILOG_ERROR("failed to spawn new app process, errCode %{public}08x", errCode);
         appRunningManager_->RemoveAppRunningRecordById(appRecord->GetRecordId());
         return;
     }
-    HILOG_INFO("Start process success, pid is %{public}d, processName is %{public}s.", pid, processName.c_str());
-    appRecord->GetPriorityObject()->SetPid(pid);
+    HILOG_INFO("Start process success, pid is %{public}d, processName is %{public}s.", pid,
+        startMsg.procName.c_str());
+    appRunningManager_->SetAppRunningRecordPid(appRecord, pid);
     appRecord->SetUid(startMsg.uid);
     appRecord->SetStartMsg(startMsg);
     appRecord->SetAppMgrServiceInner(weak_from_this());
     OnAppStateChanged(appRecord, ApplicationState::APP_STATE_CREATE);
     AddAppToRecentList(appName, appRecord->GetProcessName(), pid, appRecord->GetRecordId());
     DelayedSingleton<AppStateObserverManager>::GetInstance()->OnProcessCreated(appRecord);
-    PerfProfile::GetInstance().SetAppForkEndTime(GetTickCount());
 }
 
 void AppMgrServiceInner::RemoveAppFromRecentList(const std::string &appName, const std::string &processName)
@@ -1281,14 +1254,9 @@ void AppMgrServiceInner::RemoveAppFromRecentList(const std::string &appName, con
     startTime = SystemTimeMillis();
     pids.push_back(appTaskInfo->GetPid());
     appRecord->ScheduleProcessSecurityExit();
-    if (!WaitForRemoteProcessExit(pids, startTime)) {
-        int32_t result = KillProcessByPid(appTaskInfo->GetPid());
-        if (result < 0) {
-            HILOG_ERROR("RemoveAppFromRecentList kill process is fail");
-            return;
-        }
-    }
-    appProcessManager_->RemoveAppFromRecentList(appTaskInfo);
+    KillProcessesOnExitTimeout(pids, startTime, [appProcessManager = appProcessManager_, appTaskInfo]() {
+        appProcessManager->RemoveAppFromRecentList(appTaskInfo);
+    });
 }
 
 const std::list<const std::shared_ptr<AppTaskInfo>> &AppMgrServiceInner::GetRecentAppList() const
@@ -1305,18 +1273,9 @@ void AppMgrServiceInner::ClearRecentAppList()
     }
 
     startTime = SystemTimeMillis();
-    if (WaitForRemoteProcessExit(pids, startTime)) {
-        appProcessManager_->ClearRecentAppList();
-        return;
-    }
-    for (auto iter = pids.begin(); iter != pids.end(); ++iter) {
-        int32_t result = KillProcessByPid(*iter);
-        if (result < 0) {
-            HILOG_ERROR("ClearRecentAppList kill process is fail");
-            return;
-        }
-    }
-    appProcessManager_->ClearRecentAppList();
+    KillProcessesOnExitTimeout(pids, startTime, [appProcessManager = appProcessManager_]() {
+        appProcessManager->ClearRecentAppList();
+    });
 }
 
 void AppMgrServiceInner::OnRemoteDied(const wptr<IRemoteObject> &remote, bool isRenderProcess)
@@ -1332,6 +1291,8 @@ void AppMgrServiceInner::OnRemoteDied(const wptr<IRemoteObject> &remote, bool is
         return;
     }
 
+    // the death of the app ends the kill paths waiting for it, whether or not its pidfd is watched.
+    processExitWatcher_->NotifyProcessExit(appRecord->GetPriorityObject()->GetPid());
     ClearAppRunningData(appRecord, false);
 }
 
@@ -1561,6 +1522,14 @@ void AppMgrServiceInner::StartResidentProcess(const std::vector<BundleInfo> &inf
         return;
     }
 
+    if (!CheckRemoteClient()) {
+        HILOG_INFO("Failed to start resident process!");
+        return;
+    }
+
+    // boot and user switch start many resident processes at once, spawn them as one pipelined batch.
+    std::vector<std::shared_ptr<AppRunningRecord>> appRecords;
+    std::vector<AppSpawnStartMsg> startMsgs;
     for (auto &bundle : infos) {
         auto processName = bundle.applicationInfo.process.empty() ?
             bundle.applicationInfo.bundleName : bundle.applicationInfo.process;
@@ -1573,32 +1542,30 @@ void AppMgrServiceInner::StartResidentProcess(const std::vector<BundleInfo> &inf
             HILOG_INFO("processName [%{public}s] Already exists ", processName.c_str());
             continue;
         }
-        StartEmptyResidentProcess(bundle, processName, restartCount);
+        appRecord = CreateResidentProcessRecord(bundle, processName, restartCount);
+        if (!appRecord) {
+            continue;
+        }
+        AppSpawnStartMsg startMsg;
+        if (!CreateStartMsg(processName, 0, bundle.applicationInfo.uid, bundle.applicationInfo.bundleName,
+            startMsg)) {
+            continue;
+        }
+        appRecords.emplace_back(appRecord);
+        startMsgs.emplace_back(startMsg);
     }
+    StartProcesses(appRecords, startMsgs);
 }
 
-void AppMgrServiceInner::StartEmptyResidentProcess(
+std::shared_ptr<AppRunningRecord> AppMgrServiceInner::CreateResidentProcessRecord(
     const BundleInfo &info, const std::string &processName, int restartCount)
 {
     HILOG_INFO("start bundle [%{public}s | processName [%{public}s]]", info.name.c_str(), processName.c_str());
-    if (!CheckRemoteClient() || !appRunningManager_) {
-        HILOG_INFO("Failed to start resident process!");
-        return;
-    }
-
     auto appInfo = std::make_shared<ApplicationInfo>(info.applicationInfo);
     auto appRecord = appRunningManager_->CreateAppRunningRecord(appInfo, processName, info);
     if (!appRecord) {
         HILOG_ERROR("start process [%{public}s] failed!", processName.c_str());
-        return;
-    }
-
-    StartProcess(appInfo->name, processName, 0, appRecord, appInfo->uid, appInfo->bundleName);
-
-    // If it is empty, the startup failed
-    if (!appRecord) {
-        HILOG_ERROR("start process [%{public}s] failed!", processName.c_str());
-        return;
+        return nullptr;
     }
 
     bool isStageBased = false;
@@ -1607,18 +1574,18 @@ void AppMgrServiceInner::StartEmptyResidentProcess(
         isStageBased = info.hapModuleInfos.back().isStageBasedModel;
         moduelJson = info.hapModuleInfos.back().isModuleJson;
     }
-    HILOG_INFO("StartEmptyResidentProcess stage:%{public}d moduel:%{public}d size:%{public}d",
+    HILOG_INFO("CreateResidentProcessRecord stage:%{public}d moduel:%{public}d size:%{public}d",
         isStageBased, moduelJson, (int32_t)info.hapModuleInfos.size());
     appRecord->SetKeepAliveAppState(true, isStageBased);
 
     if (restartCount > 0) {
-        HILOG_INFO("StartEmptyResidentProcess restartCount : [%{public}d], ", restartCount);
+        HILOG_INFO("CreateResidentProcessRecord restartCount : [%{public}d], ", restartCount);
         appRecord->SetRestartResidentProcCount(restartCount);
     }
 
     appRecord->SetEventHandler(eventHandler_);
     appRecord->AddModules(appInfo, info.hapModuleInfos);
-    HILOG_INFO("StartEmptyResidentProcess oK pid : [%{public}d], ", appRecord->GetPriorityObject()->GetPid());
+    return appRecord;
 }
 
 bool AppMgrServiceInner::CheckRemoteClient()
@@ -2091,15 +2058,7 @@ void AppMgrServiceInner::KillApplicationByRecord(const std::shared_ptr<AppRunnin
 
     auto startTime = SystemTimeMillis();
     std::list<pid_t> pids = {pid};
-    if (WaitForRemoteProcessExit(pids, startTime)) {
-        HILOG_DEBUG("The remote process exited successfully");
-        return;
-    }
-
-    auto result = KillProcessByPid(pid);
-    if (result < 0) {
-        HILOG_ERROR("Kill application by app record, pid: %{public}d", pid);
-    }
+    KillProcessesOnExitTimeout(pids, startTime);
 }
 
 void AppMgrServiceInner::SendHiSysEvent(const int32_t innerEventId, const int64_t eventId)
@@ -2345,8 +2304,8 @@ int AppMgrServiceInner::StartRenderProcessImpl(const std::shared_ptr<RenderRecor
         return ERR_INVALID_VALUE;
     }
     renderPid = pid;
-    appRecord->SetRenderRecord(renderRecord);
     renderRecord->SetPid(pid);
+    appRunningManager_->SetAppRunningRecordRender(appRecord, renderRecord);
     HILOG_INFO("start render process successed, hostPid:%{public}d, pid:%{public}d uid:%{public}d",
         renderRecord->GetHostPid(), pid, startMsg.uid);
     return 0;
@@ -36,7 +36,7 @@ static void GetOsAccountIdFromUid(int uid, int &osAccountId)
 }
 }
 #endif // OS_ACCOUNT_PART_ENABLED
-AppRunningManager::AppRunningManager()
+AppRunningManager::AppRunningManager() : tokenIndex_(std::make_shared<AbilityTokenIndex>())
 {}
 AppRunningManager::~AppRunningManager()
 {}
@@ -61,14 +61,12 @@ std::shared_ptr<AppRunningRecord> AppRunningManager::CreateAppRunningRecord(
         return nullptr;
     }
 
-    std::regex rule("[a-zA-Z.]+[-_#]{1}");
-    std::string signCode;
-    ClipStringContent(rule, bundleInfo.appId, signCode);
-
     HILOG_INFO("Create AppRunningRecord, processName: %{public}s, recordId: %{public}d", processName.c_str(), recordId);
-    appRecord->SetSignCode(signCode);
+    appRecord->SetSignCode(GetSignCode(bundleInfo.appId));
     appRecord->SetJointUserId(bundleInfo.jointUserId);
+    appRecord->SetAbilityTokenIndex(tokenIndex_);
     appRunningRecordMap_.emplace(recordId, appRecord);
+    processNameIndex_[processName].emplace(recordId);
     return appRecord;
 }
 
@@ -79,26 +77,22 @@ std::shared_ptr<AppRunningRecord> AppRunningManager::CheckAppRunningRecordIsExis
         appName.c_str(), processName.c_str(), uid);
     std::lock_guard<std::recursive_mutex> guard(lock_);
 
-    std::regex rule("[a-zA-Z.]+[-_#]{1}");
-    std::string signCode;
+    auto indexIter = processNameIndex_.find(processName);
+    if (indexIter == processNameIndex_.end()) {
+        return nullptr;
+    }
+
     auto jointUserId = bundleInfo.jointUserId;
     HILOG_INFO("jointUserId : %{public}s", jointUserId.c_str());
-    ClipStringContent(rule, bundleInfo.appId, signCode);
-
-    auto FindSameProcess = [signCode, processName, jointUserId](const auto &pair) {
-            return ((pair.second->GetSignCode() == signCode) &&
-                    (pair.second->GetProcessName() == processName) &&
-                    (pair.second->GetJointUserId() == jointUserId) &&
-                    !(pair.second->IsTerminating()) &&
-                    !(pair.second->IsKilling()));
-    };
-
     // If it is not empty, look for whether it can come in the same process
     if (jointUserId.empty()) {
-        for (const auto &item : appRunningRecordMap_) {
-            const auto &appRecord = item.second;
-            if (appRecord && appRecord->GetProcessName() == processName &&
-                !(appRecord->IsTerminating()) && !(appRecord->IsKilling())) {
+        for (const auto &recordId : indexIter->second) {
+            auto iter = appRunningRecordMap_.find(recordId);
+            if (iter == appRunningRecordMap_.end()) {
+                continue;
+            }
+            const auto &appRecord = iter->second;
+            if (appRecord && !(appRecord->IsTerminating()) && !(appRecord->IsKilling())) {
                 HILOG_INFO("appRecord->GetProcessName() : %{public}s", appRecord->GetProcessName().c_str());
                 auto appInfoList = appRecord->GetAppInfoList();
                 HILOG_INFO("appInfoList : %{public}zu", appInfoList.size());
@@ -115,30 +109,68 @@ std::shared_ptr<AppRunningRecord> AppRunningManager::CheckAppRunningRecordIsExis
         return nullptr;
     }
 
-    auto iter = std::find_if(appRunningRecordMap_.begin(), appRunningRecordMap_.end(), FindSameProcess);
-    return ((iter == appRunningRecordMap_.end()) ? nullptr : iter->second);
+    auto signCode = GetSignCode(bundleInfo.appId);
+    for (const auto &recordId : indexIter->second) {
+        auto iter = appRunningRecordMap_.find(recordId);
+        if (iter == appRunningRecordMap_.end()) {
+            continue;
+        }
+        const auto &appRecord = iter->second;
+        if (appRecord && appRecord->GetSignCode() == signCode && appRecord->GetJointUserId() == jointUserId &&
+            !(appRecord->IsTerminating()) && !(appRecord->IsKilling())) {
+            return appRecord;
+        }
+    }
+    return nullptr;
 }
 
 std::shared_ptr<AppRunningRecord> AppRunningManager::GetAppRunningRecordByPid(const pid_t pid)
 {
     std::lock_guard<std::recursive_mutex> guard(lock_);
-    auto iter = std::find_if(appRunningRecordMap_.begin(), appRunningRecordMap_.end(), [&pid](const auto &pair) {
-        return pair.second->GetPriorityObject()->GetPid() == pid;
-    });
-    return ((iter == appRunningRecordMap_.end()) ? nullptr : iter->second);
+    auto indexIter = pidIndex_.find(pid);
+    if (indexIter == pidIndex_.end()) {
+        return nullptr;
+    }
+    auto iter = appRunningRecordMap_.find(indexIter->second);
+    if (iter == appRunningRecordMap_.end()) {
+        return nullptr;
+    }
+    return iter->second;
+}
+
+void AppRunningManager::SetAppRunningRecordPid(const std::shared_ptr<AppRunningRecord> &appRecord, const pid_t pid)
+{
+    std::lock_guard<std::recursive_mutex> guard(lock_);
+    if (!appRecord) {
+        HILOG_ERROR("appRecord is null");
+        return;
+    }
+    auto recordId = appRecord->GetRecordId();
+    auto priorityObject = appRecord->GetPriorityObject();
+    auto indexIter = pidIndex_.find(priorityObject->GetPid());
+    if (indexIter != pidIndex_.end() && indexIter->second == recordId) {
+        pidIndex_.erase(indexIter);
+    }
+    priorityObject->SetPid(pid);
+    // records that are not started yet all have pid 0, only index real pids of records still in the map.
+    if (pid > 0 && appRunningRecordMap_.find(recordId) != appRunningRecordMap_.end()) {
+        pidIndex_[pid] = recordId;
+    }
 }
 
 std::shared_ptr<AppRunningRecord> AppRunningManager::GetAppRunningRecordByAbilityToken(
     const sptr<IRemoteObject> &abilityToken)
 {
     std::lock_guard<std::recursive_mutex> guard(lock_);
-    for (const auto &item : appRunningRecordMap_) {
-        const auto &appRecord = item.second;
-        if (appRecord && appRecord->GetAbilityRunningRecordByToken(abilityToken)) {
-            return appRecord;
-        }
+    int32_t recordId = 0;
+    if (!tokenIndex_->Find(abilityToken, recordId)) {
+        return nullptr;
     }
-    return nullptr;
+    auto iter = appRunningRecordMap_.find(recordId);
+    if (iter == appRunningRecordMap_.end()) {
+        return nullptr;
+    }
+    return iter->second;
 }
 
 bool AppRunningManager::ProcessExitByBundleName(const std::string &bundleName, std::list<pid_t> &pids)
@@ -244,6 +276,7 @@ std::shared_ptr<AppRunningRecord> AppRunningManager::OnRemoteDied(const wptr<IRe
         appRecord->SetApplicationClient(nullptr);
     }
     appRunningRecordMap_.erase(iter);
+    RemoveRecordIndex(appRecord);
     return appRecord;
 }
 
@@ -256,13 +289,46 @@ const std::map<const int32_t, const std::shared_ptr<AppRunningRecord>> &AppRunni
 void AppRunningManager::RemoveAppRunningRecordById(const int32_t recordId)
 {
     std::lock_guard<std::recursive_mutex> guard(lock_);
-    appRunningRecordMap_.erase(recordId);
+    auto iter = appRunningRecordMap_.find(recordId);
+    if (iter == appRunningRecordMap_.end()) {
+        return;
+    }
+    auto appRecord = iter->second;
+    appRunningRecordMap_.erase(iter);
+    RemoveRecordIndex(appRecord);
 }
 
 void AppRunningManager::ClearAppRunningRecordMap()
 {
     std::lock_guard<std::recursive_mutex> guard(lock_);
     appRunningRecordMap_.clear();
+    processNameIndex_.clear();
+    pidIndex_.clear();
+    renderPidIndex_.clear();
+    tokenIndex_->Clear();
+}
+
+void AppRunningManager::RemoveRecordIndex(const std::shared_ptr<AppRunningRecord> &appRecord)
+{
+    if (!appRecord) {
+        return;
+    }
+    auto recordId = appRecord->GetRecordId();
+    auto nameIter = processNameIndex_.find(appRecord->GetProcessName());
+    if (nameIter != processNameIndex_.end()) {
+        nameIter->second.erase(recordId);
+        if (nameIter->second.empty()) {
+            processNameIndex_.erase(nameIter);
+        }
+    }
+    auto eraseRecord = [recordId](auto &index) {
+        for (auto iter = index.begin(); iter != index.end();) {
+            iter = (iter->second == recordId) ? index.erase(iter) : std::next(iter);
+        }
+    };
+    eraseRecord(pidIndex_);
+    eraseRecord(renderPidIndex_);
+    tokenIndex_->RemoveRecord(recordId);
 }
 
 void AppRunningManager::HandleTerminateTimeOut(int64_t eventId)
@@ -402,6 +468,23 @@ void AppRunningManager::GetRunningProcessInfoByToken(
     info.bundleNames.emplace_back(appRecord->GetBundleName());
 }
 
+std::string AppRunningManager::GetSignCode(const std::string &appId)
+{
+    auto iter = signCodeCache_.find(appId);
+    if (iter != signCodeCache_.end()) {
+        return iter->second;
+    }
+
+    static const std::regex rule("[a-zA-Z.]+[-_#]{1}");
+    std::string signCode;
+    ClipStringContent(rule, appId, signCode);
+    if (signCodeCache_.size() >= SIGN_CODE_CACHE_SIZE) {
+        signCodeCache_.clear();
+    }
+    signCodeCache_.emplace(appId, signCode);
+    return signCode;
+}
+
 void AppRunningManager::ClipStringContent(const std::regex &re, const std::string &sorce, std::string &afferCutStr)
 {
     std::smatch basket;
@@ -482,11 +565,38 @@ void AppRunningManager::UpdateConfiguration(const Configuration &config)
 std::shared_ptr<AppRunningRecord> AppRunningManager::GetAppRunningRecordByRenderPid(const pid_t pid)
 {
     std::lock_guard<std::recursive_mutex> guard(lock_);
-    auto iter = std::find_if(appRunningRecordMap_.begin(), appRunningRecordMap_.end(), [&pid](const auto &pair) {
-        auto renderRecord = pair.second->GetRenderRecord();
-        return renderRecord && renderRecord->GetPid() == pid;
-    });
-    return ((iter == appRunningRecordMap_.end()) ? nullptr : iter->second);
+    auto indexIter = renderPidIndex_.find(pid);
+    if (indexIter == renderPidIndex_.end()) {
+        return nullptr;
+    }
+    auto iter = appRunningRecordMap_.find(indexIter->second);
+    if (iter == appRunningRecordMap_.end()) {
+        return nullptr;
+    }
+    return iter->second;
+}
+
+void AppRunningManager::SetAppRunningRecordRender(const std::shared_ptr<AppRunningRecord> &appRecord,
+    const std::shared_ptr<RenderRecord> &renderRecord)
+{
+    std::lock_guard<std::recursive_mutex> guard(lock_);
+    if (!appRecord) {
+        HILOG_ERROR("appRecord is null");
+        return;
+    }
+    auto recordId = appRecord->GetRecordId();
+    auto oldRenderRecord = appRecord->GetRenderRecord();
+    if (oldRenderRecord) {
+        auto indexIter = renderPidIndex_.find(oldRenderRecord->GetPid());
+        if (indexIter != renderPidIndex_.end() && indexIter->second == recordId) {
+            renderPidIndex_.erase(indexIter);
+        }
+    }
+    appRecord->SetRenderRecord(renderRecord);
+    if (renderRecord && renderRecord->GetPid() > 0 &&
+        appRunningRecordMap_.find(recordId) != appRunningRecordMap_.end()) {
+        renderPidIndex_[renderRecord->GetPid()] = recordId;
+    }
 }
 
 void AppRunningManager::OnRemoteRenderDied(const wptr<IRemoteObject> &remote)
@@ -517,8 +627,7 @@ void AppRunningManager::OnRemoteRenderDied(const wptr<IRemoteObject> &remote)
             return scheduler && scheduler->AsObject() == object;
         });
     if (it != appRunningRecordMap_.end()) {
-        auto appRecord = it->second;
-        appRecord->SetRenderRecord(nullptr);
+        SetAppRunningRecordRender(it->second, nullptr);
     }
 }
 }  // namespace AppExecFwk
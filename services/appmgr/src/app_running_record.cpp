@@ -102,6 +102,55 @@ void RenderRecord::RegisterDeathRecipient()
     }
 }
 
+void AbilityTokenIndex::Add(const sptr<IRemoteObject> &token, const int32_t recordId)
+{
+    if (!token) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(lock_);
+    tokens_[token.GetRefPtr()] = recordId;
+}
+
+void AbilityTokenIndex::Remove(const sptr<IRemoteObject> &token, const int32_t recordId)
+{
+    if (!token) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(lock_);
+    auto iter = tokens_.find(token.GetRefPtr());
+    if (iter != tokens_.end() && iter->second == recordId) {
+        tokens_.erase(iter);
+    }
+}
+
+void AbilityTokenIndex::RemoveRecord(const int32_t recordId)
+{
+    std::lock_guard<std::mutex> guard(lock_);
+    for (auto iter = tokens_.begin(); iter != tokens_.end();) {
+        iter = (iter->second == recordId) ? tokens_.erase(iter) : std::next(iter);
+    }
+}
+
+bool AbilityTokenIndex::Find(const sptr<IRemoteObject> &token, int32_t &recordId)
+{
+    if (!token) {
+        return false;
+    }
+    std::lock_guard<std::mutex> guard(lock_);
+    auto iter = tokens_.find(token.GetRefPtr());
+    if (iter == tokens_.end()) {
+        return false;
+    }
+    recordId = iter->second;
+    return true;
+}
+
+void AbilityTokenIndex::Clear()
+{
+    std::lock_guard<std::mutex> guard(lock_);
+    tokens_.clear();
+}
+
 AppRunningRecord::AppRunningRecord(
     const std::shared_ptr<ApplicationInfo> &info, const int32_t recordId, const std::string &processName)
     : appRecordId_(recordId), processName_(processName)
@@ -282,6 +331,9 @@ void AppRunningRecord::ClearAbility(const std::shared_ptr<AbilityRunningRecord>
     }
 
     moduleRecord->ClearAbility(record);
+    if (abilityTokenIndex_) {
+        abilityTokenIndex_->Remove(record->GetToken(), appRecordId_);
+    }
 
     if (moduleRecord->GetAbilities().empty()) {
         RemoveModuleRecord(moduleRecord);
@@ -526,6 +578,9 @@ void AppRunningRecord::AddModule(const std::shared_ptr<ApplicationInfo> &appInfo
         return;
     }
     moduleRecord->AddAbility(token, abilityInfo, want);
+    if (abilityTokenIndex_) {
+        abilityTokenIndex_->Add(token, appRecordId_);
+    }
 
     return;
 }
@@ -750,6 +805,9 @@ void AppRunningRecord::TerminateAbility(const sptr<IRemoteObject> &token, const
     auto abilityRecord = GetAbilityRunningRecordByToken(token);
     StateChangedNotifyObserver(abilityRecord, static_cast<int32_t>(AbilityState::ABILITY_STATE_TERMINATED), true);
     moduleRecord->TerminateAbility(token, isForce);
+    if (abilityTokenIndex_) {
+        abilityTokenIndex_->Remove(token, appRecordId_);
+    }
 }
 
 void AppRunningRecord::AbilityTerminated(const sptr<IRemoteObject> &token)
@@ -815,6 +873,11 @@ void AppRunningRecord::RemoveAppDeathRecipient() const
     }
 }
 
+void AppRunningRecord::SetAbilityTokenIndex(const std::shared_ptr<AbilityTokenIndex> &index)
+{
+    abilityTokenIndex_ = index;
+}
+
 void AppRunningRecord::SetAppMgrServiceInner(const std::weak_ptr<AppMgrServiceInner> &inner)
 {
     appMgrServiceInner_ = inner;
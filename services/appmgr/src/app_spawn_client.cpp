@@ -15,6 +15,8 @@
 
 #include "app_spawn_client.h"
 
+#include <algorithm>
+
 #include "hitrace_meter.h"
 #include "hilog_wrapper.h"
 
@@ -28,6 +30,7 @@ const int32_t CONNECT_RETRY_MAX_TIMES = 2;
 AppSpawnClient::AppSpawnClient(bool isNWebSpawn)
 {
     socket_ = std::make_shared<AppSpawnSocket>(isNWebSpawn);
+    socketFactory_ = [isNWebSpawn]() { return std::make_shared<AppSpawnSocket>(isNWebSpawn); };
     state_ = SpawnConnectionState::STATE_NOT_CONNECT;
 }
 
@@ -117,6 +120,83 @@ ErrCode AppSpawnClient::StartProcessImpl(const AppSpawnStartMsg &startMsg, pid_t
     return result;
 }
 
+void AppSpawnClient::StartProcesses(const std::vector<AppSpawnStartMsg> &startMsgs, const StartProcessCallback &callback)
+{
+    HITRACE_METER_NAME(HITRACE_TAG_APP, __PRETTY_FUNCTION__);
+    for (size_t begin = 0; begin < startMsgs.size(); begin += MAX_PIPELINE_REQUESTS) {
+        size_t end = std::min(begin + MAX_PIPELINE_REQUESTS, startMsgs.size());
+        std::vector<std::shared_ptr<AppSpawnSocket>> sockets(end - begin);
+        std::vector<ErrCode> results(end - begin, ERR_APPEXECFWK_BAD_APPSPAWN_SOCKET);
+        if (socketFactory_) {
+            // appspawn answers one request per connection, send the whole window before reading any pid.
+            for (size_t index = begin; index < end; index++) {
+                results[index - begin] = SendStartMsg(startMsgs[index], sockets[index - begin]);
+            }
+        }
+        for (size_t index = begin; index < end; index++) {
+            pid_t pid = 0;
+            ErrCode errCode = results[index - begin];
+            auto &socket = sockets[index - begin];
+            bool sent = SUCCEEDED(errCode);
+            if (sent) {
+                errCode = ReadPid(socket, pid);
+            }
+            if (socket) {
+                socket->CloseAppSpawnConnection();
+                socket.reset();
+            }
+            // a sent request may be spawned already, only a request that was never sent is retried.
+            if (!sent) {
+                errCode = StartProcess(startMsgs[index], pid);
+            }
+            if (callback) {
+                callback(index, errCode, pid);
+            }
+        }
+    }
+}
+
+ErrCode AppSpawnClient::SendStartMsg(const AppSpawnStartMsg &startMsg, std::shared_ptr<AppSpawnSocket> &socket)
+{
+    AppSpawnMsgWrapper msgWrapper;
+    if (!msgWrapper.AssembleMsg(startMsg) || !msgWrapper.IsValid()) {
+        HILOG_ERROR("AssembleMsg failed!");
+        return ERR_APPEXECFWK_ASSEMBLE_START_MSG_FAILED;
+    }
+    auto newSocket = socketFactory_();
+    if (!newSocket) {
+        HILOG_ERROR("failed to create socket!");
+        return ERR_APPEXECFWK_BAD_APPSPAWN_SOCKET;
+    }
+    ErrCode result = newSocket->OpenAppSpawnConnection();
+    if (FAILED(result)) {
+        HILOG_WARN("failed to open pipelined connection, errorCode is %{public}08x", result);
+        return result;
+    }
+    socket = newSocket;
+    result = socket->WriteMessage(msgWrapper.GetMsgBuf(), msgWrapper.GetMsgLength());
+    if (FAILED(result)) {
+        HILOG_WARN("WriteMessage failed!");
+    }
+    return result;
+}
+
+ErrCode AppSpawnClient::ReadPid(const std::shared_ptr<AppSpawnSocket> &socket, pid_t &pid)
+{
+    AppSpawnPidMsg pidMsg;
+    ErrCode result = socket->ReadMessage(reinterpret_cast<void *>(pidMsg.pidBuf), LEN_PID);
+    if (FAILED(result)) {
+        HILOG_WARN("ReadMessage failed!");
+        return result;
+    }
+    if (pidMsg.pid <= 0) {
+        HILOG_ERROR("invalid pid!");
+        return ERR_APPEXECFWK_INVALID_PID;
+    }
+    pid = pidMsg.pid;
+    return ERR_OK;
+}
+
 ErrCode AppSpawnClient::GetRenderProcessTerminationStatus(const AppSpawnStartMsg &startMsg, int &status)
 {
     if (!socket_) {
@@ -173,5 +253,10 @@ void AppSpawnClient::SetSocket(const std::shared_ptr<AppSpawnSocket> socket)
 {
     socket_ = socket;
 }
+
+void AppSpawnClient::SetSocketFactory(const SocketFactory &factory)
+{
+    socketFactory_ = factory;
+}
 }  // namespace AppExecFwk
 }  // namespace OHOS
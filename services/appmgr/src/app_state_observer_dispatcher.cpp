@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "app_state_observer_dispatcher.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+
+#include "hilog_wrapper.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace {
+const std::string WORKER_NAME_PREFIX = "AppStateObserverDelivery";
+const std::string WATCHDOG_TASK = "CheckSlowObservers";
+// the most notifications delivered to an observer before the worker goes on with the other observers.
+constexpr size_t MAX_BATCH_SIZE = 16;
+// a callback taking longer is reported.
+constexpr int64_t SLOW_CALLBACK_MS = 500;
+constexpr int64_t WATCHDOG_INTERVAL_MS = 2000;
+// report a dropped notification of an observer once in so many.
+constexpr uint64_t DROP_REPORT_INTERVAL = 64;
+
+bool IsStateChange(const ObserverEvent &event)
+{
+    return event.type == ObserverEventType::FOREGROUND_APPLICATION_CHANGED ||
+        event.type == ObserverEventType::ABILITY_STATE_CHANGED ||
+        event.type == ObserverEventType::EXTENSION_STATE_CHANGED;
+}
+
+// whether a newer state change supersedes a pending one.
+bool IsSameTarget(const ObserverEvent &pending, const ObserverEvent &event)
+{
+    if (pending.type != event.type) {
+        return false;
+    }
+    if (event.type == ObserverEventType::FOREGROUND_APPLICATION_CHANGED) {
+        return pending.appStateData.pid == event.appStateData.pid &&
+            pending.appStateData.uid == event.appStateData.uid;
+    }
+    return event.abilityStateData.token != nullptr &&
+        pending.abilityStateData.token == event.abilityStateData.token;
+}
+}
+
+AppStateObserverDispatcher::AppStateObserverDispatcher(const std::shared_ptr<EventHandler> &watchdogHandler,
+    size_t workerCount, size_t queueCapacity)
+    : watchdogHandler_(watchdogHandler), queueCapacity_(std::max(queueCapacity, static_cast<size_t>(1)))
+{
+    workerCount = std::max(workerCount, static_cast<size_t>(1));
+    for (size_t i = 0; i < workerCount; i++) {
+        workers_.emplace_back(
+            std::make_shared<EventHandler>(EventRunner::Create(WORKER_NAME_PREFIX + std::to_string(i))));
+    }
+    workerRunning_.resize(workerCount, false);
+}
+
+void AppStateObserverDispatcher::AddObserver(const sptr<IApplicationStateObserver> &observer)
+{
+    if (observer == nullptr || observer->AsObject() == nullptr) {
+        HILOG_ERROR("The param observer is nullptr.");
+        return;
+    }
+    std::lock_guard<std::mutex> lock(queueLock_);
+    if (queues_.find(observer->AsObject()) != queues_.end()) {
+        return;
+    }
+    auto queue = std::make_shared<ObserverQueue>();
+    queue->observer = observer;
+    queues_.emplace(observer->AsObject(), queue);
+}
+
+void AppStateObserverDispatcher::RemoveObserver(const sptr<IApplicationStateObserver> &observer)
+{
+    if (observer == nullptr || observer->AsObject() == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(queueLock_);
+    auto it = queues_.find(observer->AsObject());
+    if (it == queues_.end()) {
+        return;
+    }
+    // a drain in progress stops after the callback it is in.
+    it->second->removed = true;
+    it->second->events.clear();
+    queues_.erase(it);
+}
+
+void AppStateObserverDispatcher::Dispatch(const std::shared_ptr<ObserverEvent> &event)
+{
+    if (event == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(queueLock_);
+    for (auto &item : queues_) {
+        Enqueue(item.second, event);
+    }
+}
+
+bool AppStateObserverDispatcher::GetStats(const sptr<IApplicationStateObserver> &observer, ObserverStats &stats)
+{
+    if (observer == nullptr || observer->AsObject() == nullptr) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(queueLock_);
+    auto it = queues_.find(observer->AsObject());
+    if (it == queues_.end()) {
+        return false;
+    }
+    stats = it->second->stats;
+    stats.pending = it->second->events.size();
+    return true;
+}
+
+void AppStateObserverDispatcher::CheckSlowObservers()
+{
+    std::lock_guard<std::mutex> lock(queueLock_);
+    watchdogArmed_ = false;
+    bool draining = false;
+    int64_t now = NowMillis();
+    for (const auto &item : queues_) {
+        const auto &queue = item.second;
+        draining = draining || queue->draining;
+        const auto &stats = queue->stats;
+        int64_t average = stats.delivered == 0 ? 0 : stats.totalLatency / static_cast<int64_t>(stats.delivered);
+        if (queue->deliveryStart != 0 && now - queue->deliveryStart > SLOW_CALLBACK_MS) {
+            HILOG_WARN("observer %{public}p stuck in a callback for %{public}" PRId64 " ms, pending: %{public}zu, "
+                "average: %{public}" PRId64 " ms, max: %{public}" PRId64 " ms, dropped: %{public}" PRIu64,
+                item.first.GetRefPtr(), now - queue->deliveryStart, queue->events.size(), average,
+                stats.maxLatency, stats.dropped);
+        } else if (queue->events.size() > queueCapacity_ / 2) {
+            HILOG_WARN("observer %{public}p falls behind, pending: %{public}zu, average: %{public}" PRId64
+                " ms, max: %{public}" PRId64 " ms, dropped: %{public}" PRIu64,
+                item.first.GetRefPtr(), queue->events.size(), average, stats.maxLatency, stats.dropped);
+        }
+    }
+    if (draining) {
+        ArmWatchdog();
+    }
+}
+
+void AppStateObserverDispatcher::Enqueue(const std::shared_ptr<ObserverQueue> &queue,
+    const std::shared_ptr<ObserverEvent> &event)
+{
+    auto &events = queue->events;
+    if (IsStateChange(*event)) {
+        // at most one state change of a target is pending.
+        auto it = std::find_if(events.begin(), events.end(),
+            [&event](const std::shared_ptr<ObserverEvent> &pending) { return IsSameTarget(*pending, *event); });
+        if (it != events.end()) {
+            events.erase(it);
+            queue->stats.coalesced++;
+        }
+    }
+    if (events.size() >= queueCapacity_) {
+        auto it = std::find_if(events.begin(), events.end(),
+            [](const std::shared_ptr<ObserverEvent> &pending) { return IsStateChange(*pending); });
+        events.erase(it != events.end() ? it : events.begin());
+        if (queue->stats.dropped++ % DROP_REPORT_INTERVAL == 0) {
+            HILOG_WARN("observer %{public}p queue is full, dropped: %{public}" PRIu64,
+                queue->observer->AsObject().GetRefPtr(), queue->stats.dropped);
+        }
+    }
+    events.emplace_back(event);
+    if (!queue->draining) {
+        StartDrain(queue);
+    }
+}
+
+void AppStateObserverDispatcher::StartDrain(const std::shared_ptr<ObserverQueue> &queue)
+{
+    queue->draining = true;
+    readyQueues_.emplace_back(queue);
+    ArmWatchdog();
+    auto it = std::find(workerRunning_.begin(), workerRunning_.end(), false);
+    if (it == workerRunning_.end()) {
+        // a running worker takes it up.
+        return;
+    }
+    size_t worker = static_cast<size_t>(it - workerRunning_.begin());
+    workerRunning_[worker] = true;
+    auto task = [weak = weak_from_this(), worker]() {
+        auto self = weak.lock();
+        if (self != nullptr) {
+            self->RunWorker(worker);
+        }
+    };
+    workers_[worker]->PostTask(task);
+}
+
+void AppStateObserverDispatcher::RunWorker(size_t worker)
+{
+    while (true) {
+        std::shared_ptr<ObserverQueue> queue;
+        {
+            std::lock_guard<std::mutex> lock(queueLock_);
+            if (readyQueues_.empty()) {
+                workerRunning_[worker] = false;
+                return;
+            }
+            queue = readyQueues_.front();
+            readyQueues_.pop_front();
+        }
+        Drain(queue);
+    }
+}
+
+void AppStateObserverDispatcher::Drain(const std::shared_ptr<ObserverQueue> &queue)
+{
+    std::vector<std::shared_ptr<ObserverEvent>> batch;
+    {
+        std::lock_guard<std::mutex> lock(queueLock_);
+        size_t count = queue->removed ? 0 : std::min(queue->events.size(), MAX_BATCH_SIZE);
+        batch.assign(queue->events.begin(), queue->events.begin() + count);
+        queue->events.erase(queue->events.begin(), queue->events.begin() + count);
+    }
+
+    for (const auto &event : batch) {
+        int64_t start = NowMillis();
+        {
+            std::lock_guard<std::mutex> lock(queueLock_);
+            if (queue->removed) {
+                break;
+            }
+            queue->deliveryStart = start;
+        }
+        Deliver(queue->observer, *event);
+        int64_t latency = NowMillis() - start;
+        std::lock_guard<std::mutex> lock(queueLock_);
+        queue->deliveryStart = 0;
+        queue->stats.delivered++;
+        queue->stats.totalLatency += latency;
+        queue->stats.maxLatency = std::max(queue->stats.maxLatency, latency);
+        if (latency > SLOW_CALLBACK_MS) {
+            HILOG_WARN("observer %{public}p callback took %{public}" PRId64 " ms",
+                queue->observer->AsObject().GetRefPtr(), latency);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(queueLock_);
+    if (!queue->removed && !queue->events.empty()) {
+        // to the back of the ready list, after the other observers waiting.
+        readyQueues_.emplace_back(queue);
+        return;
+    }
+    queue->draining = false;
+}
+
+void AppStateObserverDispatcher::Deliver(const sptr<IApplicationStateObserver> &observer, const ObserverEvent &event)
+{
+    switch (event.type) {
+        case ObserverEventType::FOREGROUND_APPLICATION_CHANGED:
+            observer->OnForegroundApplicationChanged(event.appStateData);
+            break;
+        case ObserverEventType::APPLICATION_STATE_CHANGED:
+            observer->OnApplicationStateChanged(event.appStateData);
+            break;
+        case ObserverEventType::ABILITY_STATE_CHANGED:
+            observer->OnAbilityStateChanged(event.abilityStateData);
+            break;
+        case ObserverEventType::EXTENSION_STATE_CHANGED:
+            observer->OnExtensionStateChanged(event.abilityStateData);
+            break;
+        case ObserverEventType::PROCESS_CREATED:
+            observer->OnProcessCreated(event.processData);
+            break;
+        case ObserverEventType::PROCESS_DIED:
+            observer->OnProcessDied(event.processData);
+            break;
+        default:
+            break;
+    }
+}
+
+void AppStateObserverDispatcher::ArmWatchdog()
+{
+    if (watchdogHandler_ == nullptr || watchdogArmed_) {
+        return;
+    }
+    auto task = [weak = weak_from_this()]() {
+        auto self = weak.lock();
+        if (self != nullptr) {
+            self->CheckSlowObservers();
+        }
+    };
+    watchdogArmed_ = watchdogHandler_->PostTask(task, WATCHDOG_TASK, WATCHDOG_INTERVAL_MS);
+}
+
+int64_t AppStateObserverDispatcher::NowMillis()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
@@ -35,6 +35,9 @@ void AppStateObserverManager::Init()
     if (!handler_) {
         handler_ = std::make_shared<EventHandler>(EventRunner::Create(THREAD_NAME));
     }
+    if (!dispatcher_) {
+        dispatcher_ = std::make_shared<AppStateObserverDispatcher>(handler_);
+    }
 }
 
 int32_t AppStateObserverManager::RegisterApplicationStateObserver(const sptr<IApplicationStateObserver> &observer)
@@ -54,6 +57,9 @@ int32_t AppStateObserverManager::RegisterApplicationStateObserver(const sptr<IAp
         return ERR_INVALID_VALUE;
     }
     appStateObservers_.push_back(observer);
+    if (dispatcher_) {
+        dispatcher_->AddObserver(observer);
+    }
     HILOG_INFO("%{public}s appStateObservers_ size:%{public}d", __func__, (int32_t)appStateObservers_.size());
     AddObserverDeathRecipient(observer);
     return ERR_OK;
@@ -75,6 +81,9 @@ int32_t AppStateObserverManager::UnregisterApplicationStateObserver(const sptr<I
     for (it = appStateObservers_.begin(); it != appStateObservers_.end(); ++it) {
         if ((*it)->AsObject() == observer->AsObject()) {
             appStateObservers_.erase(it);
+            if (dispatcher_) {
+                dispatcher_->RemoveObserver(observer);
+            }
             HILOG_INFO("%{public}s appStateObservers_ size:%{public}d", __func__, (int32_t)appStateObservers_.size());
             RemoveObserverDeathRecipient(observer);
             return ERR_OK;
@@ -145,47 +154,35 @@ void AppStateObserverManager::HandleAppStateChanged(const std::shared_ptr<AppRun
     const ApplicationState state)
 {
     if (state == ApplicationState::APP_STATE_FOREGROUND || state == ApplicationState::APP_STATE_BACKGROUND) {
-        AppStateData data = WrapAppStateData(appRecord, state);
+        auto event = std::make_shared<ObserverEvent>();
+        event->type = ObserverEventType::FOREGROUND_APPLICATION_CHANGED;
+        event->appStateData = WrapAppStateData(appRecord, state);
         HILOG_DEBUG("OnForegroundApplicationChanged, name:%{public}s, uid:%{public}d, state:%{public}d",
-            data.bundleName.c_str(), data.uid, data.state);
-        std::lock_guard<std::recursive_mutex> lockNotify(observerLock_);
-        for (const auto &observer : appStateObservers_) {
-            if (observer != nullptr) {
-                observer->OnForegroundApplicationChanged(data);
-            }
-        }
+            event->appStateData.bundleName.c_str(), event->appStateData.uid, event->appStateData.state);
+        Dispatch(event);
     }
 
     if (state == ApplicationState::APP_STATE_CREATE || state == ApplicationState::APP_STATE_TERMINATED) {
-        AppStateData data = WrapAppStateData(appRecord, state);
+        auto event = std::make_shared<ObserverEvent>();
+        event->type = ObserverEventType::APPLICATION_STATE_CHANGED;
+        event->appStateData = WrapAppStateData(appRecord, state);
         HILOG_INFO("OnApplicationStateChanged, name:%{public}s, uid:%{public}d, state:%{public}d",
-            data.bundleName.c_str(), data.uid, data.state);
-        std::lock_guard<std::recursive_mutex> lockNotify(observerLock_);
-        for (const auto &observer : appStateObservers_) {
-            if (observer != nullptr) {
-                observer->OnApplicationStateChanged(data);
-            }
-        }
+            event->appStateData.bundleName.c_str(), event->appStateData.uid, event->appStateData.state);
+        Dispatch(event);
     }
 }
 
 void AppStateObserverManager::HandleStateChangedNotifyObserver(const AbilityStateData abilityStateData, bool isAbility)
 {
-    std::lock_guard<std::recursive_mutex> lockNotify(observerLock_);
     HILOG_DEBUG("Handle state change, module:%{public}s, bundle:%{public}s, ability:%{public}s, state:%{public}d,"
         "pid:%{public}d ,uid:%{public}d, abilityType:%{public}d, isAbility:%{public}d",
         abilityStateData.moduleName.c_str(), abilityStateData.bundleName.c_str(),
         abilityStateData.abilityName.c_str(), abilityStateData.abilityState,
         abilityStateData.pid, abilityStateData.uid, abilityStateData.abilityType, isAbility);
-    for (const auto &observer : appStateObservers_) {
-        if (observer != nullptr) {
-            if (isAbility) {
-                observer->OnAbilityStateChanged(abilityStateData);
-            } else {
-                observer->OnExtensionStateChanged(abilityStateData);
-            }
-        }
-    }
+    auto event = std::make_shared<ObserverEvent>();
+    event->type = isAbility ? ObserverEventType::ABILITY_STATE_CHANGED : ObserverEventType::EXTENSION_STATE_CHANGED;
+    event->abilityStateData = abilityStateData;
+    Dispatch(event);
 }
 
 void AppStateObserverManager::HandleOnProcessCreated(const std::shared_ptr<AppRunningRecord> &appRecord)
@@ -194,15 +191,12 @@ void AppStateObserverManager::HandleOnProcessCreated(const std::shared_ptr<AppRu
         HILOG_ERROR("app record is null");
         return;
     }
-    ProcessData data = WrapProcessData(appRecord);
-    HILOG_DEBUG("Process Create, bundle:%{public}s, pid:%{public}d, uid:%{public}d, size:%{public}d",
-        data.bundleName.c_str(), data.pid, data.uid, (int32_t)appStateObservers_.size());
-    std::lock_guard<std::recursive_mutex> lockNotify(observerLock_);
-    for (const auto &observer : appStateObservers_) {
-        if (observer != nullptr) {
-            observer->OnProcessCreated(data);
-        }
-    }
+    auto event = std::make_shared<ObserverEvent>();
+    event->type = ObserverEventType::PROCESS_CREATED;
+    event->processData = WrapProcessData(appRecord);
+    HILOG_DEBUG("Process Create, bundle:%{public}s, pid:%{public}d, uid:%{public}d",
+        event->processData.bundleName.c_str(), event->processData.pid, event->processData.uid);
+    Dispatch(event);
 }
 
 void AppStateObserverManager::HandleOnProcessDied(const std::shared_ptr<AppRunningRecord> &appRecord)
@@ -211,15 +205,21 @@ void AppStateObserverManager::HandleOnProcessDied(const std::shared_ptr<AppRunni
         HILOG_ERROR("app record is null");
         return;
     }
-    ProcessData data = WrapProcessData(appRecord);
-    HILOG_DEBUG("Process died, bundle:%{public}s, pid:%{public}d, uid:%{public}d, size:%{public}d.",
-        data.bundleName.c_str(), data.pid, data.uid, (int32_t)appStateObservers_.size());
-    std::lock_guard<std::recursive_mutex> lockNotify(observerLock_);
-    for (const auto &observer : appStateObservers_) {
-        if (observer != nullptr) {
-            observer->OnProcessDied(data);
-        }
+    auto event = std::make_shared<ObserverEvent>();
+    event->type = ObserverEventType::PROCESS_DIED;
+    event->processData = WrapProcessData(appRecord);
+    HILOG_DEBUG("Process died, bundle:%{public}s, pid:%{public}d, uid:%{public}d.",
+        event->processData.bundleName.c_str(), event->processData.pid, event->processData.uid);
+    Dispatch(event);
+}
+
+void AppStateObserverManager::Dispatch(const std::shared_ptr<ObserverEvent> &event)
+{
+    if (!dispatcher_) {
+        HILOG_ERROR("dispatcher is null, call Init first.");
+        return;
     }
+    dispatcher_->Dispatch(event);
 }
 
 ProcessData AppStateObserverManager::WrapProcessData(const std::shared_ptr<AppRunningRecord> &appRecord)
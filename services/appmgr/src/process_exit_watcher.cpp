@@ -0,0 +1,353 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "process_exit_watcher.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <string>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+
+#include "hilog_wrapper.h"
+
+#ifndef SYS_pidfd_open
+#define SYS_pidfd_open 434
+#endif
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace {
+constexpr int MAX_EVENTS = 32;
+// how often the processes without pidfd are checked in /proc.
+constexpr int64_t POLL_INTERVAL_MILLI_SECONDS = 10;
+// pid 0 is never watched, the event of the wakeup eventfd carries it.
+constexpr uint64_t WAKEUP_EVENT = 0;
+}
+
+ProcessExitWatcher::ProcessExitWatcher(bool usePidfd) : usePidfd_(usePidfd)
+{}
+
+ProcessExitWatcher::~ProcessExitWatcher()
+{
+    Stop();
+}
+
+bool ProcessExitWatcher::Start()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_) {
+        return true;
+    }
+    epollFd_ = epoll_create1(EPOLL_CLOEXEC);
+    eventFd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (epollFd_ < 0 || eventFd_ < 0) {
+        HILOG_ERROR("create epoll or eventfd failed, errno: %{public}d", errno);
+        if (epollFd_ >= 0) {
+            close(epollFd_);
+        }
+        if (eventFd_ >= 0) {
+            close(eventFd_);
+        }
+        epollFd_ = -1;
+        eventFd_ = -1;
+        return false;
+    }
+    struct epoll_event event = {};
+    event.events = EPOLLIN;
+    event.data.u64 = WAKEUP_EVENT;
+    epoll_ctl(epollFd_, EPOLL_CTL_ADD, eventFd_, &event);
+    running_ = true;
+    thread_ = std::thread(&ProcessExitWatcher::Run, this);
+    return true;
+}
+
+void ProcessExitWatcher::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        running_ = false;
+    }
+    Wakeup();
+    if (thread_.joinable()) {
+        if (thread_.get_id() == std::this_thread::get_id()) {
+            thread_.detach();
+        } else {
+            thread_.join();
+        }
+    }
+
+    std::list<CompletedWatch> completed;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto &request : requests_) {
+            completed.emplace_back(std::move(request.callback),
+                std::list<pid_t>(request.pids.begin(), request.pids.end()));
+        }
+        requests_.clear();
+        for (const auto &item : processes_) {
+            if (item.second.pidfd >= 0) {
+                close(item.second.pidfd);
+            }
+        }
+        processes_.clear();
+        polledCount_ = 0;
+        close(epollFd_);
+        close(eventFd_);
+        epollFd_ = -1;
+        eventFd_ = -1;
+    }
+    for (const auto &item : completed) {
+        item.first(item.second);
+    }
+}
+
+void ProcessExitWatcher::Watch(const std::list<pid_t> &pids, int64_t timeoutMs, const ExitCallback &callback)
+{
+    if (!callback) {
+        HILOG_ERROR("callback is nullptr");
+        return;
+    }
+    if (!Start()) {
+        // without the thread there is nothing to wait with, end the watch at once.
+        std::list<pid_t> alivePids;
+        for (auto pid : pids) {
+            if (pid > 0 && IsProcessAlive(pid)) {
+                alivePids.push_back(pid);
+            }
+        }
+        callback(alivePids);
+        return;
+    }
+
+    bool queued = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        WatchRequest request;
+        request.deadline = NowMillis() + timeoutMs;
+        request.callback = callback;
+        for (auto pid : pids) {
+            if (pid > 0 && request.pids.count(pid) == 0 && AddProcess(pid)) {
+                request.pids.insert(pid);
+            }
+        }
+        if (!request.pids.empty()) {
+            requests_.emplace_back(std::move(request));
+            queued = true;
+        }
+    }
+    if (!queued) {
+        callback({});
+        return;
+    }
+    // let the thread pick up the new deadline.
+    Wakeup();
+}
+
+void ProcessExitWatcher::NotifyProcessExit(pid_t pid)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (processes_.find(pid) == processes_.end()) {
+            return;
+        }
+        OnProcessExit(pid);
+    }
+    Wakeup();
+}
+
+size_t ProcessExitWatcher::GetWatchCount()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return requests_.size();
+}
+
+void ProcessExitWatcher::Run()
+{
+    struct epoll_event events[MAX_EVENTS];
+    while (true) {
+        int timeout = -1;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!running_) {
+                break;
+            }
+            timeout = GetWaitTimeout(NowMillis());
+        }
+
+        int count = epoll_wait(epollFd_, events, MAX_EVENTS, timeout);
+        std::list<CompletedWatch> completed;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!running_) {
+                break;
+            }
+            for (int i = 0; i < count; i++) {
+                if (events[i].data.u64 == WAKEUP_EVENT) {
+                    uint64_t value = 0;
+                    read(eventFd_, &value, sizeof(value));
+                    continue;
+                }
+                OnProcessExit(static_cast<pid_t>(events[i].data.u64));
+            }
+            if (polledCount_ > 0) {
+                CheckPolledProcesses();
+            }
+            CollectCompletedWatches(NowMillis(), completed);
+        }
+        for (const auto &item : completed) {
+            item.first(item.second);
+        }
+    }
+}
+
+void ProcessExitWatcher::Wakeup()
+{
+    uint64_t value = 1;
+    if (eventFd_ >= 0) {
+        write(eventFd_, &value, sizeof(value));
+    }
+}
+
+bool ProcessExitWatcher::AddProcess(pid_t pid)
+{
+    auto iter = processes_.find(pid);
+    if (iter != processes_.end()) {
+        iter->second.refCount++;
+        return true;
+    }
+
+    WatchedProcess process;
+    process.refCount = 1;
+    if (usePidfd_) {
+        int pidfd = static_cast<int>(syscall(SYS_pidfd_open, pid, 0));
+        if (pidfd < 0 && errno == ESRCH) {
+            return false;
+        }
+        if (pidfd >= 0) {
+            struct epoll_event event = {};
+            event.events = EPOLLIN;
+            event.data.u64 = static_cast<uint64_t>(pid);
+            if (epoll_ctl(epollFd_, EPOLL_CTL_ADD, pidfd, &event) == 0) {
+                process.pidfd = pidfd;
+                processes_.emplace(pid, process);
+                return true;
+            }
+            close(pidfd);
+        }
+        HILOG_WARN("watch pid %{public}d by pidfd failed, errno: %{public}d", pid, errno);
+    }
+
+    if (!IsProcessAlive(pid)) {
+        return false;
+    }
+    processes_.emplace(pid, process);
+    polledCount_++;
+    return true;
+}
+
+void ProcessExitWatcher::ReleaseProcess(pid_t pid)
+{
+    auto iter = processes_.find(pid);
+    if (iter == processes_.end() || --iter->second.refCount > 0) {
+        return;
+    }
+    if (iter->second.pidfd >= 0) {
+        epoll_ctl(epollFd_, EPOLL_CTL_DEL, iter->second.pidfd, nullptr);
+        close(iter->second.pidfd);
+    } else {
+        polledCount_--;
+    }
+    processes_.erase(iter);
+}
+
+void ProcessExitWatcher::OnProcessExit(pid_t pid)
+{
+    auto iter = processes_.find(pid);
+    if (iter == processes_.end()) {
+        return;
+    }
+    for (auto &request : requests_) {
+        request.pids.erase(pid);
+    }
+    // every watch has let go of the process, drop it at once.
+    iter->second.refCount = 1;
+    ReleaseProcess(pid);
+}
+
+void ProcessExitWatcher::CheckPolledProcesses()
+{
+    std::list<pid_t> exitedPids;
+    for (const auto &item : processes_) {
+        if (item.second.pidfd < 0 && !IsProcessAlive(item.first)) {
+            exitedPids.push_back(item.first);
+        }
+    }
+    for (auto pid : exitedPids) {
+        OnProcessExit(pid);
+    }
+}
+
+void ProcessExitWatcher::CollectCompletedWatches(int64_t now, std::list<CompletedWatch> &completed)
+{
+    for (auto iter = requests_.begin(); iter != requests_.end();) {
+        if (!iter->pids.empty() && iter->deadline > now) {
+            ++iter;
+            continue;
+        }
+        std::list<pid_t> alivePids(iter->pids.begin(), iter->pids.end());
+        for (auto pid : alivePids) {
+            ReleaseProcess(pid);
+        }
+        completed.emplace_back(std::move(iter->callback), std::move(alivePids));
+        iter = requests_.erase(iter);
+    }
+}
+
+int ProcessExitWatcher::GetWaitTimeout(int64_t now)
+{
+    if (requests_.empty()) {
+        return -1;
+    }
+    int64_t timeout = requests_.front().deadline - now;
+    for (const auto &request : requests_) {
+        timeout = std::min(timeout, request.deadline - now);
+    }
+    if (polledCount_ > 0) {
+        timeout = std::min(timeout, POLL_INTERVAL_MILLI_SECONDS);
+    }
+    return static_cast<int>(std::max(timeout, static_cast<int64_t>(0)));
+}
+
+bool ProcessExitWatcher::IsProcessAlive(pid_t pid)
+{
+    struct stat statBuf;
+    std::string path = "/proc/" + std::to_string(pid) + "/status";
+    return stat(path.c_str(), &statBuf) == 0;
+}
+
+int64_t ProcessExitWatcher::NowMillis()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
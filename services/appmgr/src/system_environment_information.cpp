@@ -14,43 +14,187 @@
  */
 #include "system_environment_information.h"
 
-#include <cstdio>
-#include <cstdlib>
-#include <iostream>
-#include <map>
-#include <memory>
-#include <regex>
+#include <cerrno>
+#include <chrono>
+#include <fcntl.h>
+#include <iterator>
+#include <mutex>
 #include <string>
+#include <unistd.h>
 
 #include "hilog_wrapper.h"
 #include "kernel_system_memory_info.h"
-#include "securec.h"
 
 namespace OHOS {
 namespace AppExecFwk {
 namespace SystemEnv {
 namespace {
 static const int BYTES_KB = 1024;
+// meminfo is about 1.5K, the fields parsed are in its first lines.
+constexpr size_t READ_BUFFER_SIZE = 8192;
+// how long callers share one snapshot of the memory information.
+constexpr int64_t MEM_INFO_CACHE_TIME_MS = 200;
+const std::string PROC_ROOT = "/proc";
+const std::string MEM_INFO_PATH = "/meminfo";
+const std::string MEM_PRESSURE_PATH = "/pressure/memory";
+
+std::mutex g_snapshotMutex;
+KernelSystemMemoryInfo g_snapshot;
+bool g_snapshotValid = false;
+int64_t g_snapshotTime = 0;
+
+int64_t NowMillis()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
 }
-void KernelSystemMemoryInfo::Init(std::map<std::string, std::string> &memInfo)
+
+bool ReadProcFile(const std::string &path, char *buffer, size_t size, std::string_view &content)
 {
-    auto findData = [&] (const std::string& key) -> std::string {
-        auto iter = memInfo.find(key);
-        if (iter != memInfo.end()) {
-            HILOG_DEBUG("key[%{public}s] data[%{public}s]", key.c_str(), iter->second.c_str());
-            return iter->second;
-        } else {
-            HILOG_ERROR("key[%{public}s]", key.c_str());
-            return std::string("");
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    size_t length = 0;
+    while (length < size) {
+        ssize_t count = pread(fd, buffer + length, size - length, static_cast<off_t>(length));
+        if (count < 0 && errno == EINTR) {
+            continue;
+        }
+        if (count <= 0) {
+            break;
         }
+        length += static_cast<size_t>(count);
+    }
+    close(fd);
+    content = std::string_view(buffer, length);
+    return length > 0;
+}
+
+// the next line of content, without the line feed, content moves past it.
+std::string_view NextLine(std::string_view &content)
+{
+    size_t pos = content.find('\n');
+    std::string_view line = content.substr(0, pos);
+    content = (pos == std::string_view::npos) ? std::string_view() : content.substr(pos + 1);
+    return line;
+}
+
+bool ParseUnsigned(std::string_view text, uint64_t &value)
+{
+    size_t pos = text.find_first_not_of(' ');
+    if (pos == std::string_view::npos || text[pos] < '0' || text[pos] > '9') {
+        return false;
+    }
+    value = 0;
+    for (; pos < text.size() && text[pos] >= '0' && text[pos] <= '9'; pos++) {
+        value = value * 10 + static_cast<uint64_t>(text[pos] - '0');
+    }
+    return true;
+}
+
+bool ParseDecimal(std::string_view text, double &value)
+{
+    size_t dot = text.find('.');
+    uint64_t integer = 0;
+    if (!ParseUnsigned(text.substr(0, dot), integer)) {
+        return false;
+    }
+    value = static_cast<double>(integer);
+    if (dot == std::string_view::npos) {
+        return true;
+    }
+    double scale = 0.1;
+    for (size_t pos = dot + 1; pos < text.size() && text[pos] >= '0' && text[pos] <= '9'; pos++) {
+        value += (text[pos] - '0') * scale;
+        scale /= 10;
+    }
+    return true;
+}
+}
+
+bool KernelSystemMemoryInfo::ParseMemInfo(std::string_view content)
+{
+    struct Field {
+        std::string_view key;
+        int64_t *value;
+    };
+    Field fields[] = {
+        { "MemTotal", &memTotal_ },
+        { "MemFree", &memFree_ },
+        { "MemAvailable", &memAvailable_ },
+        { "Buffers", &buffers_ },
+        { "Cached", &cached_ },
+        { "SwapCached", &swapCached_ },
     };
+    size_t found = 0;
+    while (!content.empty() && found < std::size(fields)) {
+        std::string_view line = NextLine(content);
+        size_t colon = line.find(':');
+        if (colon == std::string_view::npos) {
+            continue;
+        }
+        std::string_view key = line.substr(0, colon);
+        for (auto &field : fields) {
+            uint64_t value = 0;
+            if (field.key == key && ParseUnsigned(line.substr(colon + 1), value)) {
+                *field.value = static_cast<int64_t>(value) * BYTES_KB;
+                found++;
+                break;
+            }
+        }
+    }
+    if (found < std::size(fields)) {
+        HILOG_ERROR("meminfo has %{public}zu of %{public}zu fields", found, std::size(fields));
+        return false;
+    }
+    return true;
+}
 
-    memTotal_ = std::stoll(findData(std::string("MemTotal"))) * BYTES_KB;
-    memFree_ = std::stoll(findData(std::string("MemFree"))) * BYTES_KB;
-    memAvailable_ = std::stoll(findData(std::string("MemAvailable"))) * BYTES_KB;
-    buffers_ = std::stoll(findData(std::string("Buffers"))) * BYTES_KB;
-    cached_ = std::stoll(findData(std::string("Cached"))) * BYTES_KB;
-    swapCached_ = std::stoll(findData(std::string("SwapCached"))) * BYTES_KB;
+bool KernelSystemMemoryInfo::ParsePressure(std::string_view content)
+{
+    bool hasSome = false;
+    bool hasFull = false;
+    while (!content.empty()) {
+        std::string_view line = NextLine(content);
+        size_t space = line.find(' ');
+        std::string_view kind = line.substr(0, space);
+        if (kind == "some") {
+            hasSome = ParsePressureLine(line.substr(space + 1), pressureSome_);
+        } else if (kind == "full") {
+            hasFull = ParsePressureLine(line.substr(space + 1), pressureFull_);
+        }
+    }
+    hasPressure_ = hasSome && hasFull;
+    return hasPressure_;
+}
+
+bool KernelSystemMemoryInfo::ParsePressureLine(std::string_view line, PressureInfo &info)
+{
+    size_t found = 0;
+    while (!line.empty()) {
+        size_t space = line.find(' ');
+        std::string_view item = line.substr(0, space);
+        line = (space == std::string_view::npos) ? std::string_view() : line.substr(space + 1);
+        size_t equal = item.find('=');
+        if (equal == std::string_view::npos) {
+            continue;
+        }
+        std::string_view key = item.substr(0, equal);
+        std::string_view value = item.substr(equal + 1);
+        bool parsed = false;
+        if (key == "avg10") {
+            parsed = ParseDecimal(value, info.avg10);
+        } else if (key == "avg60") {
+            parsed = ParseDecimal(value, info.avg60);
+        } else if (key == "avg300") {
+            parsed = ParseDecimal(value, info.avg300);
+        } else if (key == "total") {
+            parsed = ParseUnsigned(value, info.total);
+        }
+        found += parsed ? 1 : 0;
+    }
+    return found == 4;
 }
 
 int64_t KernelSystemMemoryInfo::GetMemTotal() const
@@ -83,50 +227,80 @@ int64_t KernelSystemMemoryInfo::GetSwapCached() const
     return swapCached_;
 }
 
-static void RequestSystemMemoryInfo(std::map<std::string, std::string> &memInfo)
+bool KernelSystemMemoryInfo::HasPressure() const
 {
-    std::regex rLabel("[\\w()]+");
-    std::regex rData("\\d+");
-    const int buffsize = 1024;
-    char buff[buffsize] = {0};
+    return hasPressure_;
+}
 
-    FILE *fp = popen("cat /proc/meminfo", "r");
-    if (fp == nullptr) {
-        HILOG_ERROR("open meminfo failed");
-        return;
-    }
+double KernelSystemMemoryInfo::GetPressureSomeAvg10() const
+{
+    return pressureSome_.avg10;
+}
 
-    while (fgets(buff, sizeof(buff), fp) != nullptr) {
-        std::string strbuf(buff);
-        (void)memset_s(buff, sizeof(buff), 0x00, sizeof(buff));
-        std::smatch sm;
-        std::smatch smData;
-        bool flag = false;
-        flag = std::regex_search(strbuf, sm, rLabel);
-        if (!flag) {
-            HILOG_ERROR("open meminfo failed");
-            continue;
-        }
-        std::string strLabel = sm[0];
-        strbuf = sm.suffix().str();
-        flag = std::regex_search(strbuf, sm, rData);
-        if (!flag) {
-            HILOG_ERROR("open meminfo failed");
-            continue;
-        }
-        std::string strData = sm[0];
-        memInfo[strLabel] = strData;
-    }
+double KernelSystemMemoryInfo::GetPressureSomeAvg60() const
+{
+    return pressureSome_.avg60;
+}
+
+double KernelSystemMemoryInfo::GetPressureSomeAvg300() const
+{
+    return pressureSome_.avg300;
+}
+
+uint64_t KernelSystemMemoryInfo::GetPressureSomeTotal() const
+{
+    return pressureSome_.total;
+}
+
+double KernelSystemMemoryInfo::GetPressureFullAvg10() const
+{
+    return pressureFull_.avg10;
+}
 
-    pclose(fp);
-    fp = nullptr;
+double KernelSystemMemoryInfo::GetPressureFullAvg60() const
+{
+    return pressureFull_.avg60;
+}
+
+double KernelSystemMemoryInfo::GetPressureFullAvg300() const
+{
+    return pressureFull_.avg300;
+}
+
+uint64_t KernelSystemMemoryInfo::GetPressureFullTotal() const
+{
+    return pressureFull_.total;
+}
+
+bool ReadMemInfo(const std::string &procRoot, KernelSystemMemoryInfo &memInfo)
+{
+    char buffer[READ_BUFFER_SIZE];
+    std::string_view content;
+    if (!ReadProcFile(procRoot + MEM_INFO_PATH, buffer, sizeof(buffer), content)) {
+        HILOG_ERROR("read meminfo failed, errno: %{public}d", errno);
+        return false;
+    }
+    if (!memInfo.ParseMemInfo(content)) {
+        return false;
+    }
+    // kernels without CONFIG_PSI have no pressure file.
+    if (ReadProcFile(procRoot + MEM_PRESSURE_PATH, buffer, sizeof(buffer), content)) {
+        memInfo.ParsePressure(content);
+    }
+    return true;
 }
 
 void GetMemInfo(KernelSystemMemoryInfo &memInfo)
 {
-    std::map<std::string, std::string> memListInfo;
-    RequestSystemMemoryInfo(memListInfo);
-    memInfo.Init(memListInfo);
+    std::lock_guard<std::mutex> lock(g_snapshotMutex);
+    int64_t now = NowMillis();
+    if (!g_snapshotValid || now - g_snapshotTime >= MEM_INFO_CACHE_TIME_MS) {
+        KernelSystemMemoryInfo snapshot;
+        g_snapshotValid = ReadMemInfo(PROC_ROOT, snapshot);
+        g_snapshot = snapshot;
+        g_snapshotTime = now;
+    }
+    memInfo = g_snapshot;
 }
 }  // namespace SystemEnv
 }  // namespace AppExecFwk
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_SERVICES_APPMGR_TEST_UT_FAKE_APP_SPAWN_SOCKET_H
+#define FOUNDATION_APPEXECFWK_SERVICES_APPMGR_TEST_UT_FAKE_APP_SPAWN_SOCKET_H
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "app_spawn_msg_wrapper.h"
+#include "app_spawn_socket.h"
+#include "securec.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+/**
+ * FakeAppSpawner stands in for the appspawn daemon, every request written to one of its sockets
+ * is answered with the next pid, replyDelay after it was written. Set failOpenCount or failReadCount
+ * to make that many requests fail.
+ */
+struct FakeAppSpawner {
+    std::chrono::microseconds replyDelay { 0 };
+    std::atomic<int32_t> nextPid { 1000 };
+    std::atomic<int32_t> openCount { 0 };
+    std::atomic<int32_t> writeCount { 0 };
+    std::atomic<int32_t> failOpenCount { 0 };
+    std::atomic<int32_t> failReadCount { 0 };
+};
+
+class FakeAppSpawnSocket : public AppSpawnSocket {
+public:
+    explicit FakeAppSpawnSocket(const std::shared_ptr<FakeAppSpawner> &spawner)
+        : AppSpawnSocket(false), spawner_(spawner)
+    {}
+    virtual ~FakeAppSpawnSocket() = default;
+
+    ErrCode OpenAppSpawnConnection() override
+    {
+        if (spawner_->failOpenCount.fetch_sub(1) > 0) {
+            return ERR_APPEXECFWK_CONNECT_APPSPAWN_FAILED;
+        }
+        spawner_->openCount++;
+        return ERR_OK;
+    }
+
+    void CloseAppSpawnConnection() override
+    {}
+
+    ErrCode WriteMessage(const void *buf, const int32_t len) override
+    {
+        if (buf == nullptr || len <= 0) {
+            return ERR_INVALID_VALUE;
+        }
+        spawner_->writeCount++;
+        pending_ = true;
+        replyTime_ = std::chrono::steady_clock::now() + spawner_->replyDelay;
+        return ERR_OK;
+    }
+
+    ErrCode ReadMessage(void *buf, const int32_t len) override
+    {
+        if (buf == nullptr || len != static_cast<int32_t>(LEN_PID) || !pending_) {
+            return ERR_INVALID_VALUE;
+        }
+        pending_ = false;
+        std::this_thread::sleep_until(replyTime_);
+        if (spawner_->failReadCount.fetch_sub(1) > 0) {
+            return ERR_APPEXECFWK_SOCKET_READ_FAILED;
+        }
+        AppSpawnPidMsg msg;
+        msg.pid = spawner_->nextPid++;
+        if (memcpy_s(buf, len, msg.pidBuf, LEN_PID) != 0) {
+            return ERR_APPEXECFWK_SOCKET_READ_FAILED;
+        }
+        return ERR_OK;
+    }
+
+private:
+    std::shared_ptr<FakeAppSpawner> spawner_;
+    bool pending_ = false;
+    std::chrono::steady_clock::time_point replyTime_;
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif  // FOUNDATION_APPEXECFWK_SERVICES_APPMGR_TEST_UT_FAKE_APP_SPAWN_SOCKET_H
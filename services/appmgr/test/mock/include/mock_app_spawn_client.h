@@ -23,7 +23,10 @@ namespace AppExecFwk {
 class MockAppSpawnClient : public AppSpawnClient {
 public:
     MockAppSpawnClient()
-    {}
+    {
+        // start batches one by one, so they reach the mocked StartProcess.
+        SetSocketFactory(nullptr);
+    }
     virtual ~MockAppSpawnClient()
     {}
     MOCK_METHOD2(StartProcess, ErrCode(const AppSpawnStartMsg &startMsg, pid_t &pid));
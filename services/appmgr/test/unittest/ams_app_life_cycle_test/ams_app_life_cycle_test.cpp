@@ -1406,7 +1406,7 @@ HWTEST_F(AmsAppLifeCycleTest, KillApplication_002, TestSize.Level1)
 
     pid_t pid = fork();
     if (pid > 0) {
-        appRecord->GetPriorityObject()->SetPid(pid);
+        serviceInner_->appRunningManager_->SetAppRunningRecordPid(appRecord, pid);
     }
 
     sptr<MockAppScheduler> mockAppScheduler = new MockAppScheduler();
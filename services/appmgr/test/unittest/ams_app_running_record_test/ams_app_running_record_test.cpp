@@ -1672,5 +1672,96 @@ HWTEST_F(AmsAppRunningRecordTest, Specified_LaunchApplication_001, TestSize.Leve
     auto ability = record->GetAbilityRunningRecord(GetTestAbilityName(), hapModuleInfo.moduleName);
     EXPECT_TRUE(ability->GetState() != AbilityState::ABILITY_STATE_READY);
 }
+
+/*
+ * Feature: AMS
+ * Function: AppRunningManager
+ * SubFunction: GetAppRunningRecordByPid
+ * FunctionPoints: check the pid index
+ * EnvConditions: NA
+ * CaseDescription: Lookups by pid follow the pids set through the manager and removed records.
+ */
+HWTEST_F(AmsAppRunningRecordTest, AppRunningManager_PidIndex_001, TestSize.Level1)
+{
+    auto appRunningManager = std::make_shared<AppRunningManager>();
+    auto appInfo = std::make_shared<ApplicationInfo>();
+    appInfo->name = GetTestAppName();
+    BundleInfo bundleInfo;
+    bundleInfo.appId = "com.ohos.test.helloworld_code123";
+    auto record1 = appRunningManager->CreateAppRunningRecord(appInfo, GetTestProcessName(), bundleInfo);
+    auto record2 = appRunningManager->CreateAppRunningRecord(appInfo, GetTestProcessName() + "2", bundleInfo);
+    ASSERT_NE(record1, nullptr);
+    ASSERT_NE(record2, nullptr);
+    EXPECT_EQ(appRunningManager->GetAppRunningRecordByPid(0), nullptr);
+    appRunningManager->SetAppRunningRecordPid(record1, 1001);
+    appRunningManager->SetAppRunningRecordPid(record2, 1002);
+    EXPECT_EQ(appRunningManager->GetAppRunningRecordByPid(1001), record1);
+    EXPECT_EQ(appRunningManager->GetAppRunningRecordByPid(1002), record2);
+
+    appRunningManager->SetAppRunningRecordPid(record1, 1003);
+    EXPECT_EQ(record1->GetPriorityObject()->GetPid(), 1003);
+    EXPECT_EQ(appRunningManager->GetAppRunningRecordByPid(1001), nullptr);
+    EXPECT_EQ(appRunningManager->GetAppRunningRecordByPid(1003), record1);
+
+    appRunningManager->RemoveAppRunningRecordById(record2->GetRecordId());
+    EXPECT_EQ(appRunningManager->GetAppRunningRecordByPid(1002), nullptr);
+    EXPECT_TRUE(appRunningManager->pidIndex_.find(1002) == appRunningManager->pidIndex_.end());
+
+    // a removed record is not indexed again.
+    appRunningManager->SetAppRunningRecordPid(record2, 1004);
+    EXPECT_EQ(appRunningManager->GetAppRunningRecordByPid(1004), nullptr);
+}
+
+/*
+ * Feature: AMS
+ * Function: AppRunningManager
+ * SubFunction: CheckAppRunningRecordIsExist
+ * FunctionPoints: check the process index and the ability token index
+ * EnvConditions: NA
+ * CaseDescription: Records are found by process name, sign code and joint user id, and by ability token.
+ */
+HWTEST_F(AmsAppRunningRecordTest, AppRunningManager_ProcessIndex_001, TestSize.Level1)
+{
+    auto appRunningManager = std::make_shared<AppRunningManager>();
+    auto appInfo = std::make_shared<ApplicationInfo>();
+    appInfo->name = GetTestAppName();
+    appInfo->bundleName = GetTestAppName();
+    BundleInfo bundleInfo;
+    bundleInfo.appId = "com.ohos.test.helloworld_code123";
+    bundleInfo.jointUserId = "joint456";
+    auto record = appRunningManager->CreateAppRunningRecord(appInfo, GetTestProcessName(), bundleInfo);
+    ASSERT_NE(record, nullptr);
+    EXPECT_EQ(record->GetSignCode(), "code123");
+
+    BundleInfo sameSignBundleInfo = bundleInfo;
+    sameSignBundleInfo.appId = "com.ohos.test.other_code123";
+    EXPECT_EQ(appRunningManager->CheckAppRunningRecordIsExist(
+        appInfo->name, GetTestProcessName(), appInfo->uid, sameSignBundleInfo), record);
+    BundleInfo otherSignBundleInfo = bundleInfo;
+    otherSignBundleInfo.appId = "com.ohos.test.helloworld_code456";
+    EXPECT_EQ(appRunningManager->CheckAppRunningRecordIsExist(
+        appInfo->name, GetTestProcessName(), appInfo->uid, otherSignBundleInfo), nullptr);
+    EXPECT_EQ(appRunningManager->CheckAppRunningRecordIsExist(
+        appInfo->name, GetTestProcessName() + "2", appInfo->uid, bundleInfo), nullptr);
+
+    auto abilityInfo = std::make_shared<AbilityInfo>();
+    abilityInfo->name = GetTestAbilityName();
+    HapModuleInfo hapModuleInfo;
+    hapModuleInfo.moduleName = "module789";
+    record->AddModule(appInfo, abilityInfo, GetMockToken(), hapModuleInfo, nullptr);
+    EXPECT_EQ(appRunningManager->GetAppRunningRecordByAbilityToken(GetMockToken()), record);
+
+    // the token leaves the index with its ability and comes back with it.
+    record->ClearAbility(record->GetAbilityRunningRecordByToken(GetMockToken()));
+    EXPECT_EQ(appRunningManager->GetAppRunningRecordByAbilityToken(GetMockToken()), nullptr);
+    record->AddModule(appInfo, abilityInfo, GetMockToken(), hapModuleInfo, nullptr);
+    EXPECT_EQ(appRunningManager->GetAppRunningRecordByAbilityToken(GetMockToken()), record);
+
+    appRunningManager->RemoveAppRunningRecordById(record->GetRecordId());
+    EXPECT_EQ(appRunningManager->GetAppRunningRecordByAbilityToken(GetMockToken()), nullptr);
+    EXPECT_EQ(appRunningManager->CheckAppRunningRecordIsExist(
+        appInfo->name, GetTestProcessName(), appInfo->uid, bundleInfo), nullptr);
+    EXPECT_TRUE(appRunningManager->processNameIndex_.empty());
+}
 }  // namespace AppExecFwk
 }  // namespace OHOS
@@ -38,6 +38,9 @@ const int32_t INDEX_NUM_1 = 1;
 const int32_t INDEX_NUM_2 = 2;
 const int32_t INDEX_NUM_3 = 3;
 const int32_t PID_MAX = 0x8000;
+// longer than the exit timeout of the killed processes.
+const int32_t WAIT_KILL_TIMEOUT_MS = 2000;
+const int32_t WAIT_KILL_INTERVAL_MS = 10;
 }  // namespace
 class AmsRecentAppListTest : public testing::Test {
 public:
@@ -51,6 +54,7 @@ protected:
     const std::shared_ptr<ApplicationInfo> GetApplicationByIndex(const int32_t index) const;
     const std::shared_ptr<AppRunningRecord> GetAppRunningRecordByIndex(const int32_t index) const;
     void StartProcessSuccess(const int32_t index) const;
+    bool WaitForRecentAppListEmpty() const;
 
     std::unique_ptr<AppMgrServiceInner> serviceInner_;
     sptr<MockAbilityToken> mockToken_;
@@ -91,6 +95,18 @@ const std::shared_ptr<ApplicationInfo> AmsRecentAppListTest::GetApplicationByInd
     return appInfo;
 }
 
+bool AmsRecentAppListTest::WaitForRecentAppListEmpty() const
+{
+    // the recent app list is updated once the killed processes are gone, not when the kill returns.
+    for (int32_t waited = 0; waited < WAIT_KILL_TIMEOUT_MS; waited += WAIT_KILL_INTERVAL_MS) {
+        if (serviceInner_->GetRecentAppList().empty()) {
+            return true;
+        }
+        usleep(WAIT_KILL_INTERVAL_MS * 1000);
+    }
+    return serviceInner_->GetRecentAppList().empty();
+}
+
 const std::shared_ptr<AppRunningRecord> AmsRecentAppListTest::GetAppRunningRecordByIndex(const int32_t index) const
 {
     auto appInfo = GetApplicationByIndex(index);
@@ -285,7 +301,7 @@ HWTEST_F(AmsRecentAppListTest, Remove_001, TestSize.Level1)
     EXPECT_CALL(*mockAppScheduler, ScheduleProcessSecurityExit()).Times(1);
 
     serviceInner_->RemoveAppFromRecentList(appInfo->name, appInfo->bundleName);
-    EXPECT_TRUE(serviceInner_->GetRecentAppList().empty());
+    EXPECT_TRUE(WaitForRecentAppListEmpty());
 }
 
 /*
@@ -21,6 +21,7 @@
 #include <gtest/gtest.h>
 #include "securec.h"
 #include "hilog_wrapper.h"
+#include "fake_app_spawn_socket.h"
 #include "mock_app_spawn_socket.h"
 
 using namespace testing::ext;
@@ -746,3 +747,105 @@ HWTEST_F(AmsServiceAppSpawnClientTest, ReConnectAppSpawn_006, TestSize.Level1)
     EXPECT_EQ(ERR_APPEXECFWK_SOCKET_READ_FAILED, result);
     HILOG_INFO("ams_service_reconnect_app_spawn_006 end");
 }
+
+/*
+ * Feature: AppMgrService
+ * Function: Service
+ * SubFunction: StartProcesses
+ * FunctionPoints: Test AppSpawnClient pipelined batch start.
+ * EnvConditions: mobile that can run ohos test framework
+ * CaseDescription: Verify if AppSpawnClient starts a batch larger than one pipeline window, one connection per
+ *                  request, and reports every pid in order.
+ */
+HWTEST_F(AmsServiceAppSpawnClientTest, StartProcesses_001, TestSize.Level1)
+{
+    HILOG_INFO("ams_service_start_processes_001 start");
+    std::shared_ptr<AppSpawnClient> appSpawnClient = std::make_shared<AppSpawnClient>();
+    auto spawner = std::make_shared<FakeAppSpawner>();
+    appSpawnClient->SetSocketFactory([spawner]() { return std::make_shared<FakeAppSpawnSocket>(spawner); });
+    const size_t count = 20;
+    std::vector<AppSpawnStartMsg> startMsgs(count, {10001, 10001, {10001, 10002}, "processName", "soPath"});
+    std::vector<size_t> indexes;
+    std::vector<pid_t> pids;
+    appSpawnClient->StartProcesses(startMsgs, [&indexes, &pids](size_t index, ErrCode errCode, pid_t pid) {
+        EXPECT_EQ(ERR_OK, errCode);
+        indexes.push_back(index);
+        pids.push_back(pid);
+    });
+    ASSERT_EQ(count, indexes.size());
+    for (size_t i = 0; i < count; i++) {
+        EXPECT_EQ(i, indexes[i]);
+        EXPECT_EQ(static_cast<pid_t>(1000 + i), pids[i]);
+    }
+    EXPECT_EQ(static_cast<int32_t>(count), spawner->openCount.load());
+    EXPECT_EQ(static_cast<int32_t>(count), spawner->writeCount.load());
+    HILOG_INFO("ams_service_start_processes_001 end");
+}
+
+/*
+ * Feature: AppMgrService
+ * Function: Service
+ * SubFunction: StartProcesses
+ * FunctionPoints: Test AppSpawnClient pipelined batch start.
+ * EnvConditions: mobile that can run ohos test framework
+ * CaseDescription: Verify if a request that fails in the pipeline is retried through StartProcess.
+ */
+HWTEST_F(AmsServiceAppSpawnClientTest, StartProcesses_002, TestSize.Level1)
+{
+    HILOG_INFO("ams_service_start_processes_002 start");
+    std::shared_ptr<AppSpawnClient> appSpawnClient = std::make_shared<AppSpawnClient>();
+    auto spawner = std::make_shared<FakeAppSpawner>();
+    spawner->failOpenCount = 1;
+    appSpawnClient->SetSocketFactory([spawner]() { return std::make_shared<FakeAppSpawnSocket>(spawner); });
+    std::shared_ptr<MockAppSpawnSocket> socketMock = std::make_shared<MockAppSpawnSocket>();
+    appSpawnClient->SetSocket(socketMock);
+    pid_t expectPid = 11111;
+    socketMock->SetExpectPid(expectPid);
+    EXPECT_CALL(*socketMock, OpenAppSpawnConnection()).WillOnce(Return(ERR_OK));
+    EXPECT_CALL(*socketMock, WriteMessage(_, _)).WillOnce(Return(ERR_OK));
+    EXPECT_CALL(*socketMock, ReadMessage(_, _)).WillOnce(Invoke(socketMock.get(), &MockAppSpawnSocket::ReadImpl));
+    EXPECT_CALL(*socketMock, CloseAppSpawnConnection()).Times(1);
+    std::vector<AppSpawnStartMsg> startMsgs(2, {10001, 10001, {10001, 10002}, "processName", "soPath"});
+    std::vector<pid_t> pids(startMsgs.size(), 0);
+    appSpawnClient->StartProcesses(startMsgs, [&pids](size_t index, ErrCode errCode, pid_t pid) {
+        EXPECT_EQ(ERR_OK, errCode);
+        pids[index] = pid;
+    });
+    EXPECT_EQ(expectPid, pids[0]);
+    EXPECT_EQ(1000, pids[1]);
+    HILOG_INFO("ams_service_start_processes_002 end");
+}
+
+/*
+ * Feature: AppMgrService
+ * Function: Service
+ * SubFunction: StartProcesses
+ * FunctionPoints: Test AppSpawnClient pipelined batch start.
+ * EnvConditions: mobile that can run ohos test framework
+ * CaseDescription: Verify if a request sent but with no pid read back fails, and is not sent again.
+ */
+HWTEST_F(AmsServiceAppSpawnClientTest, StartProcesses_003, TestSize.Level1)
+{
+    HILOG_INFO("ams_service_start_processes_003 start");
+    std::shared_ptr<AppSpawnClient> appSpawnClient = std::make_shared<AppSpawnClient>();
+    auto spawner = std::make_shared<FakeAppSpawner>();
+    spawner->failReadCount = 1;
+    appSpawnClient->SetSocketFactory([spawner]() { return std::make_shared<FakeAppSpawnSocket>(spawner); });
+    std::shared_ptr<MockAppSpawnSocket> socketMock = std::make_shared<MockAppSpawnSocket>();
+    appSpawnClient->SetSocket(socketMock);
+    EXPECT_CALL(*socketMock, OpenAppSpawnConnection()).Times(0);
+    EXPECT_CALL(*socketMock, WriteMessage(_, _)).Times(0);
+    std::vector<AppSpawnStartMsg> startMsgs(2, {10001, 10001, {10001, 10002}, "processName", "soPath"});
+    std::vector<ErrCode> results(startMsgs.size(), ERR_OK);
+    std::vector<pid_t> pids(startMsgs.size(), 0);
+    appSpawnClient->StartProcesses(startMsgs, [&results, &pids](size_t index, ErrCode errCode, pid_t pid) {
+        results[index] = errCode;
+        pids[index] = pid;
+    });
+    EXPECT_EQ(ERR_APPEXECFWK_SOCKET_READ_FAILED, results[0]);
+    EXPECT_EQ(0, pids[0]);
+    EXPECT_EQ(ERR_OK, results[1]);
+    EXPECT_EQ(1000, pids[1]);
+    EXPECT_EQ(static_cast<int32_t>(startMsgs.size()), spawner->writeCount.load());
+    HILOG_INFO("ams_service_start_processes_003 end");
+}
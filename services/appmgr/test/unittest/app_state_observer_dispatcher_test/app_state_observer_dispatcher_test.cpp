@@ -0,0 +1,291 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "app_state_observer_dispatcher.h"
+#include "application_state_observer_stub.h"
+
+using namespace testing::ext;
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace {
+constexpr auto WAIT_TIME = std::chrono::seconds(5);
+constexpr size_t QUEUE_CAPACITY = 4;
+
+// records the state, or the pid, of every notification it gets, and can be held in a callback.
+class RecordingObserver : public ApplicationStateObserverStub {
+public:
+    void OnForegroundApplicationChanged(const AppStateData &appStateData) override
+    {
+        Record(appStateData.state);
+    }
+
+    void OnApplicationStateChanged(const AppStateData &appStateData) override
+    {
+        Record(appStateData.state);
+    }
+
+    void OnAbilityStateChanged(const AbilityStateData &abilityStateData) override
+    {
+        Record(abilityStateData.abilityState);
+    }
+
+    void OnExtensionStateChanged(const AbilityStateData &abilityStateData) override
+    {
+        Record(abilityStateData.abilityState);
+    }
+
+    void OnProcessCreated(const ProcessData &processData) override
+    {
+        Record(processData.pid);
+    }
+
+    void OnProcessDied(const ProcessData &processData) override
+    {
+        Record(processData.pid);
+    }
+
+    void Hold()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        held_ = true;
+    }
+
+    void Release()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        held_ = false;
+        cv_.notify_all();
+    }
+
+    bool WaitFor(size_t count)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, WAIT_TIME, [this, count] { return values_.size() >= count; });
+    }
+
+    std::vector<int32_t> GetValues()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return values_;
+    }
+
+private:
+    void Record(int32_t value)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        values_.push_back(value);
+        cv_.notify_all();
+        cv_.wait(lock, [this] { return !held_; });
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool held_ = false;
+    std::vector<int32_t> values_;
+};
+
+std::shared_ptr<ObserverEvent> MakeProcessEvent(ObserverEventType type, pid_t pid)
+{
+    auto event = std::make_shared<ObserverEvent>();
+    event->type = type;
+    event->processData.pid = pid;
+    return event;
+}
+
+std::shared_ptr<ObserverEvent> MakeAbilityEvent(const sptr<IRemoteObject> &token, int32_t state)
+{
+    auto event = std::make_shared<ObserverEvent>();
+    event->type = ObserverEventType::ABILITY_STATE_CHANGED;
+    event->abilityStateData.token = token;
+    event->abilityStateData.abilityState = state;
+    return event;
+}
+}  // namespace
+
+class AppStateObserverDispatcherTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp(void) override;
+    void TearDown(void) override;
+
+    std::shared_ptr<AppStateObserverDispatcher> dispatcher_;
+};
+
+void AppStateObserverDispatcherTest::SetUpTestCase(void)
+{}
+
+void AppStateObserverDispatcherTest::TearDownTestCase(void)
+{}
+
+void AppStateObserverDispatcherTest::SetUp(void)
+{
+    dispatcher_ = std::make_shared<AppStateObserverDispatcher>(nullptr,
+        AppStateObserverDispatcher::DEFAULT_WORKER_COUNT, QUEUE_CAPACITY);
+}
+
+void AppStateObserverDispatcherTest::TearDown(void)
+{
+    dispatcher_.reset();
+}
+
+/*
+ * Feature: AppStateObserverDispatcher
+ * Function: Dispatch
+ * SubFunction: NA
+ * FunctionPoints: Deliver notifications
+ * CaseDescription: Every observer gets every notification, in the order they were dispatched.
+ */
+HWTEST_F(AppStateObserverDispatcherTest, Dispatch_001, TestSize.Level1)
+{
+    sptr<RecordingObserver> first = new RecordingObserver();
+    sptr<RecordingObserver> second = new RecordingObserver();
+    dispatcher_->AddObserver(first);
+    dispatcher_->AddObserver(second);
+
+    std::vector<int32_t> pids = { 100, 101, 102 };
+    for (auto pid : pids) {
+        dispatcher_->Dispatch(MakeProcessEvent(ObserverEventType::PROCESS_CREATED, pid));
+    }
+    ASSERT_TRUE(first->WaitFor(pids.size()));
+    ASSERT_TRUE(second->WaitFor(pids.size()));
+    EXPECT_EQ(first->GetValues(), pids);
+    EXPECT_EQ(second->GetValues(), pids);
+
+    ObserverStats stats;
+    ASSERT_TRUE(dispatcher_->GetStats(first, stats));
+    EXPECT_EQ(stats.delivered, pids.size());
+    EXPECT_EQ(stats.dropped, 0U);
+}
+
+/*
+ * Feature: AppStateObserverDispatcher
+ * Function: Dispatch
+ * SubFunction: NA
+ * FunctionPoints: Isolate slow observers
+ * CaseDescription: An observer held in a callback does not delay the other observers.
+ */
+HWTEST_F(AppStateObserverDispatcherTest, Dispatch_002, TestSize.Level1)
+{
+    sptr<RecordingObserver> slow = new RecordingObserver();
+    sptr<RecordingObserver> fast = new RecordingObserver();
+    slow->Hold();
+    dispatcher_->AddObserver(slow);
+    dispatcher_->AddObserver(fast);
+
+    dispatcher_->Dispatch(MakeProcessEvent(ObserverEventType::PROCESS_CREATED, 100));
+    dispatcher_->Dispatch(MakeProcessEvent(ObserverEventType::PROCESS_DIED, 100));
+    EXPECT_TRUE(fast->WaitFor(2));
+    ASSERT_TRUE(slow->WaitFor(1));
+    EXPECT_EQ(slow->GetValues().size(), 1U);
+
+    slow->Release();
+    EXPECT_TRUE(slow->WaitFor(2));
+}
+
+/*
+ * Feature: AppStateObserverDispatcher
+ * Function: Dispatch
+ * SubFunction: NA
+ * FunctionPoints: Coalesce state changes
+ * CaseDescription: A pending state change of an ability is replaced by its newer one, lifecycle ones are kept.
+ */
+HWTEST_F(AppStateObserverDispatcherTest, Dispatch_003, TestSize.Level1)
+{
+    sptr<RecordingObserver> observer = new RecordingObserver();
+    sptr<IRemoteObject> token = new RecordingObserver();
+    observer->Hold();
+    dispatcher_->AddObserver(observer);
+
+    dispatcher_->Dispatch(MakeProcessEvent(ObserverEventType::PROCESS_CREATED, 100));
+    ASSERT_TRUE(observer->WaitFor(1));
+    dispatcher_->Dispatch(MakeAbilityEvent(token, static_cast<int32_t>(AbilityState::ABILITY_STATE_FOREGROUND)));
+    dispatcher_->Dispatch(MakeProcessEvent(ObserverEventType::PROCESS_CREATED, 101));
+    dispatcher_->Dispatch(MakeAbilityEvent(token, static_cast<int32_t>(AbilityState::ABILITY_STATE_BACKGROUND)));
+    observer->Release();
+
+    std::vector<int32_t> expected = { 100, 101, static_cast<int32_t>(AbilityState::ABILITY_STATE_BACKGROUND) };
+    ASSERT_TRUE(observer->WaitFor(expected.size()));
+    EXPECT_EQ(observer->GetValues(), expected);
+    ObserverStats stats;
+    ASSERT_TRUE(dispatcher_->GetStats(observer, stats));
+    EXPECT_EQ(stats.coalesced, 1U);
+}
+
+/*
+ * Feature: AppStateObserverDispatcher
+ * Function: Dispatch
+ * SubFunction: NA
+ * FunctionPoints: Bound the queue
+ * CaseDescription: A full queue drops its oldest state change first, then its oldest notification.
+ */
+HWTEST_F(AppStateObserverDispatcherTest, Dispatch_004, TestSize.Level1)
+{
+    sptr<RecordingObserver> observer = new RecordingObserver();
+    sptr<IRemoteObject> token = new RecordingObserver();
+    observer->Hold();
+    dispatcher_->AddObserver(observer);
+
+    dispatcher_->Dispatch(MakeProcessEvent(ObserverEventType::PROCESS_CREATED, 100));
+    ASSERT_TRUE(observer->WaitFor(1));
+    dispatcher_->Dispatch(MakeProcessEvent(ObserverEventType::PROCESS_CREATED, 101));
+    dispatcher_->Dispatch(MakeAbilityEvent(token, static_cast<int32_t>(AbilityState::ABILITY_STATE_FOREGROUND)));
+    for (pid_t pid = 102; pid < 106; pid++) {
+        dispatcher_->Dispatch(MakeProcessEvent(ObserverEventType::PROCESS_DIED, pid));
+    }
+    observer->Release();
+
+    std::vector<int32_t> expected = { 100, 102, 103, 104, 105 };
+    ASSERT_TRUE(observer->WaitFor(expected.size()));
+    EXPECT_EQ(observer->GetValues(), expected);
+    ObserverStats stats;
+    ASSERT_TRUE(dispatcher_->GetStats(observer, stats));
+    EXPECT_EQ(stats.dropped, 2U);
+}
+
+/*
+ * Feature: AppStateObserverDispatcher
+ * Function: RemoveObserver
+ * SubFunction: NA
+ * FunctionPoints: Remove observers
+ * CaseDescription: A removed observer gets none of its pending notifications.
+ */
+HWTEST_F(AppStateObserverDispatcherTest, RemoveObserver_001, TestSize.Level1)
+{
+    sptr<RecordingObserver> observer = new RecordingObserver();
+    observer->Hold();
+    dispatcher_->AddObserver(observer);
+
+    dispatcher_->Dispatch(MakeProcessEvent(ObserverEventType::PROCESS_CREATED, 100));
+    ASSERT_TRUE(observer->WaitFor(1));
+    dispatcher_->Dispatch(MakeProcessEvent(ObserverEventType::PROCESS_DIED, 100));
+    dispatcher_->RemoveObserver(observer);
+    ObserverStats stats;
+    EXPECT_FALSE(dispatcher_->GetStats(observer, stats));
+    observer->Release();
+
+    dispatcher_->Dispatch(MakeProcessEvent(ObserverEventType::PROCESS_CREATED, 101));
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_EQ(observer->GetValues().size(), 1U);
+}
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <csignal>
+#include <future>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "process_exit_watcher.h"
+
+using namespace testing::ext;
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace {
+constexpr int64_t LONG_TIMEOUT_MILLI_SECONDS = 10000;
+constexpr int64_t SHORT_TIMEOUT_MILLI_SECONDS = 100;
+constexpr auto WAIT_TIME = std::chrono::seconds(5);
+}  // namespace
+
+class ProcessExitWatcherTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp(void) override;
+    void TearDown(void) override;
+
+    static pid_t ForkDummyProcess(void);
+    static void KillDummyProcess(pid_t pid);
+};
+
+void ProcessExitWatcherTest::SetUpTestCase(void)
+{}
+
+void ProcessExitWatcherTest::TearDownTestCase(void)
+{}
+
+void ProcessExitWatcherTest::SetUp(void)
+{}
+
+void ProcessExitWatcherTest::TearDown(void)
+{}
+
+pid_t ProcessExitWatcherTest::ForkDummyProcess(void)
+{
+    pid_t pid = fork();
+    if (pid == 0) {
+        // the dummy process waits to be killed.
+        while (true) {
+            pause();
+        }
+    }
+    EXPECT_GT(pid, 0);
+    return pid;
+}
+
+void ProcessExitWatcherTest::KillDummyProcess(pid_t pid)
+{
+    kill(pid, SIGKILL);
+    waitpid(pid, nullptr, 0);
+}
+
+/*
+ * Feature: ProcessExitWatcher
+ * Function: Watch
+ * SubFunction: NA
+ * FunctionPoints: Watch processes exit
+ * CaseDescription: The watch ends with no alive pids once all processes exit, before the deadline.
+ */
+HWTEST_F(ProcessExitWatcherTest, Watch_001, TestSize.Level1)
+{
+    ProcessExitWatcher watcher;
+    std::list<pid_t> pids = { ForkDummyProcess(), ForkDummyProcess(), ForkDummyProcess() };
+    std::promise<std::list<pid_t>> promise;
+    auto future = promise.get_future();
+    auto startTime = std::chrono::steady_clock::now();
+    watcher.Watch(pids, LONG_TIMEOUT_MILLI_SECONDS, [&promise](const std::list<pid_t> &alivePids) {
+        promise.set_value(alivePids);
+    });
+    EXPECT_EQ(watcher.GetWatchCount(), 1U);
+
+    for (auto pid : pids) {
+        KillDummyProcess(pid);
+    }
+    ASSERT_EQ(future.wait_for(WAIT_TIME), std::future_status::ready);
+    EXPECT_TRUE(future.get().empty());
+    EXPECT_LT(std::chrono::steady_clock::now() - startTime, std::chrono::milliseconds(LONG_TIMEOUT_MILLI_SECONDS));
+    EXPECT_EQ(watcher.GetWatchCount(), 0U);
+}
+
+/*
+ * Feature: ProcessExitWatcher
+ * Function: Watch
+ * SubFunction: NA
+ * FunctionPoints: Watch processes exit
+ * CaseDescription: The watch ends with the alive pids when the deadline hits.
+ */
+HWTEST_F(ProcessExitWatcherTest, Watch_002, TestSize.Level1)
+{
+    ProcessExitWatcher watcher;
+    pid_t alivePid = ForkDummyProcess();
+    pid_t exitedPid = ForkDummyProcess();
+    std::promise<std::list<pid_t>> promise;
+    auto future = promise.get_future();
+    watcher.Watch({ alivePid, exitedPid }, SHORT_TIMEOUT_MILLI_SECONDS,
+        [&promise](const std::list<pid_t> &alivePids) {
+            promise.set_value(alivePids);
+        });
+    KillDummyProcess(exitedPid);
+
+    ASSERT_EQ(future.wait_for(WAIT_TIME), std::future_status::ready);
+    std::list<pid_t> expected = { alivePid };
+    EXPECT_EQ(future.get(), expected);
+    KillDummyProcess(alivePid);
+}
+
+/*
+ * Feature: ProcessExitWatcher
+ * Function: Watch
+ * SubFunction: NA
+ * FunctionPoints: Watch processes exit
+ * CaseDescription: The watch of processes already gone ends at once on the calling thread.
+ */
+HWTEST_F(ProcessExitWatcherTest, Watch_003, TestSize.Level1)
+{
+    ProcessExitWatcher watcher;
+    pid_t pid = ForkDummyProcess();
+    KillDummyProcess(pid);
+
+    bool called = false;
+    watcher.Watch({ pid, 0, -1 }, LONG_TIMEOUT_MILLI_SECONDS, [&called](const std::list<pid_t> &alivePids) {
+        EXPECT_TRUE(alivePids.empty());
+        called = true;
+    });
+    EXPECT_TRUE(called);
+    EXPECT_EQ(watcher.GetWatchCount(), 0U);
+}
+
+/*
+ * Feature: ProcessExitWatcher
+ * Function: Watch
+ * SubFunction: NA
+ * FunctionPoints: Watch processes exit
+ * CaseDescription: Without pidfd, the processes are checked in /proc and exits can be notified.
+ */
+HWTEST_F(ProcessExitWatcherTest, Watch_004, TestSize.Level1)
+{
+    ProcessExitWatcher watcher(false);
+    pid_t polledPid = ForkDummyProcess();
+    pid_t notifiedPid = ForkDummyProcess();
+    std::promise<std::list<pid_t>> promise;
+    auto future = promise.get_future();
+    watcher.Watch({ polledPid, notifiedPid }, LONG_TIMEOUT_MILLI_SECONDS,
+        [&promise](const std::list<pid_t> &alivePids) {
+            promise.set_value(alivePids);
+        });
+
+    KillDummyProcess(polledPid);
+    watcher.NotifyProcessExit(notifiedPid);
+    ASSERT_EQ(future.wait_for(WAIT_TIME), std::future_status::ready);
+    EXPECT_TRUE(future.get().empty());
+    KillDummyProcess(notifiedPid);
+}
+
+/*
+ * Feature: ProcessExitWatcher
+ * Function: Stop
+ * SubFunction: NA
+ * FunctionPoints: Watch processes exit
+ * CaseDescription: Stopping the watcher ends the pending watches with the alive pids.
+ */
+HWTEST_F(ProcessExitWatcherTest, Stop_001, TestSize.Level1)
+{
+    ProcessExitWatcher watcher;
+    pid_t pid = ForkDummyProcess();
+    std::list<pid_t> result;
+    bool called = false;
+    watcher.Watch({ pid }, LONG_TIMEOUT_MILLI_SECONDS, [&](const std::list<pid_t> &alivePids) {
+        result = alivePids;
+        called = true;
+    });
+    watcher.Stop();
+    EXPECT_TRUE(called);
+    std::list<pid_t> expected = { pid };
+    EXPECT_EQ(result, expected);
+    KillDummyProcess(pid);
+}
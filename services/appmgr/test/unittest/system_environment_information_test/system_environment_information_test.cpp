@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "system_environment_information.h"
+
+using namespace testing::ext;
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+using namespace OHOS::AppExecFwk::SystemEnv;
+
+namespace {
+const std::string FAKE_PROC_ROOT_TEMPLATE = "/data/local/tmp/fake_proc_XXXXXX";
+const std::string MEM_INFO =
+    "MemTotal:        8052536 kB\n"
+    "MemFree:          316152 kB\n"
+    "MemAvailable:    2937116 kB\n"
+    "Buffers:           52520 kB\n"
+    "Cached:          2809692 kB\n"
+    "SwapCached:         6548 kB\n"
+    "Active:          3284764 kB\n"
+    "Inactive:        3356248 kB\n"
+    "HugePages_Total:       0\n";
+const std::string MEM_PRESSURE =
+    "some avg10=1.50 avg60=0.25 avg300=0.05 total=123456\n"
+    "full avg10=0.75 avg60=0.00 avg300=0.01 total=65432\n";
+constexpr int64_t BYTES_KB = 1024;
+}  // namespace
+
+class SystemEnvironmentInformationTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp(void) override;
+    void TearDown(void) override;
+
+    void WriteProcFile(const std::string &path, const std::string &content);
+
+    // a directory laid out like procfs, holding the files written by the test.
+    std::string procRoot_;
+    std::vector<std::string> files_;
+};
+
+void SystemEnvironmentInformationTest::SetUpTestCase(void)
+{}
+
+void SystemEnvironmentInformationTest::TearDownTestCase(void)
+{}
+
+void SystemEnvironmentInformationTest::SetUp(void)
+{
+    std::string root = FAKE_PROC_ROOT_TEMPLATE;
+    ASSERT_NE(mkdtemp(&root[0]), nullptr);
+    procRoot_ = root;
+    ASSERT_EQ(mkdir((procRoot_ + "/pressure").c_str(), S_IRWXU), 0);
+}
+
+void SystemEnvironmentInformationTest::TearDown(void)
+{
+    for (const auto &file : files_) {
+        unlink(file.c_str());
+    }
+    rmdir((procRoot_ + "/pressure").c_str());
+    rmdir(procRoot_.c_str());
+}
+
+void SystemEnvironmentInformationTest::WriteProcFile(const std::string &path, const std::string &content)
+{
+    std::string file = procRoot_ + path;
+    std::ofstream stream(file, std::ios::trunc);
+    stream << content;
+    files_.push_back(file);
+}
+
+/*
+ * Feature: SystemEnv
+ * Function: ReadMemInfo
+ * SubFunction: NA
+ * FunctionPoints: Read system memory information
+ * CaseDescription: The sizes of meminfo are read in bytes, together with the memory pressure.
+ */
+HWTEST_F(SystemEnvironmentInformationTest, ReadMemInfo_001, TestSize.Level1)
+{
+    WriteProcFile("/meminfo", MEM_INFO);
+    WriteProcFile("/pressure/memory", MEM_PRESSURE);
+
+    KernelSystemMemoryInfo memInfo;
+    EXPECT_TRUE(ReadMemInfo(procRoot_, memInfo));
+    EXPECT_EQ(memInfo.GetMemTotal(), 8052536 * BYTES_KB);
+    EXPECT_EQ(memInfo.GetMemFree(), 316152 * BYTES_KB);
+    EXPECT_EQ(memInfo.GetMemAvailable(), 2937116 * BYTES_KB);
+    EXPECT_EQ(memInfo.GetBuffers(), 52520 * BYTES_KB);
+    EXPECT_EQ(memInfo.GetCached(), 2809692 * BYTES_KB);
+    EXPECT_EQ(memInfo.GetSwapCached(), 6548 * BYTES_KB);
+
+    EXPECT_TRUE(memInfo.HasPressure());
+    EXPECT_DOUBLE_EQ(memInfo.GetPressureSomeAvg10(), 1.5);
+    EXPECT_DOUBLE_EQ(memInfo.GetPressureSomeAvg60(), 0.25);
+    EXPECT_DOUBLE_EQ(memInfo.GetPressureSomeAvg300(), 0.05);
+    EXPECT_EQ(memInfo.GetPressureSomeTotal(), 123456U);
+    EXPECT_DOUBLE_EQ(memInfo.GetPressureFullAvg10(), 0.75);
+    EXPECT_DOUBLE_EQ(memInfo.GetPressureFullAvg60(), 0);
+    EXPECT_DOUBLE_EQ(memInfo.GetPressureFullAvg300(), 0.01);
+    EXPECT_EQ(memInfo.GetPressureFullTotal(), 65432U);
+}
+
+/*
+ * Feature: SystemEnv
+ * Function: ReadMemInfo
+ * SubFunction: NA
+ * FunctionPoints: Read system memory information
+ * CaseDescription: The memory pressure is optional, the meminfo is required.
+ */
+HWTEST_F(SystemEnvironmentInformationTest, ReadMemInfo_002, TestSize.Level1)
+{
+    KernelSystemMemoryInfo memInfo;
+    EXPECT_FALSE(ReadMemInfo(procRoot_, memInfo));
+
+    WriteProcFile("/meminfo", MEM_INFO);
+    EXPECT_TRUE(ReadMemInfo(procRoot_, memInfo));
+    EXPECT_EQ(memInfo.GetMemTotal(), 8052536 * BYTES_KB);
+    EXPECT_FALSE(memInfo.HasPressure());
+
+    // the pressure of a kernel without full stall information is not taken.
+    WriteProcFile("/pressure/memory", "some avg10=1.50 avg60=0.25 avg300=0.05 total=123456\n");
+    EXPECT_TRUE(ReadMemInfo(procRoot_, memInfo));
+    EXPECT_FALSE(memInfo.HasPressure());
+}
+
+/*
+ * Feature: SystemEnv
+ * Function: ReadMemInfo
+ * SubFunction: NA
+ * FunctionPoints: Read system memory information
+ * CaseDescription: A meminfo missing fields or with malformed values is rejected.
+ */
+HWTEST_F(SystemEnvironmentInformationTest, ReadMemInfo_003, TestSize.Level1)
+{
+    KernelSystemMemoryInfo memInfo;
+    WriteProcFile("/meminfo", "MemTotal:        8052536 kB\nMemFree:          316152 kB\n");
+    EXPECT_FALSE(ReadMemInfo(procRoot_, memInfo));
+
+    WriteProcFile("/meminfo", "MemTotal: kB\nMemFree: 1 kB\nMemAvailable: 1 kB\nBuffers: 1 kB\n"
+        "Cached: 1 kB\nSwapCached: 1 kB\n");
+    EXPECT_FALSE(ReadMemInfo(procRoot_, memInfo));
+
+    WriteProcFile("/meminfo", "SwapCached: 6 kB\nCached: 5 kB\nBuffers: 4 kB\nMemAvailable: 3 kB\n"
+        "MemFree: 2 kB\nMemTotal: 1 kB");
+    EXPECT_TRUE(ReadMemInfo(procRoot_, memInfo));
+    EXPECT_EQ(memInfo.GetMemTotal(), BYTES_KB);
+    EXPECT_EQ(memInfo.GetSwapCached(), 6 * BYTES_KB);
+}
+
+/*
+ * Feature: SystemEnv
+ * Function: GetMemInfo
+ * SubFunction: NA
+ * FunctionPoints: Read system memory information
+ * CaseDescription: The snapshot of the system memory information is the same for callers close in time.
+ */
+HWTEST_F(SystemEnvironmentInformationTest, GetMemInfo_001, TestSize.Level1)
+{
+    KernelSystemMemoryInfo first;
+    KernelSystemMemoryInfo second;
+    GetMemInfo(first);
+    GetMemInfo(second);
+    EXPECT_GT(first.GetMemTotal(), 0);
+    EXPECT_EQ(first.GetMemTotal(), second.GetMemTotal());
+    EXPECT_EQ(first.GetMemFree(), second.GetMemFree());
+}
@@ -22,6 +22,9 @@
 #include <memory>
 #include <map>
 #include <mutex>
+#include <set>
+#include <string_view>
+#include <vector>
 
 #include "iremote_object.h"
 #include "refbase.h"
@@ -35,7 +38,6 @@ namespace AAFwk {
 using EventHandler = OHOS::AppExecFwk::EventHandler;
 class DataObsMgrInner : public std::enable_shared_from_this<DataObsMgrInner> {
 public:
-    using ObsMapType = std::map<std::string, std::list<sptr<IDataAbilityObserver>>>;
     using ObsListType = std::list<sptr<IDataAbilityObserver>>;
     using ObsRecipientMapType = std::map<sptr<IRemoteObject>, sptr<IRemoteObject::DeathRecipient>>;
 
@@ -43,7 +45,8 @@ public:
     virtual ~DataObsMgrInner();
 
     void SetHandler(const std::shared_ptr<EventHandler> &handler);
-    int HandleRegisterObserver(const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver);
+    int HandleRegisterObserver(const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver,
+        bool isDescendants = false);
     int HandleUnregisterObserver(const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver);
     int HandleNotifyChange(const Uri &uri);
     bool CheckNeedLimmit();
@@ -52,7 +55,22 @@ public:
     void AtomicSubTaskCount();
     void OnCallBackDied(const wptr<IRemoteObject> &remote);
 
+    /**
+     * Set the window in milliseconds in which changes are gathered before the observers are called,
+     * an observer is called once per window however many of its uris changed. 0 notifies at once.
+     */
+    void SetNotifyWindow(int64_t window);
+    void Dump(std::string &info);
+
 private:
+    // one node per '/' separated segment of the uri string.
+    struct ObsTrieNode {
+        // keyed by uri segment, looked up by the segment views of the uri without copying them.
+        std::map<std::string, std::unique_ptr<ObsTrieNode>, std::less<>> children;
+        ObsListType obsList;
+        ObsListType descendantObsList;
+    };
+
     bool GetObsListFromMap(const Uri &uri, ObsListType &obslist);
     void AddObsDeathRecipient(const sptr<IDataAbilityObserver> &dataObserver);
     void RemoveObsDeathRecipient(const sptr<IDataAbilityObserver> &dataObserver);
@@ -60,13 +78,29 @@ private:
     void RemoveObsFromMap(const sptr<IDataAbilityObserver> &dataObserver);
     bool ObsExistInMap(const sptr<IDataAbilityObserver> &dataObserver);
 
+    static std::vector<std::string_view> SplitUri(const std::string &uri);
+    ObsTrieNode *FindNode(const std::string &uri);
+    ObsTrieNode *FindOrCreateNode(const std::string &uri);
+    void PruneNode(const std::string &uri);
+    bool RemoveObsFromNode(ObsTrieNode &node, const sptr<IRemoteObject> &object);
+    bool ObsExistInNode(const ObsTrieNode &node, const sptr<IRemoteObject> &object) const;
+    size_t CollectObservers(const std::string &uri, std::set<sptr<IRemoteObject>> &objects, ObsListType &obsList);
+    void FlushPendingNotify();
+    void DispatchChange(const ObsListType &obsList);
+
     std::atomic_int taskCount_;
     const int taskCount_max_ = 50;
     const unsigned int obs_max_ = 50;
     static std::mutex innerMutex_;
     std::shared_ptr<EventHandler> handler_ = nullptr;
-    ObsMapType obsmap_;
+    ObsTrieNode root_;
     ObsRecipientMapType recipientMap_;
+    int64_t notifyWindow_ = NOTIFY_WINDOW;
+    std::set<std::string> pendingUris_;
+    uint64_t notifyCount_ = 0;
+    uint64_t deliveredCount_ = 0;
+    uint64_t coalescedCount_ = 0;
+    static constexpr int64_t NOTIFY_WINDOW = 20;
 };
 
 }  // namespace AAFwk
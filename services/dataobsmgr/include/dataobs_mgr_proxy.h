@@ -64,6 +64,18 @@ public:
      */
     virtual int NotifyChange(const Uri &uri);
 
+    /**
+     * Registers an observer to DataObsMgr specified by the given Uri.
+     *
+     * @param uri, Indicates the path of the data to operate.
+     * @param dataObserver, Indicates the IDataAbilityObserver object.
+     * @param isDescendants, Indicates whether the observer is also notified of changes to the uris under the uri.
+     *
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    virtual int RegisterObserverExt(const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver,
+        bool isDescendants) override;
+
 private:
     bool WriteInterfaceToken(MessageParcel &data);
 
@@ -53,6 +53,13 @@ public:
     virtual int RegisterObserver(const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver) override;
     virtual int UnregisterObserver(const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver) override;
     virtual int NotifyChange(const Uri &uri) override;
+    virtual int RegisterObserverExt(const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver,
+        bool isDescendants) override;
+
+    /**
+     * Dump the notify counters of the dataobs manager service, to tune the notify window.
+     */
+    int Dump(int fd, const std::vector<std::u16string> &args) override;
 
     /**
      * GetEventHandler, get the dataobs manager service's handler.
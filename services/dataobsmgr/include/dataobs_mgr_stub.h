@@ -41,6 +41,7 @@ private:
     int RegisterObserverInner(MessageParcel &data, MessageParcel &reply);
     int UnregisterObserverInner(MessageParcel &data, MessageParcel &reply);
     int NotifyChangeInner(MessageParcel &data, MessageParcel &reply);
+    int RegisterObserverExtInner(MessageParcel &data, MessageParcel &reply);
 
     using RequestFuncType = int (DataObsManagerStub::*)(MessageParcel &data, MessageParcel &reply);
     std::map<uint32_t, RequestFuncType> requestFuncMap_;
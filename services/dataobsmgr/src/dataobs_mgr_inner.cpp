@@ -14,6 +14,9 @@
  */
 #include "dataobs_mgr_inner.h"
 
+#include <algorithm>
+#include <functional>
+
 #include "data_ability_observer_stub.h"
 #include "dataobs_mgr_errors.h"
 #include "hilog_wrapper.h"
@@ -38,31 +41,25 @@ void DataObsMgrInner::SetHandler(const std::shared_ptr<EventHandler> &handler)
     handler_ = handler;
 }
 
-int DataObsMgrInner::HandleRegisterObserver(const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver)
+int DataObsMgrInner::HandleRegisterObserver(
+    const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver, bool isDescendants)
 {
     HILOG_INFO("DataObsMgrInner::HandleRegisterObserver called start");
     std::lock_guard<std::mutex> lock_l(innerMutex_);
 
-    ObsListType obslist;
-    bool exist = GetObsListFromMap(uri, obslist);
-
-    auto obs = obslist.begin();
-    for (; obs != obslist.end(); obs++) {
-        if ((*obs)->AsObject() == dataObserver->AsObject()) {
-            HILOG_ERROR("DataObsMgrInner::HandleRegisterObserver the obs exist. no need to register.");
-            return OBS_EXIST;
-        }
+    ObsTrieNode *node = FindOrCreateNode(uri.ToString());
+    if (ObsExistInNode(*node, dataObserver->AsObject())) {
+        HILOG_ERROR("DataObsMgrInner::HandleRegisterObserver the obs exist. no need to register.");
+        return OBS_EXIST;
     }
 
-    obslist.push_back(dataObserver);
-
-    AddObsDeathRecipient(dataObserver);
-
-    if (exist) {
-        obsmap_.erase(uri.ToString());
+    if (isDescendants) {
+        node->descendantObsList.push_back(dataObserver);
+    } else {
+        node->obsList.push_back(dataObserver);
     }
 
-    obsmap_.emplace(uri.ToString(), obslist);
+    AddObsDeathRecipient(dataObserver);
 
     AtomicSubTaskCount();
 
@@ -75,34 +72,25 @@ int DataObsMgrInner::HandleUnregisterObserver(const Uri &uri, const sptr<IDataAb
     HILOG_INFO("DataObsMgrInner::HandleUnregisterObserver called start");
     std::lock_guard<std::mutex> lock_l(innerMutex_);
 
-    ObsListType obslist;
-    if (!GetObsListFromMap(uri, obslist)) {
+    const std::string &uriString = uri.ToString();
+    ObsTrieNode *node = FindNode(uriString);
+    if (node == nullptr || (node->obsList.empty() && node->descendantObsList.empty())) {
         AtomicSubTaskCount();
         HILOG_ERROR("DataObsMgrInner::HandleUnregisterObserver there is no obs in the uri.");
         return NO_OBS_FOR_URI;
     }
 
-    HILOG_INFO("DataObsMgrInner::HandleUnregisterObserver obslist size is %{public}zu", obslist.size());
-    auto obs = obslist.begin();
-    for (; obs != obslist.end(); obs++) {
-        if ((*obs)->AsObject() == dataObserver->AsObject()) {
-            break;
-        }
-    }
-    if (obs == obslist.end()) {
+    HILOG_INFO("DataObsMgrInner::HandleUnregisterObserver obslist size is %{public}zu",
+        node->obsList.size() + node->descendantObsList.size());
+    if (!RemoveObsFromNode(*node, dataObserver->AsObject())) {
         AtomicSubTaskCount();
         HILOG_ERROR("DataObsMgrInner::HandleUnregisterObserver the obs is not registered to the uri.");
         return NO_OBS_FOR_URI;
     }
-    sptr<IDataAbilityObserver> removeObs = *obs;
-    obslist.remove(removeObs);
-    obsmap_.erase(uri.ToString());
-    if (!obslist.empty()) {
-        obsmap_.emplace(uri.ToString(), obslist);
-    }
+    PruneNode(uriString);
 
-    if (!ObsExistInMap(removeObs)) {
-        RemoveObsDeathRecipient(removeObs);
+    if (!ObsExistInMap(dataObserver)) {
+        RemoveObsDeathRecipient(dataObserver);
     }
 
     AtomicSubTaskCount();
@@ -113,24 +101,86 @@ int DataObsMgrInner::HandleUnregisterObserver(const Uri &uri, const sptr<IDataAb
 int DataObsMgrInner::HandleNotifyChange(const Uri &uri)
 {
     HILOG_INFO("DataObsMgrInner::HandleNotifyChange called start");
-    std::lock_guard<std::mutex> lock_l(innerMutex_);
+    const std::string &uriString = uri.ToString();
+    ObsListType obslist;
+    {
+        std::lock_guard<std::mutex> lock_l(innerMutex_);
+        notifyCount_++;
+        std::set<sptr<IRemoteObject>> objects;
+        size_t duplicateCount = CollectObservers(uriString, objects, obslist);
+        if (obslist.empty()) {
+            AtomicSubTaskCount();
+            HILOG_INFO("DataObsMgrInner::HandleNotifyChange there is no obs in the uri.");
+            return NO_OBS_FOR_URI;
+        }
+
+        if (handler_ != nullptr && notifyWindow_ > 0) {
+            // a change of a pending uri is delivered with it, the first pending uri opens the window.
+            if (!pendingUris_.insert(uriString).second) {
+                coalescedCount_++;
+                AtomicSubTaskCount();
+                return NO_ERROR;
+            }
+            auto task = [dataObsMgrInner = shared_from_this()]() {
+                dataObsMgrInner->FlushPendingNotify();
+            };
+            if (pendingUris_.size() > 1 || handler_->PostTask(task, notifyWindow_)) {
+                AtomicSubTaskCount();
+                return NO_ERROR;
+            }
+            HILOG_ERROR("DataObsMgrInner::HandleNotifyChange PostTask error, notify at once.");
+            pendingUris_.erase(uriString);
+        }
+        deliveredCount_ += obslist.size();
+        coalescedCount_ += duplicateCount;
+    }
+
+    DispatchChange(obslist);
+
+    AtomicSubTaskCount();
+    HILOG_INFO("DataObsMgrInner::HandleNotifyChange called end %{public}zu", obslist.size());
+    return NO_ERROR;
+}
 
+void DataObsMgrInner::FlushPendingNotify()
+{
     ObsListType obslist;
-    if (!GetObsListFromMap(uri, obslist)) {
-        AtomicSubTaskCount();
-        HILOG_INFO("DataObsMgrInner::HandleNotifyChange there is no obs in the uri.");
-        return NO_OBS_FOR_URI;
+    {
+        std::lock_guard<std::mutex> lock_l(innerMutex_);
+        std::set<sptr<IRemoteObject>> objects;
+        for (const auto &uri : pendingUris_) {
+            coalescedCount_ += CollectObservers(uri, objects, obslist);
+        }
+        pendingUris_.clear();
+        deliveredCount_ += obslist.size();
     }
 
-    for (auto obs : obslist) {
+    DispatchChange(obslist);
+    HILOG_INFO("DataObsMgrInner::FlushPendingNotify called end %{public}zu", obslist.size());
+}
+
+void DataObsMgrInner::DispatchChange(const ObsListType &obsList)
+{
+    for (auto &obs : obsList) {
         if (obs != nullptr) {
             obs->OnChange();
         }
     }
+}
 
-    AtomicSubTaskCount();
-    HILOG_INFO("DataObsMgrInner::HandleNotifyChange called end %{public}zu", obslist.size());
-    return NO_ERROR;
+void DataObsMgrInner::SetNotifyWindow(int64_t window)
+{
+    std::lock_guard<std::mutex> lock_l(innerMutex_);
+    notifyWindow_ = window;
+}
+
+void DataObsMgrInner::Dump(std::string &info)
+{
+    std::lock_guard<std::mutex> lock_l(innerMutex_);
+    info += "DataObsMgr: window " + std::to_string(notifyWindow_) + "ms, notify #" + std::to_string(notifyCount_) +
+        ", delivered #" + std::to_string(deliveredCount_) + ", coalesced #" + std::to_string(coalescedCount_) +
+        ", pending uris #" + std::to_string(pendingUris_.size()) +
+        ", observers #" + std::to_string(recipientMap_.size()) + "\n";
 }
 
 bool DataObsMgrInner::CheckNeedLimmit()
@@ -142,14 +192,9 @@ bool DataObsMgrInner::CheckRegisteFull(const Uri &uri)
 {
     std::lock_guard<std::mutex> lock_l(innerMutex_);
 
-    ObsListType obslist;
-    if (GetObsListFromMap(uri, obslist)) {
-        // The obs size for input uri has been lager than max.
-        if (obslist.size() >= obs_max_) {
-            return true;
-        }
-    }
-    return false;
+    ObsTrieNode *node = FindNode(uri.ToString());
+    // The obs size for input uri has been lager than max.
+    return node != nullptr && node->obsList.size() + node->descendantObsList.size() >= obs_max_;
 }
 
 void DataObsMgrInner::AtomicAddTaskCount()
@@ -164,15 +209,134 @@ void DataObsMgrInner::AtomicSubTaskCount()
 
 bool DataObsMgrInner::GetObsListFromMap(const Uri &uri, ObsListType &obslist)
 {
-    auto it = obsmap_.find(uri.ToString());
-    if (it == obsmap_.end()) {
+    ObsTrieNode *node = FindNode(uri.ToString());
+    if (node == nullptr || (node->obsList.empty() && node->descendantObsList.empty())) {
         return false;
     }
 
-    obslist = it->second;
+    obslist = node->obsList;
+    obslist.insert(obslist.end(), node->descendantObsList.begin(), node->descendantObsList.end());
     return true;
 }
 
+std::vector<std::string_view> DataObsMgrInner::SplitUri(const std::string &uri)
+{
+    std::vector<std::string_view> segments;
+    std::string_view uriView(uri);
+    std::string::size_type begin = 0;
+    std::string::size_type end = uriView.find('/');
+    while (end != std::string::npos) {
+        segments.emplace_back(uriView.substr(begin, end - begin));
+        begin = end + 1;
+        end = uriView.find('/', begin);
+    }
+    segments.emplace_back(uriView.substr(begin));
+    return segments;
+}
+
+DataObsMgrInner::ObsTrieNode *DataObsMgrInner::FindNode(const std::string &uri)
+{
+    ObsTrieNode *node = &root_;
+    for (const auto &segment : SplitUri(uri)) {
+        auto it = node->children.find(segment);
+        if (it == node->children.end()) {
+            return nullptr;
+        }
+        node = it->second.get();
+    }
+    return node;
+}
+
+DataObsMgrInner::ObsTrieNode *DataObsMgrInner::FindOrCreateNode(const std::string &uri)
+{
+    ObsTrieNode *node = &root_;
+    for (const auto &segment : SplitUri(uri)) {
+        auto it = node->children.find(segment);
+        if (it == node->children.end()) {
+            it = node->children.emplace(std::string(segment), std::make_unique<ObsTrieNode>()).first;
+        }
+        node = it->second.get();
+    }
+    return node;
+}
+
+void DataObsMgrInner::PruneNode(const std::string &uri)
+{
+    std::vector<std::pair<ObsTrieNode *, std::string_view>> path;
+    ObsTrieNode *node = &root_;
+    for (const auto &segment : SplitUri(uri)) {
+        auto it = node->children.find(segment);
+        if (it == node->children.end()) {
+            return;
+        }
+        path.emplace_back(node, segment);
+        node = it->second.get();
+    }
+    // drop the nodes left without observers or children, from the leaf up.
+    for (auto it = path.rbegin(); it != path.rend(); it++) {
+        auto child = it->first->children.find(it->second);
+        if (!child->second->children.empty() || !child->second->obsList.empty() ||
+            !child->second->descendantObsList.empty()) {
+            return;
+        }
+        it->first->children.erase(child);
+    }
+}
+
+bool DataObsMgrInner::RemoveObsFromNode(ObsTrieNode &node, const sptr<IRemoteObject> &object)
+{
+    auto isObject = [&object](const sptr<IDataAbilityObserver> &obs) {
+        return obs != nullptr && obs->AsObject() == object;
+    };
+    size_t size = node.obsList.size() + node.descendantObsList.size();
+    node.obsList.remove_if(isObject);
+    node.descendantObsList.remove_if(isObject);
+    return node.obsList.size() + node.descendantObsList.size() != size;
+}
+
+bool DataObsMgrInner::ObsExistInNode(const ObsTrieNode &node, const sptr<IRemoteObject> &object) const
+{
+    auto isObject = [&object](const sptr<IDataAbilityObserver> &obs) {
+        return obs != nullptr && obs->AsObject() == object;
+    };
+    return std::any_of(node.obsList.begin(), node.obsList.end(), isObject) ||
+        std::any_of(node.descendantObsList.begin(), node.descendantObsList.end(), isObject);
+}
+
+size_t DataObsMgrInner::CollectObservers(
+    const std::string &uri, std::set<sptr<IRemoteObject>> &objects, ObsListType &obsList)
+{
+    size_t duplicateCount = 0;
+    auto collect = [&objects, &obsList, &duplicateCount](const ObsListType &list) {
+        for (auto &obs : list) {
+            if (obs == nullptr) {
+                continue;
+            }
+            if (objects.insert(obs->AsObject()).second) {
+                obsList.push_back(obs);
+            } else {
+                duplicateCount++;
+            }
+        }
+    };
+
+    ObsTrieNode *node = &root_;
+    auto segments = SplitUri(uri);
+    for (size_t i = 0; i < segments.size(); i++) {
+        auto it = node->children.find(segments[i]);
+        if (it == node->children.end()) {
+            break;
+        }
+        node = it->second.get();
+        // observers of an ancestor uri are notified only if they asked for descendants.
+        collect(node->descendantObsList);
+        if (i + 1 == segments.size()) {
+            collect(node->obsList);
+        }
+    }
+    return duplicateCount;
+}
+
 void DataObsMgrInner::AddObsDeathRecipient(const sptr<IDataAbilityObserver> &dataObserver)
 {
     if ((dataObserver == nullptr) || dataObserver->AsObject() == nullptr) {
@@ -242,30 +406,46 @@ void DataObsMgrInner::HandleCallBackDiedTask(const sptr<IRemoteObject> &dataObse
 
 void DataObsMgrInner::RemoveObsFromMap(const sptr<IDataAbilityObserver> &dataObserver)
 {
-    for (auto &obsCallback : obsmap_) {
-        auto &obsList = obsCallback.second;
-        auto obs = std::find(obsList.begin(), obsList.end(), dataObserver);
-        if (obs != obsList.end()) {
-            obsList.remove(dataObserver);
-            if (obsList.empty()) {
-                HILOG_INFO("%{public}s: remove obsList from map ", __func__);
-                obsmap_.erase(obsCallback.first);
+    if ((dataObserver == nullptr) || dataObserver->AsObject() == nullptr) {
+        return;
+    }
+
+    sptr<IRemoteObject> object = dataObserver->AsObject();
+    std::function<bool(ObsTrieNode &)> removeFromTree = [this, &object, &removeFromTree](ObsTrieNode &node) {
+        RemoveObsFromNode(node, object);
+        for (auto it = node.children.begin(); it != node.children.end();) {
+            if (removeFromTree(*it->second)) {
+                HILOG_INFO("RemoveObsFromMap: remove obsList from map ");
+                it = node.children.erase(it);
+            } else {
+                it++;
             }
         }
-    }
+        return node.children.empty() && node.obsList.empty() && node.descendantObsList.empty();
+    };
+    removeFromTree(root_);
     RemoveObsDeathRecipient(dataObserver);
 }
 
 bool DataObsMgrInner::ObsExistInMap(const sptr<IDataAbilityObserver> &dataObserver)
 {
-    for (auto &obsCallback : obsmap_) {
-        auto &obsList = obsCallback.second;
-        auto obs = std::find(obsList.begin(), obsList.end(), dataObserver);
-        if (obs != obsList.end()) {
+    if ((dataObserver == nullptr) || dataObserver->AsObject() == nullptr) {
+        return false;
+    }
+
+    sptr<IRemoteObject> object = dataObserver->AsObject();
+    std::function<bool(const ObsTrieNode &)> existInTree = [this, &object, &existInTree](const ObsTrieNode &node) {
+        if (ObsExistInNode(node, object)) {
             return true;
         }
-    }
-    return false;
+        for (auto &child : node.children) {
+            if (existInTree(*child.second)) {
+                return true;
+            }
+        }
+        return false;
+    };
+    return existInTree(root_);
 }
 
 }  // namespace AAFwk
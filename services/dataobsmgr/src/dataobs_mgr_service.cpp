@@ -15,6 +15,7 @@
 
 #include "dataobs_mgr_service.h"
 
+#include <cstdio>
 #include <functional>
 #include <memory>
 #include <string>
@@ -76,6 +77,7 @@ bool DataObsMgrService::Init()
     }
 
     handler_ = std::make_shared<AppExecFwk::EventHandler>(eventLoop_);
+    dataObsMgrInner_->SetHandler(handler_);
 
     HILOG_INFO("init success");
     return true;
@@ -96,7 +98,13 @@ DataObsServiceRunningState DataObsMgrService::QueryServiceState() const
 
 int DataObsMgrService::RegisterObserver(const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver)
 {
-    HILOG_INFO("DataObsMgrService::RegisterObserver called start");
+    return RegisterObserverExt(uri, dataObserver, false);
+}
+
+int DataObsMgrService::RegisterObserverExt(
+    const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver, bool isDescendants)
+{
+    HILOG_INFO("DataObsMgrService::RegisterObserver called start, isDescendants: %{public}d", isDescendants);
     if (dataObserver == nullptr) {
         HILOG_ERROR("DataObsMgrService::RegisterObserver failed!. dataObserver is nullptr");
         return DATA_OBSERVER_IS_NULL;
@@ -121,7 +129,7 @@ int DataObsMgrService::RegisterObserver(const Uri &uri, const sptr<IDataAbilityO
     }
 
     std::function<void()> registerObserverFunc =
-        std::bind(&DataObsMgrInner::HandleRegisterObserver, dataObsMgrInner_, uri, dataObserver);
+        std::bind(&DataObsMgrInner::HandleRegisterObserver, dataObsMgrInner_, uri, dataObserver, isDescendants);
 
     dataObsMgrInner_->AtomicAddTaskCount();
     bool ret = handler_->PostTask(registerObserverFunc);
@@ -205,5 +213,19 @@ std::shared_ptr<EventHandler> DataObsMgrService::GetEventHandler()
     return handler_;
 }
 
+int DataObsMgrService::Dump(int fd, const std::vector<std::u16string> &args)
+{
+    if (dataObsMgrInner_ == nullptr) {
+        return DATAOBS_SERVICE_INNER_IS_NULL;
+    }
+    std::string result;
+    dataObsMgrInner_->Dump(result);
+    if (dprintf(fd, "%s", result.c_str()) < 0) {
+        HILOG_ERROR("dprintf error");
+        return ERR_INVALID_OPERATION;
+    }
+    return NO_ERROR;
+}
+
 }  // namespace AAFwk
 }  // namespace OHOS
@@ -30,6 +30,7 @@ DataObsManagerStub::DataObsManagerStub()
     requestFuncMap_[REGISTER_OBSERVER] = &DataObsManagerStub::RegisterObserverInner;
     requestFuncMap_[UNREGISTER_OBSERVER] = &DataObsManagerStub::UnregisterObserverInner;
     requestFuncMap_[NOTIFY_CHANGE] = &DataObsManagerStub::NotifyChangeInner;
+    requestFuncMap_[REGISTER_OBSERVER_EXT] = &DataObsManagerStub::RegisterObserverExtInner;
 }
 
 DataObsManagerStub::~DataObsManagerStub()
@@ -108,5 +109,21 @@ int DataObsManagerStub::NotifyChangeInner(MessageParcel &data, MessageParcel &re
     return NO_ERROR;
 }
 
+int DataObsManagerStub::RegisterObserverExtInner(MessageParcel &data, MessageParcel &reply)
+{
+    Uri *uri = data.ReadParcelable<Uri>();
+    if (uri == nullptr) {
+        HILOG_ERROR("DataObsManagerStub: uri is nullptr");
+        return ERR_INVALID_VALUE;
+    }
+
+    auto observer = iface_cast<IDataAbilityObserver>(data.ReadRemoteObject());
+    bool isDescendants = data.ReadBool();
+    int32_t result = RegisterObserverExt(*uri, observer, isDescendants);
+    reply.WriteInt32(result);
+    delete uri;
+    return NO_ERROR;
+}
+
 }  // namespace AAFwk
 }  // namespace OHOS
@@ -16,6 +16,7 @@
 #include <memory>
 #include <algorithm>
 #include <functional>
+#include <unistd.h>
 #include "uri.h"
 #define private public
 #include "data_ability_observer_proxy.h"
@@ -171,5 +172,68 @@ HWTEST_F(DataObsMgrInnerTest, DataObsMgrInner_AddRemove_ObsDeathRecipient_0100,
     EXPECT_EQ(false, it != dataObsMgrInner_->recipientMap_.end());
 }
 
+/*
+ * Feature: DataObsMgrInner
+ * Function: HandleRegisterObserver/HandleNotifyChange function test
+ * SubFunction: NA
+ * FunctionPoints: An observer of the descendants of a uri is notified of the changes to the uris under it
+ * EnvConditions: NA
+ * CaseDescription:NA
+ */
+HWTEST_F(DataObsMgrInnerTest, DataObsMgrInner_HandleNotifyChange_Descendants_0100, TestSize.Level1)
+{
+    auto dataObsMgrInner = std::make_shared<DataObsMgrInner>();
+    Uri parentUri("dataability://device_id/com.domainname.dataability.persondata/person");
+    Uri uri("dataability://device_id/com.domainname.dataability.persondata/person/10");
+    sptr<MockDataAbilityObserverStub> descendantsStub(new (std::nothrow) MockDataAbilityObserverStub());
+    sptr<MockDataAbilityObserverStub> parentStub(new (std::nothrow) MockDataAbilityObserverStub());
+    const sptr<IDataAbilityObserver> descendantsCallback(new (std::nothrow) DataAbilityObserverProxy(descendantsStub));
+    const sptr<IDataAbilityObserver> parentCallback(new (std::nothrow) DataAbilityObserverProxy(parentStub));
+
+    EXPECT_CALL(*descendantsStub, OnChange()).Times(1);
+    EXPECT_CALL(*parentStub, OnChange()).Times(0);
+
+    dataObsMgrInner->HandleRegisterObserver(parentUri, descendantsCallback, true);
+    dataObsMgrInner->HandleRegisterObserver(parentUri, parentCallback);
+    dataObsMgrInner->HandleNotifyChange(uri);
+
+    dataObsMgrInner->HandleUnregisterObserver(parentUri, descendantsCallback);
+    dataObsMgrInner->HandleUnregisterObserver(parentUri, parentCallback);
+    EXPECT_EQ(false, dataObsMgrInner->ObsExistInMap(descendantsCallback));
+    EXPECT_EQ(true, dataObsMgrInner->root_.children.empty());
+}
+
+/*
+ * Feature: DataObsMgrInner
+ * Function: HandleNotifyChange function test
+ * SubFunction: NA
+ * FunctionPoints: The changes to a uri in one notify window are delivered once to each observer
+ * EnvConditions: NA
+ * CaseDescription:NA
+ */
+HWTEST_F(DataObsMgrInnerTest, DataObsMgrInner_HandleNotifyChange_Coalesce_0100, TestSize.Level1)
+{
+    const int notifyCount = 10;
+    const int waitTime = 200000;
+    auto dataObsMgrInner = std::make_shared<DataObsMgrInner>();
+    auto handler = std::make_shared<EventHandler>(AppExecFwk::EventRunner::Create("DataObsMgrInnerTest"));
+    dataObsMgrInner->SetHandler(handler);
+    Uri uri("dataability://device_id/com.domainname.dataability.persondata/person/10");
+    sptr<MockDataAbilityObserverStub> mockDataAbilityObserverStub(new (std::nothrow) MockDataAbilityObserverStub());
+    const sptr<IDataAbilityObserver> callback(new (std::nothrow) DataAbilityObserverProxy(mockDataAbilityObserverStub));
+
+    EXPECT_CALL(*mockDataAbilityObserverStub, OnChange()).Times(1);
+
+    dataObsMgrInner->HandleRegisterObserver(uri, callback);
+    for (int i = 0; i < notifyCount; i++) {
+        dataObsMgrInner->HandleNotifyChange(uri);
+    }
+    usleep(waitTime);
+
+    std::string info;
+    dataObsMgrInner->Dump(info);
+    EXPECT_NE(std::string::npos, info.find("coalesced #" + std::to_string(notifyCount - 1)));
+}
+
 }  // namespace AAFwk
 }  // namespace OHOS
\ No newline at end of file
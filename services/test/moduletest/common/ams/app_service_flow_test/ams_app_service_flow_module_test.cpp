@@ -141,7 +141,8 @@ TestApplicationPreRunningRecord AmsAppServiceFlowModuleTest::TestCreateApplicati
     if (!appRecord) {
         appRecord = serviceInner_->CreateAppRunningRecord(
             token, nullptr, appInfo, abilityInfo, appName, bundleInfo, hapModuleInfo, nullptr);
-        appRecord->GetPriorityObject()->SetPid(TestApplicationPreRunningRecord::g_pid++);
+        serviceInner_->appRunningManager_->SetAppRunningRecordPid(
+            appRecord, TestApplicationPreRunningRecord::g_pid++);
     } else {
         serviceInner_->StartAbility(token, nullptr, abilityInfo, appRecord, hapModuleInfo, nullptr);
     }
@@ -16,10 +16,16 @@
 #ifndef OHOS_AAFWK_URI_PERMISSION_MANAGER_STUB_IMPL_H
 #define OHOS_AAFWK_URI_PERMISSION_MANAGER_STUB_IMPL_H
 
+#include <chrono>
 #include <functional>
+#include <list>
 #include <map>
+#include <mutex>
+#include <set>
+#include <unordered_map>
 
 #include "bundlemgr/bundle_mgr_interface.h"
+#include "common_event_subscriber.h"
 #include "uri.h"
 #include "uri_permission_manager_stub.h"
 
@@ -32,6 +38,20 @@ struct GrantInfo {
     const unsigned int fromTokenId;
     const unsigned int targetTokenId;
 };
+
+// the uris granted to a target token, so its grants are removed without walking every uri.
+struct TokenGrants {
+    std::set<std::string> uris;
+    std::set<std::string> prefixUris;
+};
+
+// what the bundle manager answers for an owner key, kept until a package changes.
+struct UriOwner {
+    bool found = false;
+    AppExecFwk::ExtensionAbilityType type = AppExecFwk::ExtensionAbilityType::UNSPECIFIED;
+    Security::AccessToken::AccessTokenID tokenId = 0;
+};
+
 class UriPermissionManagerStubImpl : public UriPermissionManagerStub,
                                      public std::enable_shared_from_this<UriPermissionManagerStubImpl> {
 public:
@@ -46,10 +66,42 @@ public:
 
     void RemoveUriPermission(const Security::AccessToken::AccessTokenID tokenId) override;
 
+    /**
+     * @brief Drop the cached owners of uris, a package was added, changed or removed.
+     */
+    void ClearUriOwners();
+
 private:
+    void GrantUriPermissionInner(std::string uriStr, unsigned int flag,
+        const Security::AccessToken::AccessTokenID fromTokenId,
+        const Security::AccessToken::AccessTokenID targetTokenId);
     sptr<AppExecFwk::IBundleMgr> ConnectBundleManager();
     int GetCurrentAccountId();
     void ClearProxy();
+    bool GetUriOwner(const std::string &uriStr, UriOwner &owner);
+    void SubscribeBundleEvent();
+    static std::string GetOwnerKey(const std::string &uriStr);
+    static void AddGrant(std::map<std::string, std::list<GrantInfo>> &grantMap, std::set<std::string> &tokenUris,
+        const std::string &uriStr, const GrantInfo &info);
+    static void RemoveGrants(std::map<std::string, std::list<GrantInfo>> &grantMap,
+        const std::set<std::string> &tokenUris, const Security::AccessToken::AccessTokenID tokenId);
+    static bool HasGrant(const std::list<GrantInfo> &infoList, unsigned int flag,
+        const Security::AccessToken::AccessTokenID tokenId);
+    static bool HasDotSegment(const std::string &uriStr);
+    bool HasPrefixGrant(const std::string &uriStr, unsigned int flag,
+        const Security::AccessToken::AccessTokenID tokenId);
+
+    class BundleEventSubscriber : public EventFwk::CommonEventSubscriber {
+    public:
+        BundleEventSubscriber(const EventFwk::CommonEventSubscribeInfo &subscribeInfo,
+            const wptr<UriPermissionManagerStubImpl> &impl)
+            : EventFwk::CommonEventSubscriber(subscribeInfo), impl_(impl) {}
+        ~BundleEventSubscriber() = default;
+        void OnReceiveEvent(const EventFwk::CommonEventData &data) override;
+
+    private:
+        wptr<UriPermissionManagerStubImpl> impl_;
+    };
 
     class BMSDeathRecipient : public IRemoteObject::DeathRecipient {
     public:
@@ -63,9 +115,19 @@ private:
 
 private:
     std::map<std::string, std::list<GrantInfo>> uriMap_;
+    // grants of FLAG_AUTH_PREFIX_URI_PERMISSION, keyed by the directory uri without a trailing '/'.
+    std::map<std::string, std::list<GrantInfo>> prefixUriMap_;
+    std::unordered_map<Security::AccessToken::AccessTokenID, TokenGrants> tokenGrants_;
     std::mutex mutex_;
     std::mutex bmsMutex_;
     sptr<AppExecFwk::IBundleMgr> bundleManager_ = nullptr;
+
+    // keyed by user id and GetOwnerKey, only used once the package events are subscribed.
+    std::unordered_map<std::string, UriOwner> uriOwners_;
+    uint64_t uriOwnerGeneration_ = 0;
+    std::shared_ptr<BundleEventSubscriber> bundleEventSubscriber_;
+    std::chrono::steady_clock::time_point lastSubscribeTime_;
+    std::mutex ownerMutex_;
 };
 }  // namespace AAFwk
 }  // namespace OHOS
@@ -15,7 +15,11 @@
 
 #include "uri_permission_manager_stub_impl.h"
 
+#include <cctype>
+
 #include "accesstoken_kit.h"
+#include "common_event_manager.h"
+#include "common_event_support.h"
 #include "hilog_wrapper.h"
 #include "if_system_ability_manager.h"
 #include "in_process_call_wrapper.h"
@@ -31,6 +35,11 @@ const int32_t DEFAULT_USER_ID = 0;
 #ifndef OS_ACCOUNT_PART_ENABLED
 const int32_t DEFAULT_OS_ACCOUNT_ID = 0; // 0 is the default id when there is no os_account part
 #endif // OS_ACCOUNT_PART_ENABLED
+// the bundle manager takes the owner of "scheme:///authority/path" from "scheme://authority".
+const std::string PARAM_URI_SEPARATOR = ":///";
+const std::string SCHEME_SEPARATOR = "://";
+constexpr size_t MAX_URI_OWNER_COUNT = 256;
+constexpr std::chrono::seconds SUBSCRIBE_RETRY_INTERVAL(10);
 
 void UriPermissionManagerStubImpl::GrantUriPermission(const Uri &uri, unsigned int flag,
     const Security::AccessToken::AccessTokenID fromTokenId, const Security::AccessToken::AccessTokenID targetTokenId)
@@ -42,7 +51,12 @@ void UriPermissionManagerStubImpl::GrantUriPermission(const Uri &uri, unsigned i
         HILOG_DEBUG("caller tokenType is not native, verify failure.");
         return;
     }
+    GrantUriPermissionInner(uri.ToString(), flag, fromTokenId, targetTokenId);
+}
 
+void UriPermissionManagerStubImpl::GrantUriPermissionInner(std::string uriStr, unsigned int flag,
+    const Security::AccessToken::AccessTokenID fromTokenId, const Security::AccessToken::AccessTokenID targetTokenId)
+{
     if ((flag & (Want::FLAG_AUTH_READ_URI_PERMISSION | Want::FLAG_AUTH_WRITE_URI_PERMISSION)) == 0) {
         HILOG_WARN("UriPermissionManagerStubImpl::GrantUriPermission: The param flag is invalid.");
         return;
@@ -54,21 +68,40 @@ void UriPermissionManagerStubImpl::GrantUriPermission(const Uri &uri, unsigned i
         tmpFlag = Want::FLAG_AUTH_READ_URI_PERMISSION;
     }
 
-    auto uriStr = uri.ToString();
-    std::lock_guard<std::mutex> guard(mutex_);
-    auto search = uriMap_.find(uriStr);
+    if ((flag & Want::FLAG_AUTH_PREFIX_URI_PERMISSION) != 0 && HasDotSegment(uriStr)) {
+        HILOG_WARN("The prefix uri has a dot segment, not to grant it.");
+        return;
+    }
+
     GrantInfo info = { tmpFlag, fromTokenId, targetTokenId };
-    if (search == uriMap_.end()) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto &tokenGrants = tokenGrants_[targetTokenId];
+    if ((flag & Want::FLAG_AUTH_PREFIX_URI_PERMISSION) != 0) {
+        while (uriStr.size() > 1 && uriStr.back() == '/') {
+            uriStr.pop_back();
+        }
+        AddGrant(prefixUriMap_, tokenGrants.prefixUris, uriStr, info);
+        return;
+    }
+    AddGrant(uriMap_, tokenGrants.uris, uriStr, info);
+}
+
+void UriPermissionManagerStubImpl::AddGrant(std::map<std::string, std::list<GrantInfo>> &grantMap,
+    std::set<std::string> &tokenUris, const std::string &uriStr, const GrantInfo &info)
+{
+    auto search = grantMap.find(uriStr);
+    if (search == grantMap.end()) {
         HILOG_INFO("uri is not exist, add uri and GrantInfo to map.");
         std::list<GrantInfo> infoList = { info };
-        uriMap_.emplace(uriStr, infoList);
+        grantMap.emplace(uriStr, infoList);
+        tokenUris.insert(uriStr);
         return;
     }
     auto& infoList = search->second;
     for (auto& item : infoList) {
-        if (item.fromTokenId == fromTokenId && item.targetTokenId == targetTokenId) {
-            if ((tmpFlag & Want::FLAG_AUTH_WRITE_URI_PERMISSION) != 0) {
-                item.flag = tmpFlag;
+        if (item.fromTokenId == info.fromTokenId && item.targetTokenId == info.targetTokenId) {
+            if ((info.flag & Want::FLAG_AUTH_WRITE_URI_PERMISSION) != 0) {
+                item.flag = info.flag;
             }
             HILOG_INFO("uri permission has granted, not to grant again.");
             return;
@@ -76,6 +109,7 @@ void UriPermissionManagerStubImpl::GrantUriPermission(const Uri &uri, unsigned i
     }
     HILOG_DEBUG("uri is exist, add GrantInfo to list.");
     infoList.emplace_back(info);
+    tokenUris.insert(uriStr);
 }
 
 bool UriPermissionManagerStubImpl::VerifyUriPermission(const Uri &uri, unsigned int flag,
@@ -86,32 +120,24 @@ bool UriPermissionManagerStubImpl::VerifyUriPermission(const Uri &uri, unsigned
         return false;
     }
 
-    auto bms = ConnectBundleManager();
     auto uriStr = uri.ToString();
-    if (bms) {
-        AppExecFwk::ExtensionAbilityInfo info;
-        if (!IN_PROCESS_CALL(bms->QueryExtensionAbilityInfoByUri(uriStr, GetCurrentAccountId(), info))) {
+    UriOwner owner;
+    if (GetUriOwner(uriStr, owner)) {
+        if (!owner.found) {
             HILOG_DEBUG("%{public}s, Fail to get extension info from bundle manager.", __func__);
             return false;
         }
-        if (info.type != AppExecFwk::ExtensionAbilityType::FILESHARE) {
-            HILOG_DEBUG("%{public}s, The upms only open to FILESHARE. The type is %{public}u.", __func__, info.type);
+        if (owner.type != AppExecFwk::ExtensionAbilityType::FILESHARE) {
+            HILOG_DEBUG("%{public}s, The upms only open to FILESHARE. The type is %{public}u.", __func__, owner.type);
             return false;
         }
 
-        if (tokenId == info.applicationInfo.accessTokenId) {
+        if (tokenId == owner.tokenId) {
             HILOG_DEBUG("The uri belongs to this application.");
             return true;
         }
     }
 
-    std::lock_guard<std::mutex> guard(mutex_);
-    auto search = uriMap_.find(uriStr);
-    if (search == uriMap_.end()) {
-        HILOG_DEBUG("This tokenID does not have permission for this uri.");
-        return false;
-    }
-
     unsigned int tmpFlag = 0;
     if (flag & Want::FLAG_AUTH_WRITE_URI_PERMISSION) {
         tmpFlag = Want::FLAG_AUTH_WRITE_URI_PERMISSION;
@@ -119,38 +145,227 @@ bool UriPermissionManagerStubImpl::VerifyUriPermission(const Uri &uri, unsigned
         tmpFlag = Want::FLAG_AUTH_READ_URI_PERMISSION;
     }
 
-    for (auto& item : search->second) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto search = uriMap_.find(uriStr);
+    if (search != uriMap_.end() && HasGrant(search->second, tmpFlag, tokenId)) {
+        HILOG_DEBUG("This tokenID have permission for this uri.");
+        return true;
+    }
+    if (!prefixUriMap_.empty() && HasPrefixGrant(uriStr, tmpFlag, tokenId)) {
+        HILOG_DEBUG("This tokenID have permission for a directory of this uri.");
+        return true;
+    }
+
+    HILOG_DEBUG("The application does not have permission for this URI.");
+    return false;
+}
+
+bool UriPermissionManagerStubImpl::HasGrant(const std::list<GrantInfo> &infoList, unsigned int flag,
+    const Security::AccessToken::AccessTokenID tokenId)
+{
+    for (auto& item : infoList) {
         if (item.targetTokenId == tokenId &&
-            (item.flag == Want::FLAG_AUTH_WRITE_URI_PERMISSION || item.flag == tmpFlag)) {
-            HILOG_DEBUG("This tokenID have permission for this uri.");
+            (item.flag == Want::FLAG_AUTH_WRITE_URI_PERMISSION || item.flag == flag)) {
             return true;
         }
     }
+    return false;
+}
 
-    HILOG_DEBUG("The application does not have permission for this URI.");
+bool UriPermissionManagerStubImpl::HasPrefixGrant(const std::string &uriStr, unsigned int flag,
+    const Security::AccessToken::AccessTokenID tokenId)
+{
+    // a uri walking up out of a granted directory must not match it.
+    if (HasDotSegment(uriStr)) {
+        HILOG_WARN("The uri has a dot segment, no prefix grant matches it.");
+        return false;
+    }
+    // look the uri and each of its parent directories up, never above the authority.
+    auto schemePos = uriStr.find(SCHEME_SEPARATOR);
+    if (schemePos == std::string::npos) {
+        return false;
+    }
+    size_t minSize = schemePos + SCHEME_SEPARATOR.size();
+    std::string path = uriStr;
+    while (path.size() > minSize) {
+        while (path.size() > minSize && path.back() == '/') {
+            path.pop_back();
+        }
+        auto search = prefixUriMap_.find(path);
+        if (search != prefixUriMap_.end() && HasGrant(search->second, flag, tokenId)) {
+            return true;
+        }
+        auto pos = path.rfind('/');
+        if (pos == std::string::npos || pos < minSize) {
+            break;
+        }
+        path.resize(pos);
+    }
+    return false;
+}
+
+bool UriPermissionManagerStubImpl::HasDotSegment(const std::string &uriStr)
+{
+    // decode "%2e" and "%2f" the way the file system sees them, then look for a "." or ".." segment.
+    auto schemePos = uriStr.find(SCHEME_SEPARATOR);
+    size_t start = (schemePos == std::string::npos) ? 0 : schemePos + SCHEME_SEPARATOR.size();
+    std::string path;
+    for (size_t i = start; i < uriStr.size(); i++) {
+        if (uriStr[i] == '%' && i + 2 < uriStr.size() && uriStr[i + 1] == '2') {
+            char c = static_cast<char>(std::tolower(static_cast<unsigned char>(uriStr[i + 2])));
+            if (c == 'e' || c == 'f') {
+                path.push_back(c == 'e' ? '.' : '/');
+                i += 2;
+                continue;
+            }
+        }
+        path.push_back(uriStr[i]);
+    }
+    size_t begin = 0;
+    while (begin <= path.size()) {
+        auto end = path.find('/', begin);
+        if (end == std::string::npos) {
+            end = path.size();
+        }
+        auto segment = path.substr(begin, end - begin);
+        if (segment == "." || segment == "..") {
+            return true;
+        }
+        begin = end + 1;
+    }
     return false;
 }
 
 void UriPermissionManagerStubImpl::RemoveUriPermission(const Security::AccessToken::AccessTokenID tokenId)
 {
     std::lock_guard<std::mutex> guard(mutex_);
-    for (auto iter = uriMap_.begin(); iter != uriMap_.end();) {
-        auto& list = iter->second;
-        for (auto it = list.begin(); it != list.end(); it++) {
-            if (it->targetTokenId == tokenId) {
-                HILOG_INFO("Erase an info form list.");
-                list.erase(it);
-                break;
-            }
+    auto iter = tokenGrants_.find(tokenId);
+    if (iter == tokenGrants_.end()) {
+        return;
+    }
+    RemoveGrants(uriMap_, iter->second.uris, tokenId);
+    RemoveGrants(prefixUriMap_, iter->second.prefixUris, tokenId);
+    tokenGrants_.erase(iter);
+}
+
+void UriPermissionManagerStubImpl::RemoveGrants(std::map<std::string, std::list<GrantInfo>> &grantMap,
+    const std::set<std::string> &tokenUris, const Security::AccessToken::AccessTokenID tokenId)
+{
+    for (const auto &uriStr : tokenUris) {
+        auto search = grantMap.find(uriStr);
+        if (search == grantMap.end()) {
+            continue;
         }
-        if (list.size() == 0) {
-            uriMap_.erase(iter++);
-        } else {
-            iter++;
+        auto& list = search->second;
+        list.remove_if([tokenId](const GrantInfo &info) { return info.targetTokenId == tokenId; });
+        if (list.empty()) {
+            HILOG_INFO("Erase an uri form map.");
+            grantMap.erase(search);
         }
     }
 }
 
+std::string UriPermissionManagerStubImpl::GetOwnerKey(const std::string &uriStr)
+{
+    // the same part of the uri the bundle manager matches the FILESHARE extension with.
+    auto schemePos = uriStr.find(PARAM_URI_SEPARATOR);
+    if (schemePos == std::string::npos) {
+        return uriStr;
+    }
+    auto cutPos = uriStr.find('/', schemePos + PARAM_URI_SEPARATOR.size());
+    if (cutPos == std::string::npos) {
+        return uriStr;
+    }
+    return uriStr.substr(0, cutPos);
+}
+
+bool UriPermissionManagerStubImpl::GetUriOwner(const std::string &uriStr, UriOwner &owner)
+{
+    auto bms = ConnectBundleManager();
+    if (bms == nullptr) {
+        return false;
+    }
+    int32_t userId = GetCurrentAccountId();
+    std::string key = std::to_string(userId) + "|" + GetOwnerKey(uriStr);
+    uint64_t generation = 0;
+    bool cacheEnabled = false;
+    {
+        std::lock_guard<std::mutex> guard(ownerMutex_);
+        cacheEnabled = bundleEventSubscriber_ != nullptr;
+        auto search = uriOwners_.find(key);
+        if (search != uriOwners_.end()) {
+            owner = search->second;
+            return true;
+        }
+        generation = uriOwnerGeneration_;
+    }
+    if (!cacheEnabled) {
+        SubscribeBundleEvent();
+    }
+
+    AppExecFwk::ExtensionAbilityInfo info;
+    owner.found = IN_PROCESS_CALL(bms->QueryExtensionAbilityInfoByUri(uriStr, userId, info));
+    owner.type = info.type;
+    owner.tokenId = info.applicationInfo.accessTokenId;
+
+    std::lock_guard<std::mutex> guard(ownerMutex_);
+    // an owner queried before a package changed may be stale, and none is kept until the changes are heard.
+    if (bundleEventSubscriber_ == nullptr || generation != uriOwnerGeneration_) {
+        return true;
+    }
+    if (uriOwners_.size() >= MAX_URI_OWNER_COUNT) {
+        uriOwners_.clear();
+    }
+    uriOwners_.emplace(key, owner);
+    return true;
+}
+
+void UriPermissionManagerStubImpl::ClearUriOwners()
+{
+    std::lock_guard<std::mutex> guard(ownerMutex_);
+    uriOwnerGeneration_++;
+    uriOwners_.clear();
+}
+
+void UriPermissionManagerStubImpl::SubscribeBundleEvent()
+{
+    {
+        std::lock_guard<std::mutex> guard(ownerMutex_);
+        auto now = std::chrono::steady_clock::now();
+        if (bundleEventSubscriber_ != nullptr || (lastSubscribeTime_ != std::chrono::steady_clock::time_point() &&
+            now - lastSubscribeTime_ < SUBSCRIBE_RETRY_INTERVAL)) {
+            return;
+        }
+        lastSubscribeTime_ = now;
+    }
+    EventFwk::MatchingSkills matchingSkills;
+    matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_ADDED);
+    matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_CHANGED);
+    matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_REMOVED);
+    matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_USER_REMOVED);
+    EventFwk::CommonEventSubscribeInfo subscribeInfo(matchingSkills);
+    auto subscriber = std::make_shared<BundleEventSubscriber>(subscribeInfo, this);
+    if (!EventFwk::CommonEventManager::SubscribeCommonEvent(subscriber)) {
+        HILOG_WARN("Subscribe bundle event failed, the owners of uris are not cached.");
+        return;
+    }
+    std::lock_guard<std::mutex> guard(ownerMutex_);
+    bundleEventSubscriber_ = subscriber;
+    // nothing was cached while package events could be missed.
+    uriOwnerGeneration_++;
+    uriOwners_.clear();
+}
+
+void UriPermissionManagerStubImpl::BundleEventSubscriber::OnReceiveEvent(const EventFwk::CommonEventData &data)
+{
+    auto impl = impl_.promote();
+    if (impl == nullptr) {
+        return;
+    }
+    HILOG_DEBUG("%{public}s, action: %{public}s.", __func__, data.GetWant().GetAction().c_str());
+    impl->ClearUriOwners();
+}
+
 sptr<AppExecFwk::IBundleMgr> UriPermissionManagerStubImpl::ConnectBundleManager()
 {
     HILOG_DEBUG("%{public}s is called.", __func__);
@@ -167,9 +382,9 @@ sptr<AppExecFwk::IBundleMgr> UriPermissionManagerStubImpl::ConnectBundleManager(
             HILOG_ERROR("Failed to get bms.");
             return nullptr;
         }
-        auto self = weak_from_this();
+        wptr<UriPermissionManagerStubImpl> self(this);
         const auto& onClearProxyCallback = [self](const wptr<IRemoteObject>& remote) {
-            auto impl = self.lock();
+            auto impl = self.promote();
             if (impl && impl->bundleManager_ == remote) {
                 impl->ClearProxy();
             }
@@ -184,8 +399,12 @@ sptr<AppExecFwk::IBundleMgr> UriPermissionManagerStubImpl::ConnectBundleManager(
 void UriPermissionManagerStubImpl::ClearProxy()
 {
     HILOG_DEBUG("%{public}s is called.", __func__);
-    std::lock_guard<std::mutex> lock(bmsMutex_);
-    bundleManager_ = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(bmsMutex_);
+        bundleManager_ = nullptr;
+    }
+    // packages may change while the bundle manager restarts.
+    ClearUriOwners();
 }
 
 void UriPermissionManagerStubImpl::BMSDeathRecipient::OnRemoteDied([[maybe_unused]] const wptr<IRemoteObject>& remote)
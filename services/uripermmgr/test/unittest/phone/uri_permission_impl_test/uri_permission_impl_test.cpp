@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+
+#include "common_event_data.h"
+#include "common_event_support.h"
+#include "uri.h"
+#include "want.h"
+#define private public
+#include "uri_permission_manager_stub_impl.h"
+#undef private
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace AAFwk {
+namespace {
+const std::string OWNER_KEY = "dataability:///com.example.upms";
+const std::string DIR_URI = OWNER_KEY + "/data";
+constexpr Security::AccessToken::AccessTokenID OWNER_TOKEN_ID = 1000;
+constexpr Security::AccessToken::AccessTokenID TARGET_TOKEN_ID = 1001;
+constexpr Security::AccessToken::AccessTokenID OTHER_TOKEN_ID = 1002;
+constexpr unsigned int READ_FLAG = Want::FLAG_AUTH_READ_URI_PERMISSION;
+constexpr unsigned int WRITE_FLAG = Want::FLAG_AUTH_WRITE_URI_PERMISSION;
+constexpr unsigned int PREFIX_READ_FLAG = Want::FLAG_AUTH_READ_URI_PERMISSION | Want::FLAG_AUTH_PREFIX_URI_PERMISSION;
+}  // namespace
+
+class UriPermissionImplTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    bool Verify(const std::string &uriStr, unsigned int flag, Security::AccessToken::AccessTokenID tokenId);
+
+    sptr<UriPermissionManagerStubImpl> upms_ = nullptr;
+};
+
+void UriPermissionImplTest::SetUpTestCase(void)
+{}
+
+void UriPermissionImplTest::TearDownTestCase(void)
+{}
+
+void UriPermissionImplTest::SetUp()
+{
+    upms_ = new UriPermissionManagerStubImpl();
+    // a FILESHARE owner other than the tokens under test, so the bundle manager is never asked.
+    UriOwner owner;
+    owner.found = true;
+    owner.type = AppExecFwk::ExtensionAbilityType::FILESHARE;
+    owner.tokenId = OWNER_TOKEN_ID;
+    std::string key = std::to_string(upms_->GetCurrentAccountId()) + "|" + OWNER_KEY;
+    upms_->uriOwners_.emplace(key, owner);
+}
+
+void UriPermissionImplTest::TearDown()
+{
+    upms_ = nullptr;
+}
+
+bool UriPermissionImplTest::Verify(const std::string &uriStr, unsigned int flag,
+    Security::AccessToken::AccessTokenID tokenId)
+{
+    Uri uri(uriStr);
+    return upms_->VerifyUriPermission(uri, flag, tokenId);
+}
+
+/*
+ * Feature: UriPermissionManagerStubImpl
+ * Function: GrantUriPermission/VerifyUriPermission/RemoveUriPermission
+ * SubFunction: NA
+ * FunctionPoints: a prefix grant covers the directory and every uri below it, and is revoked with its token.
+ * EnvConditions: NA
+ * CaseDescription: NA
+ */
+HWTEST_F(UriPermissionImplTest, UriPermission_PrefixGrant_0100, TestSize.Level1)
+{
+    upms_->GrantUriPermissionInner(DIR_URI + "/", PREFIX_READ_FLAG, OWNER_TOKEN_ID, TARGET_TOKEN_ID);
+    EXPECT_EQ(upms_->prefixUriMap_.count(DIR_URI), 1);
+
+    EXPECT_TRUE(Verify(DIR_URI, READ_FLAG, TARGET_TOKEN_ID));
+    EXPECT_TRUE(Verify(DIR_URI + "/a.txt", READ_FLAG, TARGET_TOKEN_ID));
+    EXPECT_TRUE(Verify(DIR_URI + "/sub/b.txt", READ_FLAG, TARGET_TOKEN_ID));
+    EXPECT_FALSE(Verify(DIR_URI + "base/a.txt", READ_FLAG, TARGET_TOKEN_ID));
+    EXPECT_FALSE(Verify(OWNER_KEY + "/other/a.txt", READ_FLAG, TARGET_TOKEN_ID));
+    EXPECT_FALSE(Verify(DIR_URI + "/a.txt", WRITE_FLAG, TARGET_TOKEN_ID));
+    EXPECT_FALSE(Verify(DIR_URI + "/a.txt", READ_FLAG, OTHER_TOKEN_ID));
+
+    upms_->RemoveUriPermission(TARGET_TOKEN_ID);
+    EXPECT_FALSE(Verify(DIR_URI + "/a.txt", READ_FLAG, TARGET_TOKEN_ID));
+    EXPECT_TRUE(upms_->prefixUriMap_.empty());
+    EXPECT_TRUE(upms_->tokenGrants_.empty());
+}
+
+/*
+ * Feature: UriPermissionManagerStubImpl
+ * Function: GrantUriPermission/VerifyUriPermission
+ * SubFunction: NA
+ * FunctionPoints: "." and ".." segments, plain or percent-encoded, never match a prefix grant.
+ * EnvConditions: NA
+ * CaseDescription: NA
+ */
+HWTEST_F(UriPermissionImplTest, UriPermission_PrefixGrant_0200, TestSize.Level1)
+{
+    upms_->GrantUriPermissionInner(DIR_URI, PREFIX_READ_FLAG, OWNER_TOKEN_ID, TARGET_TOKEN_ID);
+
+    EXPECT_FALSE(Verify(DIR_URI + "/../secret", READ_FLAG, TARGET_TOKEN_ID));
+    EXPECT_FALSE(Verify(DIR_URI + "/sub/../../secret", READ_FLAG, TARGET_TOKEN_ID));
+    EXPECT_FALSE(Verify(DIR_URI + "/%2e%2E/secret", READ_FLAG, TARGET_TOKEN_ID));
+    EXPECT_FALSE(Verify(DIR_URI + "/.%2e%2fsecret", READ_FLAG, TARGET_TOKEN_ID));
+    EXPECT_FALSE(Verify(DIR_URI + "/./a.txt", READ_FLAG, TARGET_TOKEN_ID));
+    EXPECT_FALSE(Verify(DIR_URI + "/..", READ_FLAG, TARGET_TOKEN_ID));
+    EXPECT_TRUE(Verify(DIR_URI + "/..a.txt", READ_FLAG, TARGET_TOKEN_ID));
+
+    upms_->GrantUriPermissionInner(DIR_URI + "/../other", PREFIX_READ_FLAG, OWNER_TOKEN_ID, OTHER_TOKEN_ID);
+    upms_->GrantUriPermissionInner(DIR_URI + "/%2E%2E", PREFIX_READ_FLAG, OWNER_TOKEN_ID, OTHER_TOKEN_ID);
+    EXPECT_EQ(upms_->prefixUriMap_.size(), 1);
+    EXPECT_EQ(upms_->tokenGrants_.count(OTHER_TOKEN_ID), 0);
+    EXPECT_FALSE(Verify(OWNER_KEY + "/other/a.txt", READ_FLAG, OTHER_TOKEN_ID));
+}
+
+/*
+ * Feature: UriPermissionManagerStubImpl
+ * Function: RemoveUriPermission
+ * SubFunction: NA
+ * FunctionPoints: every grant of the token is removed, the grants of other tokens are kept.
+ * EnvConditions: NA
+ * CaseDescription: NA
+ */
+HWTEST_F(UriPermissionImplTest, UriPermission_RemoveUriPermission_0100, TestSize.Level1)
+{
+    const std::string uriA = OWNER_KEY + "/files/a.txt";
+    const std::string uriB = OWNER_KEY + "/files/b.txt";
+    upms_->GrantUriPermissionInner(uriA, READ_FLAG, OWNER_TOKEN_ID, TARGET_TOKEN_ID);
+    upms_->GrantUriPermissionInner(uriB, WRITE_FLAG, OWNER_TOKEN_ID, TARGET_TOKEN_ID);
+    upms_->GrantUriPermissionInner(DIR_URI, PREFIX_READ_FLAG, OWNER_TOKEN_ID, TARGET_TOKEN_ID);
+    upms_->GrantUriPermissionInner(uriA, READ_FLAG, OWNER_TOKEN_ID, OTHER_TOKEN_ID);
+    EXPECT_TRUE(Verify(uriA, READ_FLAG, TARGET_TOKEN_ID));
+    EXPECT_TRUE(Verify(uriB, WRITE_FLAG, TARGET_TOKEN_ID));
+    EXPECT_TRUE(Verify(DIR_URI + "/c.txt", READ_FLAG, TARGET_TOKEN_ID));
+
+    upms_->RemoveUriPermission(TARGET_TOKEN_ID);
+    EXPECT_FALSE(Verify(uriA, READ_FLAG, TARGET_TOKEN_ID));
+    EXPECT_FALSE(Verify(uriB, READ_FLAG, TARGET_TOKEN_ID));
+    EXPECT_FALSE(Verify(DIR_URI + "/c.txt", READ_FLAG, TARGET_TOKEN_ID));
+    EXPECT_TRUE(Verify(uriA, READ_FLAG, OTHER_TOKEN_ID));
+    EXPECT_EQ(upms_->uriMap_.size(), 1);
+    EXPECT_TRUE(upms_->prefixUriMap_.empty());
+    EXPECT_EQ(upms_->tokenGrants_.count(TARGET_TOKEN_ID), 0);
+
+    upms_->RemoveUriPermission(OTHER_TOKEN_ID);
+    EXPECT_TRUE(upms_->uriMap_.empty());
+    EXPECT_TRUE(upms_->tokenGrants_.empty());
+}
+
+/*
+ * Feature: UriPermissionManagerStubImpl
+ * Function: ClearUriOwners
+ * SubFunction: BundleEventSubscriber::OnReceiveEvent
+ * FunctionPoints: a package event drops the cached owners of uris.
+ * EnvConditions: NA
+ * CaseDescription: NA
+ */
+HWTEST_F(UriPermissionImplTest, UriPermission_ClearUriOwners_0100, TestSize.Level1)
+{
+    EXPECT_EQ(upms_->uriOwners_.size(), 1);
+    auto generation = upms_->uriOwnerGeneration_;
+
+    EventFwk::MatchingSkills matchingSkills;
+    matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_CHANGED);
+    EventFwk::CommonEventSubscribeInfo subscribeInfo(matchingSkills);
+    auto subscriber = std::make_shared<UriPermissionManagerStubImpl::BundleEventSubscriber>(subscribeInfo, upms_);
+    Want want;
+    want.SetAction(EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_CHANGED);
+    EventFwk::CommonEventData data(want);
+    subscriber->OnReceiveEvent(data);
+
+    EXPECT_TRUE(upms_->uriOwners_.empty());
+    EXPECT_EQ(upms_->uriOwnerGeneration_, generation + 1);
+
+    upms_->uriOwners_.emplace("0|" + OWNER_KEY, UriOwner());
+    upms_->ClearUriOwners();
+    EXPECT_TRUE(upms_->uriOwners_.empty());
+    EXPECT_EQ(upms_->uriOwnerGeneration_, generation + 2);
+}
+}  // namespace AAFwk
+}  // namespace OHOS
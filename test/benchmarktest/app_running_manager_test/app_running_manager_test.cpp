@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "app_running_manager.h"
+#include "mock_ability_token.h"
+
+using namespace std;
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace {
+class AppRunningManagerTest : public benchmark::Fixture {
+public:
+    AppRunningManagerTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~AppRunningManagerTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        appRunningManager_ = make_shared<AppRunningManager>();
+        for (int32_t i = 0; i < recordCount; i++) {
+            auto appInfo = make_shared<ApplicationInfo>();
+            appInfo->name = "com.example.app" + to_string(i);
+            appInfo->bundleName = appInfo->name;
+            appInfo->uid = uid + i;
+            BundleInfo bundleInfo;
+            bundleInfo.appId = appInfo->bundleName + "_signcode" + to_string(i);
+            bundleInfos_.emplace_back(bundleInfo);
+            auto appRecord = appRunningManager_->CreateAppRunningRecord(appInfo, appInfo->name, bundleInfo);
+            if (appRecord == nullptr) {
+                continue;
+            }
+            appRecord->GetPriorityObject()->SetPid(firstPid + i);
+            auto abilityInfo = make_shared<AbilityInfo>();
+            abilityInfo->name = "MainAbility";
+            HapModuleInfo hapModuleInfo;
+            hapModuleInfo.moduleName = "entry";
+            sptr<IRemoteObject> token = new MockAbilityToken();
+            appRecord->AddModule(appInfo, abilityInfo, token, hapModuleInfo, nullptr);
+            appInfos_.emplace_back(appInfo);
+            tokens_.emplace_back(token);
+        }
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+        appRunningManager_->ClearAppRunningRecordMap();
+        appRunningManager_.reset();
+        appInfos_.clear();
+        bundleInfos_.clear();
+        tokens_.clear();
+    }
+
+protected:
+    shared_ptr<AppRunningManager> appRunningManager_ = nullptr;
+    vector<shared_ptr<ApplicationInfo>> appInfos_;
+    vector<BundleInfo> bundleInfos_;
+    vector<sptr<IRemoteObject>> tokens_;
+    const int32_t uid = 20010001;
+    const pid_t firstPid = 2000;
+    const int32_t recordCount = 500;
+    const int32_t repetitions = 3;
+    const int32_t iterations = 1000;
+};
+
+BENCHMARK_F(AppRunningManagerTest, GetAppRunningRecordByPidTestCase)(
+    benchmark::State &state)
+{
+    int32_t index = 0;
+    while (state.KeepRunning()) {
+        if (appRunningManager_->GetAppRunningRecordByPid(firstPid + index) == nullptr) {
+            state.SkipWithError("GetAppRunningRecordByPidTestCase failed.");
+        }
+        index = (index + 1) % recordCount;
+    }
+}
+
+BENCHMARK_F(AppRunningManagerTest, GetAppRunningRecordByAbilityTokenTestCase)(
+    benchmark::State &state)
+{
+    size_t index = 0;
+    while (state.KeepRunning()) {
+        if (appRunningManager_->GetAppRunningRecordByAbilityToken(tokens_[index]) == nullptr) {
+            state.SkipWithError("GetAppRunningRecordByAbilityTokenTestCase failed.");
+        }
+        index = (index + 1) % tokens_.size();
+    }
+}
+
+// Look up an existing process as LoadAbility does before deciding to start a new one.
+BENCHMARK_F(AppRunningManagerTest, CheckAppRunningRecordIsExistTestCase)(
+    benchmark::State &state)
+{
+    size_t index = 0;
+    while (state.KeepRunning()) {
+        const auto &appInfo = appInfos_[index];
+        if (appRunningManager_->CheckAppRunningRecordIsExist(
+            appInfo->name, appInfo->name, appInfo->uid, bundleInfos_[index]) == nullptr) {
+            state.SkipWithError("CheckAppRunningRecordIsExistTestCase failed.");
+        }
+        index = (index + 1) % appInfos_.size();
+    }
+}
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
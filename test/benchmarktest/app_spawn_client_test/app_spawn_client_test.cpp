@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "app_spawn_client.h"
+#include "fake_app_spawn_socket.h"
+
+using namespace std;
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace {
+class AppSpawnClientTest : public benchmark::Fixture {
+public:
+    AppSpawnClientTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~AppSpawnClientTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        spawner_ = make_shared<FakeAppSpawner>();
+        spawner_->replyDelay = chrono::microseconds(replyDelayUs);
+        auto spawner = spawner_;
+        spawnClient_ = make_shared<AppSpawnClient>();
+        spawnClient_->SetSocket(make_shared<FakeAppSpawnSocket>(spawner));
+        spawnClient_->SetSocketFactory([spawner]() { return make_shared<FakeAppSpawnSocket>(spawner); });
+        for (int32_t i = 0; i < processCount; i++) {
+            AppSpawnStartMsg startMsg {};
+            startMsg.uid = uid + i;
+            startMsg.gid = uid + i;
+            startMsg.gids = { uid + i };
+            startMsg.procName = "com.example.resident" + to_string(i);
+            startMsg.soPath = "system/lib/libmapleappkit.z.so";
+            startMsg.bundleName = startMsg.procName;
+            startMsgs_.emplace_back(startMsg);
+        }
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+        startMsgs_.clear();
+        spawnClient_.reset();
+        spawner_.reset();
+    }
+
+protected:
+    shared_ptr<FakeAppSpawner> spawner_ = nullptr;
+    shared_ptr<AppSpawnClient> spawnClient_ = nullptr;
+    vector<AppSpawnStartMsg> startMsgs_;
+    const int32_t uid = 20010001;
+    const int32_t processCount = 32;
+    const int32_t replyDelayUs = 200;
+    const int32_t repetitions = 3;
+    const int32_t iterations = 100;
+};
+
+// Start the resident processes of a boot one by one, waiting for each pid before sending the next request.
+BENCHMARK_F(AppSpawnClientTest, StartProcessTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        for (const auto &startMsg : startMsgs_) {
+            pid_t pid = 0;
+            if (FAILED(spawnClient_->StartProcess(startMsg, pid))) {
+                state.SkipWithError("StartProcessTestCase failed.");
+            }
+        }
+    }
+}
+
+// Start the same batch with the requests pipelined.
+BENCHMARK_F(AppSpawnClientTest, StartProcessesTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        spawnClient_->StartProcesses(startMsgs_, [&state](size_t index, ErrCode errCode, pid_t pid) {
+            if (FAILED(errCode)) {
+                state.SkipWithError("StartProcessesTestCase failed.");
+            }
+        });
+    }
+}
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
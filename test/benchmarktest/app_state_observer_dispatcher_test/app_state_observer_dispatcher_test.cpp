@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "app_state_observer_dispatcher.h"
+#include "application_state_observer_stub.h"
+
+using namespace std;
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace {
+constexpr int32_t OBSERVER_COUNT = 50;
+constexpr auto SLOW_CALLBACK_TIME = chrono::milliseconds(2);
+constexpr auto WAIT_TIME = chrono::seconds(5);
+
+// counts the notifications the fast observers got.
+class DeliveryCounter {
+public:
+    void Add()
+    {
+        lock_guard<mutex> lock(mutex_);
+        count_++;
+        cv_.notify_all();
+    }
+
+    uint64_t Get()
+    {
+        lock_guard<mutex> lock(mutex_);
+        return count_;
+    }
+
+    bool WaitFor(uint64_t count)
+    {
+        unique_lock<mutex> lock(mutex_);
+        return cv_.wait_for(lock, WAIT_TIME, [this, count] { return count_ >= count; });
+    }
+
+private:
+    mutex mutex_;
+    condition_variable cv_;
+    uint64_t count_ = 0;
+};
+
+class CountingObserver : public ApplicationStateObserverStub {
+public:
+    CountingObserver(const shared_ptr<DeliveryCounter> &counter, bool slow) : counter_(counter), slow_(slow)
+    {}
+
+    void OnAbilityStateChanged(const AbilityStateData &abilityStateData) override
+    {
+        if (slow_) {
+            this_thread::sleep_for(SLOW_CALLBACK_TIME);
+            return;
+        }
+        counter_->Add();
+    }
+
+private:
+    shared_ptr<DeliveryCounter> counter_;
+    bool slow_ = false;
+};
+
+class AppStateObserverDispatcherTest : public benchmark::Fixture {
+public:
+    AppStateObserverDispatcherTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~AppStateObserverDispatcherTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        counter_ = make_shared<DeliveryCounter>();
+        dispatcher_ = make_shared<AppStateObserverDispatcher>(nullptr);
+        // the slow observer comes first, as any registered early may.
+        for (int32_t i = 0; i < OBSERVER_COUNT; i++) {
+            sptr<IApplicationStateObserver> observer = new CountingObserver(counter_, i == 0);
+            observers_.emplace_back(observer);
+            dispatcher_->AddObserver(observer);
+        }
+        token_ = new CountingObserver(counter_, false);
+        event_ = make_shared<ObserverEvent>();
+        event_->type = ObserverEventType::ABILITY_STATE_CHANGED;
+        event_->abilityStateData.bundleName = "com.example.app";
+        event_->abilityStateData.abilityName = "MainAbility";
+        event_->abilityStateData.token = token_;
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+        for (const auto &observer : observers_) {
+            dispatcher_->RemoveObserver(observer);
+        }
+        observers_.clear();
+        dispatcher_.reset();
+    }
+
+protected:
+    const int32_t repetitions = 3;
+    const int32_t iterations = 100;
+    shared_ptr<DeliveryCounter> counter_;
+    shared_ptr<AppStateObserverDispatcher> dispatcher_;
+    vector<sptr<IApplicationStateObserver>> observers_;
+    sptr<IRemoteObject> token_;
+    shared_ptr<ObserverEvent> event_;
+};
+
+// Call every observer in turn, as the observer manager did, until the fast observers are notified.
+BENCHMARK_F(AppStateObserverDispatcherTest, SerialNotifyTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        for (const auto &observer : observers_) {
+            observer->OnAbilityStateChanged(event_->abilityStateData);
+        }
+    }
+}
+
+// Queue a state change for every observer and wait for the fast observers to be notified.
+BENCHMARK_F(AppStateObserverDispatcherTest, DispatchTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        uint64_t expected = counter_->Get() + OBSERVER_COUNT - 1;
+        dispatcher_->Dispatch(event_);
+        if (!counter_->WaitFor(expected)) {
+            state.SkipWithError("DispatchTestCase failed.");
+        }
+    }
+}
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
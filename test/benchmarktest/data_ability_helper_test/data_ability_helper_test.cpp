@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+
+#include "data_ability_connection_pool.h"
+#include "data_ability_helper.h"
+#include "mock_ability_manager_client.h"
+#include "values_bucket.h"
+
+using namespace std;
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace {
+class DataAbilityHelperTest : public benchmark::Fixture {
+public:
+    DataAbilityHelperTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~DataAbilityHelperTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        token_ = new (std::nothrow) MockAbilityThread();
+        dataAbilityHelper_ = DataAbilityHelper::Creator(token_);
+        value_.PutString("name", "benchmark");
+        value_.PutInt("age", age);
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+        DataAbilityConnectionPool::GetInstance().SetIdleTimeout(0);
+        DataAbilityConnectionPool::GetInstance().ReleaseIdleConnections();
+        dataAbilityHelper_.reset();
+        token_ = nullptr;
+    }
+
+protected:
+    sptr<IRemoteObject> token_ = nullptr;
+    shared_ptr<DataAbilityHelper> dataAbilityHelper_ = nullptr;
+    NativeRdb::ValuesBucket value_;
+    const std::string uri = "dataability:///com.example.benchmark.DataAbility/person";
+    const int32_t age = 20;
+    const int32_t repetitions = 3;
+    const int32_t iterations = 10000;
+};
+
+// Repeated inserts against one provider through a helper without a bound uri reuse the pooled connection.
+BENCHMARK_F(DataAbilityHelperTest, InsertTestCase)(
+    benchmark::State &state)
+{
+    Uri dataUri(uri);
+    while (state.KeepRunning()) {
+        if (dataAbilityHelper_->Insert(dataUri, value_) != INSERTNUM) {
+            state.SkipWithError("InsertTestCase failed.");
+        }
+    }
+}
+
+// Release the connection after every insert, as each insert acquired and released the data ability before.
+BENCHMARK_F(DataAbilityHelperTest, InsertWithoutPoolTestCase)(
+    benchmark::State &state)
+{
+    Uri dataUri(uri);
+    auto &pool = DataAbilityConnectionPool::GetInstance();
+    pool.SetIdleTimeout(0);
+    while (state.KeepRunning()) {
+        if (dataAbilityHelper_->Insert(dataUri, value_) != INSERTNUM) {
+            state.SkipWithError("InsertWithoutPoolTestCase failed.");
+        }
+        pool.ReleaseIdleConnections();
+    }
+}
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include "form_constants.h"
+#define private public
+#include "form_timer_mgr.h"
+#undef private
+
+using namespace std;
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace {
+class FormTimerMgrTest : public benchmark::Fixture {
+public:
+    FormTimerMgrTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~FormTimerMgrTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        // spread the periods so that only a part of the forms is due on each tick.
+        auto &timerMgr = FormTimerMgr::GetInstance();
+        for (int64_t i = 0; i < formCount; i++) {
+            FormTimer task(firstFormId + i, (i % periodKinds + 1) * Constants::MIN_PERIOD);
+            timerMgr.intervalTimerTasks_.emplace(task.formId, task);
+            timerMgr.intervalDueQueue_.emplace(timerMgr.GetIntervalDueTime(task), task.formId);
+        }
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+        auto &timerMgr = FormTimerMgr::GetInstance();
+        timerMgr.intervalTimerTasks_.clear();
+        timerMgr.intervalDueQueue_.clear();
+    }
+
+protected:
+    const int64_t firstFormId = 1000000;
+    const int64_t formCount = 5000;
+    const int64_t periodKinds = 48;
+    const int64_t startTime = 1000000000;
+    const int32_t repetitions = 3;
+    const int32_t iterations = 1000;
+};
+
+// Each iteration is one interval timer tick, the simulated clock moves on by the minimum period.
+BENCHMARK_F(FormTimerMgrTest, CollectDueIntervalTasksTestCase)(
+    benchmark::State &state)
+{
+    auto &timerMgr = FormTimerMgr::GetInstance();
+    int64_t currentTime = startTime;
+    vector<FormTimer> updateList;
+    while (state.KeepRunning()) {
+        updateList.clear();
+        timerMgr.CollectDueIntervalTasks(currentTime, updateList);
+        if (currentTime == startTime && updateList.size() != static_cast<size_t>(formCount)) {
+            state.SkipWithError("CollectDueIntervalTasksTestCase failed.");
+        }
+        currentTime += Constants::MIN_PERIOD;
+    }
+}
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
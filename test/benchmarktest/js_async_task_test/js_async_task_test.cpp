@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+
+#include "event_handler.h"
+#include "js_runtime.h"
+#include "js_runtime_utils.h"
+
+using namespace std;
+using namespace OHOS;
+using namespace OHOS::AbilityRuntime;
+
+namespace {
+// js calls the native function, which returns a promise resolved by an async task.
+class JsAsyncTaskTest : public benchmark::Fixture {
+public:
+    JsAsyncTaskTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~JsAsyncTaskTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        runner_ = AppExecFwk::EventRunner::Create("JsAsyncTaskTest");
+        handler_ = std::make_shared<AppExecFwk::EventHandler>(runner_);
+        handler_->PostSyncTask([this]() {
+            Runtime::Options options;
+            options.eventRunner = runner_;
+            options.loadAce = false;
+            runtime_ = JsRuntime::Create(options);
+        });
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+        handler_->PostSyncTask([this]() { runtime_.reset(); });
+        runner_->Stop();
+        handler_.reset();
+        runner_.reset();
+    }
+
+protected:
+    // calls the native function count times in one js task, and waits for all the promises resolved.
+    bool RoundTrip(NativeCallback func, int32_t count)
+    {
+        if (runtime_ == nullptr) {
+            return false;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            completed_ = 0;
+        }
+        handler_->PostTask([this, func, count]() {
+            auto &jsRuntime = static_cast<JsRuntime &>(*runtime_);
+            NativeEngine &engine = jsRuntime.GetNativeEngine();
+            HandleScope handleScope(jsRuntime);
+            NativeValue *function = engine.CreateFunction("roundTrip", strlen("roundTrip"), func, this);
+            for (int32_t i = 0; i < count; i++) {
+                engine.CallFunction(engine.CreateUndefined(), function, nullptr, 0);
+            }
+        });
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, timeout, [this, count]() { return completed_ >= count; });
+    }
+
+    static NativeValue *CompleteOnly(NativeEngine *engine, NativeCallbackInfo *info)
+    {
+        auto me = static_cast<JsAsyncTaskTest *>(info->functionInfo->data);
+        AsyncTask::CompleteCallback complete = [me](NativeEngine &engine, AsyncTask &task, int32_t status) {
+            task.Resolve(engine, engine.CreateUndefined());
+            me->OnComplete();
+        };
+        NativeValue *result = nullptr;
+        AsyncTask::Schedule(*engine,
+            CreateAsyncTaskWithLastParam(*engine, nullptr, nullptr, std::move(complete), &result));
+        return result;
+    }
+
+    static NativeValue *ExecuteAndComplete(NativeEngine *engine, NativeCallbackInfo *info)
+    {
+        auto me = static_cast<JsAsyncTaskTest *>(info->functionInfo->data);
+        AsyncTask::ExecuteCallback execute = []() {};
+        AsyncTask::CompleteCallback complete = [me](NativeEngine &engine, AsyncTask &task, int32_t status) {
+            task.Resolve(engine, engine.CreateUndefined());
+            me->OnComplete();
+        };
+        NativeValue *result = nullptr;
+        AsyncTask::Schedule(*engine,
+            CreateAsyncTaskWithLastParam(*engine, nullptr, std::move(execute), std::move(complete), &result));
+        return result;
+    }
+
+    void OnComplete()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        completed_++;
+        cv_.notify_one();
+    }
+
+    const int32_t repetitions = 3;
+    const int32_t iterations = 1000;
+    const int32_t batchSize = 100;
+    const std::chrono::seconds timeout = std::chrono::seconds(5);
+    std::shared_ptr<AppExecFwk::EventRunner> runner_;
+    std::shared_ptr<AppExecFwk::EventHandler> handler_;
+    std::unique_ptr<Runtime> runtime_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    int32_t completed_ = 0;
+};
+
+// one call, completed on the js thread without async work
+BENCHMARK_F(JsAsyncTaskTest, CompleteOnlyRoundTripTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        if (!RoundTrip(CompleteOnly, 1)) {
+            state.SkipWithError("CompleteOnlyRoundTripTestCase failed.");
+        }
+    }
+}
+
+// one call, executed on the thread pool before completed
+BENCHMARK_F(JsAsyncTaskTest, ExecuteAndCompleteRoundTripTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        if (!RoundTrip(ExecuteAndComplete, 1)) {
+            state.SkipWithError("ExecuteAndCompleteRoundTripTestCase failed.");
+        }
+    }
+}
+
+// many calls in one js task, completed in one wake up of the js thread
+BENCHMARK_F(JsAsyncTaskTest, CompleteOnlyBatchTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        if (!RoundTrip(CompleteOnly, batchSize)) {
+            state.SkipWithError("CompleteOnlyBatchTestCase failed.");
+        }
+    }
+}
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <fstream>
+#include <memory>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+#include "event_handler.h"
+#include "js_runtime.h"
+#include "mapped_file_cache.h"
+
+using namespace std;
+using namespace OHOS;
+using namespace OHOS::AbilityRuntime;
+
+namespace {
+// synthetic bundle of assets, written by the test.
+const std::string ASSET_PATH = "/data/test/js_module_load_test/";
+// compiled modules module0.abc, module1.abc, ..., each with a default export class, pushed with the test.
+const std::string MODULE_PATH = "/data/test/resource/js_module_load_test/";
+constexpr int32_t MODULE_COUNT = 8;
+constexpr size_t ASSET_SIZE = 256 * 1024;
+constexpr size_t ASSET_MAX_SIZE = 20 * 1024 * 1024;
+
+class JsModuleLoadTest : public benchmark::Fixture {
+public:
+    JsModuleLoadTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~JsModuleLoadTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        mkdir(ASSET_PATH.c_str(), S_IRWXU);
+        std::vector<char> content(ASSET_SIZE, 'a');
+        for (int32_t i = 0; i < MODULE_COUNT; i++) {
+            std::ofstream stream(GetAssetName(i), std::ios::binary | std::ios::trunc);
+            stream.write(content.data(), content.size());
+        }
+        MappedFileCache::GetInstance().Clear();
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+        for (int32_t i = 0; i < MODULE_COUNT; i++) {
+            unlink(GetAssetName(i).c_str());
+        }
+        rmdir(ASSET_PATH.c_str());
+        MappedFileCache::GetInstance().Clear();
+    }
+
+protected:
+    static std::string GetAssetName(int32_t index)
+    {
+        return ASSET_PATH + "module" + std::to_string(index) + ".abc";
+    }
+
+    static bool ReadAssetsByStream()
+    {
+        for (int32_t i = 0; i < MODULE_COUNT; i++) {
+            std::ifstream stream(GetAssetName(i), std::ios::binary);
+            if (!stream.is_open()) {
+                return false;
+            }
+            stream.seekg(0, std::ios::end);
+            std::vector<uint8_t> content(stream.tellg());
+            stream.seekg(0, std::ios::beg);
+            stream.read(reinterpret_cast<char *>(content.data()), content.size());
+        }
+        return true;
+    }
+
+    static bool ReadAssetsByCache()
+    {
+        for (int32_t i = 0; i < MODULE_COUNT; i++) {
+            std::vector<uint8_t> content;
+            if (!MappedFileCache::GetInstance().Read(GetAssetName(i), content, ASSET_MAX_SIZE)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // the runtime is used on this thread only, its event runner is never run.
+    static std::unique_ptr<Runtime> CreateRuntime()
+    {
+        Runtime::Options options;
+        options.codePath = MODULE_PATH;
+        options.eventRunner = AppExecFwk::EventRunner::Create(false);
+        options.loadAce = false;
+        return JsRuntime::Create(options);
+    }
+
+    static bool LoadModules(Runtime &runtime)
+    {
+        auto &jsRuntime = static_cast<JsRuntime &>(runtime);
+        for (int32_t i = 0; i < MODULE_COUNT; i++) {
+            std::string moduleName = "module" + std::to_string(i);
+            if (jsRuntime.LoadModule(moduleName, moduleName + ".abc") == nullptr) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    const int32_t repetitions = 3;
+    const int32_t iterations = 100;
+};
+
+// the assets read as before, by a stream into a buffer
+BENCHMARK_F(JsModuleLoadTest, ReadAssetsByStreamTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        if (!ReadAssetsByStream()) {
+            state.SkipWithError("ReadAssetsByStreamTestCase failed.");
+        }
+    }
+}
+
+// the assets mapped for every read
+BENCHMARK_F(JsModuleLoadTest, ReadAssetsColdTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        state.PauseTiming();
+        MappedFileCache::GetInstance().Clear();
+        state.ResumeTiming();
+        if (!ReadAssetsByCache()) {
+            state.SkipWithError("ReadAssetsColdTestCase failed.");
+        }
+    }
+}
+
+// the assets read from the kept mappings
+BENCHMARK_F(JsModuleLoadTest, ReadAssetsWarmTestCase)(
+    benchmark::State &state)
+{
+    ReadAssetsByCache();
+    while (state.KeepRunning()) {
+        if (!ReadAssetsByCache()) {
+            state.SkipWithError("ReadAssetsWarmTestCase failed.");
+        }
+    }
+}
+
+// the modules loaded by a new runtime, as on a cold start
+BENCHMARK_F(JsModuleLoadTest, LoadModuleColdTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        state.PauseTiming();
+        auto runtime = CreateRuntime();
+        state.ResumeTiming();
+        if (runtime == nullptr || !LoadModules(*runtime)) {
+            state.SkipWithError("LoadModuleColdTestCase failed, check the modules are pushed.");
+        }
+        state.PauseTiming();
+        runtime.reset();
+        state.ResumeTiming();
+    }
+}
+
+// the modules loaded again by the same runtime
+BENCHMARK_F(JsModuleLoadTest, LoadModuleWarmTestCase)(
+    benchmark::State &state)
+{
+    auto runtime = CreateRuntime();
+    if (runtime == nullptr || !LoadModules(*runtime)) {
+        state.SkipWithError("LoadModuleWarmTestCase failed, check the modules are pushed.");
+        return;
+    }
+    while (state.KeepRunning()) {
+        if (!LoadModules(*runtime)) {
+            state.SkipWithError("LoadModuleWarmTestCase failed.");
+        }
+    }
+}
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "mission_journal.h"
+
+using namespace std;
+using namespace OHOS;
+using namespace OHOS::AAFwk;
+
+namespace {
+const std::string TEST_DIR_TEMPLATE = "/data/local/tmp/mission_journal_XXXXXX";
+constexpr int32_t MISSION_COUNT = 30;
+constexpr int32_t UPDATE_COUNT = 10;
+constexpr size_t MISSION_INFO_SIZE = 1024;
+
+class MissionJournalTest : public benchmark::Fixture {
+public:
+    MissionJournalTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~MissionJournalTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        dirPath_ = TEST_DIR_TEMPLATE;
+        if (mkdtemp(&dirPath_[0]) == nullptr) {
+            dirPath_.clear();
+            return;
+        }
+        MissionJournal journal(dirPath_);
+        for (int32_t i = 0; i < MISSION_COUNT; i++) {
+            SaveFile(i, GetMissionInfo(i, 0));
+            journal.StageSave(i, GetMissionInfo(i, 0));
+        }
+        journal.Flush();
+        journal.Compact();
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+        DIR *dir = opendir(dirPath_.c_str());
+        if (dir == nullptr) {
+            return;
+        }
+        struct dirent *entry = nullptr;
+        while ((entry = readdir(dir)) != nullptr) {
+            if (entry->d_type == DT_REG) {
+                unlink((dirPath_ + "/" + entry->d_name).c_str());
+            }
+        }
+        closedir(dir);
+        rmdir(dirPath_.c_str());
+    }
+
+    static std::string GetMissionInfo(int32_t missionId, int32_t timeStamp)
+    {
+        std::string content = "{\"id\":" + std::to_string(missionId) + ",\"time\":" + std::to_string(timeStamp);
+        content.resize(MISSION_INFO_SIZE, ' ');
+        return content + "}";
+    }
+
+    // the same as FileUtil::SaveStringToFile, which rewrites the file of the mission.
+    bool SaveFile(int32_t missionId, const std::string &content)
+    {
+        std::string path = dirPath_ + "/mission_" + std::to_string(missionId) + ".json";
+        int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR);
+        if (fd < 0) {
+            return false;
+        }
+        bool written = write(fd, content.data(), content.size()) == static_cast<ssize_t>(content.size());
+        close(fd);
+        return written;
+    }
+
+    // the same as the per-file LoadAllMissionInfo, which lists the directory and reads every file.
+    size_t LoadFiles()
+    {
+        size_t count = 0;
+        DIR *dir = opendir(dirPath_.c_str());
+        if (dir == nullptr) {
+            return count;
+        }
+        struct dirent *entry = nullptr;
+        char buffer[MISSION_INFO_SIZE * 2];
+        while ((entry = readdir(dir)) != nullptr) {
+            std::string name = entry->d_name;
+            if (name.find("mission_") != 0) {
+                continue;
+            }
+            int fd = open((dirPath_ + "/" + name).c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0) {
+                continue;
+            }
+            std::string content;
+            ssize_t size = 0;
+            while ((size = read(fd, buffer, sizeof(buffer))) > 0) {
+                content.append(buffer, size);
+            }
+            close(fd);
+            count++;
+        }
+        closedir(dir);
+        return count;
+    }
+
+protected:
+    const int32_t repetitions = 3;
+    const int32_t iterations = 100;
+    std::string dirPath_;
+};
+
+// Rewrite the file of a mission on every update, as the per-file storage does on each foreground switch.
+BENCHMARK_F(MissionJournalTest, PerFileSaveTestCase)(
+    benchmark::State &state)
+{
+    int32_t timeStamp = 0;
+    while (state.KeepRunning()) {
+        for (int32_t i = 0; i < UPDATE_COUNT; i++) {
+            if (!SaveFile(i % 2, GetMissionInfo(i % 2, ++timeStamp))) {
+                state.SkipWithError("PerFileSaveTestCase failed.");
+            }
+        }
+    }
+}
+
+// Stage the same updates and write them together, as one flush window of the journal.
+BENCHMARK_F(MissionJournalTest, JournalSaveTestCase)(
+    benchmark::State &state)
+{
+    MissionJournal journal(dirPath_);
+    journal.Load();
+    int32_t timeStamp = 0;
+    while (state.KeepRunning()) {
+        for (int32_t i = 0; i < UPDATE_COUNT; i++) {
+            journal.StageSave(i % 2, GetMissionInfo(i % 2, ++timeStamp));
+        }
+        if (!journal.Flush()) {
+            state.SkipWithError("JournalSaveTestCase failed.");
+        }
+    }
+}
+
+// List the directory and read the file of every mission.
+BENCHMARK_F(MissionJournalTest, PerFileLoadTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        if (LoadFiles() != MISSION_COUNT) {
+            state.SkipWithError("PerFileLoadTestCase failed.");
+        }
+    }
+}
+
+// Read the snapshot and the journal of every mission sequentially.
+BENCHMARK_F(MissionJournalTest, JournalLoadTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        MissionJournal journal(dirPath_);
+        std::map<int32_t, std::string> missions;
+        journal.GetMissions(missions);
+        if (missions.size() != MISSION_COUNT) {
+            state.SkipWithError("JournalLoadTestCase failed.");
+        }
+    }
+}
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#define private public
+#define protected public
+#include "mission_list_manager.h"
+#undef protected
+#undef private
+
+using namespace std;
+using namespace OHOS;
+using namespace OHOS::AAFwk;
+
+namespace {
+class MissionListManagerTest : public benchmark::Fixture {
+public:
+    MissionListManagerTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~MissionListManagerTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        missionListManager_ = make_shared<MissionListManager>(userId);
+        missionListManager_->Init();
+        vector<shared_ptr<MissionList>> missionLists;
+        for (int32_t i = 0; i < missionListCount; i++) {
+            auto missionList = make_shared<MissionList>();
+            missionListManager_->currentMissionLists_.push_back(missionList);
+            missionLists.emplace_back(missionList);
+        }
+        for (int32_t i = 0; i < missionCount; i++) {
+            AbilityRequest abilityRequest;
+            abilityRequest.abilityInfo.bundleName = "com.example.mission" + to_string(i);
+            abilityRequest.abilityInfo.name = "MainAbility";
+            abilityRequest.appInfo.bundleName = abilityRequest.abilityInfo.bundleName;
+            abilityRequest.want.SetElementName(abilityRequest.abilityInfo.bundleName, abilityRequest.abilityInfo.name);
+            auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
+            auto mission = make_shared<Mission>(i + 1, abilityRecord, abilityRequest.abilityInfo.bundleName);
+            abilityRecord->SetMission(mission);
+            abilityRecord->SetEventId(i + 1);
+            missionLists[i % missionListCount]->AddMissionToTop(mission);
+            missions_.emplace_back(mission);
+        }
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+        missions_.clear();
+        missionListManager_.reset();
+    }
+
+protected:
+    shared_ptr<MissionListManager> missionListManager_ = nullptr;
+    vector<shared_ptr<Mission>> missions_;
+    const int32_t userId = 100;
+    const int32_t missionCount = 512;
+    const int32_t missionListCount = 32;
+    const int32_t repetitions = 3;
+    const int32_t iterations = 1000;
+};
+
+// Look up abilities by token among 512 missions, as every lifecycle callback from an app does.
+BENCHMARK_F(MissionListManagerTest, GetAbilityRecordByTokenTestCase)(
+    benchmark::State &state)
+{
+    size_t index = 0;
+    while (state.KeepRunning()) {
+        auto token = missions_[index]->GetAbilityRecord()->GetToken();
+        if (missionListManager_->GetAbilityRecordByToken(token) == nullptr) {
+            state.SkipWithError("GetAbilityRecordByTokenTestCase failed.");
+        }
+        index = (index + 1) % missions_.size();
+    }
+}
+
+BENCHMARK_F(MissionListManagerTest, GetMissionByIdTestCase)(
+    benchmark::State &state)
+{
+    size_t index = 0;
+    while (state.KeepRunning()) {
+        if (missionListManager_->GetMissionById(missions_[index]->GetMissionId()) == nullptr) {
+            state.SkipWithError("GetMissionByIdTestCase failed.");
+        }
+        index = (index + 1) % missions_.size();
+    }
+}
+
+BENCHMARK_F(MissionListManagerTest, GetAbilityRecordByEventIdTestCase)(
+    benchmark::State &state)
+{
+    size_t index = 0;
+    while (state.KeepRunning()) {
+        if (missionListManager_->GetAbilityRecordByEventId(missions_[index]->GetAbilityRecord()->GetEventId()) ==
+            nullptr) {
+            state.SkipWithError("GetAbilityRecordByEventIdTestCase failed.");
+        }
+        index = (index + 1) % missions_.size();
+    }
+}
+
+// Move a mission to the default list and back, as a background and foreground cycle does, then look it up.
+BENCHMARK_F(MissionListManagerTest, MoveMissionTestCase)(
+    benchmark::State &state)
+{
+    size_t index = 0;
+    while (state.KeepRunning()) {
+        auto mission = missions_[index];
+        auto missionList = mission->GetMissionList();
+        missionList->RemoveMission(mission);
+        missionListManager_->defaultStandardList_->AddMissionToTop(mission);
+        if (missionListManager_->GetAbilityRecordByToken(mission->GetAbilityRecord()->GetToken()) == nullptr) {
+            state.SkipWithError("MoveMissionTestCase failed.");
+        }
+        missionListManager_->defaultStandardList_->RemoveMission(mission);
+        missionList->AddMissionToTop(mission);
+        if (missionListManager_->GetMissionById(mission->GetMissionId()) == nullptr) {
+            state.SkipWithError("MoveMissionTestCase failed.");
+        }
+        index = (index + 1) % missions_.size();
+    }
+}
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <unistd.h>
+
+#include "mission_snapshot_codec.h"
+#include "png.h"
+
+using namespace std;
+using namespace OHOS;
+using namespace OHOS::AAFwk;
+
+namespace {
+const std::string TEST_DIR_TEMPLATE = "/data/local/tmp/mission_snapshot_XXXXXX";
+constexpr uint32_t BPP = 4;
+constexpr uint32_t WIDTH = 1080;
+constexpr uint32_t HEIGHT = 2340;
+constexpr uint32_t THUMBNAIL_FACTOR = 4;
+constexpr uint32_t BAND_HEIGHT = 120;
+constexpr uint32_t TEXT_HEIGHT = 40;
+
+class MissionSnapshotCodecTest : public benchmark::Fixture {
+public:
+    MissionSnapshotCodecTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~MissionSnapshotCodecTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        dirPath_ = TEST_DIR_TEMPLATE;
+        if (mkdtemp(&dirPath_[0]) == nullptr) {
+            dirPath_.clear();
+        }
+        pngPath_ = dirPath_ + "/mission_1.png";
+        rawPath_ = dirPath_ + "/mission_1.snapshot";
+        // bands of flat color with lines of scattered dark pixels, roughly what a screen of text looks like.
+        pixels_.resize(WIDTH * HEIGHT * BPP);
+        uint32_t seed = 1;
+        for (uint32_t y = 0; y < HEIGHT; y++) {
+            uint8_t band = static_cast<uint8_t>((y / BAND_HEIGHT) * 37);
+            bool text = (y % BAND_HEIGHT) < TEXT_HEIGHT;
+            for (uint32_t x = 0; x < WIDTH; x++) {
+                seed = seed * 1103515245 + 12345;
+                uint8_t color = (text && (seed >> 29) == 0) ? static_cast<uint8_t>(seed >> 24) : band;
+                uint8_t *pixel = &pixels_[(y * WIDTH + x) * BPP];
+                pixel[0] = color;
+                pixel[1] = color;
+                pixel[2] = color;
+                pixel[3] = 0xff;
+            }
+        }
+        MissionSnapshotCodec::Encode(pngPath_, pixels_.data(), WIDTH, HEIGHT, WIDTH * BPP, SnapshotCodec::PNG);
+        MissionSnapshotCodec::Encode(rawPath_, pixels_.data(), WIDTH, HEIGHT, WIDTH * BPP, SnapshotCodec::RAW);
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+        unlink(pngPath_.c_str());
+        unlink(rawPath_.c_str());
+        rmdir(dirPath_.c_str());
+    }
+
+    // the encoder MissionDataStorage used before, libpng at its default filters and compression level.
+    bool WriteDefaultPng(const std::string &path)
+    {
+        png_structp pngPtr = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
+        png_infop infoPtr = png_create_info_struct(pngPtr);
+        FILE *file = fopen(path.c_str(), "wb");
+        if (file == nullptr) {
+            png_destroy_write_struct(&pngPtr, &infoPtr);
+            return false;
+        }
+        if (setjmp(png_jmpbuf(pngPtr))) {
+            fclose(file);
+            png_destroy_write_struct(&pngPtr, &infoPtr);
+            return false;
+        }
+        png_init_io(pngPtr, file);
+        png_set_IHDR(pngPtr, infoPtr, WIDTH, HEIGHT, 8, PNG_COLOR_TYPE_RGBA, PNG_INTERLACE_NONE,
+            PNG_COMPRESSION_TYPE_BASE, PNG_FILTER_TYPE_BASE);
+        png_set_packing(pngPtr);
+        png_write_info(pngPtr, infoPtr);
+        for (uint32_t i = 0; i < HEIGHT; i++) {
+            png_write_row(pngPtr, pixels_.data() + i * WIDTH * BPP);
+        }
+        png_write_end(pngPtr, infoPtr);
+        png_destroy_write_struct(&pngPtr, &infoPtr);
+        fclose(file);
+        return true;
+    }
+
+protected:
+    const int32_t repetitions = 3;
+    const int32_t iterations = 10;
+    std::string dirPath_;
+    std::string pngPath_;
+    std::string rawPath_;
+    std::vector<uint8_t> pixels_;
+};
+
+// Encode a full frame the way it was done before, libpng with its default settings.
+BENCHMARK_F(MissionSnapshotCodecTest, DefaultPngEncodeTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        if (!WriteDefaultPng(pngPath_)) {
+            state.SkipWithError("DefaultPngEncodeTestCase failed.");
+        }
+    }
+}
+
+// Encode a full frame as PNG compressed for speed.
+BENCHMARK_F(MissionSnapshotCodecTest, PngEncodeTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        if (!MissionSnapshotCodec::Encode(pngPath_, pixels_.data(), WIDTH, HEIGHT, WIDTH * BPP,
+            SnapshotCodec::PNG)) {
+            state.SkipWithError("PngEncodeTestCase failed.");
+        }
+    }
+}
+
+// Write a full frame as raw pixels.
+BENCHMARK_F(MissionSnapshotCodecTest, RawEncodeTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        if (!MissionSnapshotCodec::Encode(rawPath_, pixels_.data(), WIDTH, HEIGHT, WIDTH * BPP,
+            SnapshotCodec::RAW)) {
+            state.SkipWithError("RawEncodeTestCase failed.");
+        }
+    }
+}
+
+// Shrink a full frame and write it as the raw thumbnail, the extra work of every save.
+BENCHMARK_F(MissionSnapshotCodecTest, ThumbnailEncodeTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        SnapshotImage thumbnail;
+        MissionSnapshotCodec::Downscale(pixels_.data(), WIDTH, HEIGHT, WIDTH * BPP, THUMBNAIL_FACTOR, thumbnail);
+        if (!MissionSnapshotCodec::Encode(rawPath_, thumbnail.pixels.data(), thumbnail.width, thumbnail.height,
+            thumbnail.width * BPP, SnapshotCodec::RAW)) {
+            state.SkipWithError("ThumbnailEncodeTestCase failed.");
+        }
+    }
+}
+
+// Read a full frame back from PNG.
+BENCHMARK_F(MissionSnapshotCodecTest, PngDecodeTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        SnapshotImage image;
+        if (!MissionSnapshotCodec::Decode(pngPath_, image)) {
+            state.SkipWithError("PngDecodeTestCase failed.");
+        }
+    }
+}
+
+// Read a full frame back from raw pixels.
+BENCHMARK_F(MissionSnapshotCodecTest, RawDecodeTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        SnapshotImage image;
+        if (!MissionSnapshotCodec::Decode(rawPath_, image)) {
+            state.SkipWithError("RawDecodeTestCase failed.");
+        }
+    }
+}
+
+// Read the raw thumbnail the recents list asks for.
+BENCHMARK_F(MissionSnapshotCodecTest, ThumbnailDecodeTestCase)(
+    benchmark::State &state)
+{
+    SnapshotImage thumbnail;
+    MissionSnapshotCodec::Downscale(pixels_.data(), WIDTH, HEIGHT, WIDTH * BPP, THUMBNAIL_FACTOR, thumbnail);
+    MissionSnapshotCodec::Encode(rawPath_, thumbnail.pixels.data(), thumbnail.width, thumbnail.height,
+        thumbnail.width * BPP, SnapshotCodec::RAW);
+    while (state.KeepRunning()) {
+        SnapshotImage image;
+        if (!MissionSnapshotCodec::Decode(rawPath_, image)) {
+            state.SkipWithError("ThumbnailDecodeTestCase failed.");
+        }
+    }
+}
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "pac_map.h"
+
+using namespace std;
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace {
+class PacMapTest : public benchmark::Fixture {
+public:
+    PacMapTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~PacMapTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        PacMap nested;
+        FillData(nested);
+        FillData(pacMap_);
+        pacMap_.PutPacMap("key_pacmap", nested);
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+        pacMap_.Clear();
+    }
+
+protected:
+    void FillData(PacMap &pacMap)
+    {
+        for (int32_t i = 0; i < keyCount; i++) {
+            string index = to_string(i);
+            pacMap.PutIntValue("key_int_" + index, i);
+            pacMap.PutLongValue("key_long_" + index, i);
+            pacMap.PutDoubleValue("key_double_" + index, i * 0.5);
+            pacMap.PutStringValue("key_string_" + index, "value_" + index);
+        }
+        pacMap.PutIntValueArray("key_int_array", vector<int>(arraySize, 1));
+        pacMap.PutStringValueArray("key_string_array", vector<string>(arraySize, "element"));
+    }
+
+    PacMap pacMap_;
+    const int32_t keyCount = 16;
+    const int32_t arraySize = 32;
+    const int32_t repetitions = 3;
+    const int32_t iterations = 1000;
+};
+
+// Copy through the JSON round trip previously used by the copy constructor.
+BENCHMARK_F(PacMapTest, JsonCopyTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        PacMap copy;
+        if (!copy.FromString(pacMap_.ToString())) {
+            state.SkipWithError("JsonCopyTestCase failed.");
+        }
+    }
+}
+
+BENCHMARK_F(PacMapTest, CopyTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        PacMap copy(pacMap_);
+        benchmark::DoNotOptimize(copy);
+    }
+}
+
+// Marshal through the legacy JSON encoding that Unmarshalling still accepts.
+BENCHMARK_F(PacMapTest, JsonMarshallingTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        Parcel parcel;
+        parcel.WriteString("PACMAP");
+        parcel.WriteString(pacMap_.ToString());
+        unique_ptr<PacMap> result(PacMap::Unmarshalling(parcel));
+        if (result == nullptr) {
+            state.SkipWithError("JsonMarshallingTestCase failed.");
+        }
+    }
+}
+
+BENCHMARK_F(PacMapTest, MarshallingTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        Parcel parcel;
+        pacMap_.Marshalling(parcel);
+        unique_ptr<PacMap> result(PacMap::Unmarshalling(parcel));
+        if (result == nullptr) {
+            state.SkipWithError("MarshallingTestCase failed.");
+        }
+    }
+}
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
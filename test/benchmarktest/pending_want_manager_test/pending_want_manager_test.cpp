@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#define private public
+#include "pending_want_manager.h"
+#undef private
+#include "wants_info.h"
+
+using namespace std;
+using namespace OHOS;
+using namespace OHOS::AAFwk;
+
+namespace {
+class PendingWantManagerTest : public benchmark::Fixture {
+public:
+    PendingWantManagerTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~PendingWantManagerTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        pendingManager_ = make_shared<PendingWantManager>();
+        for (int32_t i = 0; i < senderCount; i++) {
+            WantSenderInfo wantSenderInfo = MakeWantSenderInfo(i);
+            sptr<IWantSender> sender =
+                pendingManager_->GetWantSenderLocked(uid, uid, wantSenderInfo.userId, wantSenderInfo, nullptr);
+            if (sender != nullptr) {
+                codes_.emplace_back(iface_cast<PendingWantRecord>(sender->AsObject())->GetKey()->GetCode());
+            }
+        }
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+        codes_.clear();
+        pendingManager_.reset();
+    }
+
+protected:
+    WantSenderInfo MakeWantSenderInfo(int32_t index)
+    {
+        Want want;
+        want.SetElementName("", "com.example.notification" + to_string(index % bundleCount), "MainAbility");
+        want.SetParam("index", index);
+        WantsInfo wantsInfo;
+        wantsInfo.want = want;
+        WantSenderInfo wantSenderInfo;
+        wantSenderInfo.type = static_cast<int32_t>(OperationType::START_ABILITY);
+        wantSenderInfo.bundleName = want.GetElement().GetBundleName();
+        wantSenderInfo.requestCode = index;
+        wantSenderInfo.allWants.emplace_back(wantsInfo);
+        wantSenderInfo.userId = 100;
+        return wantSenderInfo;
+    }
+
+    shared_ptr<PendingWantManager> pendingManager_ = nullptr;
+    vector<int32_t> codes_;
+    const int32_t uid = 20010001;
+    const int32_t senderCount = 10000;
+    const int32_t bundleCount = 50;
+    const int32_t repetitions = 3;
+    const int32_t iterations = 1000;
+};
+
+// Look up an existing sender among 10k live senders, as GetWantSender does for a repeated request.
+BENCHMARK_F(PendingWantManagerTest, GetWantSenderTestCase)(
+    benchmark::State &state)
+{
+    int32_t index = 0;
+    while (state.KeepRunning()) {
+        WantSenderInfo wantSenderInfo = MakeWantSenderInfo(index);
+        sptr<IWantSender> sender =
+            pendingManager_->GetWantSenderLocked(uid, uid, wantSenderInfo.userId, wantSenderInfo, nullptr);
+        if (sender == nullptr) {
+            state.SkipWithError("GetWantSenderTestCase failed.");
+        }
+        index = (index + 1) % senderCount;
+    }
+}
+
+BENCHMARK_F(PendingWantManagerTest, GetPendingWantRecordByCodeTestCase)(
+    benchmark::State &state)
+{
+    size_t index = 0;
+    while (state.KeepRunning()) {
+        if (pendingManager_->GetPendingWantRecordByCode(codes_[index]) == nullptr) {
+            state.SkipWithError("GetPendingWantRecordByCodeTestCase failed.");
+        }
+        index = (index + 1) % codes_.size();
+    }
+}
+
+// Cancel a sender and create it again so the number of live senders stays constant.
+BENCHMARK_F(PendingWantManagerTest, CancelWantSenderTestCase)(
+    benchmark::State &state)
+{
+    int32_t index = 0;
+    while (state.KeepRunning()) {
+        WantSenderInfo wantSenderInfo = MakeWantSenderInfo(index);
+        sptr<IWantSender> sender =
+            pendingManager_->GetWantSenderLocked(uid, uid, wantSenderInfo.userId, wantSenderInfo, nullptr);
+        if (sender == nullptr) {
+            state.SkipWithError("CancelWantSenderTestCase failed.");
+            continue;
+        }
+        pendingManager_->CancelWantSenderLocked(*iface_cast<PendingWantRecord>(sender->AsObject()), true);
+        wantSenderInfo = MakeWantSenderInfo(index);
+        pendingManager_->GetWantSenderLocked(uid, uid, wantSenderInfo.userId, wantSenderInfo, nullptr);
+        index = (index + 1) % senderCount;
+    }
+}
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+#include "skills.h"
+#include "skills_index.h"
+#include "want.h"
+
+using namespace std;
+using namespace OHOS;
+using namespace OHOS::AAFwk;
+
+namespace {
+class SkillsTest : public benchmark::Fixture {
+public:
+    SkillsTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~SkillsTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        // spread the skills over a few actions and schemes, like the skills of the installed abilities.
+        for (int32_t i = 0; i < skillsCount; i++) {
+            string index = to_string(i);
+            Skills skills;
+            skills.AddAction("action.system." + to_string(i % actionCount));
+            skills.AddEntity("entity.system.default");
+            skills.AddScheme("scheme" + to_string(i % schemeCount));
+            skills.AddAuthority("com.example.bundle" + index);
+            skills.AddPath("/path" + index);
+            skills.AddType("text/plain");
+            skillsList_.emplace_back(skills);
+            index_.AddSkills(skills);
+        }
+        want_.SetAction("action.system.1");
+        want_.AddEntity("entity.system.default");
+        want_.SetUri("scheme1://com.example.bundle1/path1");
+        want_.SetType("text/plain");
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+        skillsList_.clear();
+        index_.Clear();
+    }
+
+protected:
+    vector<Skills> skillsList_;
+    SkillsIndex index_;
+    Want want_;
+    const int32_t skillsCount = 1000;
+    const int32_t actionCount = 10;
+    const int32_t schemeCount = 4;
+    const int32_t repetitions = 3;
+    const int32_t iterations = 1000;
+};
+
+// Match the want against every skills one by one.
+BENCHMARK_F(SkillsTest, SkillsMatchTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        size_t count = 0;
+        for (auto &skills : skillsList_) {
+            if (skills.Match(want_)) {
+                count++;
+            }
+        }
+        if (count != 1) {
+            state.SkipWithError("SkillsMatchTestCase failed.");
+        }
+    }
+}
+
+BENCHMARK_F(SkillsTest, SkillsIndexMatchTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        if (index_.Match(want_).size() != 1) {
+            state.SkipWithError("SkillsIndexMatchTestCase failed.");
+        }
+    }
+}
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "system_environment_information.h"
+
+using namespace std;
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace {
+class SystemEnvironmentInformationTest : public benchmark::Fixture {
+public:
+    SystemEnvironmentInformationTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~SystemEnvironmentInformationTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {}
+
+    void TearDown(const ::benchmark::State &state) override
+    {}
+
+protected:
+    const int32_t repetitions = 3;
+    const int32_t iterations = 1000;
+};
+
+// Read and parse /proc/meminfo and /proc/pressure/memory on every call.
+BENCHMARK_F(SystemEnvironmentInformationTest, ReadMemInfoTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        SystemEnv::KernelSystemMemoryInfo memInfo;
+        if (!SystemEnv::ReadMemInfo("/proc", memInfo)) {
+            state.SkipWithError("ReadMemInfoTestCase failed.");
+        }
+    }
+}
+
+// Take the memory information from the shared snapshot, as memory pressure polling does.
+BENCHMARK_F(SystemEnvironmentInformationTest, GetMemInfoTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        SystemEnv::KernelSystemMemoryInfo memInfo;
+        SystemEnv::GetMemInfo(memInfo);
+        if (memInfo.GetMemTotal() == 0) {
+            state.SkipWithError("GetMemInfoTestCase failed.");
+        }
+    }
+}
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include "uri.h"
+
+using namespace std;
+using namespace OHOS;
+
+namespace {
+class UriTest : public benchmark::Fixture {
+public:
+    UriTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~UriTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        for (int32_t i = 0; i < uriCount; i++) {
+            string index = to_string(i);
+            uriStrings_.emplace_back("dataability://device" + index + "/com.example.bundle" + index +
+                "/ability/table?key=" + index + "#fragment");
+            uris_.emplace(uriStrings_.back());
+        }
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+        uriStrings_.clear();
+        uris_.clear();
+    }
+
+protected:
+    vector<string> uriStrings_;
+    unordered_set<Uri> uris_;
+    const int32_t uriCount = 100;
+    const int32_t repetitions = 3;
+    const int32_t iterations = 1000;
+};
+
+// Parse the uris and read the components as strings.
+BENCHMARK_F(UriTest, UriParseTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        size_t length = 0;
+        vector<string> segments;
+        for (const auto &uriString : uriStrings_) {
+            Uri uri(uriString);
+            length += uri.GetScheme().size() + uri.GetAuthority().size() + uri.GetPath().size() +
+                uri.GetQuery().size() + uri.GetFragment().size();
+            uri.GetPathSegments(segments);
+            length += segments.size();
+        }
+        if (length == 0) {
+            state.SkipWithError("UriParseTestCase failed.");
+        }
+    }
+}
+
+// Parse the uris and read the components as views into the uri string.
+BENCHMARK_F(UriTest, UriParseViewTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        size_t length = 0;
+        vector<string_view> segments;
+        for (const auto &uriString : uriStrings_) {
+            Uri uri(uriString);
+            length += uri.GetSchemeView().size() + uri.GetAuthorityView().size() + uri.GetPathView().size() +
+                uri.GetQueryView().size() + uri.GetFragmentView().size();
+            uri.GetPathSegments(segments);
+            length += segments.size();
+        }
+        if (length == 0) {
+            state.SkipWithError("UriParseViewTestCase failed.");
+        }
+    }
+}
+
+BENCHMARK_F(UriTest, UriLookupTestCase)(
+    benchmark::State &state)
+{
+    Uri uri(uriStrings_[uriCount / 2]);
+    while (state.KeepRunning()) {
+        if (uris_.find(uri) == uris_.end()) {
+            state.SkipWithError("UriLookupTestCase failed.");
+        }
+    }
+}
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
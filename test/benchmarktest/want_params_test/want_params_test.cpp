@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <string>
+
+#include "array_wrapper.h"
+#include "int_wrapper.h"
+#include "string_ex.h"
+#include "string_wrapper.h"
+#include "want_params.h"
+#include "want_params_wrapper.h"
+
+using namespace std;
+using namespace OHOS;
+using namespace OHOS::AAFwk;
+
+namespace {
+constexpr int32_t DEPTH = 32;
+constexpr int32_t WIDTH = 64;
+constexpr int32_t KEY_COUNT = 8;
+
+class WantParamsTest : public benchmark::Fixture {
+public:
+    WantParamsTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~WantParamsTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        // a chain of params each holding the next one, like an object nested in an object from JS.
+        WantParams nested;
+        for (int32_t i = 0; i < DEPTH; i++) {
+            WantParams level = GetLeaf(i);
+            level.SetParam("child", WantParamWrapper::Box(nested));
+            nested = level;
+        }
+        deep_.SetParam("root", WantParamWrapper::Box(nested));
+
+        // an array of params side by side, like an array of objects from JS.
+        sptr<IArray> array = new Array(WIDTH, g_IID_IWantParams);
+        for (int32_t i = 0; i < WIDTH; i++) {
+            array->Set(i, WantParamWrapper::Box(GetLeaf(i)));
+        }
+        wide_.SetParam("array", array);
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {}
+
+    static WantParams GetLeaf(int32_t index)
+    {
+        WantParams leaf;
+        for (int32_t i = 0; i < KEY_COUNT; i++) {
+            leaf.SetParam("int" + to_string(i), Integer::Box(index + i));
+            leaf.SetParam("string" + to_string(i), String::Box("value" + to_string(index + i)));
+        }
+        return leaf;
+    }
+
+    static bool RoundTrip(const WantParams &params)
+    {
+        Parcel parcel;
+        if (!params.Marshalling(parcel, WANT_WIRE_VERSION_UTF8)) {
+            return false;
+        }
+        WantParams *result = WantParams::Unmarshalling(parcel);
+        bool unmarshalled = (result != nullptr);
+        delete result;
+        return unmarshalled;
+    }
+
+    // what the nested params cost before, written to the parcel as a string and parsed back.
+    static bool StringRoundTrip(const WantParams &params)
+    {
+        Parcel parcel;
+        WantParamWrapper wrapper(params);
+        if (!parcel.WriteString16(Str8ToStr16(wrapper.ToString()))) {
+            return false;
+        }
+        return WantParamWrapper::Parse(Str16ToStr8(parcel.ReadString16())) != nullptr;
+    }
+
+protected:
+    const int32_t repetitions = 3;
+    const int32_t iterations = 100;
+    WantParams deep_;
+    WantParams wide_;
+};
+
+// Marshal and unmarshal params nested DEPTH levels deep.
+BENCHMARK_F(WantParamsTest, DeepMarshallingTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        if (!RoundTrip(deep_)) {
+            state.SkipWithError("DeepMarshallingTestCase failed.");
+        }
+    }
+}
+
+// Convert params nested DEPTH levels deep to a string and parse them back.
+BENCHMARK_F(WantParamsTest, DeepStringTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        if (!StringRoundTrip(deep_)) {
+            state.SkipWithError("DeepStringTestCase failed.");
+        }
+    }
+}
+
+// Marshal and unmarshal an array of WIDTH params.
+BENCHMARK_F(WantParamsTest, WideMarshallingTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        if (!RoundTrip(wide_)) {
+            state.SkipWithError("WideMarshallingTestCase failed.");
+        }
+    }
+}
+
+// Convert an array of WIDTH params to a string and parse it back.
+BENCHMARK_F(WantParamsTest, WideStringTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        if (!StringRoundTrip(wide_)) {
+            state.SkipWithError("WideStringTestCase failed.");
+        }
+    }
+}
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
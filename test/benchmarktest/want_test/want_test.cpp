@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+
+#include "want.h"
+
+using namespace std;
+using namespace OHOS;
+using namespace OHOS::AAFwk;
+
+namespace {
+constexpr int32_t PARAM_COUNT = 16;
+constexpr int32_t FILE_COUNT = 8;
+
+class WantTest : public benchmark::Fixture {
+public:
+    WantTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~WantTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        // what starting an ability usually carries, mostly short ASCII strings.
+        want_.SetAction("ohos.want.action.viewData");
+        want_.AddEntity("entity.system.browsable");
+        want_.SetUri("https://www.example.com/path/to/the/content?query=value");
+        want_.SetElement(AppExecFwk::ElementName("", "com.example.myapplication",
+            "com.example.myapplication.MainAbility", "entry"));
+        for (int32_t i = 0; i < PARAM_COUNT; i++) {
+            want_.SetParam("ohos.aafwk.param.key" + to_string(i), "value of the parameter " + to_string(i));
+        }
+        std::vector<std::string> files;
+        for (int32_t i = 0; i < FILE_COUNT; i++) {
+            files.push_back("/data/storage/el2/base/haps/entry/files/document" + to_string(i) + ".txt");
+        }
+        want_.SetParam("ohos.aafwk.param.files", files);
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {}
+
+    bool RoundTrip(int32_t version)
+    {
+        Parcel parcel;
+        if (!want_.Marshalling(parcel, version)) {
+            return false;
+        }
+        std::unique_ptr<Want> result(Want::Unmarshalling(parcel));
+        return result != nullptr;
+    }
+
+protected:
+    const int32_t repetitions = 3;
+    const int32_t iterations = 1000;
+    Want want_;
+};
+
+// Marshal a want with its strings as UTF-16, the way every earlier version does.
+BENCHMARK_F(WantTest, Utf16MarshallingTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        Parcel parcel;
+        if (!want_.Marshalling(parcel, WANT_WIRE_VERSION_UTF16)) {
+            state.SkipWithError("Utf16MarshallingTestCase failed.");
+        }
+    }
+}
+
+// Marshal a want with its strings as UTF-8.
+BENCHMARK_F(WantTest, Utf8MarshallingTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        Parcel parcel;
+        if (!want_.Marshalling(parcel, WANT_WIRE_VERSION_UTF8)) {
+            state.SkipWithError("Utf8MarshallingTestCase failed.");
+        }
+    }
+}
+
+// Marshal and unmarshal a want with its strings as UTF-16.
+BENCHMARK_F(WantTest, Utf16RoundTripTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        if (!RoundTrip(WANT_WIRE_VERSION_UTF16)) {
+            state.SkipWithError("Utf16RoundTripTestCase failed.");
+        }
+    }
+}
+
+// Marshal and unmarshal a want with its strings as UTF-8.
+BENCHMARK_F(WantTest, Utf8RoundTripTestCase)(
+    benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        if (!RoundTrip(WANT_WIRE_VERSION_UTF8)) {
+            state.SkipWithError("Utf8RoundTripTestCase failed.");
+        }
+    }
+}
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();